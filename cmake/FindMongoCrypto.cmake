@@ -1,8 +1,19 @@
 set (MONGOC_ENABLE_CRYPTO_COMMON_CRYPTO 0)
 set (MONGOC_ENABLE_CRYPTO_LIBCRYPTO 0)
 set (MONGOC_ENABLE_CRYPTO_CNG 0)
+set (MONGOC_ENABLE_CRYPTO_BUILTIN 0)
 
-IF(APPLE)
+# -DENABLE_CRYPTO_BUILTIN=ON links no crypto library at all, for the static
+# plugin embedded in the ODBC driver.
+IF(ENABLE_CRYPTO_BUILTIN STREQUAL ON)
+    MESSAGE(STATUS "Using built-in mongoc crypto")
+    set (MONGOC_ENABLE_CRYPTO_BUILTIN 1)
+    IF(WIN32)
+        set(MONGO_CRYPTO_LIBS Bcrypt.lib)
+    ELSE()
+        set(MONGO_CRYPTO_LIBS "")
+    ENDIF()
+ELSEIF(APPLE)
     MESSAGE(STATUS "Using OpenSSL")
     set (MONGOC_ENABLE_CRYPTO_LIBCRYPTO 1)
     set(MONGO_CRYPTO_LIBS "${WITH_SSL}/lib/libcrypto.1.0.0.dylib" "${WITH_SSL}/lib/libssl.1.0.0.dylib")
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+#
+# Copyright 2018 MongoDB, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates mongoc-saslprep-tables-private.h, the tables behind the built-in
+SASLprep (RFC 4013) in mongoc-saslprep.c.
+
+usage: generate-saslprep-tables.py [output]
+
+The mapping, prohibited and unassigned tables are RFC 3454's, which Python's
+stringprep module implements, and NFKC is Unicode 3.2's. Where ICU's SASLprep
+departs from the letter of the RFC, the tables follow ICU, so a password
+prepares to the same bytes, and so to the same keys, with or without it: bidi
+is checked with the current Unicode classes rather than tables D.1 and D.2,
+and U+200B, in both B.1 and C.1.2, is mapped to a space.
+"""
+
+import os
+import stringprep
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+LICENSE = """/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""
+
+PROP_UNASSIGNED = 0x01
+PROP_MAP_TO_NOTHING = 0x02
+PROP_MAP_TO_SPACE = 0x04
+PROP_PROHIBITED = 0x08
+PROP_RAND_AL = 0x10
+PROP_L = 0x20
+
+PROHIBITED_TABLES = (
+    stringprep.in_table_c21_c22,
+    stringprep.in_table_c3,
+    stringprep.in_table_c4,
+    stringprep.in_table_c5,
+    stringprep.in_table_c6,
+    stringprep.in_table_c7,
+    stringprep.in_table_c8,
+    stringprep.in_table_c9,
+)
+
+
+def assigned_in_3_2(ch):
+    return unicodedata.ucd_3_2_0.category(ch) != "Cn"
+
+
+def properties(ch):
+    props = 0
+    if stringprep.in_table_a1(ch):
+        props |= PROP_UNASSIGNED
+    if stringprep.in_table_c12(ch):
+        props |= PROP_MAP_TO_SPACE
+    elif stringprep.in_table_b1(ch):
+        props |= PROP_MAP_TO_NOTHING
+    if any(table(ch) for table in PROHIBITED_TABLES):
+        props |= PROP_PROHIBITED
+    if assigned_in_3_2(ch):
+        bidi = unicodedata.bidirectional(ch)
+        if bidi in ("R", "AL"):
+            props |= PROP_RAND_AL
+        elif bidi == "L":
+            props |= PROP_L
+    return props
+
+
+def combining_class(ch):
+    return unicodedata.ucd_3_2_0.combining(ch)
+
+
+def decomposition(ch):
+    """the full compatibility decomposition, or None if ch is its own"""
+    cp = ord(ch)
+    if HANGUL_FIRST <= cp <= HANGUL_LAST or not assigned_in_3_2(ch):
+        return None
+    nfkd = unicodedata.ucd_3_2_0.normalize("NFKD", ch)
+    return nfkd if nfkd != ch else None
+
+
+def compositions():
+    """the pairs canonical composition joins, but for Hangul syllables"""
+    pairs = {}
+    for cp in range(MAX_CODE_POINT):
+        ch = chr(cp)
+        if HANGUL_FIRST <= cp <= HANGUL_LAST or not assigned_in_3_2(ch):
+            continue
+        mapping = unicodedata.ucd_3_2_0.decomposition(ch)
+        if not mapping or mapping.startswith("<"):
+            continue
+        parts = [chr(int(part, 16)) for part in mapping.split()]
+        # singletons and excluded compositions don't compose back
+        if (len(parts) != 2 or
+                unicodedata.ucd_3_2_0.normalize("NFC", "".join(parts)) != ch):
+            continue
+        assert all(assigned_in_3_2(part) for part in parts)
+        assert all(ord(c) < 0x10000 for c in parts + [ch])
+        pairs[(ord(parts[0]) << 16) | ord(parts[1])] = cp
+    return sorted(pairs.items())
+
+
+def utf16(s):
+    units = []
+    for ch in s:
+        cp = ord(ch)
+        if cp < 0x10000:
+            units.append(cp)
+        else:
+            cp -= 0x10000
+            units += [0xD800 | (cp >> 10), 0xDC00 | (cp & 0x3FF)]
+    return units
+
+
+def element_size(values):
+    return 1 if max(values) < 0x100 else 2
+
+
+def trie(values):
+    """splits values into deduplicated blocks of 2**shift and an index of
+    them, with the shift that needs the fewest bytes"""
+    best = None
+    for shift in range(4, 11):
+        size = 1 << shift
+        blocks, index = [], []
+        offsets = {}
+        for start in range(0, MAX_CODE_POINT, size):
+            block = tuple(values[start:start + size])
+            if block not in offsets:
+                offsets[block] = len(blocks)
+                blocks.append(block)
+            index.append(offsets[block])
+        total = (len(index) * element_size(index) +
+                 len(blocks) * size * element_size(values))
+        if best is None or total < best[0]:
+            best = (total, shift, index, [v for b in blocks for v in b])
+    return best[1:]
+
+
+def c_type(values):
+    return "uint8_t" if element_size(values) == 1 else "uint16_t"
+
+
+def c_array(out, name, values):
+    out.append("static const %s %s[%d] = {" % (c_type(values), name,
+                                                len(values)))
+    width = 4 if element_size(values) == 1 else 6
+    per_line = 72 // (width + 2)
+    for i in range(0, len(values), per_line):
+        row = values[i:i + per_line]
+        out.append("   " + " ".join(
+            ("0x%0*x," % (width - 2, v)) for v in row))
+    out.append("};")
+    out.append("")
+
+
+def c_trie(out, prefix, values):
+    shift, index, blocks = trie(values)
+    out.append("#define %s_SHIFT %d" % (prefix.upper(), shift))
+    out.append("")
+    c_array(out, prefix + "_index", index)
+    c_array(out, prefix + "_blocks", blocks)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "mongoc-saslprep-tables-private.h")
+
+    chars = [chr(cp) for cp in range(MAX_CODE_POINT)]
+    props = [properties(ch) for ch in chars]
+    ccc = [combining_class(ch) for ch in chars]
+
+    # each decomposition is its length in UTF-16 units, then the units; the
+    # trie holds its offset, and an empty first entry leaves 0 for none
+    pool = [0]
+    offsets = {}
+    decomp = []
+    for ch in chars:
+        mapping = decomposition(ch)
+        if mapping is None:
+            decomp.append(0)
+            continue
+        if mapping not in offsets:
+            offsets[mapping] = len(pool)
+            units = utf16(mapping)
+            pool += [len(units)] + units
+        decomp.append(offsets[mapping])
+    assert len(pool) < 0x10000
+
+    pairs = compositions()
+
+    out = [LICENSE,
+           "/* Generated by generate-saslprep-tables.py from Unicode 3.2, and %s"
+           % unicodedata.unidata_version,
+           " * for bidi classes; do not edit. */",
+           "",
+           "#ifndef MONGOC_SASLPREP_TABLES_PRIVATE_H",
+           "#define MONGOC_SASLPREP_TABLES_PRIVATE_H",
+           "",
+           "#define MONGOC_SASLPREP_UNASSIGNED 0x%02x" % PROP_UNASSIGNED,
+           "#define MONGOC_SASLPREP_MAP_TO_NOTHING 0x%02x" %
+           PROP_MAP_TO_NOTHING,
+           "#define MONGOC_SASLPREP_MAP_TO_SPACE 0x%02x" % PROP_MAP_TO_SPACE,
+           "#define MONGOC_SASLPREP_PROHIBITED 0x%02x" % PROP_PROHIBITED,
+           "#define MONGOC_SASLPREP_RAND_AL 0x%02x" % PROP_RAND_AL,
+           "#define MONGOC_SASLPREP_L 0x%02x" % PROP_L,
+           ""]
+    c_trie(out, "mongoc_saslprep_props", props)
+    c_trie(out, "mongoc_saslprep_ccc", ccc)
+    c_trie(out, "mongoc_saslprep_decomp", decomp)
+    c_array(out, "mongoc_saslprep_decomp_pool", pool)
+    out.append("/* the first and second code points of each pair, sorted */")
+    out.append("static const uint32_t mongoc_saslprep_compose_keys[%d] = {" %
+               len(pairs))
+    for i in range(0, len(pairs), 6):
+        out.append("   " + " ".join(
+            "0x%08x," % key for key, _ in pairs[i:i + 6]))
+    out.append("};")
+    out.append("")
+    c_array(out, "mongoc_saslprep_compose_values",
+            [value for _, value in pairs])
+    out.append("#endif /* MONGOC_SASLPREP_TABLES_PRIVATE_H */")
+
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
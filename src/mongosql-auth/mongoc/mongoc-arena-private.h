@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOC_ARENA_PRIVATE_H
+#define MONGOC_ARENA_PRIVATE_H
+
+#include "mongoc-misc.h"
+#include "mongoc-thread-private.h"
+
+/* the first chunk holds a whole single-conversation SCRAM handshake */
+#define MONGOC_ARENA_CHUNK_SIZE 32768
+
+/*
+ * A bump allocator for the buffers and strings of one handshake. Nothing is
+ * freed on its own: every chunk is wiped and released at once by
+ * _mongoc_arena_destroy, which also takes care of zeroing any secrets that
+ * were copied into it. Allocation takes a lock, since the conversations of a
+ * handshake may be stepped on several threads.
+ *
+ * Every function also accepts a NULL arena and then falls back to the heap,
+ * so that callers without a handshake (tests, standalone SCRAM use) work
+ * unchanged. _mongoc_arena_free must then be used to release memory.
+ */
+typedef struct _mongoc_arena_chunk_t {
+   struct _mongoc_arena_chunk_t *next;
+   size_t size;
+   size_t used;
+} mongoc_arena_chunk_t;
+
+typedef struct _mongoc_arena_t {
+   mongoc_mutex_t mutex;
+   mongoc_arena_chunk_t *chunks;
+} mongoc_arena_t;
+
+void
+_mongoc_arena_init (mongoc_arena_t *arena);
+
+/* wipes and frees every chunk */
+void
+_mongoc_arena_destroy (mongoc_arena_t *arena);
+
+/* returns size bytes aligned for any type, or NULL if out of memory */
+void *
+_mongoc_arena_alloc (mongoc_arena_t *arena, size_t size);
+
+/* as _mongoc_arena_alloc, but zeroed */
+void *
+_mongoc_arena_calloc (mongoc_arena_t *arena, size_t n, size_t size);
+
+char *
+_mongoc_arena_strdup (mongoc_arena_t *arena, const char *str);
+
+/* frees ptr if there is no arena, and otherwise does nothing */
+void
+_mongoc_arena_free (mongoc_arena_t *arena, void *ptr);
+
+#endif /* MONGOC_ARENA_PRIVATE_H */
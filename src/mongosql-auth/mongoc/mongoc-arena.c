@@ -0,0 +1,136 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-arena-private.h"
+
+/* allocations are aligned as malloc aligns them on 64-bit platforms */
+#define MONGOC_ARENA_ALIGN 16
+#define MONGOC_ARENA_ROUND(n) \
+   (((n) + MONGOC_ARENA_ALIGN - 1) & ~((size_t) MONGOC_ARENA_ALIGN - 1))
+
+/* chunk data starts after the header, rounded up to the alignment */
+#define MONGOC_ARENA_HEADER_SIZE MONGOC_ARENA_ROUND (sizeof (mongoc_arena_chunk_t))
+
+
+void
+_mongoc_arena_init (mongoc_arena_t *arena)
+{
+   mongoc_mutex_init (&arena->mutex);
+   arena->chunks = NULL;
+}
+
+
+void
+_mongoc_arena_destroy (mongoc_arena_t *arena)
+{
+   mongoc_arena_chunk_t *chunk;
+
+   while ((chunk = arena->chunks)) {
+      arena->chunks = chunk->next;
+      memset ((uint8_t *) chunk + MONGOC_ARENA_HEADER_SIZE, 0, chunk->used);
+      free (chunk);
+   }
+
+   mongoc_mutex_destroy (&arena->mutex);
+}
+
+
+void *
+_mongoc_arena_alloc (mongoc_arena_t *arena, size_t size)
+{
+   mongoc_arena_chunk_t *chunk;
+   size_t chunk_size;
+   void *ptr = NULL;
+
+   if (!arena) {
+      return malloc (size ? size : 1);
+   }
+
+   size = MONGOC_ARENA_ROUND (size ? size : 1);
+
+   mongoc_mutex_lock (&arena->mutex);
+
+   chunk = arena->chunks;
+   if (!chunk || chunk->size - chunk->used < size) {
+      /* each chunk is at least twice the last, so a handshake with many
+       * conversations still takes few mallocs */
+      chunk_size = chunk ? 2 * chunk->size : MONGOC_ARENA_CHUNK_SIZE;
+      if (chunk_size < size) {
+         chunk_size = size;
+      }
+
+      chunk = (mongoc_arena_chunk_t *) malloc (MONGOC_ARENA_HEADER_SIZE +
+                                               chunk_size);
+      if (!chunk) {
+         goto DONE;
+      }
+
+      chunk->next = arena->chunks;
+      chunk->size = chunk_size;
+      chunk->used = 0;
+      arena->chunks = chunk;
+   }
+
+   ptr = (uint8_t *) chunk + MONGOC_ARENA_HEADER_SIZE + chunk->used;
+   chunk->used += size;
+
+DONE:
+   mongoc_mutex_unlock (&arena->mutex);
+
+   return ptr;
+}
+
+
+void *
+_mongoc_arena_calloc (mongoc_arena_t *arena, size_t n, size_t size)
+{
+   void *ptr;
+
+   if (size && n > SIZE_MAX / size) {
+      return NULL;
+   }
+
+   ptr = _mongoc_arena_alloc (arena, n * size);
+   if (ptr) {
+      memset (ptr, 0, n * size);
+   }
+
+   return ptr;
+}
+
+
+char *
+_mongoc_arena_strdup (mongoc_arena_t *arena, const char *str)
+{
+   size_t len = strlen (str) + 1;
+   char *copy;
+
+   copy = (char *) _mongoc_arena_alloc (arena, len);
+   if (copy) {
+      memcpy (copy, str, len);
+   }
+
+   return copy;
+}
+
+
+void
+_mongoc_arena_free (mongoc_arena_t *arena, void *ptr)
+{
+   if (!arena) {
+      free (ptr);
+   }
+}
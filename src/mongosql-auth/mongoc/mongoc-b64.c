@@ -41,6 +41,7 @@
  */
 
 #include "mongoc-b64.h"
+#include "mongoc-thread-private.h"
 
 #define Assert(Cond) \
    if (!(Cond))      \
@@ -252,6 +253,7 @@ mongoc_b64_ntop (uint8_t const *src,
  */
 
 static int mongoc_b64rmap_initialized = 0;
+static mongoc_mutex_t mongoc_b64rmap_mutex = MONGOC_MUTEX_INITIALIZER;
 static uint8_t mongoc_b64rmap[256];
 
 static const uint8_t mongoc_b64rmap_special = 0xf0;
@@ -505,8 +507,11 @@ mongoc_b64_pton_len (char const *src)
 int
 mongoc_b64_pton (char const *src, uint8_t *target, size_t targsize)
 {
+   /* concurrent handshakes decode salts at once; one of them builds the map */
+   mongoc_mutex_lock (&mongoc_b64rmap_mutex);
    if (!mongoc_b64rmap_initialized)
       mongoc_b64_initialize_rmap ();
+   mongoc_mutex_unlock (&mongoc_b64rmap_mutex);
 
    if (target)
       return mongoc_b64_pton_do (src, target, targsize);
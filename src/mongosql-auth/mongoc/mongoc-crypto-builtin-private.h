@@ -0,0 +1,71 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+
+#ifdef MONGOC_ENABLE_CRYPTO_BUILTIN
+
+#ifndef MONGOC_CRYPTO_BUILTIN_PRIVATE_H
+#define MONGOC_CRYPTO_BUILTIN_PRIVATE_H
+
+#include "mongoc-crypto-private.h"
+
+/*
+ * SHA-1, SHA-256, HMAC and PBKDF2 in portable C, built on the compression
+ * functions of the PBKDF2 kernel, for builds that link no crypto library.
+ * The hash and HMAC follow crypto->algorithm.
+ */
+
+void
+mongoc_crypto_builtin_hmac (mongoc_crypto_t *crypto,
+                            const void *key,
+                            int key_len,
+                            const unsigned char *data,
+                            int data_len,
+                            unsigned char *hmac_out);
+
+my_bool
+mongoc_crypto_builtin_hash (mongoc_crypto_t *crypto,
+                            const unsigned char *input,
+                            const size_t input_len,
+                            unsigned char *hash_out);
+
+my_bool
+mongoc_crypto_builtin_hmac_set_key (mongoc_crypto_t *crypto,
+                                    const void *key,
+                                    int key_len);
+
+my_bool
+mongoc_crypto_builtin_hmac_keyed (mongoc_crypto_t *crypto,
+                                  const unsigned char *data,
+                                  int data_len,
+                                  unsigned char *hmac_out);
+
+my_bool
+mongoc_crypto_builtin_pbkdf2 (mongoc_crypto_t *crypto,
+                              const char *password,
+                              size_t password_len,
+                              const uint8_t *salt,
+                              size_t salt_len,
+                              uint32_t iterations,
+                              size_t output_len,
+                              unsigned char *output);
+
+void
+mongoc_crypto_builtin_destroy (mongoc_crypto_t *crypto);
+
+#endif /* MONGOC_CRYPTO_BUILTIN_PRIVATE_H */
+#endif /* MONGOC_ENABLE_CRYPTO_BUILTIN */
@@ -0,0 +1,312 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+
+#ifdef MONGOC_ENABLE_CRYPTO_BUILTIN
+#include "mongoc-crypto-builtin-private.h"
+#include "mongoc-pbkdf2-private.h"
+
+#include <string.h>
+
+/* a hash in progress */
+typedef struct _mongoc_crypto_builtin_sha_t {
+   mongoc_crypto_hash_algorithm_t algorithm;
+   uint32_t state[8];
+   uint8_t buf[MONGOC_PBKDF2_BLOCK_SIZE];
+   size_t buf_len;
+   uint64_t len;
+} mongoc_crypto_builtin_sha_t;
+
+/* hashes with the HMAC key's ipad and opad blocks already taken in, kept in
+ * crypto->hmac_ctx between mongoc_crypto_builtin_hmac_keyed calls */
+typedef struct _mongoc_crypto_builtin_hmac_t {
+   mongoc_crypto_builtin_sha_t inner;
+   mongoc_crypto_builtin_sha_t outer;
+} mongoc_crypto_builtin_hmac_t;
+
+
+static size_t
+_mongoc_crypto_builtin_size (mongoc_crypto_hash_algorithm_t algorithm)
+{
+   return algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1 ? 20 : 32;
+}
+
+
+static void
+_mongoc_crypto_builtin_sha_init (mongoc_crypto_builtin_sha_t *sha,
+                                 mongoc_crypto_hash_algorithm_t algorithm)
+{
+   memset (sha, 0, sizeof *sha);
+   sha->algorithm = algorithm;
+   _mongoc_pbkdf2_hash_init (algorithm, sha->state);
+}
+
+
+static void
+_mongoc_crypto_builtin_sha_update (mongoc_crypto_builtin_sha_t *sha,
+                                   const uint8_t *data,
+                                   size_t len)
+{
+   size_t n;
+
+   sha->len += len;
+
+   if (sha->buf_len) {
+      n = sizeof sha->buf - sha->buf_len;
+      n = n < len ? n : len;
+      memcpy (sha->buf + sha->buf_len, data, n);
+      sha->buf_len += n;
+      data += n;
+      len -= n;
+
+      if (sha->buf_len < sizeof sha->buf) {
+         return;
+      }
+
+      _mongoc_pbkdf2_hash_block (sha->algorithm, sha->state, sha->buf);
+      sha->buf_len = 0;
+   }
+
+   /* whole blocks straight from the input */
+   for (; len >= sizeof sha->buf; data += sizeof sha->buf, len -= sizeof sha->buf) {
+      _mongoc_pbkdf2_hash_block (sha->algorithm, sha->state, data);
+   }
+
+   memcpy (sha->buf, data, len);
+   sha->buf_len = len;
+}
+
+
+/* writes the digest and wipes sha */
+static void
+_mongoc_crypto_builtin_sha_final (mongoc_crypto_builtin_sha_t *sha,
+                                  uint8_t *out)
+{
+   const uint64_t bits = sha->len * 8;
+   size_t words = _mongoc_crypto_builtin_size (sha->algorithm) / 4;
+   size_t i;
+
+   /* 0x80, zeros, and the length in bits as the last 8 bytes of a block */
+   sha->buf[sha->buf_len++] = 0x80;
+   if (sha->buf_len > sizeof sha->buf - 8) {
+      memset (sha->buf + sha->buf_len, 0, sizeof sha->buf - sha->buf_len);
+      _mongoc_pbkdf2_hash_block (sha->algorithm, sha->state, sha->buf);
+      sha->buf_len = 0;
+   }
+
+   memset (sha->buf + sha->buf_len, 0, sizeof sha->buf - 8 - sha->buf_len);
+   for (i = 0; i < 8; i++) {
+      sha->buf[sizeof sha->buf - 1 - i] = (uint8_t) (bits >> (8 * i));
+   }
+   _mongoc_pbkdf2_hash_block (sha->algorithm, sha->state, sha->buf);
+
+   for (i = 0; i < words; i++) {
+      out[4 * i] = (uint8_t) (sha->state[i] >> 24);
+      out[4 * i + 1] = (uint8_t) (sha->state[i] >> 16);
+      out[4 * i + 2] = (uint8_t) (sha->state[i] >> 8);
+      out[4 * i + 3] = (uint8_t) sha->state[i];
+   }
+
+   memset (sha, 0, sizeof *sha);
+}
+
+
+static void
+_mongoc_crypto_builtin_hmac_init (mongoc_crypto_builtin_hmac_t *hmac,
+                                  mongoc_crypto_hash_algorithm_t algorithm,
+                                  const uint8_t *key,
+                                  size_t key_len)
+{
+   uint8_t block[MONGOC_PBKDF2_BLOCK_SIZE];
+   size_t i;
+
+   memset (block, 0, sizeof block);
+
+   /* keys longer than a block are hashed first */
+   if (key_len > sizeof block) {
+      _mongoc_crypto_builtin_sha_init (&hmac->inner, algorithm);
+      _mongoc_crypto_builtin_sha_update (&hmac->inner, key, key_len);
+      _mongoc_crypto_builtin_sha_final (&hmac->inner, block);
+   } else {
+      memcpy (block, key, key_len);
+   }
+
+   for (i = 0; i < sizeof block; i++) {
+      block[i] ^= 0x36;
+   }
+   _mongoc_crypto_builtin_sha_init (&hmac->inner, algorithm);
+   _mongoc_crypto_builtin_sha_update (&hmac->inner, block, sizeof block);
+
+   for (i = 0; i < sizeof block; i++) {
+      block[i] ^= 0x36 ^ 0x5c;
+   }
+   _mongoc_crypto_builtin_sha_init (&hmac->outer, algorithm);
+   _mongoc_crypto_builtin_sha_update (&hmac->outer, block, sizeof block);
+
+   memset (block, 0, sizeof block);
+}
+
+
+/* HMAC of data from a keyed hmac, which is left as it was */
+static void
+_mongoc_crypto_builtin_hmac_run (const mongoc_crypto_builtin_hmac_t *hmac,
+                                 const uint8_t *data,
+                                 size_t data_len,
+                                 uint8_t *out)
+{
+   mongoc_crypto_builtin_sha_t sha;
+   uint8_t digest[32];
+
+   sha = hmac->inner;
+   _mongoc_crypto_builtin_sha_update (&sha, data, data_len);
+   _mongoc_crypto_builtin_sha_final (&sha, digest);
+
+   sha = hmac->outer;
+   _mongoc_crypto_builtin_sha_update (
+      &sha, digest, _mongoc_crypto_builtin_size (sha.algorithm));
+   _mongoc_crypto_builtin_sha_final (&sha, out);
+
+   memset (digest, 0, sizeof digest);
+}
+
+
+void
+mongoc_crypto_builtin_hmac (mongoc_crypto_t *crypto,
+                            const void *key,
+                            int key_len,
+                            const unsigned char *data,
+                            int data_len,
+                            unsigned char *hmac_out)
+{
+   mongoc_crypto_builtin_hmac_t hmac;
+
+   _mongoc_crypto_builtin_hmac_init (
+      &hmac, crypto->algorithm, (const uint8_t *) key, (size_t) key_len);
+   _mongoc_crypto_builtin_hmac_run (&hmac, data, (size_t) data_len, hmac_out);
+
+   memset (&hmac, 0, sizeof hmac);
+}
+
+my_bool
+mongoc_crypto_builtin_hash (mongoc_crypto_t *crypto,
+                            const unsigned char *input,
+                            const size_t input_len,
+                            unsigned char *hash_out)
+{
+   mongoc_crypto_builtin_sha_t sha;
+
+   _mongoc_crypto_builtin_sha_init (&sha, crypto->algorithm);
+   _mongoc_crypto_builtin_sha_update (&sha, input, input_len);
+   _mongoc_crypto_builtin_sha_final (&sha, hash_out);
+
+   return TRUE;
+}
+
+my_bool
+mongoc_crypto_builtin_hmac_set_key (mongoc_crypto_t *crypto,
+                                    const void *key,
+                                    int key_len)
+{
+   if (!crypto->hmac_ctx) {
+      crypto->hmac_ctx = malloc (sizeof (mongoc_crypto_builtin_hmac_t));
+      if (!crypto->hmac_ctx) {
+         return FALSE;
+      }
+   }
+
+   _mongoc_crypto_builtin_hmac_init (
+      (mongoc_crypto_builtin_hmac_t *) crypto->hmac_ctx,
+      crypto->algorithm,
+      (const uint8_t *) key,
+      (size_t) key_len);
+
+   return TRUE;
+}
+
+my_bool
+mongoc_crypto_builtin_hmac_keyed (mongoc_crypto_t *crypto,
+                                  const unsigned char *data,
+                                  int data_len,
+                                  unsigned char *hmac_out)
+{
+   if (!crypto->hmac_ctx) {
+      return FALSE;
+   }
+
+   _mongoc_crypto_builtin_hmac_run (
+      (const mongoc_crypto_builtin_hmac_t *) crypto->hmac_ctx,
+      data,
+      (size_t) data_len,
+      hmac_out);
+   return TRUE;
+}
+
+my_bool
+mongoc_crypto_builtin_pbkdf2 (mongoc_crypto_t *crypto,
+                              const char *password,
+                              size_t password_len,
+                              const uint8_t *salt,
+                              size_t salt_len,
+                              uint32_t iterations,
+                              size_t output_len,
+                              unsigned char *output)
+{
+   mongoc_crypto_builtin_sha_t sha;
+   mongoc_pbkdf2_t pbkdf2;
+   uint8_t hashed_key[32];
+   const uint8_t *key = (const uint8_t *) password;
+   size_t key_len = password_len;
+   my_bool ret;
+
+   /* the kernel derives one block; anything else takes the generic loop */
+   if (iterations < 1 ||
+       output_len != _mongoc_crypto_builtin_size (crypto->algorithm)) {
+      return FALSE;
+   }
+
+   if (key_len > MONGOC_PBKDF2_BLOCK_SIZE) {
+      _mongoc_crypto_builtin_sha_init (&sha, crypto->algorithm);
+      _mongoc_crypto_builtin_sha_update (&sha, key, key_len);
+      _mongoc_crypto_builtin_sha_final (&sha, hashed_key);
+      key = hashed_key;
+      key_len = output_len;
+   }
+
+   ret = _mongoc_pbkdf2_init (
+      &pbkdf2, crypto->algorithm, key, key_len, salt, salt_len);
+   memset (hashed_key, 0, sizeof hashed_key);
+   if (!ret) {
+      return FALSE;
+   }
+
+   _mongoc_pbkdf2_iterate (&pbkdf2, iterations - 1);
+   _mongoc_pbkdf2_finish (&pbkdf2, output);
+
+   return TRUE;
+}
+
+void
+mongoc_crypto_builtin_destroy (mongoc_crypto_t *crypto)
+{
+   if (crypto->hmac_ctx) {
+      memset (crypto->hmac_ctx, 0, sizeof (mongoc_crypto_builtin_hmac_t));
+      free (crypto->hmac_ctx);
+      crypto->hmac_ctx = NULL;
+   }
+}
+
+#endif
@@ -56,5 +56,29 @@ mongoc_crypto_cng_sha256 (mongoc_crypto_t *crypto,
                           const size_t input_len,
                           unsigned char *hash_out);
 
+my_bool
+mongoc_crypto_cng_hmac_set_key (mongoc_crypto_t *crypto,
+                                const void *key,
+                                int key_len);
+
+my_bool
+mongoc_crypto_cng_hmac_keyed (mongoc_crypto_t *crypto,
+                              const unsigned char *data,
+                              int data_len,
+                              unsigned char *hmac_out);
+
+my_bool
+mongoc_crypto_cng_pbkdf2 (mongoc_crypto_t *crypto,
+                          const char *password,
+                          size_t password_len,
+                          const uint8_t *salt,
+                          size_t salt_len,
+                          uint32_t iterations,
+                          size_t output_len,
+                          unsigned char *output);
+
+void
+mongoc_crypto_cng_destroy (mongoc_crypto_t *crypto);
+
 #endif /* MONGOC_CRYPTO_CNG_PRIVATE_H */
 #endif /* MONGOC_ENABLE_CRYPTO_CNG */
@@ -31,6 +31,16 @@ static BCRYPT_ALG_HANDLE _sha1_hmac_algo;
 static BCRYPT_ALG_HANDLE _sha256_hash_algo;
 static BCRYPT_ALG_HANDLE _sha256_hmac_algo;
 
+/* a keyed HMAC object, duplicated for every mongoc_crypto_cng_hmac_keyed
+ * call so the key is only processed once in mongoc_crypto_cng_hmac_set_key */
+typedef struct {
+   BCRYPT_HASH_HANDLE keyed;
+   char *keyed_object;
+   char *scratch_object;
+   ULONG object_length;
+   ULONG mac_length;
+} mongoc_crypto_cng_hmac_ctx_t;
+
 
 void
 mongoc_crypto_cng_init (void)
@@ -237,4 +247,190 @@ mongoc_crypto_cng_sha256 (mongoc_crypto_t *crypto,
       _sha256_hash_algo, NULL, 0, input, input_len, hash_out);
    return res;
 }
+
+static void
+_mongoc_crypto_cng_hmac_ctx_clear (mongoc_crypto_cng_hmac_ctx_t *ctx)
+{
+   if (ctx->keyed) {
+      (void) BCryptDestroyHash (ctx->keyed);
+      ctx->keyed = 0;
+   }
+
+   if (ctx->keyed_object) {
+      SecureZeroMemory (ctx->keyed_object, ctx->object_length);
+      free (ctx->keyed_object);
+      ctx->keyed_object = NULL;
+   }
+
+   if (ctx->scratch_object) {
+      SecureZeroMemory (ctx->scratch_object, ctx->object_length);
+      free (ctx->scratch_object);
+      ctx->scratch_object = NULL;
+   }
+}
+
+my_bool
+mongoc_crypto_cng_hmac_set_key (mongoc_crypto_t *crypto,
+                                const void *key,
+                                int key_len)
+{
+   mongoc_crypto_cng_hmac_ctx_t *ctx;
+   BCRYPT_ALG_HANDLE algorithm;
+   NTSTATUS status = STATUS_UNSUCCESSFUL;
+   ULONG noop = 0;
+
+   if (crypto->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      algorithm = _sha256_hmac_algo;
+   } else {
+      algorithm = _sha1_hmac_algo;
+   }
+
+   if (!algorithm) {
+      return FALSE;
+   }
+
+   if (!crypto->hmac_ctx) {
+      crypto->hmac_ctx = calloc (1, sizeof (mongoc_crypto_cng_hmac_ctx_t));
+      if (!crypto->hmac_ctx) {
+         return FALSE;
+      }
+   }
+
+   ctx = (mongoc_crypto_cng_hmac_ctx_t *) crypto->hmac_ctx;
+   _mongoc_crypto_cng_hmac_ctx_clear (ctx);
+
+   status = BCryptGetProperty (algorithm,
+                               BCRYPT_OBJECT_LENGTH,
+                               (char *) &ctx->object_length,
+                               sizeof ctx->object_length,
+                               &noop,
+                               0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptGetProperty(): OBJECT_LENGTH %x", status);
+      return FALSE;
+   }
+
+   status = BCryptGetProperty (algorithm,
+                               BCRYPT_HASH_LENGTH,
+                               (char *) &ctx->mac_length,
+                               sizeof ctx->mac_length,
+                               &noop,
+                               0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptGetProperty(): HASH_LENGTH %x", status);
+      return FALSE;
+   }
+
+   ctx->keyed_object = malloc (ctx->object_length);
+   ctx->scratch_object = malloc (ctx->object_length);
+   if (!ctx->keyed_object || !ctx->scratch_object) {
+      _mongoc_crypto_cng_hmac_ctx_clear (ctx);
+      return FALSE;
+   }
+
+   status = BCryptCreateHash (algorithm,
+                              &ctx->keyed,
+                              ctx->keyed_object,
+                              ctx->object_length,
+                              (PUCHAR) key,
+                              (ULONG) key_len,
+                              0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptCreateHash(): %x", status);
+      _mongoc_crypto_cng_hmac_ctx_clear (ctx);
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+my_bool
+mongoc_crypto_cng_hmac_keyed (mongoc_crypto_t *crypto,
+                              const unsigned char *data,
+                              int data_len,
+                              unsigned char *hmac_out)
+{
+   mongoc_crypto_cng_hmac_ctx_t *ctx =
+      (mongoc_crypto_cng_hmac_ctx_t *) crypto->hmac_ctx;
+   BCRYPT_HASH_HANDLE hash = 0;
+   NTSTATUS status = STATUS_UNSUCCESSFUL;
+
+   if (!ctx || !ctx->keyed) {
+      return FALSE;
+   }
+
+   /* copies the keyed midstate into the scratch object */
+   status = BCryptDuplicateHash (
+      ctx->keyed, &hash, ctx->scratch_object, ctx->object_length, 0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptDuplicateHash(): %x", status);
+      return FALSE;
+   }
+
+   status = BCryptHashData (hash, (PUCHAR) data, (ULONG) data_len, 0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptHashData(): %x", status);
+      goto cleanup;
+   }
+
+   status = BCryptFinishHash (hash, hmac_out, ctx->mac_length, 0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptFinishHash(): %x", status);
+   }
+
+cleanup:
+   (void) BCryptDestroyHash (hash);
+   return NT_SUCCESS (status);
+}
+
+my_bool
+mongoc_crypto_cng_pbkdf2 (mongoc_crypto_t *crypto,
+                          const char *password,
+                          size_t password_len,
+                          const uint8_t *salt,
+                          size_t salt_len,
+                          uint32_t iterations,
+                          size_t output_len,
+                          unsigned char *output)
+{
+   BCRYPT_ALG_HANDLE algorithm;
+   NTSTATUS status = STATUS_UNSUCCESSFUL;
+
+   if (crypto->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      algorithm = _sha256_hmac_algo;
+   } else {
+      algorithm = _sha1_hmac_algo;
+   }
+
+   if (!algorithm) {
+      return FALSE;
+   }
+
+   status = BCryptDeriveKeyPBKDF2 (algorithm,
+                                   (PUCHAR) password,
+                                   (ULONG) password_len,
+                                   (PUCHAR) salt,
+                                   (ULONG) salt_len,
+                                   (ULONGLONG) iterations,
+                                   output,
+                                   (ULONG) output_len,
+                                   0);
+   if (!NT_SUCCESS (status)) {
+      MONGOC_LOG ("BCryptDeriveKeyPBKDF2(): %x", status);
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+void
+mongoc_crypto_cng_destroy (mongoc_crypto_t *crypto)
+{
+   if (crypto->hmac_ctx) {
+      _mongoc_crypto_cng_hmac_ctx_clear (
+         (mongoc_crypto_cng_hmac_ctx_t *) crypto->hmac_ctx);
+      free (crypto->hmac_ctx);
+      crypto->hmac_ctx = NULL;
+   }
+}
 #endif
@@ -21,6 +21,7 @@
 #include "mongoc-crypto-common-crypto-private.h"
 #include <CommonCrypto/CommonHMAC.h>
 #include <CommonCrypto/CommonDigest.h>
+#include <CommonCrypto/CommonKeyDerivation.h>
 
 
 void
@@ -71,5 +72,85 @@ mongoc_crypto_common_crypto_sha256 (mongoc_crypto_t *crypto,
    return FALSE;
 }
 
+my_bool
+mongoc_crypto_common_crypto_hmac_set_key (mongoc_crypto_t *crypto,
+                                          const void *key,
+                                          int key_len)
+{
+   CCHmacAlgorithm algorithm;
+
+   if (crypto->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      algorithm = kCCHmacAlgSHA256;
+   } else {
+      algorithm = kCCHmacAlgSHA1;
+   }
+
+   if (!crypto->hmac_ctx) {
+      crypto->hmac_ctx = malloc (sizeof (CCHmacContext));
+      if (!crypto->hmac_ctx) {
+         return FALSE;
+      }
+   }
+
+   /* the initialized context holds the keyed midstate and is copied, never
+    * updated, by mongoc_crypto_common_crypto_hmac_keyed */
+   CCHmacInit ((CCHmacContext *) crypto->hmac_ctx, algorithm, key, (size_t) key_len);
+   return TRUE;
+}
+
+my_bool
+mongoc_crypto_common_crypto_hmac_keyed (mongoc_crypto_t *crypto,
+                                        const unsigned char *data,
+                                        int data_len,
+                                        unsigned char *hmac_out)
+{
+   CCHmacContext ctx;
+
+   memcpy (&ctx, crypto->hmac_ctx, sizeof ctx);
+   CCHmacUpdate (&ctx, data, (size_t) data_len);
+   CCHmacFinal (&ctx, hmac_out);
+   memset (&ctx, 0, sizeof ctx);
+   return TRUE;
+}
+
+my_bool
+mongoc_crypto_common_crypto_pbkdf2 (mongoc_crypto_t *crypto,
+                                    const char *password,
+                                    size_t password_len,
+                                    const uint8_t *salt,
+                                    size_t salt_len,
+                                    uint32_t iterations,
+                                    size_t output_len,
+                                    unsigned char *output)
+{
+   CCPseudoRandomAlgorithm prf;
+
+   if (crypto->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      prf = kCCPRFHmacAlgSHA256;
+   } else {
+      prf = kCCPRFHmacAlgSHA1;
+   }
+
+   return kCCSuccess == CCKeyDerivationPBKDF (kCCPBKDF2,
+                                              password,
+                                              password_len,
+                                              salt,
+                                              salt_len,
+                                              prf,
+                                              (unsigned) iterations,
+                                              output,
+                                              output_len);
+}
+
+void
+mongoc_crypto_common_crypto_destroy (mongoc_crypto_t *crypto)
+{
+   if (crypto->hmac_ctx) {
+      memset (crypto->hmac_ctx, 0, sizeof (CCHmacContext));
+      free (crypto->hmac_ctx);
+      crypto->hmac_ctx = NULL;
+   }
+}
+
 
 #endif
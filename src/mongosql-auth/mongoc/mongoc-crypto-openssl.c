@@ -19,23 +19,129 @@
 #ifdef MONGOC_ENABLE_CRYPTO_LIBCRYPTO
 #include "mongoc-crypto-openssl-private.h"
 #include "mongoc-crypto-private.h"
+#include "mongoc-thread-private.h"
 
 #include <openssl/sha.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+#include <openssl/core_names.h>
+#include <openssl/kdf.h>
+#define MONGOC_CRYPTO_OPENSSL_3 1
+#else
+#define MONGOC_CRYPTO_OPENSSL_3 0
+#endif
 
-void
-mongoc_crypto_openssl_hmac_sha1 (mongoc_crypto_t *crypto,
-                                 const void *key,
-                                 int key_len,
-                                 const unsigned char *data,
-                                 int data_len,
-                                 unsigned char *hmac_out)
+/* the most contexts of each kind a thread keeps for reuse */
+#define MONGOC_CRYPTO_OPENSSL_POOL_SIZE 8
+
+/* HMAC contexts are pooled by hash, as OpenSSL 3 binds them to theirs */
+typedef enum {
+   MONGOC_CRYPTO_OPENSSL_DIGEST,
+   MONGOC_CRYPTO_OPENSSL_HMAC_SHA_1,
+   MONGOC_CRYPTO_OPENSSL_HMAC_SHA_256,
+   MONGOC_CRYPTO_OPENSSL_NUM_KINDS
+} mongoc_crypto_openssl_kind_t;
+
+#define MONGOC_CRYPTO_OPENSSL_HMAC(_crypto)                          \
+   ((_crypto)->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256           \
+       ? MONGOC_CRYPTO_OPENSSL_HMAC_SHA_256                           \
+       : MONGOC_CRYPTO_OPENSSL_HMAC_SHA_1)
+
+/* Contexts given back by the mongoc_crypto_t a thread destroyed, wiped,
+ * for the next one it initializes. A handshake's many short-lived hashes
+ * and HMACs then allocate nothing once a thread has seen a handshake. */
+typedef struct _mongoc_crypto_openssl_pool_t {
+   void *ctx[MONGOC_CRYPTO_OPENSSL_NUM_KINDS][MONGOC_CRYPTO_OPENSSL_POOL_SIZE];
+   int num[MONGOC_CRYPTO_OPENSSL_NUM_KINDS];
+   /* every thread's pool is listed, so cleanup can free them all */
+   struct _mongoc_crypto_openssl_pool_t *next;
+} mongoc_crypto_openssl_pool_t;
+
+/* guards the pool key, the list of pools and, with OpenSSL 3, the fetched
+ * algorithms. The key is created once, and the flag saying it was lets
+ * every later context taken or given skip the mutex. */
+static mongoc_mutex_t mongoc_crypto_openssl_mutex = MONGOC_MUTEX_INITIALIZER;
+static mongoc_thread_key_t mongoc_crypto_openssl_pool_key;
+static mongoc_atomic_int_t mongoc_crypto_openssl_pool_key_created = 0;
+static mongoc_crypto_openssl_pool_t *mongoc_crypto_openssl_pools;
+
+#if MONGOC_CRYPTO_OPENSSL_3
+/* OpenSSL 3 looks up the provider of EVP_sha1 (), HMAC () and the like on
+ * every call, under locks that many threads authenticating at once contend
+ * for. Instead, each algorithm is fetched once per process, and contexts
+ * are made by duplicating a template that already has its parameters set.
+ * They are indexed by mongoc_crypto_hash_algorithm_t, and are written once
+ * under the mutex; the flag saying they were publishes them to threads that
+ * then read them, and duplicate the templates, without it. */
+static mongoc_atomic_int_t mongoc_crypto_openssl_fetched = 0;
+static EVP_MD *mongoc_crypto_openssl_md[2];
+static EVP_MAC_CTX *mongoc_crypto_openssl_hmac_template[2];
+static EVP_KDF_CTX *mongoc_crypto_openssl_pbkdf2_template[2];
+
+/* fetches the algorithms unless they were */
+static void
+_mongoc_crypto_openssl_fetch (void)
 {
-   /* U1 = HMAC(input, salt + 0001) */
-   HMAC (EVP_sha1 (), key, key_len, data, data_len, hmac_out, NULL);
+   static const char *const digests[2] = {OSSL_DIGEST_NAME_SHA1,
+                                          OSSL_DIGEST_NAME_SHA2_256};
+   OSSL_PARAM params[3];
+   EVP_MAC *mac;
+   EVP_KDF *kdf;
+   int pkcs5 = 1;
+   int i;
+
+   if (mongoc_atomic_load (&mongoc_crypto_openssl_fetched)) {
+      return;
+   }
+
+   mongoc_mutex_lock (&mongoc_crypto_openssl_mutex);
+   if (mongoc_crypto_openssl_fetched) {
+      mongoc_mutex_unlock (&mongoc_crypto_openssl_mutex);
+      return;
+   }
+
+   mac = EVP_MAC_fetch (NULL, OSSL_MAC_NAME_HMAC, NULL);
+   kdf = EVP_KDF_fetch (NULL, OSSL_KDF_NAME_PBKDF2, NULL);
+
+   for (i = 0; i < 2; i++) {
+      mongoc_crypto_openssl_md[i] = EVP_MD_fetch (NULL, digests[i], NULL);
+
+      params[0] = OSSL_PARAM_construct_utf8_string (
+         OSSL_MAC_PARAM_DIGEST, (char *) digests[i], 0);
+      params[1] = OSSL_PARAM_construct_end ();
+      mongoc_crypto_openssl_hmac_template[i] = mac ? EVP_MAC_CTX_new (mac) : NULL;
+      if (mongoc_crypto_openssl_hmac_template[i] &&
+          !EVP_MAC_CTX_set_params (mongoc_crypto_openssl_hmac_template[i],
+                                   params)) {
+         EVP_MAC_CTX_free (mongoc_crypto_openssl_hmac_template[i]);
+         mongoc_crypto_openssl_hmac_template[i] = NULL;
+      }
+
+      /* like PKCS5_PBKDF2_HMAC, without SP 800-132's lower bounds */
+      params[0] = OSSL_PARAM_construct_utf8_string (
+         OSSL_KDF_PARAM_DIGEST, (char *) digests[i], 0);
+      params[1] = OSSL_PARAM_construct_int (OSSL_KDF_PARAM_PKCS5, &pkcs5);
+      params[2] = OSSL_PARAM_construct_end ();
+      mongoc_crypto_openssl_pbkdf2_template[i] =
+         kdf ? EVP_KDF_CTX_new (kdf) : NULL;
+      if (mongoc_crypto_openssl_pbkdf2_template[i] &&
+          !EVP_KDF_CTX_set_params (mongoc_crypto_openssl_pbkdf2_template[i],
+                                   params)) {
+         EVP_KDF_CTX_free (mongoc_crypto_openssl_pbkdf2_template[i]);
+         mongoc_crypto_openssl_pbkdf2_template[i] = NULL;
+      }
+   }
+
+   /* the contexts hold references of their own */
+   EVP_MAC_free (mac);
+   EVP_KDF_free (kdf);
+
+   mongoc_atomic_store (&mongoc_crypto_openssl_fetched, 1);
+   mongoc_mutex_unlock (&mongoc_crypto_openssl_mutex);
 }
+#endif
 
 #if OPENSSL_VERSION_NUMBER < 0x10100000L || defined(LIBRESSL_VERSION_NUMBER)
 EVP_MD_CTX *
@@ -50,31 +156,338 @@ EVP_MD_CTX_free (EVP_MD_CTX *ctx)
    EVP_MD_CTX_cleanup (ctx);
    free (ctx);
 }
+
+static int
+EVP_MD_CTX_reset (EVP_MD_CTX *ctx)
+{
+   return EVP_MD_CTX_cleanup (ctx);
+}
+
+static HMAC_CTX *
+HMAC_CTX_new (void)
+{
+   HMAC_CTX *ctx = calloc (1, sizeof (HMAC_CTX));
+
+   if (ctx) {
+      HMAC_CTX_init (ctx);
+   }
+   return ctx;
+}
+
+static void
+HMAC_CTX_free (HMAC_CTX *ctx)
+{
+   HMAC_CTX_cleanup (ctx);
+   free (ctx);
+}
+
+static int
+HMAC_CTX_reset (HMAC_CTX *ctx)
+{
+   HMAC_CTX_cleanup (ctx);
+   HMAC_CTX_init (ctx);
+   return 1;
+}
 #endif
 
-my_bool
-mongoc_crypto_openssl_sha1 (mongoc_crypto_t *crypto,
-                            const unsigned char *input,
-                            const size_t input_len,
-                            unsigned char *hmac_out)
+
+/* the digest of crypto's algorithm */
+static const EVP_MD *
+_mongoc_crypto_openssl_md (mongoc_crypto_t *crypto)
+{
+#if MONGOC_CRYPTO_OPENSSL_3
+   if (mongoc_crypto_openssl_md[crypto->algorithm]) {
+      return mongoc_crypto_openssl_md[crypto->algorithm];
+   }
+#endif
+
+   if (crypto->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      return EVP_sha256 ();
+   }
+
+   return EVP_sha1 ();
+}
+
+
+static void *
+_mongoc_crypto_openssl_ctx_new (mongoc_crypto_openssl_kind_t kind)
+{
+   if (kind == MONGOC_CRYPTO_OPENSSL_DIGEST) {
+      return EVP_MD_CTX_new ();
+   }
+
+#if MONGOC_CRYPTO_OPENSSL_3
+   if (!mongoc_crypto_openssl_hmac_template[kind -
+                                            MONGOC_CRYPTO_OPENSSL_HMAC_SHA_1]) {
+      return NULL;
+   }
+
+   return EVP_MAC_CTX_dup (
+      mongoc_crypto_openssl_hmac_template[kind -
+                                          MONGOC_CRYPTO_OPENSSL_HMAC_SHA_1]);
+#else
+   return HMAC_CTX_new ();
+#endif
+}
+
+
+static void
+_mongoc_crypto_openssl_ctx_free (mongoc_crypto_openssl_kind_t kind, void *ctx)
+{
+   if (kind == MONGOC_CRYPTO_OPENSSL_DIGEST) {
+      EVP_MD_CTX_free ((EVP_MD_CTX *) ctx);
+   } else {
+#if MONGOC_CRYPTO_OPENSSL_3
+      EVP_MAC_CTX_free ((EVP_MAC_CTX *) ctx);
+#else
+      HMAC_CTX_free ((HMAC_CTX *) ctx);
+#endif
+   }
+}
+
+
+/* wipes what ctx holds of its last input or key */
+static my_bool
+_mongoc_crypto_openssl_ctx_wipe (mongoc_crypto_openssl_kind_t kind, void *ctx)
+{
+#if MONGOC_CRYPTO_OPENSSL_3
+   static const unsigned char zero_key[SHA256_DIGEST_LENGTH] = {0};
+#endif
+
+   if (kind == MONGOC_CRYPTO_OPENSSL_DIGEST) {
+      return 1 == EVP_MD_CTX_reset ((EVP_MD_CTX *) ctx);
+   }
+
+#if MONGOC_CRYPTO_OPENSSL_3
+   /* an EVP_MAC_CTX can't be reset, but keying it anew overwrites the
+    * midstates of the last key */
+   return 1 == EVP_MAC_init ((EVP_MAC_CTX *) ctx, zero_key, sizeof zero_key, NULL);
+#else
+   return 1 == HMAC_CTX_reset ((HMAC_CTX *) ctx);
+#endif
+}
+
+
+static void
+_mongoc_crypto_openssl_pool_free (mongoc_crypto_openssl_pool_t *pool)
+{
+   int kind;
+
+   for (kind = 0; kind < MONGOC_CRYPTO_OPENSSL_NUM_KINDS; kind++) {
+      while (pool->num[kind]) {
+         _mongoc_crypto_openssl_ctx_free (
+            (mongoc_crypto_openssl_kind_t) kind,
+            pool->ctx[kind][--pool->num[kind]]);
+      }
+   }
+
+   free (pool);
+}
+
+
+/* frees an exiting thread's pool, unless cleanup already has */
+MONGOC_THREAD_KEY_DTOR (_mongoc_crypto_openssl_pool_dtor, arg)
+{
+   mongoc_crypto_openssl_pool_t **link;
+
+   mongoc_mutex_lock (&mongoc_crypto_openssl_mutex);
+   for (link = &mongoc_crypto_openssl_pools; *link; link = &(*link)->next) {
+      if (*link == arg) {
+         *link = (*link)->next;
+         _mongoc_crypto_openssl_pool_free ((mongoc_crypto_openssl_pool_t *) arg);
+         break;
+      }
+   }
+   mongoc_mutex_unlock (&mongoc_crypto_openssl_mutex);
+}
+
+
+/* creates the pool key unless it was, returning FALSE if it can't be */
+static my_bool
+_mongoc_crypto_openssl_create_pool_key (void)
+{
+   my_bool created;
+
+   if (mongoc_atomic_load (&mongoc_crypto_openssl_pool_key_created)) {
+      return TRUE;
+   }
+
+   mongoc_mutex_lock (&mongoc_crypto_openssl_mutex);
+   created = mongoc_crypto_openssl_pool_key_created != 0;
+   if (!created &&
+       0 == mongoc_thread_key_create (&mongoc_crypto_openssl_pool_key,
+                                      _mongoc_crypto_openssl_pool_dtor)) {
+      mongoc_atomic_store (&mongoc_crypto_openssl_pool_key_created, 1);
+      created = TRUE;
+   }
+   mongoc_mutex_unlock (&mongoc_crypto_openssl_mutex);
+
+   return created;
+}
+
+
+/* the calling thread's pool, or NULL if it can't have one */
+static mongoc_crypto_openssl_pool_t *
+_mongoc_crypto_openssl_pool (void)
 {
-   EVP_MD_CTX *digest_ctxp = EVP_MD_CTX_new ();
-   my_bool rval = FALSE;
+   mongoc_crypto_openssl_pool_t *pool;
 
-   if (1 != EVP_DigestInit_ex (digest_ctxp, EVP_sha1 (), NULL)) {
-      goto cleanup;
+#if MONGOC_CRYPTO_OPENSSL_3
+   _mongoc_crypto_openssl_fetch ();
+#endif
+
+   if (!_mongoc_crypto_openssl_create_pool_key ()) {
+      return NULL;
    }
 
-   if (1 != EVP_DigestUpdate (digest_ctxp, input, input_len)) {
-      goto cleanup;
+   pool = (mongoc_crypto_openssl_pool_t *) mongoc_thread_getspecific (
+      mongoc_crypto_openssl_pool_key);
+   if (pool) {
+      return pool;
    }
 
-   rval = (1 == EVP_DigestFinal_ex (digest_ctxp, hmac_out, NULL));
+   pool = (mongoc_crypto_openssl_pool_t *) calloc (1, sizeof *pool);
+   if (pool &&
+       mongoc_thread_setspecific (mongoc_crypto_openssl_pool_key, pool)) {
+      free (pool);
+      return NULL;
+   }
+
+   if (pool) {
+      mongoc_mutex_lock (&mongoc_crypto_openssl_mutex);
+      pool->next = mongoc_crypto_openssl_pools;
+      mongoc_crypto_openssl_pools = pool;
+      mongoc_mutex_unlock (&mongoc_crypto_openssl_mutex);
+   }
+
+   return pool;
+}
+
+
+/* a context from the thread's pool, or a new one if the pool has none */
+static void *
+_mongoc_crypto_openssl_ctx_take (mongoc_crypto_openssl_kind_t kind)
+{
+   mongoc_crypto_openssl_pool_t *pool = _mongoc_crypto_openssl_pool ();
+
+   if (pool && pool->num[kind]) {
+      return pool->ctx[kind][--pool->num[kind]];
+   }
+
+   return _mongoc_crypto_openssl_ctx_new (kind);
+}
+
+
+/* wipes ctx and keeps it in the thread's pool, or frees it if that is full */
+static void
+_mongoc_crypto_openssl_ctx_give (mongoc_crypto_openssl_kind_t kind, void *ctx)
+{
+   mongoc_crypto_openssl_pool_t *pool;
+
+   if (!ctx) {
+      return;
+   }
+
+   pool = _mongoc_crypto_openssl_pool ();
+   if (!pool || pool->num[kind] == MONGOC_CRYPTO_OPENSSL_POOL_SIZE ||
+       !_mongoc_crypto_openssl_ctx_wipe (kind, ctx)) {
+      _mongoc_crypto_openssl_ctx_free (kind, ctx);
+      return;
+   }
 
-cleanup:
-   EVP_MD_CTX_free (digest_ctxp);
+   pool->ctx[kind][pool->num[kind]++] = ctx;
+}
+
+
+static void
+_mongoc_crypto_openssl_hmac (mongoc_crypto_t *crypto,
+                             const void *key,
+                             int key_len,
+                             const unsigned char *data,
+                             int data_len,
+                             unsigned char *hmac_out)
+{
+#if MONGOC_CRYPTO_OPENSSL_3
+   EVP_MAC_CTX *ctx;
+   size_t len;
+#else
+   HMAC_CTX *ctx;
+#endif
+
+   if (!crypto->mac_ctx) {
+      crypto->mac_ctx =
+         _mongoc_crypto_openssl_ctx_take (MONGOC_CRYPTO_OPENSSL_HMAC (crypto));
+   }
+
+#if MONGOC_CRYPTO_OPENSSL_3
+   ctx = (EVP_MAC_CTX *) crypto->mac_ctx;
+   if (ctx && EVP_MAC_init (ctx, key, (size_t) key_len, NULL) &&
+       EVP_MAC_update (ctx, data, (size_t) data_len) &&
+       EVP_MAC_final (ctx, hmac_out, &len, EVP_MAX_MD_SIZE)) {
+      return;
+   }
+#else
+   ctx = (HMAC_CTX *) crypto->mac_ctx;
+   if (ctx) {
+      HMAC_Init_ex (ctx, key, key_len, _mongoc_crypto_openssl_md (crypto), NULL);
+      HMAC_Update (ctx, data, (size_t) data_len);
+      HMAC_Final (ctx, hmac_out, NULL);
+      return;
+   }
+#endif
+
+   HMAC (_mongoc_crypto_openssl_md (crypto),
+         key,
+         key_len,
+         data,
+         data_len,
+         hmac_out,
+         NULL);
+}
+
+
+static my_bool
+_mongoc_crypto_openssl_hash (mongoc_crypto_t *crypto,
+                             const unsigned char *input,
+                             const size_t input_len,
+                             unsigned char *hash_out)
+{
+   EVP_MD_CTX *ctx;
+
+   if (!crypto->hash_ctx) {
+      crypto->hash_ctx =
+         _mongoc_crypto_openssl_ctx_take (MONGOC_CRYPTO_OPENSSL_DIGEST);
+   }
+
+   ctx = (EVP_MD_CTX *) crypto->hash_ctx;
+
+   /* with the same md as last time, the context's state is reused */
+   return ctx &&
+          1 == EVP_DigestInit_ex (ctx, _mongoc_crypto_openssl_md (crypto), NULL) &&
+          1 == EVP_DigestUpdate (ctx, input, input_len) &&
+          1 == EVP_DigestFinal_ex (ctx, hash_out, NULL);
+}
+
+
+void
+mongoc_crypto_openssl_hmac_sha1 (mongoc_crypto_t *crypto,
+                                 const void *key,
+                                 int key_len,
+                                 const unsigned char *data,
+                                 int data_len,
+                                 unsigned char *hmac_out)
+{
+   /* U1 = HMAC(input, salt + 0001) */
+   _mongoc_crypto_openssl_hmac (crypto, key, key_len, data, data_len, hmac_out);
+}
 
-   return rval;
+my_bool
+mongoc_crypto_openssl_sha1 (mongoc_crypto_t *crypto,
+                            const unsigned char *input,
+                            const size_t input_len,
+                            unsigned char *hash_out)
+{
+   return _mongoc_crypto_openssl_hash (crypto, input, input_len, hash_out);
 }
 
 void
@@ -86,7 +499,7 @@ mongoc_crypto_openssl_hmac_sha256 (mongoc_crypto_t *crypto,
                                    unsigned char *hmac_out)
 {
    /* U1 = HMAC(input, salt + 0001) */
-   HMAC (EVP_sha256 (), key, key_len, data, data_len, hmac_out, NULL);
+   _mongoc_crypto_openssl_hmac (crypto, key, key_len, data, data_len, hmac_out);
 }
 
 my_bool
@@ -95,23 +508,165 @@ mongoc_crypto_openssl_sha256 (mongoc_crypto_t *crypto,
                               const size_t input_len,
                               unsigned char *hash_out)
 {
-   EVP_MD_CTX *digest_ctxp = EVP_MD_CTX_new ();
-   my_bool rval = FALSE;
+   return _mongoc_crypto_openssl_hash (crypto, input, input_len, hash_out);
+}
 
-   if (1 != EVP_DigestInit_ex (digest_ctxp, EVP_sha256 (), NULL)) {
-      goto cleanup;
+my_bool
+mongoc_crypto_openssl_hmac_set_key (mongoc_crypto_t *crypto,
+                                    const void *key,
+                                    int key_len)
+{
+   if (!crypto->hmac_ctx) {
+      crypto->hmac_ctx =
+         _mongoc_crypto_openssl_ctx_take (MONGOC_CRYPTO_OPENSSL_HMAC (crypto));
+      if (!crypto->hmac_ctx) {
+         return FALSE;
+      }
    }
 
-   if (1 != EVP_DigestUpdate (digest_ctxp, input, input_len)) {
-      goto cleanup;
+   /* hashes key ^ ipad and key ^ opad once; the context keeps both
+    * midstates around for every following reinit without a key */
+#if MONGOC_CRYPTO_OPENSSL_3
+   return 1 == EVP_MAC_init (
+                  (EVP_MAC_CTX *) crypto->hmac_ctx, key, (size_t) key_len, NULL);
+#else
+   return 1 == HMAC_Init_ex ((HMAC_CTX *) crypto->hmac_ctx,
+                             key,
+                             key_len,
+                             _mongoc_crypto_openssl_md (crypto),
+                             NULL);
+#endif
+}
+
+my_bool
+mongoc_crypto_openssl_hmac_keyed (mongoc_crypto_t *crypto,
+                                  const unsigned char *data,
+                                  int data_len,
+                                  unsigned char *hmac_out)
+{
+#if MONGOC_CRYPTO_OPENSSL_3
+   EVP_MAC_CTX *ctx = (EVP_MAC_CTX *) crypto->hmac_ctx;
+   size_t len;
+
+   /* a NULL key restores the keyed midstate instead of rehashing the pads */
+   return ctx && 1 == EVP_MAC_init (ctx, NULL, 0, NULL) &&
+          1 == EVP_MAC_update (ctx, data, (size_t) data_len) &&
+          1 == EVP_MAC_final (ctx, hmac_out, &len, EVP_MAX_MD_SIZE);
+#else
+   HMAC_CTX *ctx = (HMAC_CTX *) crypto->hmac_ctx;
+
+   /* a NULL key restores the keyed midstate instead of rehashing the pads */
+   return ctx && 1 == HMAC_Init_ex (ctx, NULL, 0, NULL, NULL) &&
+          1 == HMAC_Update (ctx, data, (size_t) data_len) &&
+          1 == HMAC_Final (ctx, hmac_out, NULL);
+#endif
+}
+
+my_bool
+mongoc_crypto_openssl_pbkdf2 (mongoc_crypto_t *crypto,
+                              const char *password,
+                              size_t password_len,
+                              const uint8_t *salt,
+                              size_t salt_len,
+                              uint32_t iterations,
+                              size_t output_len,
+                              unsigned char *output)
+{
+#if MONGOC_CRYPTO_OPENSSL_3
+   EVP_KDF_CTX *ctx = NULL;
+   OSSL_PARAM params[4];
+   uint64_t iter = iterations;
+   my_bool ret;
+
+   /* the template is never changed once fetched, so duplicating it needs
+    * no lock */
+   _mongoc_crypto_openssl_fetch ();
+   if (mongoc_crypto_openssl_pbkdf2_template[crypto->algorithm]) {
+      ctx = EVP_KDF_CTX_dup (
+         mongoc_crypto_openssl_pbkdf2_template[crypto->algorithm]);
+   }
+
+   if (ctx) {
+      params[0] = OSSL_PARAM_construct_octet_string (
+         OSSL_KDF_PARAM_PASSWORD, (void *) password, password_len);
+      params[1] = OSSL_PARAM_construct_octet_string (
+         OSSL_KDF_PARAM_SALT, (void *) salt, salt_len);
+      params[2] = OSSL_PARAM_construct_uint64 (OSSL_KDF_PARAM_ITER, &iter);
+      params[3] = OSSL_PARAM_construct_end ();
+
+      ret = 1 == EVP_KDF_derive (ctx, output, output_len, params);
+      EVP_KDF_CTX_free (ctx);
+      return ret;
    }
+#endif
+
+   return 1 == PKCS5_PBKDF2_HMAC (password,
+                                  (int) password_len,
+                                  salt,
+                                  (int) salt_len,
+                                  (int) iterations,
+                                  _mongoc_crypto_openssl_md (crypto),
+                                  (int) output_len,
+                                  output);
+}
+
+void
+mongoc_crypto_openssl_destroy (mongoc_crypto_t *crypto)
+{
+   _mongoc_crypto_openssl_ctx_give (MONGOC_CRYPTO_OPENSSL_HMAC (crypto),
+                                    crypto->hmac_ctx);
+   _mongoc_crypto_openssl_ctx_give (MONGOC_CRYPTO_OPENSSL_HMAC (crypto),
+                                    crypto->mac_ctx);
+   _mongoc_crypto_openssl_ctx_give (MONGOC_CRYPTO_OPENSSL_DIGEST,
+                                    crypto->hash_ctx);
+   crypto->hmac_ctx = NULL;
+   crypto->mac_ctx = NULL;
+   crypto->hash_ctx = NULL;
+}
+
+void
+mongoc_crypto_openssl_cleanup (void)
+{
+   mongoc_crypto_openssl_pool_t *pools = NULL;
+   mongoc_crypto_openssl_pool_t *pool;
+   mongoc_thread_key_t pool_key;
+   my_bool delete_key = FALSE;
+#if MONGOC_CRYPTO_OPENSSL_3
+   int i;
+#endif
 
-   rval = (1 == EVP_DigestFinal_ex (digest_ctxp, hash_out, NULL));
+   mongoc_mutex_lock (&mongoc_crypto_openssl_mutex);
+   if (mongoc_crypto_openssl_pool_key_created) {
+      /* no thread's destructor finds the pools once they're off the list */
+      pools = mongoc_crypto_openssl_pools;
+      mongoc_crypto_openssl_pools = NULL;
+      mongoc_thread_setspecific (mongoc_crypto_openssl_pool_key, NULL);
+      pool_key = mongoc_crypto_openssl_pool_key;
+      delete_key = TRUE;
+      mongoc_atomic_store (&mongoc_crypto_openssl_pool_key_created, 0);
+   }
+#if MONGOC_CRYPTO_OPENSSL_3
+   for (i = 0; i < 2; i++) {
+      EVP_MD_free (mongoc_crypto_openssl_md[i]);
+      EVP_MAC_CTX_free (mongoc_crypto_openssl_hmac_template[i]);
+      EVP_KDF_CTX_free (mongoc_crypto_openssl_pbkdf2_template[i]);
+      mongoc_crypto_openssl_md[i] = NULL;
+      mongoc_crypto_openssl_hmac_template[i] = NULL;
+      mongoc_crypto_openssl_pbkdf2_template[i] = NULL;
+   }
+   mongoc_atomic_store (&mongoc_crypto_openssl_fetched, 0);
+#endif
+   mongoc_mutex_unlock (&mongoc_crypto_openssl_mutex);
 
-cleanup:
-   EVP_MD_CTX_free (digest_ctxp);
+   /* off the mutex, as FlsFree runs the destructor on every thread's pool */
+   if (delete_key) {
+      mongoc_thread_key_delete (pool_key);
+   }
 
-   return rval;
+   while ((pool = pools) != NULL) {
+      pools = pool->next;
+      _mongoc_crypto_openssl_pool_free (pool);
+   }
 }
 
 #endif
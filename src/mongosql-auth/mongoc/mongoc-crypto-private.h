@@ -16,6 +16,7 @@
 
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <my_global.h>
 #include "mongoc-config.h"
 
@@ -39,6 +40,32 @@ struct _mongoc_crypto_t {
                  const unsigned char *input,
                  const size_t input_len,
                  unsigned char *hmac_out);
+   /* hmac_set_key hashes the ipad/opad blocks of key once and keeps the
+    * resulting midstate in hmac_ctx, so that hmac_keyed only pays for the
+    * data it is given. hmac_keyed returns FALSE, leaving hmac_out
+    * unusable, if the HMAC could not be computed. */
+   my_bool (*hmac_set_key) (mongoc_crypto_t *crypto,
+                            const void *key,
+                            int key_len);
+   my_bool (*hmac_keyed) (mongoc_crypto_t *crypto,
+                          const unsigned char *data,
+                          int data_len,
+                          unsigned char *hmac_out);
+   /* optional; derives PBKDF2 with the platform's own implementation */
+   my_bool (*pbkdf2) (mongoc_crypto_t *crypto,
+                      const char *password,
+                      size_t password_len,
+                      const uint8_t *salt,
+                      size_t salt_len,
+                      uint32_t iterations,
+                      size_t output_len,
+                      unsigned char *output);
+   void (*destroy) (mongoc_crypto_t *crypto);
+   void *hmac_ctx;
+   /* contexts of hash and the one-shot hmac, kept for the next call so a
+    * crypto allocates them once; the one-shot hmac leaves hmac_ctx keyed */
+   void *hash_ctx;
+   void *mac_ctx;
    mongoc_crypto_hash_algorithm_t algorithm;
 };
 
@@ -54,6 +81,36 @@ mongoc_crypto_hmac (mongoc_crypto_t *crypto,
                          int data_len,
                          unsigned char *hmac_out);
 
+my_bool
+mongoc_crypto_hmac_set_key (mongoc_crypto_t *crypto,
+                            const void *key,
+                            int key_len);
+
+my_bool
+mongoc_crypto_hmac_keyed (mongoc_crypto_t *crypto,
+                          const unsigned char *data,
+                          int data_len,
+                          unsigned char *hmac_out);
+
+my_bool
+mongoc_crypto_pbkdf2 (mongoc_crypto_t *crypto,
+                      const char *password,
+                      size_t password_len,
+                      const uint8_t *salt,
+                      size_t salt_len,
+                      uint32_t iterations,
+                      size_t output_len,
+                      unsigned char *output);
+
+void
+mongoc_crypto_destroy (mongoc_crypto_t *crypto);
+
+/* Frees the contexts every thread kept for reuse, and stops keeping them.
+ * Call it once no mongoc_crypto_t is in use, before the library is
+ * unloaded. */
+void
+mongoc_crypto_cleanup (void);
+
 my_bool
 mongoc_crypto_hash (mongoc_crypto_t *crypto,
                     const unsigned char *input,
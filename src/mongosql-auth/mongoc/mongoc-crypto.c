@@ -22,6 +22,8 @@
 #include "mongoc-crypto-common-crypto-private.h"
 #elif defined(MONGOC_ENABLE_CRYPTO_CNG)
 #include "mongoc-crypto-cng-private.h"
+#elif defined(MONGOC_ENABLE_CRYPTO_BUILTIN)
+#include "mongoc-crypto-builtin-private.h"
 #endif
 
 void
@@ -29,6 +31,34 @@ mongoc_crypto_init (mongoc_crypto_t *crypto, mongoc_crypto_hash_algorithm_t algo
 {
    crypto->hmac = NULL;
    crypto->hash = NULL;
+   crypto->hmac_ctx = NULL;
+   crypto->hash_ctx = NULL;
+   crypto->mac_ctx = NULL;
+   crypto->pbkdf2 = NULL;
+#ifdef MONGOC_ENABLE_CRYPTO_LIBCRYPTO
+   crypto->hmac_set_key = mongoc_crypto_openssl_hmac_set_key;
+   crypto->hmac_keyed = mongoc_crypto_openssl_hmac_keyed;
+   crypto->pbkdf2 = mongoc_crypto_openssl_pbkdf2;
+   crypto->destroy = mongoc_crypto_openssl_destroy;
+#elif defined(MONGOC_ENABLE_CRYPTO_COMMON_CRYPTO)
+   crypto->hmac_set_key = mongoc_crypto_common_crypto_hmac_set_key;
+   crypto->hmac_keyed = mongoc_crypto_common_crypto_hmac_keyed;
+   crypto->pbkdf2 = mongoc_crypto_common_crypto_pbkdf2;
+   crypto->destroy = mongoc_crypto_common_crypto_destroy;
+#elif defined(MONGOC_ENABLE_CRYPTO_CNG)
+   crypto->hmac_set_key = mongoc_crypto_cng_hmac_set_key;
+   crypto->hmac_keyed = mongoc_crypto_cng_hmac_keyed;
+   crypto->pbkdf2 = mongoc_crypto_cng_pbkdf2;
+   crypto->destroy = mongoc_crypto_cng_destroy;
+#elif defined(MONGOC_ENABLE_CRYPTO_BUILTIN)
+   /* one implementation serves both algorithms */
+   crypto->hmac = mongoc_crypto_builtin_hmac;
+   crypto->hash = mongoc_crypto_builtin_hash;
+   crypto->hmac_set_key = mongoc_crypto_builtin_hmac_set_key;
+   crypto->hmac_keyed = mongoc_crypto_builtin_hmac_keyed;
+   crypto->pbkdf2 = mongoc_crypto_builtin_pbkdf2;
+   crypto->destroy = mongoc_crypto_builtin_destroy;
+#endif
    if (algo == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
 #ifdef MONGOC_ENABLE_CRYPTO_LIBCRYPTO
    crypto->hmac = mongoc_crypto_openssl_hmac_sha1;
@@ -66,6 +96,63 @@ mongoc_crypto_hmac (mongoc_crypto_t *crypto,
    crypto->hmac (crypto, key, key_len, d, n, hmac_out);
 }
 
+my_bool
+mongoc_crypto_hmac_set_key (mongoc_crypto_t *crypto,
+                            const void *key,
+                            int key_len)
+{
+   return crypto->hmac_set_key (crypto, key, key_len);
+}
+
+my_bool
+mongoc_crypto_hmac_keyed (mongoc_crypto_t *crypto,
+                          const unsigned char *data,
+                          int data_len,
+                          unsigned char *hmac_out)
+{
+   return crypto->hmac_keyed (crypto, data, data_len, hmac_out);
+}
+
+my_bool
+mongoc_crypto_pbkdf2 (mongoc_crypto_t *crypto,
+                      const char *password,
+                      size_t password_len,
+                      const uint8_t *salt,
+                      size_t salt_len,
+                      uint32_t iterations,
+                      size_t output_len,
+                      unsigned char *output)
+{
+   if (!crypto->pbkdf2) {
+      return FALSE;
+   }
+
+   return crypto->pbkdf2 (crypto,
+                          password,
+                          password_len,
+                          salt,
+                          salt_len,
+                          iterations,
+                          output_len,
+                          output);
+}
+
+void
+mongoc_crypto_destroy (mongoc_crypto_t *crypto)
+{
+   if (crypto->destroy) {
+      crypto->destroy (crypto);
+   }
+}
+
+void
+mongoc_crypto_cleanup (void)
+{
+#ifdef MONGOC_ENABLE_CRYPTO_LIBCRYPTO
+   mongoc_crypto_openssl_cleanup ();
+#endif
+}
+
 my_bool
 mongoc_crypto_hash (mongoc_crypto_t *crypto,
                     const unsigned char *input,
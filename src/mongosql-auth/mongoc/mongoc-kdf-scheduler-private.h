@@ -0,0 +1,71 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOC_KDF_SCHEDULER_PRIVATE_H
+#define MONGOC_KDF_SCHEDULER_PRIVATE_H
+
+#include "mongoc-misc.h"
+
+/*
+ * A process-wide limit on how many threads derive SCRAM keys at once, so a
+ * burst of logins can't take every core from the rest of the process.
+ *
+ * A thread takes a slot before it runs PBKDF2 and gives it back after.
+ * With every slot taken, threads queue for one: higher priorities first,
+ * and in the order they arrived within a priority. A slot is handed
+ * straight to the next thread in the queue, so later arrivals can't
+ * overtake it. Without a limit, which is the default, every thread gets a
+ * slot at once.
+ */
+
+typedef struct _mongoc_kdf_scheduler_stats_t {
+   /* threads deriving now, and threads queued for a slot now */
+   uint32_t running;
+   uint32_t queued;
+   /* the most threads ever queued at once */
+   uint32_t max_queued;
+   /* slots handed out, and how many of them after queueing */
+   uint64_t admitted;
+   uint64_t waits;
+   /* microseconds spent queued, in total and at most at once */
+   uint64_t wait_us;
+   uint64_t max_wait_us;
+   /* threads that gave up queueing when their KDF budget ran out */
+   uint64_t timeouts;
+} mongoc_kdf_scheduler_stats_t;
+
+/* limits the slots to percent of the processors, at least one; 0 lifts the
+ * limit. Queued threads are admitted at once if the limit rises. */
+void
+_mongoc_kdf_scheduler_set_cpu_percent (int percent);
+
+/* the number of slots, or 0 without a limit */
+int
+_mongoc_kdf_scheduler_slots (void);
+
+/* takes a slot, waiting at most timeout_ms unless it is 0. Returns FALSE if
+ * the wait timed out, with no slot taken. */
+my_bool
+_mongoc_kdf_scheduler_acquire (int32_t priority, uint32_t timeout_ms);
+
+/* gives back a slot taken with _mongoc_kdf_scheduler_acquire */
+void
+_mongoc_kdf_scheduler_release (void);
+
+void
+_mongoc_kdf_scheduler_stats (mongoc_kdf_scheduler_stats_t *stats);
+
+#endif /* MONGOC_KDF_SCHEDULER_PRIVATE_H */
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-kdf-scheduler-private.h"
+#include "mongoc-thread-private.h"
+
+/* a thread queued for a slot, on its own stack */
+typedef struct _mongoc_kdf_waiter_t {
+   int32_t priority;
+   /* woken alone once it is admitted */
+   mongoc_cond_t cond;
+   my_bool admitted;
+   struct _mongoc_kdf_waiter_t *next;
+} mongoc_kdf_waiter_t;
+
+static mongoc_mutex_t _mongoc_kdf_mutex = MONGOC_MUTEX_INITIALIZER;
+static uint32_t _mongoc_kdf_slots = 0;
+/* ordered by priority, then by arrival */
+static mongoc_kdf_waiter_t *_mongoc_kdf_queue = NULL;
+static mongoc_kdf_scheduler_stats_t _mongoc_kdf_counters;
+
+
+/* called with the mutex held */
+static my_bool
+_mongoc_kdf_slot_free (void)
+{
+   return !_mongoc_kdf_slots ||
+          _mongoc_kdf_counters.running < _mongoc_kdf_slots;
+}
+
+
+/* hand free slots to the head of the queue; called with the mutex held */
+static void
+_mongoc_kdf_admit (void)
+{
+   mongoc_kdf_waiter_t *waiter;
+
+   while (_mongoc_kdf_queue && _mongoc_kdf_slot_free ()) {
+      waiter = _mongoc_kdf_queue;
+      _mongoc_kdf_queue = waiter->next;
+      _mongoc_kdf_counters.queued--;
+      _mongoc_kdf_counters.running++;
+      waiter->admitted = TRUE;
+      mongoc_cond_signal (&waiter->cond);
+   }
+}
+
+
+void
+_mongoc_kdf_scheduler_set_cpu_percent (int percent)
+{
+   int64_t slots = 0;
+
+   if (percent > 0) {
+      slots = (int64_t) _mongoc_cpu_count () * percent / 100;
+      if (slots < 1) {
+         slots = 1;
+      }
+   }
+
+   mongoc_mutex_lock (&_mongoc_kdf_mutex);
+   _mongoc_kdf_slots = (uint32_t) slots;
+   _mongoc_kdf_admit ();
+   mongoc_mutex_unlock (&_mongoc_kdf_mutex);
+}
+
+
+int
+_mongoc_kdf_scheduler_slots (void)
+{
+   int slots;
+
+   mongoc_mutex_lock (&_mongoc_kdf_mutex);
+   slots = (int) _mongoc_kdf_slots;
+   mongoc_mutex_unlock (&_mongoc_kdf_mutex);
+
+   return slots;
+}
+
+
+my_bool
+_mongoc_kdf_scheduler_acquire (int32_t priority, uint32_t timeout_ms)
+{
+   const int64_t start = bson_get_monotonic_time ();
+   mongoc_kdf_waiter_t waiter;
+   mongoc_kdf_waiter_t **link;
+   int64_t remaining_ms;
+   uint64_t waited_us;
+
+   mongoc_mutex_lock (&_mongoc_kdf_mutex);
+
+   /* nobody is ahead, so no need to queue */
+   if (!_mongoc_kdf_queue && _mongoc_kdf_slot_free ()) {
+      _mongoc_kdf_counters.running++;
+      _mongoc_kdf_counters.admitted++;
+      mongoc_mutex_unlock (&_mongoc_kdf_mutex);
+      return TRUE;
+   }
+
+   waiter.priority = priority;
+   waiter.admitted = FALSE;
+   mongoc_cond_init (&waiter.cond);
+
+   for (link = &_mongoc_kdf_queue; *link && (*link)->priority >= priority;
+        link = &(*link)->next) {
+   }
+   waiter.next = *link;
+   *link = &waiter;
+
+   if (++_mongoc_kdf_counters.queued > _mongoc_kdf_counters.max_queued) {
+      _mongoc_kdf_counters.max_queued = _mongoc_kdf_counters.queued;
+   }
+
+   while (!waiter.admitted) {
+      if (!timeout_ms) {
+         mongoc_cond_wait (&waiter.cond, &_mongoc_kdf_mutex);
+         continue;
+      }
+
+      remaining_ms =
+         (int64_t) timeout_ms - (bson_get_monotonic_time () - start) / 1000;
+      if (remaining_ms <= 0) {
+         break;
+      }
+      mongoc_cond_timedwait (&waiter.cond, &_mongoc_kdf_mutex, remaining_ms);
+   }
+
+   waited_us = (uint64_t) (bson_get_monotonic_time () - start);
+
+   if (!waiter.admitted) {
+      for (link = &_mongoc_kdf_queue; *link != &waiter;
+           link = &(*link)->next) {
+      }
+      *link = waiter.next;
+      _mongoc_kdf_counters.queued--;
+      _mongoc_kdf_counters.timeouts++;
+   } else {
+      _mongoc_kdf_counters.admitted++;
+   }
+
+   _mongoc_kdf_counters.waits++;
+   _mongoc_kdf_counters.wait_us += waited_us;
+   if (waited_us > _mongoc_kdf_counters.max_wait_us) {
+      _mongoc_kdf_counters.max_wait_us = waited_us;
+   }
+
+   mongoc_mutex_unlock (&_mongoc_kdf_mutex);
+   mongoc_cond_destroy (&waiter.cond);
+
+   return waiter.admitted;
+}
+
+
+void
+_mongoc_kdf_scheduler_release (void)
+{
+   mongoc_mutex_lock (&_mongoc_kdf_mutex);
+   _mongoc_kdf_counters.running--;
+   _mongoc_kdf_admit ();
+   mongoc_mutex_unlock (&_mongoc_kdf_mutex);
+}
+
+
+void
+_mongoc_kdf_scheduler_stats (mongoc_kdf_scheduler_stats_t *stats)
+{
+   mongoc_mutex_lock (&_mongoc_kdf_mutex);
+   *stats = _mongoc_kdf_counters;
+   mongoc_mutex_unlock (&_mongoc_kdf_mutex);
+}
@@ -17,6 +17,13 @@
 #include "mongoc-misc.h"
 #include "bson-md5-private.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
 int64_t
 bson_ascii_strtoll (const char *s, char **e, int base)
 {
@@ -256,3 +263,32 @@ _mongoc_hex_md5 (const char *input)
 
    return strdup (digest_str);
 }
+
+int
+_mongoc_cpu_count (void)
+{
+#ifdef _WIN32
+   SYSTEM_INFO info;
+
+   GetSystemInfo (&info);
+   return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+   long n = sysconf (_SC_NPROCESSORS_ONLN);
+
+   return n > 0 ? (int) n : 1;
+#endif
+}
+
+
+int64_t
+bson_get_monotonic_time (void)
+{
+#ifdef _WIN32
+   return (int64_t) GetTickCount64 () * 1000;
+#else
+   struct timespec ts;
+
+   clock_gettime (CLOCK_MONOTONIC, &ts);
+   return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
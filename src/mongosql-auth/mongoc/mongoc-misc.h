@@ -29,6 +29,8 @@
 #define MONGOC_ERROR_SCRAM 1
 #define MONGOC_ERROR_SCRAM_NOT_DONE 2
 #define MONGOC_ERROR_SCRAM_PROTOCOL_ERROR 3
+#define MONGOC_ERROR_SCRAM_CACHE_FILE 4
+#define MONGOC_ERROR_SCRAM_KDF_LIMIT 5
 
 typedef struct {
    uint32_t domain;
@@ -59,4 +61,12 @@ bson_ascii_strtoll (const char *s, char **e, int base);
 char *
 _mongoc_hex_md5 (const char *input);
 
+/* the number of online processors, at least 1 */
+int
+_mongoc_cpu_count (void);
+
+/* microseconds since an arbitrary point, never going backwards */
+int64_t
+bson_get_monotonic_time (void);
+
 #endif /* MONGOC_MISC_H */
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Multi-buffer Hi() loops, one independent derivation per 32-bit vector
+ * lane. mongoc-pbkdf2.c includes this file once per vector width, after
+ * defining:
+ *
+ *   LANES_N                 number of 32-bit lanes
+ *   LANES_VEC               vector type
+ *   LANES_TARGET            function attribute enabling the instructions
+ *   LANES_FN(name)          name mangling for this width
+ *   LANES_LOAD(p), LANES_STORE(p, v), LANES_SET1(x)
+ *   LANES_ADD, LANES_XOR, LANES_AND, LANES_OR
+ *   LANES_ANDNOT(a, b)      ~a & b
+ *   LANES_ROTL(x, n), LANES_ROTR(x, n), LANES_SHR(x, n)
+ *
+ * There is no include guard on purpose.
+ */
+
+LANES_TARGET static void
+LANES_FN (_sha1_compress) (LANES_VEC *state, LANES_VEC *w)
+{
+   LANES_VEC a = state[0], b = state[1], c = state[2], d = state[3];
+   LANES_VEC e = state[4];
+   LANES_VEC f, k, tmp;
+   int i;
+
+   for (i = 0; i < 80; i++) {
+      if (i >= 16) {
+         tmp = LANES_XOR (LANES_XOR (w[(i - 3) & 15], w[(i - 8) & 15]),
+                          LANES_XOR (w[(i - 14) & 15], w[i & 15]));
+         w[i & 15] = LANES_ROTL (tmp, 1);
+      }
+
+      if (i < 20) {
+         f = LANES_OR (LANES_AND (b, c), LANES_ANDNOT (b, d));
+         k = LANES_SET1 (0x5a827999);
+      } else if (i < 40) {
+         f = LANES_XOR (LANES_XOR (b, c), d);
+         k = LANES_SET1 (0x6ed9eba1);
+      } else if (i < 60) {
+         f = LANES_OR (LANES_AND (b, c), LANES_AND (d, LANES_OR (b, c)));
+         k = LANES_SET1 (0x8f1bbcdc);
+      } else {
+         f = LANES_XOR (LANES_XOR (b, c), d);
+         k = LANES_SET1 (0xca62c1d6);
+      }
+
+      tmp = LANES_ADD (LANES_ADD (LANES_ROTL (a, 5), f),
+                       LANES_ADD (LANES_ADD (e, k), w[i & 15]));
+      e = d;
+      d = c;
+      c = LANES_ROTL (b, 30);
+      b = a;
+      a = tmp;
+   }
+
+   state[0] = LANES_ADD (state[0], a);
+   state[1] = LANES_ADD (state[1], b);
+   state[2] = LANES_ADD (state[2], c);
+   state[3] = LANES_ADD (state[3], d);
+   state[4] = LANES_ADD (state[4], e);
+}
+
+LANES_TARGET static void
+LANES_FN (_sha256_compress) (LANES_VEC *state, LANES_VEC *w)
+{
+   LANES_VEC a = state[0], b = state[1], c = state[2], d = state[3];
+   LANES_VEC e = state[4], f = state[5], g = state[6], h = state[7];
+   LANES_VEC s0, s1, t1, t2;
+   int i;
+
+   for (i = 0; i < 64; i++) {
+      if (i >= 16) {
+         s0 = w[(i - 15) & 15];
+         s0 = LANES_XOR (LANES_XOR (LANES_ROTR (s0, 7), LANES_ROTR (s0, 18)),
+                         LANES_SHR (s0, 3));
+         s1 = w[(i - 2) & 15];
+         s1 = LANES_XOR (LANES_XOR (LANES_ROTR (s1, 17), LANES_ROTR (s1, 19)),
+                         LANES_SHR (s1, 10));
+         w[i & 15] = LANES_ADD (LANES_ADD (w[i & 15], s0),
+                                LANES_ADD (w[(i - 7) & 15], s1));
+      }
+
+      s1 = LANES_XOR (LANES_XOR (LANES_ROTR (e, 6), LANES_ROTR (e, 11)),
+                      LANES_ROTR (e, 25));
+      t1 = LANES_ADD (LANES_ADD (h, s1),
+                      LANES_ADD (LANES_XOR (LANES_AND (e, f),
+                                            LANES_ANDNOT (e, g)),
+                                 LANES_ADD (LANES_SET1 (_sha256_k[i]),
+                                            w[i & 15])));
+      s0 = LANES_XOR (LANES_XOR (LANES_ROTR (a, 2), LANES_ROTR (a, 13)),
+                      LANES_ROTR (a, 22));
+      t2 = LANES_ADD (
+         s0, LANES_OR (LANES_AND (a, b), LANES_AND (c, LANES_OR (a, b))));
+      h = g;
+      g = f;
+      f = e;
+      e = LANES_ADD (d, t1);
+      d = c;
+      c = b;
+      b = a;
+      a = LANES_ADD (t1, t2);
+   }
+
+   state[0] = LANES_ADD (state[0], a);
+   state[1] = LANES_ADD (state[1], b);
+   state[2] = LANES_ADD (state[2], c);
+   state[3] = LANES_ADD (state[3], d);
+   state[4] = LANES_ADD (state[4], e);
+   state[5] = LANES_ADD (state[5], f);
+   state[6] = LANES_ADD (state[6], g);
+   state[7] = LANES_ADD (state[7], h);
+}
+
+/* runs count iterations of exactly LANES_N kernels of one algorithm, with
+ * word k of every kernel's state gathered into vector k */
+LANES_TARGET static void
+LANES_FN (_hi) (mongoc_pbkdf2_t **lanes, uint32_t count)
+{
+   const my_bool sha1 = lanes[0]->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1;
+   const int words = sha1 ? 5 : 8;
+   uint32_t scratch[LANES_N];
+   LANES_VEC istate[8], ostate[8], u[8], t[8], state[8], w[16];
+   int k, l;
+
+#define LANES_GATHER(_vec, _field)             \
+   for (k = 0; k < words; k++) {               \
+      for (l = 0; l < LANES_N; l++) {          \
+         scratch[l] = lanes[l]->_field[k];     \
+      }                                        \
+      _vec[k] = LANES_LOAD (scratch);          \
+   }
+#define LANES_SCATTER(_vec, _field)            \
+   for (k = 0; k < words; k++) {               \
+      LANES_STORE (scratch, _vec[k]);          \
+      for (l = 0; l < LANES_N; l++) {          \
+         lanes[l]->_field[k] = scratch[l];     \
+      }                                        \
+   }
+
+   LANES_GATHER (istate, istate);
+   LANES_GATHER (ostate, ostate);
+   LANES_GATHER (u, u);
+   LANES_GATHER (t, t);
+
+   while (count--) {
+      for (k = 0; k < words; k++) {
+         state[k] = istate[k];
+         w[k] = u[k];
+      }
+      w[words] = LANES_SET1 (0x80000000);
+      for (k = words + 1; k < 15; k++) {
+         w[k] = LANES_SET1 (0);
+      }
+      w[15] = LANES_SET1 (sha1 ? SHA1_HI_BITS : SHA256_HI_BITS);
+
+      if (sha1) {
+         LANES_FN (_sha1_compress) (state, w);
+      } else {
+         LANES_FN (_sha256_compress) (state, w);
+      }
+
+      for (k = 0; k < words; k++) {
+         w[k] = state[k];
+         state[k] = ostate[k];
+      }
+      w[words] = LANES_SET1 (0x80000000);
+      for (k = words + 1; k < 15; k++) {
+         w[k] = LANES_SET1 (0);
+      }
+      w[15] = LANES_SET1 (sha1 ? SHA1_HI_BITS : SHA256_HI_BITS);
+
+      if (sha1) {
+         LANES_FN (_sha1_compress) (state, w);
+      } else {
+         LANES_FN (_sha256_compress) (state, w);
+      }
+
+      for (k = 0; k < words; k++) {
+         u[k] = state[k];
+         t[k] = LANES_XOR (t[k], state[k]);
+      }
+   }
+
+   LANES_SCATTER (u, u);
+   LANES_SCATTER (t, t);
+
+#undef LANES_GATHER
+#undef LANES_SCATTER
+
+   memset (scratch, 0, sizeof scratch);
+}
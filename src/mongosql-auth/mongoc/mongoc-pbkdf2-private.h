@@ -0,0 +1,106 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOC_PBKDF2_PRIVATE_H
+#define MONGOC_PBKDF2_PRIVATE_H
+
+#include "mongoc-misc.h"
+#include "mongoc-crypto-private.h"
+
+/* SHA-1 and SHA-256 both hash 64 byte blocks */
+#define MONGOC_PBKDF2_BLOCK_SIZE 64
+
+/*
+ * A single-block PBKDF2-HMAC kernel for SCRAM's Hi().
+ *
+ * Hi() only ever produces one hash-sized output block, and every message it
+ * hashes (salt + INT(1), then each Ui) fits in one padded block. The kernel
+ * keeps the HMAC ipad/opad midstates and Ui as 32-bit words and runs the
+ * compression function directly, so each iteration costs exactly two block
+ * compressions and no digest API calls. The compression function is picked
+ * at runtime: SHA-NI on x86, the ARMv8 crypto extensions on AArch64, and
+ * portable C everywhere else.
+ *
+ * SHA-1 state uses the first five words of each array.
+ */
+typedef struct _mongoc_pbkdf2_t {
+   mongoc_crypto_hash_algorithm_t algorithm;
+   uint32_t istate[8];
+   uint32_t ostate[8];
+   uint32_t u[8];
+   uint32_t t[8];
+   uint32_t iterations;
+   /* bookkeeping for _mongoc_pbkdf2_run_batch */
+   uint32_t target;
+   my_bool claimed;
+   struct _mongoc_pbkdf2_t *next;
+} mongoc_pbkdf2_t;
+
+/* Keys the kernel and computes U1. The key must not be longer than a block
+ * (hash longer keys first, as HMAC does) and the salt must leave room for
+ * INT(1) and padding in one block. Returns FALSE if these do not hold. */
+my_bool
+_mongoc_pbkdf2_init (mongoc_pbkdf2_t *pbkdf2,
+                     mongoc_crypto_hash_algorithm_t algorithm,
+                     const uint8_t *key,
+                     size_t key_len,
+                     const uint8_t *salt,
+                     size_t salt_len);
+
+/* Runs count more iterations. May be called repeatedly to split up work. */
+void
+_mongoc_pbkdf2_iterate (mongoc_pbkdf2_t *pbkdf2, uint32_t count);
+
+/* Runs each kernel in batch until it has done iterations[i] iterations in
+ * total. Kernels from every thread calling this are queued together, and
+ * those of one algorithm are packed into the SIMD lanes of a multi-buffer
+ * engine (8 with AVX2, 16 with AVX-512) when that beats the single-buffer
+ * path. Each caller works on queued kernels until its own are done, so
+ * concurrent callers still spread the work over their cores. */
+void
+_mongoc_pbkdf2_run_batch (mongoc_pbkdf2_t **batch,
+                          const uint32_t *iterations,
+                          size_t n);
+
+/* The number of kernels the multi-buffer engine runs at once, or 1. */
+int
+_mongoc_pbkdf2_lanes (void);
+
+/* Writes the derived key (one hash-sized block) and wipes the state. */
+void
+_mongoc_pbkdf2_finish (mongoc_pbkdf2_t *pbkdf2, uint8_t *output);
+
+/* Start a plain SHA-1 or SHA-256 hash in state, and run one 64 byte block
+ * of it through the portable compression function. The built-in crypto
+ * backend builds its hashes and HMACs on these. */
+void
+_mongoc_pbkdf2_hash_init (mongoc_crypto_hash_algorithm_t algorithm,
+                          uint32_t state[8]);
+
+void
+_mongoc_pbkdf2_hash_block (mongoc_crypto_hash_algorithm_t algorithm,
+                           uint32_t state[8],
+                           const uint8_t *bytes);
+
+/* TRUE if a hardware accelerated compression function was selected. */
+my_bool
+_mongoc_pbkdf2_accelerated (void);
+
+/* The name of the selected compression function, for logging. */
+const char *
+_mongoc_pbkdf2_implementation (void);
+
+#endif /* MONGOC_PBKDF2_PRIVATE_H */
@@ -0,0 +1,1496 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+#include "mongoc-pbkdf2-private.h"
+#include "mongoc-thread-private.h"
+
+/*
+ * Hardware paths are compiled with per-function target attributes so the
+ * rest of the plugin keeps its baseline instruction set, and are only called
+ * after a runtime CPU check.
+ */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+   defined(_M_IX86)
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#define MONGOC_PBKDF2_X86 1
+#define MONGOC_PBKDF2_SHANI_TARGET
+#define MONGOC_PBKDF2_AVX2_TARGET
+#if _MSC_VER >= 1911
+#define MONGOC_PBKDF2_AVX512 1
+#define MONGOC_PBKDF2_AVX512_TARGET
+#endif
+#elif (defined(__clang__) && __clang_major__ >= 4) || \
+   (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 5)
+#include <cpuid.h>
+#include <immintrin.h>
+#define MONGOC_PBKDF2_X86 1
+#define MONGOC_PBKDF2_SHANI_TARGET __attribute__ ((target ("sha,sse4.1")))
+#define MONGOC_PBKDF2_AVX2_TARGET __attribute__ ((target ("avx2")))
+#define MONGOC_PBKDF2_AVX512 1
+#define MONGOC_PBKDF2_AVX512_TARGET __attribute__ ((target ("avx512f")))
+#endif
+#elif defined(__aarch64__)
+#if defined(__ARM_FEATURE_CRYPTO)
+#define MONGOC_PBKDF2_ARMV8 1
+#define MONGOC_PBKDF2_ARMV8_TARGET
+#elif defined(__clang__) && __clang_major__ >= 6
+#define MONGOC_PBKDF2_ARMV8 1
+#define MONGOC_PBKDF2_ARMV8_TARGET __attribute__ ((target ("crypto")))
+#elif !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8
+#define MONGOC_PBKDF2_ARMV8 1
+#define MONGOC_PBKDF2_ARMV8_TARGET __attribute__ ((target ("+crypto")))
+#endif
+#ifdef MONGOC_PBKDF2_ARMV8
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_SHA1
+#define HWCAP_SHA1 (1 << 5)
+#endif
+#ifndef HWCAP_SHA2
+#define HWCAP_SHA2 (1 << 6)
+#endif
+#endif
+#endif
+#endif
+
+#define ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* SHA-1 with a 20 byte message in one block: 0x80 pad and 84 bytes of
+ * length once the 64 byte HMAC key block is included */
+#define SHA1_HI_BITS ((MONGOC_PBKDF2_BLOCK_SIZE + 20) * 8)
+#define SHA256_HI_BITS ((MONGOC_PBKDF2_BLOCK_SIZE + 32) * 8)
+
+typedef void (*mongoc_pbkdf2_hi_fn) (const uint32_t *istate,
+                                     const uint32_t *ostate,
+                                     uint32_t *u,
+                                     uint32_t *t,
+                                     uint32_t count);
+
+typedef struct {
+   const char *name;
+   my_bool accelerated;
+   mongoc_pbkdf2_hi_fn sha1_hi;
+   mongoc_pbkdf2_hi_fn sha256_hi;
+} mongoc_pbkdf2_impl_t;
+
+/* runs count iterations of as many kernels as the engine has lanes */
+typedef void (*mongoc_pbkdf2_lanes_fn) (mongoc_pbkdf2_t **lanes,
+                                        uint32_t count);
+
+typedef struct {
+   const char *name;
+   int lanes;
+   mongoc_pbkdf2_lanes_fn hi;
+   /* how many kernels it takes to beat running them one at a time on a
+    * hardware accelerated single-buffer path */
+   int min_jobs_accelerated;
+} mongoc_pbkdf2_lanes_t;
+
+static const uint32_t _sha1_iv[5] = {
+   0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+static const uint32_t _sha256_iv[8] = {0x6a09e667,
+                                       0xbb67ae85,
+                                       0x3c6ef372,
+                                       0xa54ff53a,
+                                       0x510e527f,
+                                       0x9b05688c,
+                                       0x1f83d9ab,
+                                       0x5be0cd19};
+
+static const uint32_t _sha256_k[64] = {
+   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+   0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+   0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+   0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+   0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+   0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+   0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+   0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+   0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+   0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+   0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+
+/* portable compression functions, over a block of big-endian words */
+static void
+_sha1_compress (uint32_t state[5], const uint32_t block[16])
+{
+   uint32_t w[80];
+   uint32_t a, b, c, d, e, f, k, tmp;
+   int i;
+
+   for (i = 0; i < 16; i++) {
+      w[i] = block[i];
+   }
+
+   for (i = 16; i < 80; i++) {
+      w[i] = ROTL (w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+   }
+
+   a = state[0];
+   b = state[1];
+   c = state[2];
+   d = state[3];
+   e = state[4];
+
+   for (i = 0; i < 80; i++) {
+      if (i < 20) {
+         f = (b & c) | (~b & d);
+         k = 0x5a827999;
+      } else if (i < 40) {
+         f = b ^ c ^ d;
+         k = 0x6ed9eba1;
+      } else if (i < 60) {
+         f = (b & c) | (b & d) | (c & d);
+         k = 0x8f1bbcdc;
+      } else {
+         f = b ^ c ^ d;
+         k = 0xca62c1d6;
+      }
+
+      tmp = ROTL (a, 5) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = ROTL (b, 30);
+      b = a;
+      a = tmp;
+   }
+
+   state[0] += a;
+   state[1] += b;
+   state[2] += c;
+   state[3] += d;
+   state[4] += e;
+}
+
+static void
+_sha256_compress (uint32_t state[8], const uint32_t block[16])
+{
+   uint32_t w[64];
+   uint32_t a, b, c, d, e, f, g, h, t1, t2;
+   int i;
+
+   for (i = 0; i < 16; i++) {
+      w[i] = block[i];
+   }
+
+   for (i = 16; i < 64; i++) {
+      t1 = ROTR (w[i - 2], 17) ^ ROTR (w[i - 2], 19) ^ (w[i - 2] >> 10);
+      t2 = ROTR (w[i - 15], 7) ^ ROTR (w[i - 15], 18) ^ (w[i - 15] >> 3);
+      w[i] = t1 + w[i - 7] + t2 + w[i - 16];
+   }
+
+   a = state[0];
+   b = state[1];
+   c = state[2];
+   d = state[3];
+   e = state[4];
+   f = state[5];
+   g = state[6];
+   h = state[7];
+
+   for (i = 0; i < 64; i++) {
+      t1 = h + (ROTR (e, 6) ^ ROTR (e, 11) ^ ROTR (e, 25)) +
+           ((e & f) ^ (~e & g)) + _sha256_k[i] + w[i];
+      t2 = (ROTR (a, 2) ^ ROTR (a, 13) ^ ROTR (a, 22)) +
+           ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+   }
+
+   state[0] += a;
+   state[1] += b;
+   state[2] += c;
+   state[3] += d;
+   state[4] += e;
+   state[5] += f;
+   state[6] += g;
+   state[7] += h;
+}
+
+
+/* U(i) = HMAC(key, U(i-1)) and T ^= U(i), for count iterations. Every
+ * block is U(i-1) or the inner digest followed by constant padding. */
+static void
+_sha1_hi_portable (const uint32_t *istate,
+                   const uint32_t *ostate,
+                   uint32_t *u,
+                   uint32_t *t,
+                   uint32_t count)
+{
+   uint32_t block[16] = {0};
+   uint32_t state[5];
+   int k;
+
+   block[5] = 0x80000000;
+   block[15] = SHA1_HI_BITS;
+
+   while (count--) {
+      memcpy (block, u, 5 * sizeof (uint32_t));
+      memcpy (state, istate, sizeof state);
+      _sha1_compress (state, block);
+
+      memcpy (block, state, sizeof state);
+      memcpy (state, ostate, sizeof state);
+      _sha1_compress (state, block);
+
+      for (k = 0; k < 5; k++) {
+         u[k] = state[k];
+         t[k] ^= state[k];
+      }
+   }
+
+   memset (state, 0, sizeof state);
+   memset (block, 0, sizeof block);
+}
+
+static void
+_sha256_hi_portable (const uint32_t *istate,
+                     const uint32_t *ostate,
+                     uint32_t *u,
+                     uint32_t *t,
+                     uint32_t count)
+{
+   uint32_t block[16] = {0};
+   uint32_t state[8];
+   int k;
+
+   block[8] = 0x80000000;
+   block[15] = SHA256_HI_BITS;
+
+   while (count--) {
+      memcpy (block, u, 8 * sizeof (uint32_t));
+      memcpy (state, istate, sizeof state);
+      _sha256_compress (state, block);
+
+      memcpy (block, state, sizeof state);
+      memcpy (state, ostate, sizeof state);
+      _sha256_compress (state, block);
+
+      for (k = 0; k < 8; k++) {
+         u[k] = state[k];
+         t[k] ^= state[k];
+      }
+   }
+
+   memset (state, 0, sizeof state);
+   memset (block, 0, sizeof block);
+}
+
+static const mongoc_pbkdf2_impl_t _mongoc_pbkdf2_portable = {
+   "portable", FALSE, _sha1_hi_portable, _sha256_hi_portable};
+
+
+#ifdef MONGOC_PBKDF2_X86
+/*
+ * SHA-NI keeps SHA-1 state as ABCD with A in the high lane plus E in the
+ * high lane of a second register, and expects message words in reverse lane
+ * order. SHA-256 state is kept as ABEF/CDGH and message words in lane order.
+ * Ui and the inner digest are fed back as message words without leaving the
+ * registers.
+ */
+MONGOC_PBKDF2_SHANI_TARGET static void
+_sha1_compress_shani (
+   __m128i *state_abcd, __m128i *state_e, __m128i m0, __m128i m1, __m128i m2, __m128i m3)
+{
+   __m128i abcd = *state_abcd;
+   __m128i e0 = *state_e;
+   __m128i e1;
+
+   /* rounds 0-3 */
+   e0 = _mm_add_epi32 (e0, m0);
+   e1 = abcd;
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 0);
+
+   /* rounds 4-7 */
+   e1 = _mm_sha1nexte_epu32 (e1, m1);
+   e0 = abcd;
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 0);
+   m0 = _mm_sha1msg1_epu32 (m0, m1);
+
+   /* rounds 8-11 */
+   e0 = _mm_sha1nexte_epu32 (e0, m2);
+   e1 = abcd;
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 0);
+   m1 = _mm_sha1msg1_epu32 (m1, m2);
+   m0 = _mm_xor_si128 (m0, m2);
+
+   /* rounds 12-15 */
+   e1 = _mm_sha1nexte_epu32 (e1, m3);
+   e0 = abcd;
+   m0 = _mm_sha1msg2_epu32 (m0, m3);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 0);
+   m2 = _mm_sha1msg1_epu32 (m2, m3);
+   m1 = _mm_xor_si128 (m1, m3);
+
+   /* rounds 16-19 */
+   e0 = _mm_sha1nexte_epu32 (e0, m0);
+   e1 = abcd;
+   m1 = _mm_sha1msg2_epu32 (m1, m0);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 0);
+   m3 = _mm_sha1msg1_epu32 (m3, m0);
+   m2 = _mm_xor_si128 (m2, m0);
+
+   /* rounds 20-23 */
+   e1 = _mm_sha1nexte_epu32 (e1, m1);
+   e0 = abcd;
+   m2 = _mm_sha1msg2_epu32 (m2, m1);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 1);
+   m0 = _mm_sha1msg1_epu32 (m0, m1);
+   m3 = _mm_xor_si128 (m3, m1);
+
+   /* rounds 24-27 */
+   e0 = _mm_sha1nexte_epu32 (e0, m2);
+   e1 = abcd;
+   m3 = _mm_sha1msg2_epu32 (m3, m2);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 1);
+   m1 = _mm_sha1msg1_epu32 (m1, m2);
+   m0 = _mm_xor_si128 (m0, m2);
+
+   /* rounds 28-31 */
+   e1 = _mm_sha1nexte_epu32 (e1, m3);
+   e0 = abcd;
+   m0 = _mm_sha1msg2_epu32 (m0, m3);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 1);
+   m2 = _mm_sha1msg1_epu32 (m2, m3);
+   m1 = _mm_xor_si128 (m1, m3);
+
+   /* rounds 32-35 */
+   e0 = _mm_sha1nexte_epu32 (e0, m0);
+   e1 = abcd;
+   m1 = _mm_sha1msg2_epu32 (m1, m0);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 1);
+   m3 = _mm_sha1msg1_epu32 (m3, m0);
+   m2 = _mm_xor_si128 (m2, m0);
+
+   /* rounds 36-39 */
+   e1 = _mm_sha1nexte_epu32 (e1, m1);
+   e0 = abcd;
+   m2 = _mm_sha1msg2_epu32 (m2, m1);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 1);
+   m0 = _mm_sha1msg1_epu32 (m0, m1);
+   m3 = _mm_xor_si128 (m3, m1);
+
+   /* rounds 40-43 */
+   e0 = _mm_sha1nexte_epu32 (e0, m2);
+   e1 = abcd;
+   m3 = _mm_sha1msg2_epu32 (m3, m2);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 2);
+   m1 = _mm_sha1msg1_epu32 (m1, m2);
+   m0 = _mm_xor_si128 (m0, m2);
+
+   /* rounds 44-47 */
+   e1 = _mm_sha1nexte_epu32 (e1, m3);
+   e0 = abcd;
+   m0 = _mm_sha1msg2_epu32 (m0, m3);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 2);
+   m2 = _mm_sha1msg1_epu32 (m2, m3);
+   m1 = _mm_xor_si128 (m1, m3);
+
+   /* rounds 48-51 */
+   e0 = _mm_sha1nexte_epu32 (e0, m0);
+   e1 = abcd;
+   m1 = _mm_sha1msg2_epu32 (m1, m0);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 2);
+   m3 = _mm_sha1msg1_epu32 (m3, m0);
+   m2 = _mm_xor_si128 (m2, m0);
+
+   /* rounds 52-55 */
+   e1 = _mm_sha1nexte_epu32 (e1, m1);
+   e0 = abcd;
+   m2 = _mm_sha1msg2_epu32 (m2, m1);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 2);
+   m0 = _mm_sha1msg1_epu32 (m0, m1);
+   m3 = _mm_xor_si128 (m3, m1);
+
+   /* rounds 56-59 */
+   e0 = _mm_sha1nexte_epu32 (e0, m2);
+   e1 = abcd;
+   m3 = _mm_sha1msg2_epu32 (m3, m2);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 2);
+   m1 = _mm_sha1msg1_epu32 (m1, m2);
+   m0 = _mm_xor_si128 (m0, m2);
+
+   /* rounds 60-63 */
+   e1 = _mm_sha1nexte_epu32 (e1, m3);
+   e0 = abcd;
+   m0 = _mm_sha1msg2_epu32 (m0, m3);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 3);
+   m2 = _mm_sha1msg1_epu32 (m2, m3);
+   m1 = _mm_xor_si128 (m1, m3);
+
+   /* rounds 64-67 */
+   e0 = _mm_sha1nexte_epu32 (e0, m0);
+   e1 = abcd;
+   m1 = _mm_sha1msg2_epu32 (m1, m0);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 3);
+   m3 = _mm_sha1msg1_epu32 (m3, m0);
+   m2 = _mm_xor_si128 (m2, m0);
+
+   /* rounds 68-71 */
+   e1 = _mm_sha1nexte_epu32 (e1, m1);
+   e0 = abcd;
+   m2 = _mm_sha1msg2_epu32 (m2, m1);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 3);
+   m3 = _mm_xor_si128 (m3, m1);
+
+   /* rounds 72-75 */
+   e0 = _mm_sha1nexte_epu32 (e0, m2);
+   e1 = abcd;
+   m3 = _mm_sha1msg2_epu32 (m3, m2);
+   abcd = _mm_sha1rnds4_epu32 (abcd, e0, 3);
+
+   /* rounds 76-79 */
+   e1 = _mm_sha1nexte_epu32 (e1, m3);
+   e0 = abcd;
+   abcd = _mm_sha1rnds4_epu32 (abcd, e1, 3);
+   *state_e = _mm_sha1nexte_epu32 (e0, *state_e);
+   *state_abcd = _mm_add_epi32 (abcd, *state_abcd);
+}
+
+MONGOC_PBKDF2_SHANI_TARGET static void
+_sha1_hi_shani (const uint32_t *istate,
+                const uint32_t *ostate,
+                uint32_t *u,
+                uint32_t *t,
+                uint32_t count)
+{
+   const __m128i iabcd =
+      _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *) istate), 0x1B);
+   const __m128i ie = _mm_set_epi32 ((int) istate[4], 0, 0, 0);
+   const __m128i oabcd =
+      _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *) ostate), 0x1B);
+   const __m128i oe = _mm_set_epi32 ((int) ostate[4], 0, 0, 0);
+   /* message words 5 through 15 */
+   const __m128i pad = _mm_set_epi32 (0, (int) 0x80000000, 0, 0);
+   const __m128i zero = _mm_setzero_si128 ();
+   const __m128i bits = _mm_set_epi32 (0, 0, 0, SHA1_HI_BITS);
+   __m128i uabcd =
+      _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *) u), 0x1B);
+   __m128i ue = _mm_set_epi32 ((int) u[4], 0, 0, 0);
+   __m128i tabcd =
+      _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *) t), 0x1B);
+   __m128i te = _mm_set_epi32 ((int) t[4], 0, 0, 0);
+   __m128i abcd, e;
+
+   while (count--) {
+      abcd = iabcd;
+      e = ie;
+      _sha1_compress_shani (
+         &abcd, &e, uabcd, _mm_or_si128 (ue, pad), zero, bits);
+
+      uabcd = oabcd;
+      ue = oe;
+      _sha1_compress_shani (
+         &uabcd, &ue, abcd, _mm_or_si128 (e, pad), zero, bits);
+
+      tabcd = _mm_xor_si128 (tabcd, uabcd);
+      te = _mm_xor_si128 (te, ue);
+   }
+
+   _mm_storeu_si128 ((__m128i *) u, _mm_shuffle_epi32 (uabcd, 0x1B));
+   u[4] = (uint32_t) _mm_extract_epi32 (ue, 3);
+   _mm_storeu_si128 ((__m128i *) t, _mm_shuffle_epi32 (tabcd, 0x1B));
+   t[4] = (uint32_t) _mm_extract_epi32 (te, 3);
+}
+
+MONGOC_PBKDF2_SHANI_TARGET static void
+_sha256_compress_shani (
+   __m128i *abef, __m128i *cdgh, __m128i m0, __m128i m1, __m128i m2, __m128i m3)
+{
+   __m128i state0 = *abef;
+   __m128i state1 = *cdgh;
+   __m128i msg, tmp;
+
+   /* rounds 0-3 */
+   msg = _mm_add_epi32 (m0, _mm_set_epi64x (0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+
+   /* rounds 4-7 */
+   msg = _mm_add_epi32 (m1, _mm_set_epi64x (0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m0 = _mm_sha256msg1_epu32 (m0, m1);
+
+   /* rounds 8-11 */
+   msg = _mm_add_epi32 (m2, _mm_set_epi64x (0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m1 = _mm_sha256msg1_epu32 (m1, m2);
+
+   /* rounds 12-15 */
+   msg = _mm_add_epi32 (m3, _mm_set_epi64x (0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m3, m2, 4);
+   m0 = _mm_add_epi32 (m0, tmp);
+   m0 = _mm_sha256msg2_epu32 (m0, m3);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m2 = _mm_sha256msg1_epu32 (m2, m3);
+
+   /* rounds 16-19 */
+   msg = _mm_add_epi32 (m0, _mm_set_epi64x (0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m0, m3, 4);
+   m1 = _mm_add_epi32 (m1, tmp);
+   m1 = _mm_sha256msg2_epu32 (m1, m0);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m3 = _mm_sha256msg1_epu32 (m3, m0);
+
+   /* rounds 20-23 */
+   msg = _mm_add_epi32 (m1, _mm_set_epi64x (0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m1, m0, 4);
+   m2 = _mm_add_epi32 (m2, tmp);
+   m2 = _mm_sha256msg2_epu32 (m2, m1);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m0 = _mm_sha256msg1_epu32 (m0, m1);
+
+   /* rounds 24-27 */
+   msg = _mm_add_epi32 (m2, _mm_set_epi64x (0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m2, m1, 4);
+   m3 = _mm_add_epi32 (m3, tmp);
+   m3 = _mm_sha256msg2_epu32 (m3, m2);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m1 = _mm_sha256msg1_epu32 (m1, m2);
+
+   /* rounds 28-31 */
+   msg = _mm_add_epi32 (m3, _mm_set_epi64x (0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m3, m2, 4);
+   m0 = _mm_add_epi32 (m0, tmp);
+   m0 = _mm_sha256msg2_epu32 (m0, m3);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m2 = _mm_sha256msg1_epu32 (m2, m3);
+
+   /* rounds 32-35 */
+   msg = _mm_add_epi32 (m0, _mm_set_epi64x (0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m0, m3, 4);
+   m1 = _mm_add_epi32 (m1, tmp);
+   m1 = _mm_sha256msg2_epu32 (m1, m0);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m3 = _mm_sha256msg1_epu32 (m3, m0);
+
+   /* rounds 36-39 */
+   msg = _mm_add_epi32 (m1, _mm_set_epi64x (0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m1, m0, 4);
+   m2 = _mm_add_epi32 (m2, tmp);
+   m2 = _mm_sha256msg2_epu32 (m2, m1);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m0 = _mm_sha256msg1_epu32 (m0, m1);
+
+   /* rounds 40-43 */
+   msg = _mm_add_epi32 (m2, _mm_set_epi64x (0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m2, m1, 4);
+   m3 = _mm_add_epi32 (m3, tmp);
+   m3 = _mm_sha256msg2_epu32 (m3, m2);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m1 = _mm_sha256msg1_epu32 (m1, m2);
+
+   /* rounds 44-47 */
+   msg = _mm_add_epi32 (m3, _mm_set_epi64x (0x106AA070F40E3585ULL, 0xD6990624D192E819ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m3, m2, 4);
+   m0 = _mm_add_epi32 (m0, tmp);
+   m0 = _mm_sha256msg2_epu32 (m0, m3);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m2 = _mm_sha256msg1_epu32 (m2, m3);
+
+   /* rounds 48-51 */
+   msg = _mm_add_epi32 (m0, _mm_set_epi64x (0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m0, m3, 4);
+   m1 = _mm_add_epi32 (m1, tmp);
+   m1 = _mm_sha256msg2_epu32 (m1, m0);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   m3 = _mm_sha256msg1_epu32 (m3, m0);
+
+   /* rounds 52-55 */
+   msg = _mm_add_epi32 (m1, _mm_set_epi64x (0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m1, m0, 4);
+   m2 = _mm_add_epi32 (m2, tmp);
+   m2 = _mm_sha256msg2_epu32 (m2, m1);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+
+   /* rounds 56-59 */
+   msg = _mm_add_epi32 (m2, _mm_set_epi64x (0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   tmp = _mm_alignr_epi8 (m2, m1, 4);
+   m3 = _mm_add_epi32 (m3, tmp);
+   m3 = _mm_sha256msg2_epu32 (m3, m2);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+
+   /* rounds 60-63 */
+   msg = _mm_add_epi32 (m3, _mm_set_epi64x (0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL));
+   state1 = _mm_sha256rnds2_epu32 (state1, state0, msg);
+   msg = _mm_shuffle_epi32 (msg, 0x0E);
+   state0 = _mm_sha256rnds2_epu32 (state0, state1, msg);
+   *abef = _mm_add_epi32 (state0, *abef);
+   *cdgh = _mm_add_epi32 (state1, *cdgh);
+}
+
+/* converts between lane ordered state words and the ABEF/CDGH layout */
+MONGOC_PBKDF2_SHANI_TARGET static void
+_sha256_to_shani (__m128i *lo, __m128i *hi)
+{
+   __m128i tmp = _mm_shuffle_epi32 (*lo, 0xB1);
+
+   *hi = _mm_shuffle_epi32 (*hi, 0x1B);
+   *lo = _mm_alignr_epi8 (tmp, *hi, 8);
+   *hi = _mm_blend_epi16 (*hi, tmp, 0xF0);
+}
+
+MONGOC_PBKDF2_SHANI_TARGET static void
+_sha256_from_shani (__m128i *abef, __m128i *cdgh)
+{
+   __m128i tmp = _mm_shuffle_epi32 (*abef, 0x1B);
+
+   *cdgh = _mm_shuffle_epi32 (*cdgh, 0xB1);
+   *abef = _mm_blend_epi16 (tmp, *cdgh, 0xF0);
+   *cdgh = _mm_alignr_epi8 (*cdgh, tmp, 8);
+}
+
+MONGOC_PBKDF2_SHANI_TARGET static void
+_sha256_hi_shani (const uint32_t *istate,
+                  const uint32_t *ostate,
+                  uint32_t *u,
+                  uint32_t *t,
+                  uint32_t count)
+{
+   __m128i i0 = _mm_loadu_si128 ((const __m128i *) istate);
+   __m128i i1 = _mm_loadu_si128 ((const __m128i *) (istate + 4));
+   __m128i o0 = _mm_loadu_si128 ((const __m128i *) ostate);
+   __m128i o1 = _mm_loadu_si128 ((const __m128i *) (ostate + 4));
+   /* message words 8 through 15 */
+   const __m128i pad = _mm_set_epi32 (0, 0, 0, (int) 0x80000000);
+   const __m128i bits = _mm_set_epi32 (SHA256_HI_BITS, 0, 0, 0);
+   __m128i u0 = _mm_loadu_si128 ((const __m128i *) u);
+   __m128i u1 = _mm_loadu_si128 ((const __m128i *) (u + 4));
+   __m128i t0 = _mm_loadu_si128 ((const __m128i *) t);
+   __m128i t1 = _mm_loadu_si128 ((const __m128i *) (t + 4));
+   __m128i s0, s1;
+
+   _sha256_to_shani (&i0, &i1);
+   _sha256_to_shani (&o0, &o1);
+
+   while (count--) {
+      s0 = i0;
+      s1 = i1;
+      _sha256_compress_shani (&s0, &s1, u0, u1, pad, bits);
+      _sha256_from_shani (&s0, &s1);
+
+      u0 = o0;
+      u1 = o1;
+      _sha256_compress_shani (&u0, &u1, s0, s1, pad, bits);
+      _sha256_from_shani (&u0, &u1);
+
+      t0 = _mm_xor_si128 (t0, u0);
+      t1 = _mm_xor_si128 (t1, u1);
+   }
+
+   _mm_storeu_si128 ((__m128i *) u, u0);
+   _mm_storeu_si128 ((__m128i *) (u + 4), u1);
+   _mm_storeu_si128 ((__m128i *) t, t0);
+   _mm_storeu_si128 ((__m128i *) (t + 4), t1);
+}
+
+static const mongoc_pbkdf2_impl_t _mongoc_pbkdf2_shani = {
+   "sha-ni", TRUE, _sha1_hi_shani, _sha256_hi_shani};
+
+#define MONGOC_PBKDF2_CPU_SHANI (1 << 0)
+#define MONGOC_PBKDF2_CPU_AVX2 (1 << 1)
+#define MONGOC_PBKDF2_CPU_AVX512 (1 << 2)
+
+static int
+_mongoc_pbkdf2_x86_features (void)
+{
+   unsigned int ebx, ecx, xcr0 = 0;
+   int features = 0;
+#ifdef _MSC_VER
+   int regs[4];
+
+   __cpuid (regs, 0);
+   if (regs[0] < 7) {
+      return 0;
+   }
+   __cpuid (regs, 1);
+   ecx = (unsigned int) regs[2];
+   if (ecx & (1u << 27)) {
+      xcr0 = (unsigned int) _xgetbv (0);
+   }
+   __cpuidex (regs, 7, 0);
+   ebx = (unsigned int) regs[1];
+#else
+   unsigned int eax, edx, unused;
+
+   if (__get_cpuid_max (0, NULL) < 7) {
+      return 0;
+   }
+   __cpuid (1, eax, ebx, ecx, edx);
+   if (ecx & (1u << 27)) {
+      /* xgetbv, spelled out for compilers without the intrinsic */
+      __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a"(xcr0), "=d"(edx) : "c"(0));
+   }
+   __cpuid_count (7, 0, eax, ebx, unused, edx);
+#endif
+   /* SSSE3 (ECX bit 9) and SSE4.1 (ECX bit 19) of leaf 1, and the SHA
+    * extensions (EBX bit 29) of leaf 7 */
+   if ((ecx & (1u << 9)) && (ecx & (1u << 19)) && (ebx & (1u << 29))) {
+      features |= MONGOC_PBKDF2_CPU_SHANI;
+   }
+
+   /* the vector extensions also need the OS to save YMM (and for AVX-512,
+    * opmask and ZMM) registers, which OSXSAVE (ECX bit 27) and XCR0 say */
+   if ((ebx & (1u << 5)) && (xcr0 & 0x6) == 0x6) {
+      features |= MONGOC_PBKDF2_CPU_AVX2;
+   }
+
+   if ((ebx & (1u << 16)) && (xcr0 & 0xe6) == 0xe6) {
+      features |= MONGOC_PBKDF2_CPU_AVX512;
+   }
+
+   return features;
+}
+
+
+#define LANES_N 8
+#define LANES_VEC __m256i
+#define LANES_TARGET MONGOC_PBKDF2_AVX2_TARGET
+#define LANES_FN(_name) _name##_avx2
+#define LANES_LOAD(_p) _mm256_loadu_si256 ((const __m256i *) (_p))
+#define LANES_STORE(_p, _v) _mm256_storeu_si256 ((__m256i *) (_p), (_v))
+#define LANES_SET1(_x) _mm256_set1_epi32 ((int) (_x))
+#define LANES_ADD _mm256_add_epi32
+#define LANES_XOR _mm256_xor_si256
+#define LANES_AND _mm256_and_si256
+#define LANES_OR _mm256_or_si256
+#define LANES_ANDNOT _mm256_andnot_si256
+#define LANES_SHR _mm256_srli_epi32
+#define LANES_ROTL(_x, _n) \
+   _mm256_or_si256 (_mm256_slli_epi32 ((_x), (_n)), \
+                    _mm256_srli_epi32 ((_x), 32 - (_n)))
+#define LANES_ROTR(_x, _n) \
+   _mm256_or_si256 (_mm256_srli_epi32 ((_x), (_n)), \
+                    _mm256_slli_epi32 ((_x), 32 - (_n)))
+#include "mongoc-pbkdf2-lanes-private.h"
+#undef LANES_N
+#undef LANES_VEC
+#undef LANES_TARGET
+#undef LANES_FN
+#undef LANES_LOAD
+#undef LANES_STORE
+#undef LANES_SET1
+#undef LANES_ADD
+#undef LANES_XOR
+#undef LANES_AND
+#undef LANES_OR
+#undef LANES_ANDNOT
+#undef LANES_SHR
+#undef LANES_ROTL
+#undef LANES_ROTR
+
+/* with SHA-NI, eight AVX2 lanes only match eight single-buffer runs */
+static const mongoc_pbkdf2_lanes_t _mongoc_pbkdf2_avx2 = {
+   "avx2", 8, _hi_avx2, 9};
+
+#ifdef MONGOC_PBKDF2_AVX512
+#define LANES_N 16
+#define LANES_VEC __m512i
+#define LANES_TARGET MONGOC_PBKDF2_AVX512_TARGET
+#define LANES_FN(_name) _name##_avx512
+#define LANES_LOAD(_p) _mm512_loadu_si512 ((const void *) (_p))
+#define LANES_STORE(_p, _v) _mm512_storeu_si512 ((void *) (_p), (_v))
+#define LANES_SET1(_x) _mm512_set1_epi32 ((int) (_x))
+#define LANES_ADD _mm512_add_epi32
+#define LANES_XOR _mm512_xor_si512
+#define LANES_AND _mm512_and_si512
+#define LANES_OR _mm512_or_si512
+#define LANES_ANDNOT _mm512_andnot_si512
+#define LANES_SHR _mm512_srli_epi32
+#define LANES_ROTL _mm512_rol_epi32
+#define LANES_ROTR _mm512_ror_epi32
+#include "mongoc-pbkdf2-lanes-private.h"
+#undef LANES_N
+#undef LANES_VEC
+#undef LANES_TARGET
+#undef LANES_FN
+#undef LANES_LOAD
+#undef LANES_STORE
+#undef LANES_SET1
+#undef LANES_ADD
+#undef LANES_XOR
+#undef LANES_AND
+#undef LANES_OR
+#undef LANES_ANDNOT
+#undef LANES_SHR
+#undef LANES_ROTL
+#undef LANES_ROTR
+
+/* a full set of sixteen lanes is about twice as fast as SHA-NI */
+static const mongoc_pbkdf2_lanes_t _mongoc_pbkdf2_avx512 = {
+   "avx512", 16, _hi_avx512, 9};
+#endif /* MONGOC_PBKDF2_AVX512 */
+#endif /* MONGOC_PBKDF2_X86 */
+
+
+#ifdef MONGOC_PBKDF2_ARMV8
+/* the ARMv8 crypto extensions take state and message words in lane order */
+MONGOC_PBKDF2_ARMV8_TARGET static void
+_sha1_compress_armv8 (uint32x4_t *state_abcd, uint32_t *state_e, uint32x4_t m[4])
+{
+   static const uint32_t k[4] = {
+      0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6};
+   uint32x4_t abcd = *state_abcd;
+   uint32_t e = *state_e;
+   uint32_t next_e;
+   uint32x4_t tmp;
+   int g;
+
+   for (g = 0; g < 20; g++) {
+      tmp = vaddq_u32 (m[g % 4], vdupq_n_u32 (k[g / 5]));
+      next_e = vsha1h_u32 (vgetq_lane_u32 (abcd, 0));
+
+      if (g < 5) {
+         abcd = vsha1cq_u32 (abcd, e, tmp);
+      } else if (g < 10) {
+         abcd = vsha1pq_u32 (abcd, e, tmp);
+      } else if (g < 15) {
+         abcd = vsha1mq_u32 (abcd, e, tmp);
+      } else {
+         abcd = vsha1pq_u32 (abcd, e, tmp);
+      }
+
+      e = next_e;
+
+      if (g < 16) {
+         m[g % 4] = vsha1su1q_u32 (
+            vsha1su0q_u32 (m[g % 4], m[(g + 1) % 4], m[(g + 2) % 4]),
+            m[(g + 3) % 4]);
+      }
+   }
+
+   *state_abcd = vaddq_u32 (abcd, *state_abcd);
+   *state_e += e;
+}
+
+MONGOC_PBKDF2_ARMV8_TARGET static void
+_sha1_hi_armv8 (const uint32_t *istate,
+                const uint32_t *ostate,
+                uint32_t *u,
+                uint32_t *t,
+                uint32_t count)
+{
+   const uint32x4_t iabcd = vld1q_u32 (istate);
+   const uint32x4_t oabcd = vld1q_u32 (ostate);
+   const uint32x4_t zero = vdupq_n_u32 (0);
+   uint32x4_t uabcd = vld1q_u32 (u);
+   uint32_t ue = u[4];
+   uint32x4_t tabcd = vld1q_u32 (t);
+   uint32_t te = t[4];
+   uint32x4_t abcd;
+   uint32x4_t m[4];
+   uint32_t e;
+
+   while (count--) {
+      abcd = iabcd;
+      e = istate[4];
+      m[0] = uabcd;
+      m[1] = vsetq_lane_u32 (0x80000000, vsetq_lane_u32 (ue, zero, 0), 1);
+      m[2] = zero;
+      m[3] = vsetq_lane_u32 (SHA1_HI_BITS, zero, 3);
+      _sha1_compress_armv8 (&abcd, &e, m);
+
+      uabcd = oabcd;
+      ue = ostate[4];
+      m[0] = abcd;
+      m[1] = vsetq_lane_u32 (0x80000000, vsetq_lane_u32 (e, zero, 0), 1);
+      m[2] = zero;
+      m[3] = vsetq_lane_u32 (SHA1_HI_BITS, zero, 3);
+      _sha1_compress_armv8 (&uabcd, &ue, m);
+
+      tabcd = veorq_u32 (tabcd, uabcd);
+      te ^= ue;
+   }
+
+   vst1q_u32 (u, uabcd);
+   u[4] = ue;
+   vst1q_u32 (t, tabcd);
+   t[4] = te;
+}
+
+MONGOC_PBKDF2_ARMV8_TARGET static void
+_sha256_compress_armv8 (uint32x4_t *abcd, uint32x4_t *efgh, uint32x4_t m[4])
+{
+   uint32x4_t state0 = *abcd;
+   uint32x4_t state1 = *efgh;
+   uint32x4_t tmp, prev;
+   int g;
+
+   for (g = 0; g < 16; g++) {
+      tmp = vaddq_u32 (m[g % 4], vld1q_u32 (&_sha256_k[4 * g]));
+      prev = state0;
+      state0 = vsha256hq_u32 (state0, state1, tmp);
+      state1 = vsha256h2q_u32 (state1, prev, tmp);
+
+      if (g < 12) {
+         m[g % 4] =
+            vsha256su1q_u32 (vsha256su0q_u32 (m[g % 4], m[(g + 1) % 4]),
+                             m[(g + 2) % 4],
+                             m[(g + 3) % 4]);
+      }
+   }
+
+   *abcd = vaddq_u32 (state0, *abcd);
+   *efgh = vaddq_u32 (state1, *efgh);
+}
+
+MONGOC_PBKDF2_ARMV8_TARGET static void
+_sha256_hi_armv8 (const uint32_t *istate,
+                  const uint32_t *ostate,
+                  uint32_t *u,
+                  uint32_t *t,
+                  uint32_t count)
+{
+   const uint32x4_t i0 = vld1q_u32 (istate);
+   const uint32x4_t i1 = vld1q_u32 (istate + 4);
+   const uint32x4_t o0 = vld1q_u32 (ostate);
+   const uint32x4_t o1 = vld1q_u32 (ostate + 4);
+   const uint32x4_t zero = vdupq_n_u32 (0);
+   const uint32x4_t pad = vsetq_lane_u32 (0x80000000, zero, 0);
+   const uint32x4_t bits = vsetq_lane_u32 (SHA256_HI_BITS, zero, 3);
+   uint32x4_t u0 = vld1q_u32 (u);
+   uint32x4_t u1 = vld1q_u32 (u + 4);
+   uint32x4_t t0 = vld1q_u32 (t);
+   uint32x4_t t1 = vld1q_u32 (t + 4);
+   uint32x4_t s0, s1;
+   uint32x4_t m[4];
+
+   while (count--) {
+      s0 = i0;
+      s1 = i1;
+      m[0] = u0;
+      m[1] = u1;
+      m[2] = pad;
+      m[3] = bits;
+      _sha256_compress_armv8 (&s0, &s1, m);
+
+      u0 = o0;
+      u1 = o1;
+      m[0] = s0;
+      m[1] = s1;
+      m[2] = pad;
+      m[3] = bits;
+      _sha256_compress_armv8 (&u0, &u1, m);
+
+      t0 = veorq_u32 (t0, u0);
+      t1 = veorq_u32 (t1, u1);
+   }
+
+   vst1q_u32 (u, u0);
+   vst1q_u32 (u + 4, u1);
+   vst1q_u32 (t, t0);
+   vst1q_u32 (t + 4, t1);
+}
+
+static const mongoc_pbkdf2_impl_t _mongoc_pbkdf2_armv8 = {
+   "armv8-crypto", TRUE, _sha1_hi_armv8, _sha256_hi_armv8};
+
+static my_bool
+_mongoc_pbkdf2_have_armv8 (void)
+{
+#if defined(__APPLE__)
+   /* every 64-bit Apple ARM processor implements SHA-1 and SHA-256 */
+   return TRUE;
+#elif defined(__linux__)
+   unsigned long hwcap = getauxval (AT_HWCAP);
+
+   return (hwcap & HWCAP_SHA1) && (hwcap & HWCAP_SHA2);
+#else
+   return FALSE;
+#endif
+}
+#endif /* MONGOC_PBKDF2_ARMV8 */
+
+
+/* the CPU doesn't change under us, so racing threads all store the same
+ * pointers here */
+static const mongoc_pbkdf2_impl_t *_mongoc_pbkdf2_impl;
+static const mongoc_pbkdf2_lanes_t *_mongoc_pbkdf2_lanes_impl;
+
+static const mongoc_pbkdf2_impl_t *
+_mongoc_pbkdf2_select (void)
+{
+   const mongoc_pbkdf2_impl_t *impl = _mongoc_pbkdf2_impl;
+   const mongoc_pbkdf2_lanes_t *lanes = NULL;
+#ifdef MONGOC_PBKDF2_X86
+   int features;
+#endif
+
+   if (impl) {
+      return impl;
+   }
+
+   impl = &_mongoc_pbkdf2_portable;
+#if defined(MONGOC_PBKDF2_X86)
+   features = _mongoc_pbkdf2_x86_features ();
+   if (features & MONGOC_PBKDF2_CPU_SHANI) {
+      impl = &_mongoc_pbkdf2_shani;
+   }
+   if (features & MONGOC_PBKDF2_CPU_AVX2) {
+      lanes = &_mongoc_pbkdf2_avx2;
+   }
+#ifdef MONGOC_PBKDF2_AVX512
+   if (features & MONGOC_PBKDF2_CPU_AVX512) {
+      lanes = &_mongoc_pbkdf2_avx512;
+   }
+#endif
+#elif defined(MONGOC_PBKDF2_ARMV8)
+   if (_mongoc_pbkdf2_have_armv8 ()) {
+      impl = &_mongoc_pbkdf2_armv8;
+   }
+#endif
+
+   _mongoc_pbkdf2_lanes_impl = lanes;
+   _mongoc_pbkdf2_impl = impl;
+   return impl;
+}
+
+
+static void
+_mongoc_pbkdf2_load_block (uint32_t block[16], const uint8_t *bytes)
+{
+   int i;
+
+   for (i = 0; i < 16; i++) {
+      block[i] = ((uint32_t) bytes[4 * i] << 24) |
+                 ((uint32_t) bytes[4 * i + 1] << 16) |
+                 ((uint32_t) bytes[4 * i + 2] << 8) |
+                 (uint32_t) bytes[4 * i + 3];
+   }
+}
+
+static void
+_mongoc_pbkdf2_compress (mongoc_pbkdf2_t *pbkdf2,
+                         uint32_t *state,
+                         const uint32_t block[16])
+{
+   if (pbkdf2->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+      _sha1_compress (state, block);
+   } else {
+      _sha256_compress (state, block);
+   }
+}
+
+
+void
+_mongoc_pbkdf2_hash_init (mongoc_crypto_hash_algorithm_t algorithm,
+                          uint32_t state[8])
+{
+   if (algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+      memcpy (state, _sha1_iv, sizeof _sha1_iv);
+   } else {
+      memcpy (state, _sha256_iv, sizeof _sha256_iv);
+   }
+}
+
+
+void
+_mongoc_pbkdf2_hash_block (mongoc_crypto_hash_algorithm_t algorithm,
+                           uint32_t state[8],
+                           const uint8_t *bytes)
+{
+   uint32_t block[16];
+
+   _mongoc_pbkdf2_load_block (block, bytes);
+   if (algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+      _sha1_compress (state, block);
+   } else {
+      _sha256_compress (state, block);
+   }
+
+   memset (block, 0, sizeof block);
+}
+
+
+my_bool
+_mongoc_pbkdf2_init (mongoc_pbkdf2_t *pbkdf2,
+                     mongoc_crypto_hash_algorithm_t algorithm,
+                     const uint8_t *key,
+                     size_t key_len,
+                     const uint8_t *salt,
+                     size_t salt_len)
+{
+   uint8_t bytes[MONGOC_PBKDF2_BLOCK_SIZE];
+   uint32_t block[16];
+   uint32_t words;
+   size_t i;
+
+   /* the first block is salt + INT(1) + 0x80 + a 64-bit length */
+   if (key_len > MONGOC_PBKDF2_BLOCK_SIZE ||
+       salt_len + 4 + 1 + 8 > MONGOC_PBKDF2_BLOCK_SIZE) {
+      return FALSE;
+   }
+
+   memset (pbkdf2, 0, sizeof *pbkdf2);
+   pbkdf2->algorithm = algorithm;
+
+   if (algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+      words = 5;
+      memcpy (pbkdf2->istate, _sha1_iv, sizeof _sha1_iv);
+      memcpy (pbkdf2->ostate, _sha1_iv, sizeof _sha1_iv);
+   } else if (algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      words = 8;
+      memcpy (pbkdf2->istate, _sha256_iv, sizeof _sha256_iv);
+      memcpy (pbkdf2->ostate, _sha256_iv, sizeof _sha256_iv);
+   } else {
+      return FALSE;
+   }
+
+   /* HMAC midstates: H(IV, key ^ ipad) and H(IV, key ^ opad) */
+   memset (bytes, 0, sizeof bytes);
+   memcpy (bytes, key, key_len);
+   for (i = 0; i < sizeof bytes; i++) {
+      bytes[i] ^= 0x36;
+   }
+   _mongoc_pbkdf2_load_block (block, bytes);
+   _mongoc_pbkdf2_compress (pbkdf2, pbkdf2->istate, block);
+
+   for (i = 0; i < sizeof bytes; i++) {
+      bytes[i] ^= 0x36 ^ 0x5c;
+   }
+   _mongoc_pbkdf2_load_block (block, bytes);
+   _mongoc_pbkdf2_compress (pbkdf2, pbkdf2->ostate, block);
+
+   /* U1 = HMAC(key, salt + INT(1)) */
+   memset (bytes, 0, sizeof bytes);
+   memcpy (bytes, salt, salt_len);
+   bytes[salt_len + 3] = 1;
+   bytes[salt_len + 4] = 0x80;
+   _mongoc_pbkdf2_load_block (block, bytes);
+   block[15] = (uint32_t) ((MONGOC_PBKDF2_BLOCK_SIZE + salt_len + 4) * 8);
+   memcpy (pbkdf2->u, pbkdf2->istate, sizeof pbkdf2->u);
+   _mongoc_pbkdf2_compress (pbkdf2, pbkdf2->u, block);
+
+   memset (block, 0, sizeof block);
+   memcpy (block, pbkdf2->u, words * sizeof (uint32_t));
+   block[words] = 0x80000000;
+   block[15] = (uint32_t) ((MONGOC_PBKDF2_BLOCK_SIZE + words * 4) * 8);
+   memcpy (pbkdf2->u, pbkdf2->ostate, sizeof pbkdf2->u);
+   _mongoc_pbkdf2_compress (pbkdf2, pbkdf2->u, block);
+
+   memcpy (pbkdf2->t, pbkdf2->u, sizeof pbkdf2->t);
+   pbkdf2->iterations = 1;
+
+   memset (bytes, 0, sizeof bytes);
+   memset (block, 0, sizeof block);
+
+   return TRUE;
+}
+
+
+void
+_mongoc_pbkdf2_iterate (mongoc_pbkdf2_t *pbkdf2, uint32_t count)
+{
+   const mongoc_pbkdf2_impl_t *impl = _mongoc_pbkdf2_select ();
+
+   if (pbkdf2->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+      impl->sha1_hi (
+         pbkdf2->istate, pbkdf2->ostate, pbkdf2->u, pbkdf2->t, count);
+   } else {
+      impl->sha256_hi (
+         pbkdf2->istate, pbkdf2->ostate, pbkdf2->u, pbkdf2->t, count);
+   }
+
+   pbkdf2->iterations += count;
+}
+
+
+void
+_mongoc_pbkdf2_finish (mongoc_pbkdf2_t *pbkdf2, uint8_t *output)
+{
+   uint32_t words =
+      pbkdf2->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1 ? 5 : 8;
+   uint32_t i;
+
+   for (i = 0; i < words; i++) {
+      output[4 * i] = (uint8_t) (pbkdf2->t[i] >> 24);
+      output[4 * i + 1] = (uint8_t) (pbkdf2->t[i] >> 16);
+      output[4 * i + 2] = (uint8_t) (pbkdf2->t[i] >> 8);
+      output[4 * i + 3] = (uint8_t) pbkdf2->t[i];
+   }
+
+   memset (pbkdf2, 0, sizeof *pbkdf2);
+}
+
+
+/* kernels waiting in _mongoc_pbkdf2_run_batch, oldest first */
+static mongoc_mutex_t _mongoc_pbkdf2_batch_mutex = MONGOC_MUTEX_INITIALIZER;
+static mongoc_cond_t _mongoc_pbkdf2_batch_cond = MONGOC_COND_INITIALIZER;
+static mongoc_pbkdf2_t *_mongoc_pbkdf2_queue;
+static int _mongoc_pbkdf2_callers;
+/* callers waiting on the cond for a kernel to claim or one of theirs to
+ * finish */
+static int _mongoc_pbkdf2_sleepers;
+static int _mongoc_pbkdf2_cpus;
+
+/* iterations per claim, so kernels queued later get a lane soon */
+#define MONGOC_PBKDF2_BATCH_CHUNK 512
+
+static my_bool
+_mongoc_pbkdf2_batch_done (mongoc_pbkdf2_t **batch, size_t n)
+{
+   size_t i;
+
+   for (i = 0; i < n; i++) {
+      if (batch[i]->iterations < batch[i]->target) {
+         return FALSE;
+      }
+   }
+
+   return TRUE;
+}
+
+/* claims unclaimed kernels of the oldest waiting algorithm and returns how
+ * many; the caller holds the batch mutex. Each caller takes a fair share of
+ * what is waiting, so a few callers on many cores run in parallel and only
+ * callers outnumbering the cores fill up SIMD lanes. */
+static int
+_mongoc_pbkdf2_batch_claim (mongoc_pbkdf2_t **claimed, int max)
+{
+   mongoc_pbkdf2_t *pbkdf2;
+   int waiting = 0;
+   int workers;
+   int n = 0;
+
+   for (pbkdf2 = _mongoc_pbkdf2_queue; pbkdf2; pbkdf2 = pbkdf2->next) {
+      if (!pbkdf2->claimed) {
+         waiting++;
+      }
+   }
+
+   workers = _mongoc_pbkdf2_callers < _mongoc_pbkdf2_cpus
+                ? _mongoc_pbkdf2_callers
+                : _mongoc_pbkdf2_cpus;
+   if (workers > 1 && (waiting + workers - 1) / workers < max) {
+      max = (waiting + workers - 1) / workers;
+   }
+
+   for (pbkdf2 = _mongoc_pbkdf2_queue; pbkdf2 && n < max;
+        pbkdf2 = pbkdf2->next) {
+      if (!pbkdf2->claimed &&
+          (n == 0 || pbkdf2->algorithm == claimed[0]->algorithm)) {
+         pbkdf2->claimed = TRUE;
+         claimed[n++] = pbkdf2;
+      }
+   }
+
+   return n;
+}
+
+/* runs one chunk of the claimed kernels without holding the mutex */
+static void
+_mongoc_pbkdf2_batch_run (const mongoc_pbkdf2_impl_t *impl,
+                          const mongoc_pbkdf2_lanes_t *lanes,
+                          mongoc_pbkdf2_t **claimed,
+                          int n,
+                          uint32_t count)
+{
+   mongoc_pbkdf2_t padding[16];
+   mongoc_pbkdf2_t *lane[16];
+   int i;
+
+   if (lanes && n > 1 &&
+       (!impl->accelerated || n >= lanes->min_jobs_accelerated)) {
+      /* empty lanes repeat the first kernel's work into scratch copies */
+      for (i = 0; i < lanes->lanes; i++) {
+         if (i < n) {
+            lane[i] = claimed[i];
+         } else {
+            padding[i] = *claimed[0];
+            lane[i] = &padding[i];
+         }
+      }
+
+      lanes->hi (lane, count);
+
+      for (i = n; i < lanes->lanes; i++) {
+         memset (&padding[i], 0, sizeof padding[i]);
+      }
+
+      return;
+   }
+
+   for (i = 0; i < n; i++) {
+      if (claimed[i]->algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+         impl->sha1_hi (claimed[i]->istate,
+                        claimed[i]->ostate,
+                        claimed[i]->u,
+                        claimed[i]->t,
+                        count);
+      } else {
+         impl->sha256_hi (claimed[i]->istate,
+                          claimed[i]->ostate,
+                          claimed[i]->u,
+                          claimed[i]->t,
+                          count);
+      }
+   }
+}
+
+
+void
+_mongoc_pbkdf2_run_batch (mongoc_pbkdf2_t **batch,
+                          const uint32_t *iterations,
+                          size_t n)
+{
+   const mongoc_pbkdf2_impl_t *impl = _mongoc_pbkdf2_select ();
+   const mongoc_pbkdf2_lanes_t *lanes = _mongoc_pbkdf2_lanes_impl;
+   mongoc_pbkdf2_t *claimed[16];
+   mongoc_pbkdf2_t **tail;
+   uint32_t count;
+   size_t i;
+   my_bool finished;
+   int max = lanes ? lanes->lanes : 1;
+   int num_claimed;
+   int k;
+
+   mongoc_mutex_lock (&_mongoc_pbkdf2_batch_mutex);
+
+   if (!_mongoc_pbkdf2_cpus) {
+      _mongoc_pbkdf2_cpus = _mongoc_cpu_count ();
+   }
+
+   _mongoc_pbkdf2_callers++;
+
+   for (tail = &_mongoc_pbkdf2_queue; *tail; tail = &(*tail)->next) {
+   }
+
+   for (i = 0; i < n; i++) {
+      batch[i]->target = iterations[i];
+      batch[i]->claimed = FALSE;
+      batch[i]->next = NULL;
+
+      if (batch[i]->iterations < batch[i]->target) {
+         *tail = batch[i];
+         tail = &batch[i]->next;
+      }
+   }
+
+   while (!_mongoc_pbkdf2_batch_done (batch, n)) {
+      num_claimed = _mongoc_pbkdf2_batch_claim (claimed, max);
+
+      /* everything left, ours included, is being run by other callers */
+      if (!num_claimed) {
+         _mongoc_pbkdf2_sleepers++;
+         mongoc_cond_wait (&_mongoc_pbkdf2_batch_cond,
+                           &_mongoc_pbkdf2_batch_mutex);
+         _mongoc_pbkdf2_sleepers--;
+         continue;
+      }
+
+      count = MONGOC_PBKDF2_BATCH_CHUNK;
+      for (k = 0; k < num_claimed; k++) {
+         if (claimed[k]->target - claimed[k]->iterations < count) {
+            count = claimed[k]->target - claimed[k]->iterations;
+         }
+      }
+
+      mongoc_mutex_unlock (&_mongoc_pbkdf2_batch_mutex);
+      _mongoc_pbkdf2_batch_run (impl, lanes, claimed, num_claimed, count);
+      mongoc_mutex_lock (&_mongoc_pbkdf2_batch_mutex);
+
+      for (k = 0; k < num_claimed; k++) {
+         claimed[k]->iterations += count;
+         claimed[k]->claimed = FALSE;
+      }
+
+      /* unlink finished kernels and wake their owners. Sleepers are woken
+       * for the released claims too: we may return now that our kernels are
+       * done, or take back fewer than we released, and a sleeper's own
+       * kernel may be among those left unclaimed */
+      finished = FALSE;
+      for (tail = &_mongoc_pbkdf2_queue; *tail;) {
+         if ((*tail)->iterations >= (*tail)->target) {
+            *tail = (*tail)->next;
+            finished = TRUE;
+         } else {
+            tail = &(*tail)->next;
+         }
+      }
+
+      if (finished || (_mongoc_pbkdf2_sleepers && _mongoc_pbkdf2_queue)) {
+         mongoc_cond_broadcast (&_mongoc_pbkdf2_batch_cond);
+      }
+   }
+
+   _mongoc_pbkdf2_callers--;
+   mongoc_mutex_unlock (&_mongoc_pbkdf2_batch_mutex);
+}
+
+
+int
+_mongoc_pbkdf2_lanes (void)
+{
+   _mongoc_pbkdf2_select ();
+
+   return _mongoc_pbkdf2_lanes_impl ? _mongoc_pbkdf2_lanes_impl->lanes : 1;
+}
+
+
+my_bool
+_mongoc_pbkdf2_accelerated (void)
+{
+   return _mongoc_pbkdf2_select ()->accelerated;
+}
+
+
+const char *
+_mongoc_pbkdf2_implementation (void)
+{
+   return _mongoc_pbkdf2_select ()->name;
+}
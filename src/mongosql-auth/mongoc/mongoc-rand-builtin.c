@@ -0,0 +1,127 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+
+#ifdef MONGOC_ENABLE_CRYPTO_BUILTIN
+
+#include "mongoc-rand-private.h"
+
+/* random bytes straight from the operating system: getrandom () on Linux,
+ * arc4random_buf () on macOS and the BSDs, BCryptGenRandom () on Windows,
+ * and /dev/urandom wherever none of those is available */
+#if defined(_WIN32)
+#include <windows.h>
+#include <bcrypt.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || \
+   defined(__NetBSD__)
+#include <stdlib.h>
+#define MONGOC_RAND_ARC4RANDOM 1
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+#if !defined(_WIN32) && !defined(MONGOC_RAND_ARC4RANDOM)
+static int
+_mongoc_rand_urandom (uint8_t *buf, size_t num)
+{
+   ssize_t n;
+   int fd;
+
+   do {
+      fd = open ("/dev/urandom", O_RDONLY | O_CLOEXEC);
+   } while (fd < 0 && errno == EINTR);
+
+   if (fd < 0) {
+      return 0;
+   }
+
+   while (num) {
+      n = read (fd, buf, num);
+      if (n < 0 && errno == EINTR) {
+         continue;
+      }
+      if (n <= 0) {
+         close (fd);
+         return 0;
+      }
+      buf += n;
+      num -= (size_t) n;
+   }
+
+   close (fd);
+   return 1;
+}
+#endif
+
+int
+_mongoc_rand_bytes (uint8_t *buf, int num)
+{
+#if defined(_WIN32)
+   return BCRYPT_SUCCESS (BCryptGenRandom (
+      NULL, buf, (ULONG) num, BCRYPT_USE_SYSTEM_PREFERRED_RNG));
+#elif defined(MONGOC_RAND_ARC4RANDOM)
+   arc4random_buf (buf, (size_t) num);
+   return 1;
+#else
+#if defined(SYS_getrandom)
+   size_t left = (size_t) num;
+   long n;
+
+   /* the syscall, as libc only wraps it since glibc 2.25 */
+   while (left) {
+      n = syscall (SYS_getrandom, buf, left, 0);
+      if (n < 0 && errno == EINTR) {
+         continue;
+      }
+      if (n < 0) {
+         /* kernels before 3.17 don't have it */
+         return errno == ENOSYS && _mongoc_rand_urandom (buf, left);
+      }
+      buf += n;
+      left -= (size_t) n;
+   }
+
+   return 1;
+#else
+   return _mongoc_rand_urandom (buf, (size_t) num);
+#endif
+#endif
+}
+
+/* the operating system seeds itself, so these have nothing to do */
+void
+mongoc_rand_seed (const void *buf, int num)
+{
+}
+
+void
+mongoc_rand_add (const void *buf, int num, double entropy)
+{
+}
+
+int
+mongoc_rand_status (void)
+{
+   return 1;
+}
+
+#endif
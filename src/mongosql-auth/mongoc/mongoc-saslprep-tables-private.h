@@ -0,0 +1,5554 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by generate-saslprep-tables.py from Unicode 3.2, and 14.0.0
+ * for bidi classes; do not edit. */
+
+#ifndef MONGOC_SASLPREP_TABLES_PRIVATE_H
+#define MONGOC_SASLPREP_TABLES_PRIVATE_H
+
+#define MONGOC_SASLPREP_UNASSIGNED 0x01
+#define MONGOC_SASLPREP_MAP_TO_NOTHING 0x02
+#define MONGOC_SASLPREP_MAP_TO_SPACE 0x04
+#define MONGOC_SASLPREP_PROHIBITED 0x08
+#define MONGOC_SASLPREP_RAND_AL 0x10
+#define MONGOC_SASLPREP_L 0x20
+
+#define MONGOC_SASLPREP_PROPS_SHIFT 8
+
+static const uint8_t mongoc_saslprep_props_index[4352] = {
+   0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+   0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x01, 0x15, 0x16,
+   0x17, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+   0x1e, 0x1c, 0x1f, 0x20, 0x01, 0x1c, 0x1c, 0x08, 0x08, 0x08, 0x21, 0x22,
+   0x23, 0x24, 0x25, 0x26, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x28, 0x01, 0x01, 0x01, 0x01, 0x29, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2a,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x01, 0x2c, 0x2d,
+   0x2e, 0x2f, 0x30, 0x31, 0x08, 0x08, 0x08, 0x32, 0x33, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x34, 0x35, 0x08, 0x08,
+   0x36, 0x37, 0x38, 0x39, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x01, 0x01, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x3a,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x3a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a, 0x3d, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3a,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x3e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+   0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x3e,
+};
+
+static const uint8_t mongoc_saslprep_props_blocks[16128] = {
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x20, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x20, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x10,
+   0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x10, 0x01, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x18, 0x10, 0x00, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x00, 0x00, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00,
+   0x00, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20,
+   0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x00, 0x01, 0x20, 0x20,
+   0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x20, 0x01, 0x01, 0x20,
+   0x20, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x00, 0x00,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x01, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x01,
+   0x20, 0x20, 0x01, 0x01, 0x00, 0x01, 0x20, 0x20, 0x20, 0x00, 0x00, 0x01,
+   0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20,
+   0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x00, 0x00, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x20, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+   0x00, 0x20, 0x01, 0x20, 0x20, 0x00, 0x01, 0x01, 0x20, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20,
+   0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x00, 0x20, 0x20, 0x00,
+   0x20, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x01, 0x20,
+   0x20, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x20, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x00, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x01, 0x00, 0x00,
+   0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x01, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x00, 0x00,
+   0x00, 0x01, 0x00, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x01, 0x20, 0x01, 0x01, 0x20,
+   0x20, 0x01, 0x20, 0x01, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x01, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x01,
+   0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+   0x20, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+   0x00, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+   0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x01, 0x00, 0x00,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+   0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x08, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20,
+   0x01, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x00, 0x00, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x01, 0x04, 0x04, 0x04, 0x04,
+   0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x28, 0x18,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0a, 0x08, 0x08, 0x08,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x00, 0x20, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x01,
+   0x01, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+   0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x01, 0x10, 0x01, 0x10, 0x10, 0x01, 0x10, 0x10, 0x01, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01,
+   0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+   0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+   0x10, 0x01, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01,
+   0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x01, 0x01, 0x20, 0x01, 0x01, 0x20, 0x20, 0x01,
+   0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x01, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20,
+   0x20, 0x20, 0x20, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01,
+   0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+   0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x08, 0x08,
+};
+
+#define MONGOC_SASLPREP_CCC_SHIFT 8
+
+static const uint8_t mongoc_saslprep_ccc_index[4352] = {
+   0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x07, 0x08,
+   0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+   0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+   0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t mongoc_saslprep_ccc_blocks[5376] = {
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+   0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+   0xe6, 0xe8, 0xdc, 0xdc, 0xdc, 0xdc, 0xe8, 0xd8, 0xdc, 0xdc, 0xdc, 0xdc,
+   0xdc, 0xca, 0xca, 0xdc, 0xdc, 0xdc, 0xdc, 0xca, 0xca, 0xdc, 0xdc, 0xdc,
+   0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x01, 0x01, 0x01, 0x01,
+   0x01, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+   0xe6, 0xf0, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0xea, 0xea, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+   0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xde, 0xdc,
+   0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
+   0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xde, 0xe4, 0xe6, 0x0a, 0x0b, 0x0c, 0x0d,
+   0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x00, 0x14, 0x15, 0x16, 0x00, 0x17,
+   0x00, 0x18, 0x19, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+   0x20, 0x21, 0x22, 0xe6, 0xe6, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0xe6,
+   0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0x00, 0x00, 0xe6, 0xe6, 0x00, 0xdc, 0xe6,
+   0xe6, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xdc, 0xe6, 0xe6,
+   0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xdc, 0xdc, 0xe6, 0xdc, 0xe6,
+   0xe6, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6, 0xe6, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xe6, 0xdc, 0xe6,
+   0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x54, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x67, 0x67, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x76, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0xdc, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0xdc, 0x00, 0xd8, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x82, 0x00, 0x84, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x82, 0x00, 0xe6, 0xe6,
+   0x09, 0x00, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+   0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0x01, 0x01,
+   0xe6, 0xe6, 0xe6, 0xe6, 0x01, 0x01, 0x01, 0xe6, 0xe6, 0x00, 0x00, 0x00,
+   0x00, 0xe6, 0x00, 0x00, 0x00, 0x01, 0x01, 0xe6, 0xdc, 0xe6, 0x01, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0xda, 0xe4, 0xe8, 0xde, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0xd8, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xe2, 0xd8, 0xd8,
+   0xd8, 0xd8, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc,
+   0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x00, 0x00, 0xe6, 0xe6, 0xe6,
+   0xe6, 0xe6, 0xdc, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
+   0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#define MONGOC_SASLPREP_DECOMP_SHIFT 8
+
+static const uint8_t mongoc_saslprep_decomp_index[4352] = {
+   0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0a,
+   0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+   0x16, 0x07, 0x07, 0x07, 0x07, 0x07, 0x17, 0x07, 0x07, 0x07, 0x18, 0x19,
+   0x1a, 0x1b, 0x1c, 0x1d, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1e, 0x1f, 0x20,
+   0x21, 0x22, 0x23, 0x24, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x25, 0x07, 0x07,
+   0x26, 0x27, 0x28, 0x29, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x2a, 0x2b, 0x2c, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+   0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+};
+
+static const uint16_t mongoc_saslprep_decomp_blocks[11520] = {
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000, 0x0006,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000, 0x0000, 0x000b, 0x000d,
+   0x000f, 0x0012, 0x0000, 0x0000, 0x0014, 0x0017, 0x0019, 0x0000, 0x001b,
+   0x001f, 0x0023, 0x0000, 0x0027, 0x002a, 0x002d, 0x0030, 0x0033, 0x0036,
+   0x0000, 0x0039, 0x003c, 0x003f, 0x0042, 0x0045, 0x0048, 0x004b, 0x004e,
+   0x0051, 0x0000, 0x0054, 0x0057, 0x005a, 0x005d, 0x0060, 0x0063, 0x0000,
+   0x0000, 0x0066, 0x0069, 0x006c, 0x006f, 0x0072, 0x0000, 0x0000, 0x0075,
+   0x0078, 0x007b, 0x007e, 0x0081, 0x0084, 0x0000, 0x0087, 0x008a, 0x008d,
+   0x0090, 0x0093, 0x0096, 0x0099, 0x009c, 0x009f, 0x0000, 0x00a2, 0x00a5,
+   0x00a8, 0x00ab, 0x00ae, 0x00b1, 0x0000, 0x0000, 0x00b4, 0x00b7, 0x00ba,
+   0x00bd, 0x00c0, 0x0000, 0x00c3, 0x00c6, 0x00c9, 0x00cc, 0x00cf, 0x00d2,
+   0x00d5, 0x00d8, 0x00db, 0x00de, 0x00e1, 0x00e4, 0x00e7, 0x00ea, 0x00ed,
+   0x00f0, 0x00f3, 0x0000, 0x0000, 0x00f6, 0x00f9, 0x00fc, 0x00ff, 0x0102,
+   0x0105, 0x0108, 0x010b, 0x010e, 0x0111, 0x0114, 0x0117, 0x011a, 0x011d,
+   0x0120, 0x0123, 0x0126, 0x0129, 0x012c, 0x012f, 0x0000, 0x0000, 0x0132,
+   0x0135, 0x0138, 0x013b, 0x013e, 0x0141, 0x0144, 0x0147, 0x014a, 0x0000,
+   0x014d, 0x0150, 0x0153, 0x0156, 0x0159, 0x015c, 0x0000, 0x015f, 0x0162,
+   0x0165, 0x0168, 0x016b, 0x016e, 0x0171, 0x0174, 0x0000, 0x0000, 0x0177,
+   0x017a, 0x017d, 0x0180, 0x0183, 0x0186, 0x0189, 0x0000, 0x0000, 0x018c,
+   0x018f, 0x0192, 0x0195, 0x0198, 0x019b, 0x0000, 0x0000, 0x019e, 0x01a1,
+   0x01a4, 0x01a7, 0x01aa, 0x01ad, 0x01b0, 0x01b3, 0x01b6, 0x01b9, 0x01bc,
+   0x01bf, 0x01c2, 0x01c5, 0x01c8, 0x01cb, 0x01ce, 0x01d1, 0x0000, 0x0000,
+   0x01d4, 0x01d7, 0x01da, 0x01dd, 0x01e0, 0x01e3, 0x01e6, 0x01e9, 0x01ec,
+   0x01ef, 0x01f2, 0x01f5, 0x01f8, 0x01fb, 0x01fe, 0x0201, 0x0204, 0x0207,
+   0x020a, 0x020d, 0x0210, 0x0213, 0x0216, 0x0219, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x021b, 0x021e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0221,
+   0x0224, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0227, 0x022b, 0x022f, 0x0233, 0x0236, 0x0239, 0x023c,
+   0x023f, 0x0242, 0x0245, 0x0248, 0x024b, 0x024e, 0x0251, 0x0254, 0x0257,
+   0x025a, 0x025d, 0x0261, 0x0265, 0x0269, 0x026d, 0x0271, 0x0275, 0x0279,
+   0x0000, 0x027d, 0x0281, 0x0285, 0x0289, 0x028d, 0x0290, 0x0000, 0x0000,
+   0x0293, 0x0296, 0x0299, 0x029c, 0x029f, 0x02a2, 0x02a5, 0x02a9, 0x02ad,
+   0x02b0, 0x02b3, 0x02b6, 0x02b9, 0x02bc, 0x02bf, 0x02c2, 0x0000, 0x0000,
+   0x02c5, 0x02c8, 0x02cb, 0x02cf, 0x02d3, 0x02d6, 0x02d9, 0x02dc, 0x02df,
+   0x02e2, 0x02e5, 0x02e8, 0x02eb, 0x02ee, 0x02f1, 0x02f4, 0x02f7, 0x02fa,
+   0x02fd, 0x0300, 0x0303, 0x0306, 0x0309, 0x030c, 0x030f, 0x0312, 0x0315,
+   0x0318, 0x031b, 0x031e, 0x0321, 0x0324, 0x0327, 0x032a, 0x032d, 0x0330,
+   0x0000, 0x0000, 0x0333, 0x0336, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0339, 0x033c, 0x033f, 0x0342, 0x0345, 0x0349, 0x034d, 0x0351,
+   0x0355, 0x0358, 0x035b, 0x035f, 0x0363, 0x0366, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0369, 0x036b, 0x036d, 0x036f, 0x0371,
+   0x0373, 0x0375, 0x0377, 0x0379, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x037b,
+   0x037e, 0x0381, 0x0384, 0x0387, 0x038a, 0x0000, 0x0000, 0x038d, 0x038f,
+   0x0219, 0x0391, 0x0393, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0395, 0x0397, 0x0000, 0x0399, 0x039b,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x039e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a0,
+   0x0000, 0x0000, 0x0000, 0x03a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x000f, 0x03a5, 0x03a9, 0x03ac, 0x03ae, 0x03b1, 0x03b4, 0x0000, 0x03b7,
+   0x0000, 0x03ba, 0x03bd, 0x03c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x03c4, 0x03c7, 0x03ca, 0x03cd, 0x03d0, 0x03d3, 0x03d6,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03da, 0x03dd,
+   0x03e0, 0x03e3, 0x03e6, 0x0000, 0x03e9, 0x03eb, 0x03ed, 0x03ba, 0x03c7,
+   0x03ef, 0x03f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x03f3, 0x03f5, 0x03f7, 0x0000, 0x03f9, 0x03fb, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03fd, 0x0400,
+   0x0000, 0x0403, 0x0000, 0x0000, 0x0000, 0x0406, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0409, 0x040c, 0x040f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0412, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0415, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0418, 0x041b, 0x0000,
+   0x041e, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0424, 0x0427, 0x042a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x042d,
+   0x0430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0433, 0x0436, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0439,
+   0x043c, 0x043f, 0x0442, 0x0000, 0x0000, 0x0445, 0x0448, 0x0000, 0x0000,
+   0x044b, 0x044e, 0x0451, 0x0454, 0x0457, 0x045a, 0x0000, 0x0000, 0x045d,
+   0x0460, 0x0463, 0x0466, 0x0469, 0x046c, 0x0000, 0x0000, 0x046f, 0x0472,
+   0x0475, 0x0478, 0x047b, 0x047e, 0x0481, 0x0484, 0x0487, 0x048a, 0x048d,
+   0x0490, 0x0000, 0x0000, 0x0493, 0x0496, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0499, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x049c, 0x049f, 0x04a2, 0x04a5, 0x04a8,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ab, 0x04ae, 0x04b1,
+   0x04b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x04b7, 0x0000, 0x04ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x04bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x04c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x04c3, 0x0000, 0x0000, 0x04c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x04c9, 0x04cc, 0x04cf, 0x04d2, 0x04d5, 0x04d8,
+   0x04db, 0x04de, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x04e1, 0x04e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x04e7, 0x04ea, 0x0000, 0x04ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04f0, 0x0000, 0x0000,
+   0x04f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04f6,
+   0x04f9, 0x04fc, 0x0000, 0x0000, 0x04ff, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0502, 0x0000, 0x0000, 0x0505, 0x0508,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x050b, 0x050e, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0514,
+   0x0517, 0x051a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x051d,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0520, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0523, 0x0526, 0x0000, 0x0529, 0x052c, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0530, 0x0533, 0x0536, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0539, 0x0000, 0x053c, 0x053f,
+   0x0543, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0546, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0549, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x054c, 0x054f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0552, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0554, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0557, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x055a, 0x0000, 0x0000, 0x0000, 0x0000, 0x055d,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0560, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0563,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0566, 0x0000, 0x0569, 0x056c, 0x056f, 0x0573, 0x0576, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x057a, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x057d, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0580, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0583, 0x0000, 0x0000, 0x0000, 0x0000, 0x0586, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0589, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x058c, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x058f,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0592, 0x0595, 0x0598, 0x059b, 0x059e, 0x05a1, 0x05a4, 0x05a7,
+   0x05aa, 0x05ae, 0x05b2, 0x05b5, 0x05b8, 0x05bb, 0x05be, 0x05c1, 0x05c4,
+   0x05c7, 0x05ca, 0x05cd, 0x05d0, 0x05d4, 0x05d8, 0x05dc, 0x05e0, 0x05e3,
+   0x05e6, 0x05e9, 0x05ec, 0x05f0, 0x05f4, 0x05f7, 0x05fa, 0x05fd, 0x0600,
+   0x0603, 0x0606, 0x0609, 0x060c, 0x060f, 0x0612, 0x0615, 0x0618, 0x061b,
+   0x061e, 0x0621, 0x0624, 0x0628, 0x062c, 0x062f, 0x0632, 0x0635, 0x0638,
+   0x063b, 0x063e, 0x0641, 0x0644, 0x0648, 0x064c, 0x064f, 0x0652, 0x0655,
+   0x0658, 0x065b, 0x065e, 0x0661, 0x0664, 0x0667, 0x066a, 0x066d, 0x0670,
+   0x0673, 0x0676, 0x0679, 0x067c, 0x067f, 0x0682, 0x0686, 0x068a, 0x068e,
+   0x0692, 0x0696, 0x069a, 0x069e, 0x06a2, 0x06a5, 0x06a8, 0x06ab, 0x06ae,
+   0x06b1, 0x06b4, 0x06b7, 0x06ba, 0x06be, 0x06c2, 0x06c5, 0x06c8, 0x06cb,
+   0x06ce, 0x06d1, 0x06d4, 0x06d8, 0x06dc, 0x06e0, 0x06e4, 0x06e8, 0x06ec,
+   0x06ef, 0x06f2, 0x06f5, 0x06f8, 0x06fb, 0x06fe, 0x0701, 0x0704, 0x0707,
+   0x070a, 0x070d, 0x0710, 0x0713, 0x0716, 0x071a, 0x071e, 0x0722, 0x0726,
+   0x0729, 0x072c, 0x072f, 0x0732, 0x0735, 0x0738, 0x073b, 0x073e, 0x0741,
+   0x0744, 0x0747, 0x074a, 0x074d, 0x0750, 0x0753, 0x0756, 0x0759, 0x075c,
+   0x075f, 0x0762, 0x0765, 0x0768, 0x076b, 0x076e, 0x0771, 0x0774, 0x0777,
+   0x077a, 0x077d, 0x0780, 0x06cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0783,
+   0x0786, 0x0789, 0x078c, 0x078f, 0x0793, 0x0797, 0x079b, 0x079f, 0x07a3,
+   0x07a7, 0x07ab, 0x07af, 0x07b3, 0x07b7, 0x07bb, 0x07bf, 0x07c3, 0x07c7,
+   0x07cb, 0x07cf, 0x07d3, 0x07d7, 0x07db, 0x07df, 0x07e2, 0x07e5, 0x07e8,
+   0x07eb, 0x07ee, 0x07f1, 0x07f5, 0x07f9, 0x07fd, 0x0801, 0x0805, 0x0809,
+   0x080d, 0x0811, 0x0815, 0x0819, 0x081c, 0x081f, 0x0822, 0x0825, 0x0828,
+   0x082b, 0x082e, 0x0831, 0x0835, 0x0839, 0x083d, 0x0841, 0x0845, 0x0849,
+   0x084d, 0x0851, 0x0855, 0x0859, 0x085d, 0x0861, 0x0865, 0x0869, 0x086d,
+   0x0871, 0x0875, 0x0879, 0x087d, 0x0881, 0x0884, 0x0887, 0x088a, 0x088d,
+   0x0891, 0x0895, 0x0899, 0x089d, 0x08a1, 0x08a5, 0x08a9, 0x08ad, 0x08b1,
+   0x08b5, 0x08b8, 0x08bb, 0x08be, 0x08c1, 0x08c4, 0x08c7, 0x08ca, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08cd, 0x08d0, 0x08d3, 0x08d7,
+   0x08db, 0x08df, 0x08e3, 0x08e7, 0x08eb, 0x08ee, 0x08f1, 0x08f5, 0x08f9,
+   0x08fd, 0x0901, 0x0905, 0x0909, 0x090c, 0x090f, 0x0913, 0x0917, 0x091b,
+   0x0000, 0x0000, 0x091f, 0x0922, 0x0925, 0x0929, 0x092d, 0x0931, 0x0000,
+   0x0000, 0x0935, 0x0938, 0x093b, 0x093f, 0x0943, 0x0947, 0x094b, 0x094f,
+   0x0953, 0x0956, 0x0959, 0x095d, 0x0961, 0x0965, 0x0969, 0x096d, 0x0971,
+   0x0974, 0x0977, 0x097b, 0x097f, 0x0983, 0x0987, 0x098b, 0x098f, 0x0992,
+   0x0995, 0x0999, 0x099d, 0x09a1, 0x09a5, 0x09a9, 0x09ad, 0x09b0, 0x09b3,
+   0x09b7, 0x09bb, 0x09bf, 0x0000, 0x0000, 0x09c3, 0x09c6, 0x09c9, 0x09cd,
+   0x09d1, 0x09d5, 0x0000, 0x0000, 0x09d9, 0x09dc, 0x09df, 0x09e3, 0x09e7,
+   0x09eb, 0x09ef, 0x09f3, 0x0000, 0x09f7, 0x0000, 0x09fa, 0x0000, 0x09fe,
+   0x0000, 0x0a02, 0x0a06, 0x0a09, 0x0a0c, 0x0a10, 0x0a14, 0x0a18, 0x0a1c,
+   0x0a20, 0x0a24, 0x0a27, 0x0a2a, 0x0a2e, 0x0a32, 0x0a36, 0x0a3a, 0x0a3e,
+   0x0a42, 0x03ca, 0x0a45, 0x03cd, 0x0a48, 0x03d0, 0x0a4b, 0x03d3, 0x0a4e,
+   0x03e0, 0x0a51, 0x03e3, 0x0a54, 0x03e6, 0x0000, 0x0000, 0x0a57, 0x0a5b,
+   0x0a5f, 0x0a64, 0x0a69, 0x0a6e, 0x0a73, 0x0a78, 0x0a7d, 0x0a81, 0x0a85,
+   0x0a8a, 0x0a8f, 0x0a94, 0x0a99, 0x0a9e, 0x0aa3, 0x0aa7, 0x0aab, 0x0ab0,
+   0x0ab5, 0x0aba, 0x0abf, 0x0ac4, 0x0ac9, 0x0acd, 0x0ad1, 0x0ad6, 0x0adb,
+   0x0ae0, 0x0ae5, 0x0aea, 0x0aef, 0x0af3, 0x0af7, 0x0afc, 0x0b01, 0x0b06,
+   0x0b0b, 0x0b10, 0x0b15, 0x0b19, 0x0b1d, 0x0b22, 0x0b27, 0x0b2c, 0x0b31,
+   0x0b36, 0x0b3b, 0x0b3e, 0x0b41, 0x0b45, 0x0b48, 0x0000, 0x0b4c, 0x0b4f,
+   0x0b53, 0x0b56, 0x0b59, 0x03a9, 0x0b5c, 0x0b5f, 0x0b62, 0x0b5f, 0x0b64,
+   0x0b67, 0x0b6b, 0x0b6f, 0x0b72, 0x0000, 0x0b76, 0x0b79, 0x0b7d, 0x03ae,
+   0x0b80, 0x03b1, 0x0b83, 0x0b86, 0x0b8a, 0x0b8e, 0x0b92, 0x0b95, 0x0b98,
+   0x03c0, 0x0000, 0x0000, 0x0b9c, 0x0b9f, 0x0ba3, 0x0ba6, 0x0ba9, 0x03b4,
+   0x0000, 0x0bac, 0x0bb0, 0x0bb4, 0x0bb8, 0x0bbb, 0x0bbe, 0x03d6, 0x0bc2,
+   0x0bc5, 0x0bc8, 0x0bcb, 0x0bcf, 0x0bd2, 0x0bd5, 0x03ba, 0x0bd8, 0x0bdb,
+   0x03a5, 0x0bdf, 0x0000, 0x0000, 0x0be1, 0x0be5, 0x0be8, 0x0000, 0x0bec,
+   0x0bef, 0x0bf3, 0x03b7, 0x0bf6, 0x03bd, 0x0bf9, 0x000f, 0x0bfc, 0x0000,
+   0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+   0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bff,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c01, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0c04, 0x0c06, 0x0c09, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0c0d, 0x0c10, 0x0000,
+   0x0c14, 0x0c17, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c1b, 0x0000, 0x0c1e,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c21,
+   0x0c24, 0x0c27, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c2a, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0c2f, 0x0c31, 0x0000, 0x0000, 0x0c33,
+   0x0c35, 0x0c37, 0x0c39, 0x0c3b, 0x0c3d, 0x0c3f, 0x0c41, 0x0c43, 0x0c45,
+   0x0c47, 0x0c49, 0x0c2f, 0x0017, 0x000b, 0x000d, 0x0c33, 0x0c35, 0x0c37,
+   0x0c39, 0x0c3b, 0x0c3d, 0x0c3f, 0x0c41, 0x0c43, 0x0c45, 0x0c47, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c4b, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0c4e, 0x0c52, 0x0c56, 0x0c58, 0x0000,
+   0x0c5b, 0x0c5f, 0x0c63, 0x0000, 0x0c65, 0x0c68, 0x0c6a, 0x0c6a, 0x0c6a,
+   0x0369, 0x0c6c, 0x0c6e, 0x0c6e, 0x0c70, 0x038f, 0x0000, 0x0c72, 0x0c74,
+   0x0000, 0x0000, 0x0c77, 0x0c79, 0x0c7b, 0x0c7b, 0x0c7b, 0x0000, 0x0000,
+   0x0c7d, 0x0c80, 0x0c84, 0x0000, 0x0c87, 0x0000, 0x0c89, 0x0000, 0x0c87,
+   0x0000, 0x0c8b, 0x0036, 0x0c8d, 0x0c56, 0x0000, 0x0c8f, 0x0c91, 0x0c93,
+   0x0000, 0x0c95, 0x0019, 0x0c97, 0x0c99, 0x0c9b, 0x0c9d, 0x0c31, 0x0000,
+   0x0000, 0x0000, 0x0c9f, 0x0ca1, 0x0ca3, 0x0ca5, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0ca7, 0x0ca9, 0x0c8f, 0x0c31, 0x036d, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cab, 0x0caf, 0x0cb3,
+   0x0cb7, 0x0cbb, 0x0cbf, 0x0cc3, 0x0cc7, 0x0ccb, 0x0ccf, 0x0cd3, 0x0cd7,
+   0x0cdb, 0x0c6e, 0x0cde, 0x0ce1, 0x0ce5, 0x0ce8, 0x0cea, 0x0ced, 0x0cf1,
+   0x0cf6, 0x0cf9, 0x0cfb, 0x0cfe, 0x0c70, 0x0c56, 0x0ca7, 0x0c95, 0x0c31,
+   0x0d02, 0x0d05, 0x0d09, 0x0d0c, 0x0d0e, 0x0d11, 0x0d15, 0x0d1a, 0x0391,
+   0x0d1d, 0x0d20, 0x038f, 0x0d24, 0x0ca9, 0x0d26, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d28, 0x0d2b, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d2e, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0d31, 0x0d34, 0x0d37, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0d3a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d3d,
+   0x0000, 0x0000, 0x0d40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d43,
+   0x0000, 0x0d46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d49, 0x0d4c,
+   0x0000, 0x0d50, 0x0d53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0d57, 0x0000, 0x0000, 0x0d5a, 0x0000, 0x0000, 0x0d5d, 0x0000,
+   0x0d60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d63, 0x0000, 0x0d66, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0d69, 0x0d6c, 0x0d6f, 0x0d72, 0x0d75, 0x0000, 0x0000, 0x0d78, 0x0d7b,
+   0x0000, 0x0000, 0x0d7e, 0x0d81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0d84, 0x0d87, 0x0000, 0x0000, 0x0d8a, 0x0d8d, 0x0000, 0x0000,
+   0x0d90, 0x0d93, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0d96, 0x0d99, 0x0d9c, 0x0d9f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0da2, 0x0da5,
+   0x0da8, 0x0dab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0dae,
+   0x0db1, 0x0db4, 0x0db7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0dba,
+   0x0dbc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0017, 0x000b, 0x000d, 0x0c33, 0x0c35,
+   0x0c37, 0x0c39, 0x0c3b, 0x0c3d, 0x0dbe, 0x0dc1, 0x0dc4, 0x0dc7, 0x0dca,
+   0x0dcd, 0x0dd0, 0x0dd3, 0x0dd6, 0x0dd9, 0x0ddc, 0x0ddf, 0x0de3, 0x0de7,
+   0x0deb, 0x0def, 0x0df3, 0x0df7, 0x0dfb, 0x0dff, 0x0e03, 0x0e08, 0x0e0d,
+   0x0e12, 0x0e17, 0x0e1c, 0x0e21, 0x0e26, 0x0e2b, 0x0e30, 0x0e35, 0x0e3a,
+   0x0e3d, 0x0e40, 0x0e43, 0x0e46, 0x0e49, 0x0e4c, 0x0e4f, 0x0e52, 0x0e55,
+   0x0e59, 0x0e5d, 0x0e61, 0x0e65, 0x0e69, 0x0e6d, 0x0e71, 0x0e75, 0x0e79,
+   0x0e7d, 0x0e81, 0x0e85, 0x0e89, 0x0e8d, 0x0e91, 0x0e95, 0x0e99, 0x0e9d,
+   0x0ea1, 0x0ea5, 0x0ea9, 0x0ead, 0x0eb1, 0x0eb5, 0x0eb9, 0x0ebd, 0x0ec1,
+   0x0ec5, 0x0ec9, 0x0ecd, 0x0ed1, 0x0ed5, 0x0ed9, 0x0edd, 0x0ee1, 0x0ee5,
+   0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e,
+   0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b,
+   0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x0006,
+   0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d,
+   0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219,
+   0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09, 0x0c2f, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f0b, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0f10, 0x0f14, 0x0f17, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f1b, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0f1e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f20, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0f22, 0x0f24, 0x0f26, 0x0f28, 0x0f2a, 0x0f2c, 0x0f2e, 0x0f30,
+   0x0f32, 0x0f34, 0x0f36, 0x0f38, 0x0f3a, 0x0f3c, 0x0f3e, 0x0f40, 0x0f42,
+   0x0f44, 0x0f46, 0x0f48, 0x0f4a, 0x0f4c, 0x0f4e, 0x0f50, 0x0f52, 0x0f54,
+   0x0f56, 0x0f58, 0x0f5a, 0x0f5c, 0x0f5e, 0x0f60, 0x0f62, 0x0f64, 0x0f66,
+   0x0f68, 0x0f6a, 0x0f6c, 0x0f6e, 0x0f70, 0x0f72, 0x0f74, 0x0f76, 0x0f78,
+   0x0f7a, 0x0f7c, 0x0f7e, 0x0f80, 0x0f82, 0x0f84, 0x0f86, 0x0f88, 0x0f8a,
+   0x0f8c, 0x0f8e, 0x0f90, 0x0f92, 0x0f94, 0x0f96, 0x0f98, 0x0f9a, 0x0f9c,
+   0x0f9e, 0x0fa0, 0x0fa2, 0x0fa4, 0x0fa6, 0x0fa8, 0x0faa, 0x0fac, 0x0fae,
+   0x0fb0, 0x0fb2, 0x0fb4, 0x0fb6, 0x0fb8, 0x0fba, 0x0fbc, 0x0fbe, 0x0fc0,
+   0x0fc2, 0x0fc4, 0x0fc6, 0x0fc8, 0x0fca, 0x0fcc, 0x0fce, 0x0fd0, 0x0fd2,
+   0x0fd4, 0x0fd6, 0x0fd8, 0x0fda, 0x0fdc, 0x0fde, 0x0fe0, 0x0fe2, 0x0fe4,
+   0x0fe6, 0x0fe8, 0x0fea, 0x0fec, 0x0fee, 0x0ff0, 0x0ff2, 0x0ff4, 0x0ff6,
+   0x0ff8, 0x0ffa, 0x0ffc, 0x0ffe, 0x1000, 0x1002, 0x1004, 0x1006, 0x1008,
+   0x100a, 0x100c, 0x100e, 0x1010, 0x1012, 0x1014, 0x1016, 0x1018, 0x101a,
+   0x101c, 0x101e, 0x1020, 0x1022, 0x1024, 0x1026, 0x1028, 0x102a, 0x102c,
+   0x102e, 0x1030, 0x1032, 0x1034, 0x1036, 0x1038, 0x103a, 0x103c, 0x103e,
+   0x1040, 0x1042, 0x1044, 0x1046, 0x1048, 0x104a, 0x104c, 0x104e, 0x1050,
+   0x1052, 0x1054, 0x1056, 0x1058, 0x105a, 0x105c, 0x105e, 0x1060, 0x1062,
+   0x1064, 0x1066, 0x1068, 0x106a, 0x106c, 0x106e, 0x1070, 0x1072, 0x1074,
+   0x1076, 0x1078, 0x107a, 0x107c, 0x107e, 0x1080, 0x1082, 0x1084, 0x1086,
+   0x1088, 0x108a, 0x108c, 0x108e, 0x1090, 0x1092, 0x1094, 0x1096, 0x1098,
+   0x109a, 0x109c, 0x109e, 0x10a0, 0x10a2, 0x10a4, 0x10a6, 0x10a8, 0x10aa,
+   0x10ac, 0x10ae, 0x10b0, 0x10b2, 0x10b4, 0x10b6, 0x10b8, 0x10ba, 0x10bc,
+   0x10be, 0x10c0, 0x10c2, 0x10c4, 0x10c6, 0x10c8, 0x10ca, 0x10cc, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10ce, 0x0000, 0x0f50, 0x10d0,
+   0x10d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x10d4, 0x0000, 0x10d7, 0x0000, 0x10da, 0x0000, 0x10dd, 0x0000, 0x10e0,
+   0x0000, 0x10e3, 0x0000, 0x10e6, 0x0000, 0x10e9, 0x0000, 0x10ec, 0x0000,
+   0x10ef, 0x0000, 0x10f2, 0x0000, 0x10f5, 0x0000, 0x0000, 0x10f8, 0x0000,
+   0x10fb, 0x0000, 0x10fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x1101, 0x1104, 0x0000, 0x1107, 0x110a, 0x0000, 0x110d, 0x1110, 0x0000,
+   0x1113, 0x1116, 0x0000, 0x1119, 0x111c, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x111f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1122, 0x1125,
+   0x0000, 0x1128, 0x112b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x112e, 0x0000, 0x1131,
+   0x0000, 0x1134, 0x0000, 0x1137, 0x0000, 0x113a, 0x0000, 0x113d, 0x0000,
+   0x1140, 0x0000, 0x1143, 0x0000, 0x1146, 0x0000, 0x1149, 0x0000, 0x114c,
+   0x0000, 0x114f, 0x0000, 0x0000, 0x1152, 0x0000, 0x1155, 0x0000, 0x1158,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x115b, 0x115e, 0x0000,
+   0x1161, 0x1164, 0x0000, 0x1167, 0x116a, 0x0000, 0x116d, 0x1170, 0x0000,
+   0x1173, 0x1176, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1179, 0x0000, 0x0000,
+   0x117c, 0x117f, 0x1182, 0x1185, 0x0000, 0x0000, 0x0000, 0x1188, 0x118b,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x118e, 0x1190, 0x1192, 0x1194, 0x1196,
+   0x1198, 0x119a, 0x119c, 0x119e, 0x11a0, 0x11a2, 0x11a4, 0x11a6, 0x11a8,
+   0x11aa, 0x11ac, 0x11ae, 0x11b0, 0x11b2, 0x11b4, 0x11b6, 0x11b8, 0x11ba,
+   0x11bc, 0x11be, 0x11c0, 0x11c2, 0x11c4, 0x11c6, 0x11c8, 0x11ca, 0x11cc,
+   0x11ce, 0x11d0, 0x11d2, 0x11d4, 0x11d6, 0x11d8, 0x11da, 0x11dc, 0x11de,
+   0x11e0, 0x11e2, 0x11e4, 0x11e6, 0x11e8, 0x11ea, 0x11ec, 0x11ee, 0x11f0,
+   0x11f2, 0x11f4, 0x11f6, 0x11f8, 0x11fa, 0x11fc, 0x11fe, 0x1200, 0x1202,
+   0x1204, 0x1206, 0x1208, 0x120a, 0x120c, 0x120e, 0x1210, 0x1212, 0x1214,
+   0x1216, 0x1218, 0x121a, 0x121c, 0x121e, 0x1220, 0x1222, 0x1224, 0x1226,
+   0x1228, 0x122a, 0x122c, 0x122e, 0x1230, 0x1232, 0x1234, 0x1236, 0x1238,
+   0x123a, 0x123c, 0x123e, 0x1240, 0x1242, 0x1244, 0x1246, 0x1248, 0x0000,
+   0x0000, 0x0000, 0x0f22, 0x0f2e, 0x124a, 0x124c, 0x124e, 0x1250, 0x1252,
+   0x1254, 0x0f2a, 0x1256, 0x1258, 0x125a, 0x125c, 0x0f32, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x125e, 0x1262, 0x1266, 0x126a, 0x126e,
+   0x1272, 0x1276, 0x127a, 0x127e, 0x1282, 0x1286, 0x128a, 0x128e, 0x1292,
+   0x1296, 0x129b, 0x12a0, 0x12a5, 0x12aa, 0x12af, 0x12b4, 0x12b9, 0x12be,
+   0x12c3, 0x12c8, 0x12cd, 0x12d2, 0x12d7, 0x12dc, 0x0000, 0x0000, 0x0000,
+   0x12e1, 0x12e5, 0x12e9, 0x12ed, 0x12f1, 0x12f5, 0x12f9, 0x12fd, 0x1301,
+   0x1305, 0x1309, 0x130d, 0x1311, 0x1315, 0x1319, 0x131d, 0x1321, 0x1325,
+   0x1329, 0x132d, 0x1331, 0x1335, 0x1339, 0x133d, 0x1341, 0x1345, 0x1349,
+   0x134d, 0x1351, 0x1355, 0x1359, 0x135d, 0x1361, 0x1365, 0x1369, 0x136d,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x1371, 0x1374, 0x1377, 0x137a, 0x137d,
+   0x1380, 0x1383, 0x1386, 0x1389, 0x138c, 0x138f, 0x1392, 0x1395, 0x1398,
+   0x139b, 0x118e, 0x1194, 0x119a, 0x119e, 0x11ae, 0x11b0, 0x11b6, 0x11ba,
+   0x11bc, 0x11c0, 0x11c2, 0x11c4, 0x11c6, 0x11c8, 0x139e, 0x13a1, 0x13a4,
+   0x13a7, 0x13aa, 0x13ad, 0x13b0, 0x13b3, 0x13b6, 0x13b9, 0x13bc, 0x13bf,
+   0x13c2, 0x13c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f22, 0x0f2e, 0x124a,
+   0x124c, 0x13c8, 0x13ca, 0x13cc, 0x0f38, 0x13ce, 0x0f50, 0x0fb4, 0x0fcc,
+   0x0fca, 0x0fb6, 0x106e, 0x0f60, 0x0fb0, 0x13d0, 0x13d2, 0x13d4, 0x13d6,
+   0x13d8, 0x13da, 0x13dc, 0x13de, 0x13e0, 0x13e2, 0x0f6c, 0x13e4, 0x13e6,
+   0x13e8, 0x13ea, 0x13ec, 0x13ee, 0x13f0, 0x13f2, 0x124e, 0x1250, 0x1252,
+   0x13f4, 0x13f6, 0x13f8, 0x13fa, 0x13fc, 0x13fe, 0x1400, 0x1402, 0x1404,
+   0x1406, 0x1408, 0x140b, 0x140e, 0x1411, 0x1414, 0x1417, 0x141a, 0x141d,
+   0x1420, 0x1423, 0x1426, 0x1429, 0x142c, 0x142f, 0x1432, 0x1435, 0x1438,
+   0x143b, 0x143e, 0x1441, 0x1444, 0x1447, 0x144a, 0x144d, 0x1450, 0x1454,
+   0x1458, 0x0000, 0x0000, 0x0000, 0x0000, 0x145c, 0x145e, 0x1460, 0x1462,
+   0x1464, 0x1466, 0x1468, 0x146a, 0x146c, 0x146e, 0x1470, 0x1472, 0x1474,
+   0x1476, 0x1478, 0x147a, 0x147c, 0x147e, 0x1480, 0x1482, 0x1484, 0x1486,
+   0x1488, 0x148a, 0x148c, 0x148e, 0x1490, 0x1492, 0x1494, 0x1496, 0x1498,
+   0x149a, 0x149c, 0x149e, 0x14a0, 0x14a2, 0x14a4, 0x14a6, 0x14a8, 0x14aa,
+   0x14ac, 0x14ae, 0x14b0, 0x14b2, 0x14b4, 0x14b6, 0x14b8, 0x0000, 0x14ba,
+   0x14c0, 0x14c5, 0x14cb, 0x14cf, 0x14d5, 0x14d9, 0x14dd, 0x14e4, 0x14e9,
+   0x14ed, 0x14f1, 0x14f5, 0x14fa, 0x14ff, 0x1504, 0x1509, 0x150e, 0x1513,
+   0x1518, 0x151f, 0x1522, 0x1529, 0x1530, 0x1536, 0x153b, 0x1542, 0x1549,
+   0x154e, 0x1552, 0x1556, 0x155b, 0x1560, 0x1566, 0x156c, 0x1570, 0x1574,
+   0x1579, 0x157d, 0x1581, 0x1584, 0x1587, 0x158b, 0x158f, 0x1596, 0x159b,
+   0x15a1, 0x15a8, 0x15ad, 0x15b1, 0x15b5, 0x15bc, 0x15c1, 0x15c8, 0x15cc,
+   0x15d2, 0x15d6, 0x15db, 0x15df, 0x15e4, 0x15ea, 0x15ef, 0x15f5, 0x15fa,
+   0x15fd, 0x1603, 0x1607, 0x160b, 0x1610, 0x1614, 0x1618, 0x161c, 0x1622,
+   0x1627, 0x162a, 0x1631, 0x1635, 0x163b, 0x1640, 0x1645, 0x1649, 0x164d,
+   0x1652, 0x1655, 0x165a, 0x1660, 0x1663, 0x166a, 0x166e, 0x1671, 0x1674,
+   0x1677, 0x167a, 0x167d, 0x1680, 0x1683, 0x1686, 0x1689, 0x168c, 0x1690,
+   0x1694, 0x1698, 0x169c, 0x16a0, 0x16a4, 0x16a8, 0x16ac, 0x16b0, 0x16b4,
+   0x16b8, 0x16bc, 0x16c0, 0x16c4, 0x16c8, 0x16cc, 0x16cf, 0x16d2, 0x16d6,
+   0x16d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x16dc, 0x16df, 0x16e2, 0x16e5,
+   0x16e8, 0x16ed, 0x16f0, 0x16f3, 0x16f6, 0x16f9, 0x16fc, 0x16ff, 0x1702,
+   0x1705, 0x1709, 0x170e, 0x1711, 0x1714, 0x1717, 0x171a, 0x171d, 0x1720,
+   0x1723, 0x1727, 0x172b, 0x172f, 0x1733, 0x1736, 0x1739, 0x173c, 0x173f,
+   0x1742, 0x1745, 0x1748, 0x174b, 0x174e, 0x1751, 0x1755, 0x1759, 0x175c,
+   0x1760, 0x1764, 0x1768, 0x176b, 0x176f, 0x1773, 0x1778, 0x177b, 0x177f,
+   0x1783, 0x1787, 0x178b, 0x1791, 0x1798, 0x179b, 0x179e, 0x17a1, 0x17a4,
+   0x17a7, 0x17aa, 0x17ad, 0x17b0, 0x17b3, 0x17b6, 0x17b9, 0x17bc, 0x17bf,
+   0x17c2, 0x17c5, 0x17c8, 0x17cb, 0x17ce, 0x17d3, 0x17d6, 0x17d9, 0x17dc,
+   0x17e1, 0x17e5, 0x17e8, 0x17eb, 0x17ee, 0x17f1, 0x17f4, 0x17f7, 0x17fa,
+   0x17fd, 0x1800, 0x1803, 0x1807, 0x180a, 0x180d, 0x1811, 0x1815, 0x1818,
+   0x181d, 0x1821, 0x1824, 0x1827, 0x182a, 0x0000, 0x0000, 0x182d, 0x1830,
+   0x1833, 0x1836, 0x1839, 0x183c, 0x183f, 0x1842, 0x1845, 0x1848, 0x184c,
+   0x1850, 0x1854, 0x1858, 0x185c, 0x1860, 0x1864, 0x1868, 0x186c, 0x1870,
+   0x1874, 0x1878, 0x187c, 0x1880, 0x1884, 0x1888, 0x188c, 0x1890, 0x1894,
+   0x1898, 0x189c, 0x0000, 0x18a0, 0x18a2, 0x105e, 0x18a4, 0x18a6, 0x18a8,
+   0x18aa, 0x10ca, 0x10ca, 0x18ac, 0x106e, 0x18ae, 0x18b0, 0x18b2, 0x18b4,
+   0x18b6, 0x18b8, 0x18ba, 0x18bc, 0x18be, 0x18c0, 0x18c2, 0x18c4, 0x18c6,
+   0x18c8, 0x18ca, 0x18cc, 0x18ce, 0x18d0, 0x18d2, 0x18d4, 0x18d6, 0x18d8,
+   0x18da, 0x18dc, 0x18de, 0x18e0, 0x18e2, 0x18e4, 0x18e6, 0x18e8, 0x18ea,
+   0x18ec, 0x18ee, 0x18f0, 0x18f2, 0x18f4, 0x18f6, 0x18f8, 0x18fa, 0x18fc,
+   0x18fe, 0x101a, 0x1900, 0x1902, 0x1904, 0x1906, 0x1908, 0x190a, 0x190c,
+   0x190e, 0x1910, 0x1912, 0x1914, 0x10ac, 0x1916, 0x1918, 0x191a, 0x191c,
+   0x191e, 0x1920, 0x1922, 0x1924, 0x1926, 0x1928, 0x192a, 0x192c, 0x192e,
+   0x1930, 0x1932, 0x1934, 0x1936, 0x1938, 0x193a, 0x193c, 0x193e, 0x1940,
+   0x1942, 0x1944, 0x1946, 0x1948, 0x194a, 0x18c0, 0x194c, 0x194e, 0x1950,
+   0x1952, 0x1954, 0x1956, 0x1958, 0x195a, 0x195c, 0x195e, 0x1960, 0x1962,
+   0x1964, 0x1966, 0x1968, 0x196a, 0x196c, 0x196e, 0x1970, 0x1972, 0x1062,
+   0x1974, 0x1976, 0x1978, 0x197a, 0x197c, 0x197e, 0x1980, 0x1982, 0x1984,
+   0x1986, 0x1988, 0x198a, 0x198c, 0x198e, 0x1990, 0x0f6c, 0x1992, 0x1994,
+   0x1996, 0x1998, 0x199a, 0x199c, 0x199e, 0x19a0, 0x0f46, 0x19a2, 0x19a4,
+   0x19a6, 0x19a8, 0x19aa, 0x19ac, 0x19ae, 0x19b0, 0x19b2, 0x19b4, 0x19b6,
+   0x19b8, 0x19ba, 0x19bc, 0x19be, 0x19c0, 0x19c2, 0x19c4, 0x19c6, 0x19c8,
+   0x19ca, 0x19cc, 0x1970, 0x19ce, 0x19d0, 0x19d2, 0x19d4, 0x19d6, 0x19d8,
+   0x19da, 0x19dc, 0x1950, 0x19de, 0x19e0, 0x19e2, 0x19e4, 0x19e6, 0x19e8,
+   0x19ea, 0x19ec, 0x19ee, 0x19f0, 0x19f2, 0x19f4, 0x19f6, 0x19f8, 0x19fa,
+   0x19fc, 0x19fe, 0x1a00, 0x1a02, 0x1a04, 0x18c0, 0x1a06, 0x1a08, 0x1a0a,
+   0x1a0c, 0x10c8, 0x1a0e, 0x1a10, 0x1a12, 0x1a14, 0x1a16, 0x1a18, 0x1a1a,
+   0x1a1c, 0x1a1e, 0x1a20, 0x1a22, 0x1a24, 0x13ca, 0x1a26, 0x1a28, 0x1a2a,
+   0x1a2c, 0x1a2e, 0x1a30, 0x1a32, 0x1a34, 0x1a36, 0x1954, 0x1a38, 0x1a3a,
+   0x1a3c, 0x1a3e, 0x1a40, 0x1a42, 0x1a44, 0x1a46, 0x1a48, 0x1a4a, 0x1a4c,
+   0x1a4e, 0x1a50, 0x106c, 0x1a52, 0x1a54, 0x1a56, 0x1a58, 0x1a5a, 0x1a5c,
+   0x1a5e, 0x1a60, 0x1a62, 0x1a64, 0x1a66, 0x1a68, 0x1a6a, 0x100a, 0x1a6c,
+   0x1a6e, 0x1a70, 0x1a72, 0x1a74, 0x1a76, 0x1a78, 0x1a7a, 0x1a7c, 0x1a7e,
+   0x1a80, 0x1a82, 0x1a84, 0x1a86, 0x1a88, 0x1a8a, 0x1040, 0x1a8c, 0x1046,
+   0x1a8e, 0x1a90, 0x1a92, 0x0000, 0x0000, 0x1a94, 0x0000, 0x1a96, 0x0000,
+   0x0000, 0x1a98, 0x1a9a, 0x1a9c, 0x1a9e, 0x1aa0, 0x1aa2, 0x1aa4, 0x1aa6,
+   0x1aa8, 0x1018, 0x0000, 0x1aaa, 0x0000, 0x1aac, 0x0000, 0x0000, 0x1aae,
+   0x1ab0, 0x0000, 0x0000, 0x0000, 0x1ab2, 0x1ab4, 0x1ab6, 0x1ab8, 0x0000,
+   0x0000, 0x1aba, 0x1abc, 0x1abe, 0x1ac0, 0x1ac2, 0x1ac4, 0x1ac6, 0x1ac8,
+   0x1aca, 0x1acc, 0x1ace, 0x1ad0, 0x0f7a, 0x1ad2, 0x1ad4, 0x1ad6, 0x1ad8,
+   0x1ada, 0x1adc, 0x1ade, 0x1ae0, 0x1ae2, 0x1ae4, 0x1ae6, 0x1ae8, 0x1aea,
+   0x1aec, 0x1aee, 0x13d4, 0x1af0, 0x1af2, 0x1af4, 0x1af6, 0x13dc, 0x1af8,
+   0x1afa, 0x1afc, 0x1afe, 0x1b00, 0x19b8, 0x1b02, 0x1b04, 0x1b06, 0x1b08,
+   0x1b0a, 0x1b0c, 0x1b0c, 0x1b0e, 0x1b10, 0x1b12, 0x1b14, 0x1b16, 0x1b18,
+   0x1b1a, 0x1b1c, 0x1aae, 0x1b1e, 0x1b20, 0x1b22, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x1b24, 0x1b27, 0x1b2a, 0x1b2d, 0x1b31, 0x1b35, 0x1b35,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x1b38, 0x1b3b, 0x1b3e, 0x1b41, 0x1b44, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x1b47, 0x0000, 0x1b4a, 0x1b4d, 0x0c97,
+   0x0c9d, 0x1b4f, 0x1b51, 0x1b53, 0x1b55, 0x1b57, 0x1b59, 0x0c3f, 0x1b5b,
+   0x1b5e, 0x1b61, 0x1b65, 0x1b69, 0x1b6c, 0x1b6f, 0x1b72, 0x1b75, 0x1b78,
+   0x1b7b, 0x1b7e, 0x1b81, 0x0000, 0x1b84, 0x1b87, 0x1b8a, 0x1b8d, 0x1b90,
+   0x0000, 0x1b93, 0x0000, 0x1b96, 0x1b99, 0x0000, 0x1b9c, 0x1b9f, 0x0000,
+   0x1ba2, 0x1ba5, 0x1ba8, 0x1bab, 0x1bae, 0x1bb1, 0x1bb4, 0x1bb7, 0x1bba,
+   0x1bbd, 0x1bc0, 0x1bc0, 0x1bc2, 0x1bc2, 0x1bc2, 0x1bc2, 0x1bc4, 0x1bc4,
+   0x1bc4, 0x1bc4, 0x1bc6, 0x1bc6, 0x1bc6, 0x1bc6, 0x1bc8, 0x1bc8, 0x1bc8,
+   0x1bc8, 0x1bca, 0x1bca, 0x1bca, 0x1bca, 0x1bcc, 0x1bcc, 0x1bcc, 0x1bcc,
+   0x1bce, 0x1bce, 0x1bce, 0x1bce, 0x1bd0, 0x1bd0, 0x1bd0, 0x1bd0, 0x1bd2,
+   0x1bd2, 0x1bd2, 0x1bd2, 0x1bd4, 0x1bd4, 0x1bd4, 0x1bd4, 0x1bd6, 0x1bd6,
+   0x1bd6, 0x1bd6, 0x1bd8, 0x1bd8, 0x1bd8, 0x1bd8, 0x1bda, 0x1bda, 0x1bdc,
+   0x1bdc, 0x1bde, 0x1bde, 0x1be0, 0x1be0, 0x1be2, 0x1be2, 0x1be4, 0x1be4,
+   0x1be6, 0x1be6, 0x1be6, 0x1be6, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1bea,
+   0x1bea, 0x1bea, 0x1bea, 0x1bec, 0x1bec, 0x1bec, 0x1bec, 0x1bee, 0x1bee,
+   0x1bf0, 0x1bf0, 0x1bf0, 0x1bf0, 0x04b7, 0x04b7, 0x1bf2, 0x1bf2, 0x1bf2,
+   0x1bf2, 0x1bf4, 0x1bf4, 0x1bf4, 0x1bf4, 0x1bf6, 0x1bf6, 0x04bd, 0x04bd,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bf8, 0x1bf8, 0x1bf8,
+   0x1bf8, 0x1bfa, 0x1bfa, 0x1bfc, 0x1bfc, 0x1bfe, 0x1bfe, 0x04b1, 0x1c00,
+   0x1c00, 0x1c02, 0x1c02, 0x1c04, 0x1c04, 0x1c06, 0x1c06, 0x1c06, 0x1c06,
+   0x1c08, 0x1c08, 0x1c0a, 0x1c0a, 0x1c0e, 0x1c0e, 0x1c12, 0x1c12, 0x1c16,
+   0x1c16, 0x1c1a, 0x1c1a, 0x1c1e, 0x1c1e, 0x1c22, 0x1c22, 0x1c22, 0x1c26,
+   0x1c26, 0x1c26, 0x1c2a, 0x1c2a, 0x1c2a, 0x1c2a, 0x1c2c, 0x1c30, 0x1c34,
+   0x1c26, 0x1c38, 0x1c3c, 0x1c3f, 0x1c42, 0x1c45, 0x1c48, 0x1c4b, 0x1c4e,
+   0x1c51, 0x1c54, 0x1c57, 0x1c5a, 0x1c5d, 0x1c60, 0x1c63, 0x1c66, 0x1c69,
+   0x1c6c, 0x1c6f, 0x1c72, 0x1c75, 0x1c78, 0x1c7b, 0x1c7e, 0x1c81, 0x1c84,
+   0x1c87, 0x1c8a, 0x1c8d, 0x1c90, 0x1c93, 0x1c96, 0x1c99, 0x1c9c, 0x1c9f,
+   0x1ca2, 0x1ca5, 0x1ca8, 0x1cab, 0x1cae, 0x1cb1, 0x1cb4, 0x1cb7, 0x1cba,
+   0x1cbd, 0x1cc0, 0x1cc3, 0x1cc6, 0x1cc9, 0x1ccc, 0x1ccf, 0x1cd2, 0x1cd5,
+   0x1cd8, 0x1cdb, 0x1cde, 0x1ce1, 0x1ce4, 0x1ce7, 0x1cea, 0x1ced, 0x1cf0,
+   0x1cf3, 0x1cf6, 0x1cf9, 0x1cfc, 0x1cff, 0x1d02, 0x1d05, 0x1d08, 0x1d0b,
+   0x1d0e, 0x1d11, 0x1d14, 0x1d17, 0x1d1a, 0x1d1d, 0x1d20, 0x1d23, 0x1d26,
+   0x1d29, 0x1d2c, 0x1d2f, 0x1d32, 0x1d35, 0x1d38, 0x1d3b, 0x1d3e, 0x1d41,
+   0x1d44, 0x1d47, 0x1d4b, 0x1d4f, 0x1d53, 0x1d57, 0x1d5b, 0x1d5f, 0x1d63,
+   0x1c34, 0x1d67, 0x1c26, 0x1c38, 0x1d6b, 0x1d6e, 0x1c45, 0x1d71, 0x1c48,
+   0x1c4b, 0x1d74, 0x1d77, 0x1c57, 0x1d7a, 0x1c5a, 0x1c5d, 0x1d7d, 0x1d80,
+   0x1c63, 0x1d83, 0x1c66, 0x1c69, 0x1cc0, 0x1cc3, 0x1ccc, 0x1ccf, 0x1cd2,
+   0x1cde, 0x1ce1, 0x1ce4, 0x1ce7, 0x1cf3, 0x1cf6, 0x1cf9, 0x1d86, 0x1d05,
+   0x1d89, 0x1d8c, 0x1d17, 0x1d8f, 0x1d1a, 0x1d1d, 0x1d44, 0x1d92, 0x1d95,
+   0x1d35, 0x1d98, 0x1d38, 0x1d3b, 0x1c2c, 0x1c30, 0x1d9b, 0x1c34, 0x1d9f,
+   0x1c3c, 0x1c3f, 0x1c42, 0x1c45, 0x1da3, 0x1c4e, 0x1c51, 0x1c54, 0x1c57,
+   0x1da6, 0x1c63, 0x1c6c, 0x1c6f, 0x1c72, 0x1c75, 0x1c78, 0x1c7e, 0x1c81,
+   0x1c84, 0x1c87, 0x1c8a, 0x1c8d, 0x1da9, 0x1c90, 0x1c93, 0x1c96, 0x1c99,
+   0x1c9c, 0x1c9f, 0x1ca5, 0x1ca8, 0x1cab, 0x1cae, 0x1cb1, 0x1cb4, 0x1cb7,
+   0x1cba, 0x1cbd, 0x1cc6, 0x1cc9, 0x1cd5, 0x1cd8, 0x1cdb, 0x1cde, 0x1ce1,
+   0x1cea, 0x1ced, 0x1cf0, 0x1cf3, 0x1dac, 0x1cfc, 0x1cff, 0x1d02, 0x1d05,
+   0x1d0e, 0x1d11, 0x1d14, 0x1d17, 0x1daf, 0x1d20, 0x1d23, 0x1db2, 0x1d2c,
+   0x1d2f, 0x1d32, 0x1d35, 0x1db5, 0x1c34, 0x1d9f, 0x1c45, 0x1da3, 0x1c57,
+   0x1da6, 0x1c63, 0x1db8, 0x1c8a, 0x1dbb, 0x1dbe, 0x1dc1, 0x1cde, 0x1ce1,
+   0x1cf3, 0x1d17, 0x1daf, 0x1d35, 0x1db5, 0x1dc4, 0x1dc8, 0x1dcc, 0x1dd0,
+   0x1dd3, 0x1dd6, 0x1dd9, 0x1ddc, 0x1ddf, 0x1de2, 0x1de5, 0x1de8, 0x1deb,
+   0x1dee, 0x1df1, 0x1df4, 0x1df7, 0x1dfa, 0x1dfd, 0x1e00, 0x1e03, 0x1e06,
+   0x1e09, 0x1e0c, 0x1e0f, 0x1e12, 0x1dbe, 0x1e15, 0x1e18, 0x1e1b, 0x1e1e,
+   0x1dd0, 0x1dd3, 0x1dd6, 0x1dd9, 0x1ddc, 0x1ddf, 0x1de2, 0x1de5, 0x1de8,
+   0x1deb, 0x1dee, 0x1df1, 0x1df4, 0x1df7, 0x1dfa, 0x1dfd, 0x1e00, 0x1e03,
+   0x1e06, 0x1e09, 0x1e0c, 0x1e0f, 0x1e12, 0x1dbe, 0x1e15, 0x1e18, 0x1e1b,
+   0x1e1e, 0x1e0c, 0x1e0f, 0x1e12, 0x1dbe, 0x1dbb, 0x1dc1, 0x1ca2, 0x1c81,
+   0x1c84, 0x1c87, 0x1e0c, 0x1e0f, 0x1e12, 0x1ca2, 0x1ca5, 0x1e21, 0x1e21,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x1e24, 0x1e28, 0x1e28, 0x1e2c, 0x1e30, 0x1e34, 0x1e38, 0x1e3c, 0x1e40,
+   0x1e40, 0x1e44, 0x1e48, 0x1e4c, 0x1e50, 0x1e54, 0x1e58, 0x1e58, 0x1e5c,
+   0x1e60, 0x1e60, 0x1e64, 0x1e64, 0x1e68, 0x1e6c, 0x1e6c, 0x1e70, 0x1e74,
+   0x1e74, 0x1e78, 0x1e78, 0x1e7c, 0x1e80, 0x1e80, 0x1e84, 0x1e84, 0x1e88,
+   0x1e8c, 0x1e90, 0x1e94, 0x1e94, 0x1e98, 0x1e9c, 0x1ea0, 0x1ea4, 0x1ea8,
+   0x1ea8, 0x1eac, 0x1eb0, 0x1eb4, 0x1eb8, 0x1ebc, 0x1ec0, 0x1ec0, 0x1ec4,
+   0x1ec4, 0x1ec8, 0x1ec8, 0x1ecc, 0x1ed0, 0x1ed4, 0x1ed8, 0x1edc, 0x1ee0,
+   0x1ee4, 0x0000, 0x0000, 0x1ee8, 0x1eec, 0x1ef0, 0x1ef4, 0x1ef8, 0x1efc,
+   0x1efc, 0x1f00, 0x1f04, 0x1f08, 0x1f0c, 0x1f0c, 0x1f10, 0x1f14, 0x1f18,
+   0x1f1c, 0x1f20, 0x1f24, 0x1f28, 0x1f2c, 0x1f30, 0x1f34, 0x1f38, 0x1f3c,
+   0x1f40, 0x1f44, 0x1f48, 0x1f4c, 0x1f50, 0x1f54, 0x1f58, 0x1f5c, 0x1f60,
+   0x1f64, 0x1eac, 0x1eb4, 0x1f68, 0x1f6c, 0x1f70, 0x1f74, 0x1f78, 0x1f7c,
+   0x1f78, 0x1f70, 0x1f80, 0x1f84, 0x1f88, 0x1f8c, 0x1f90, 0x1f7c, 0x1e90,
+   0x1e68, 0x1f94, 0x1f98, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f9c, 0x1fa0,
+   0x1fa4, 0x1fa9, 0x1fae, 0x1fb3, 0x1fb8, 0x1fbd, 0x1fc2, 0x1fc7, 0x1fcb,
+   0x1fde, 0x1fe7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c06,
+   0x1fec, 0x1fee, 0x1ff0, 0x1ff0, 0x0c45, 0x0c47, 0x1ff2, 0x1ff4, 0x1ff6,
+   0x1ff8, 0x1ffa, 0x1ffc, 0x1ffe, 0x2000, 0x0dba, 0x0dbc, 0x2002, 0x2004,
+   0x2006, 0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c1e, 0x0c1e, 0x0c1e,
+   0x0c1e, 0x1ff0, 0x1ff0, 0x1ff0, 0x200a, 0x200c, 0x0c04, 0x0000, 0x03a3,
+   0x200e, 0x2010, 0x2012, 0x1fec, 0x0c45, 0x0c47, 0x1ff2, 0x1ff4, 0x1ff6,
+   0x1ff8, 0x2014, 0x2016, 0x2018, 0x0c3f, 0x201a, 0x201c, 0x201e, 0x0c43,
+   0x0000, 0x2020, 0x2022, 0x2024, 0x2026, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x2028, 0x202b, 0x202e, 0x0000, 0x2031, 0x0000, 0x2034, 0x2037, 0x203a,
+   0x203d, 0x2040, 0x2043, 0x2046, 0x2049, 0x204c, 0x204f, 0x2052, 0x049c,
+   0x049c, 0x049f, 0x049f, 0x04a2, 0x04a2, 0x04a5, 0x04a5, 0x04a8, 0x04a8,
+   0x04a8, 0x04a8, 0x2054, 0x2054, 0x2056, 0x2056, 0x2056, 0x2056, 0x2058,
+   0x2058, 0x205a, 0x205a, 0x205a, 0x205a, 0x205c, 0x205c, 0x205c, 0x205c,
+   0x205e, 0x205e, 0x205e, 0x205e, 0x2060, 0x2060, 0x2060, 0x2060, 0x2062,
+   0x2062, 0x2062, 0x2062, 0x2064, 0x2064, 0x2066, 0x2066, 0x2068, 0x2068,
+   0x206a, 0x206a, 0x206c, 0x206c, 0x206c, 0x206c, 0x206e, 0x206e, 0x206e,
+   0x206e, 0x2070, 0x2070, 0x2070, 0x2070, 0x2072, 0x2072, 0x2072, 0x2072,
+   0x2074, 0x2074, 0x2074, 0x2074, 0x2076, 0x2076, 0x2076, 0x2076, 0x2078,
+   0x2078, 0x2078, 0x2078, 0x207a, 0x207a, 0x207a, 0x207a, 0x207c, 0x207c,
+   0x207c, 0x207c, 0x207e, 0x207e, 0x207e, 0x207e, 0x2080, 0x2080, 0x2080,
+   0x2080, 0x2082, 0x2082, 0x2082, 0x2082, 0x2084, 0x2084, 0x2084, 0x2084,
+   0x2086, 0x2086, 0x2086, 0x2086, 0x2088, 0x2088, 0x2088, 0x2088, 0x208a,
+   0x208a, 0x1c08, 0x1c08, 0x208c, 0x208c, 0x208c, 0x208c, 0x208e, 0x208e,
+   0x2092, 0x2092, 0x2096, 0x2096, 0x209a, 0x209a, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x2012, 0x209d, 0x2014, 0x2022, 0x2024, 0x2016, 0x209f, 0x0c45,
+   0x0c47, 0x2018, 0x0c3f, 0x200a, 0x201a, 0x0c04, 0x20a1, 0x0c2f, 0x0017,
+   0x000b, 0x000d, 0x0c33, 0x0c35, 0x0c37, 0x0c39, 0x0c3b, 0x0c3d, 0x200e,
+   0x03a3, 0x201c, 0x0c43, 0x201e, 0x2010, 0x2026, 0x0ee9, 0x0c8d, 0x0c56,
+   0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70,
+   0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5,
+   0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x20a3, 0x2020, 0x20a5, 0x20a7,
+   0x1ff0, 0x0bdf, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68,
+   0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01,
+   0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379,
+   0x0f09, 0x1ff2, 0x20a9, 0x1ff4, 0x20ab, 0x20ad, 0x20af, 0x20b1, 0x2002,
+   0x2004, 0x200c, 0x20b3, 0x14b8, 0x20b5, 0x20b7, 0x20b9, 0x20bb, 0x20bd,
+   0x20bf, 0x20c1, 0x20c3, 0x20c5, 0x20c7, 0x145c, 0x145e, 0x1460, 0x1462,
+   0x1464, 0x1466, 0x1468, 0x146a, 0x146c, 0x146e, 0x1470, 0x1472, 0x1474,
+   0x1476, 0x1478, 0x147a, 0x147c, 0x147e, 0x1480, 0x1482, 0x1484, 0x1486,
+   0x1488, 0x148a, 0x148c, 0x148e, 0x1490, 0x1492, 0x1494, 0x1496, 0x1498,
+   0x149a, 0x149c, 0x149e, 0x14a0, 0x14a2, 0x14a4, 0x14a6, 0x14a8, 0x14aa,
+   0x14ac, 0x14ae, 0x14b0, 0x14b2, 0x20c9, 0x20cb, 0x20cd, 0x11f4, 0x118e,
+   0x1190, 0x1192, 0x1194, 0x1196, 0x1198, 0x119a, 0x119c, 0x119e, 0x11a0,
+   0x11a2, 0x11a4, 0x11a6, 0x11a8, 0x11aa, 0x11ac, 0x11ae, 0x11b0, 0x11b2,
+   0x11b4, 0x11b6, 0x11b8, 0x11ba, 0x11bc, 0x11be, 0x11c0, 0x11c2, 0x11c4,
+   0x11c6, 0x11c8, 0x0000, 0x0000, 0x0000, 0x11ca, 0x11cc, 0x11ce, 0x11d0,
+   0x11d2, 0x11d4, 0x0000, 0x0000, 0x11d6, 0x11d8, 0x11da, 0x11dc, 0x11de,
+   0x11e0, 0x0000, 0x0000, 0x11e2, 0x11e4, 0x11e6, 0x11e8, 0x11ea, 0x11ec,
+   0x0000, 0x0000, 0x11ee, 0x11f0, 0x11f2, 0x0000, 0x0000, 0x0000, 0x20cf,
+   0x20d1, 0x20d3, 0x0008, 0x20d5, 0x20d7, 0x20d9, 0x0000, 0x20db, 0x20dd,
+   0x20df, 0x20e1, 0x20e3, 0x20e5, 0x20e7, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e9,
+   0x20ee, 0x20f3, 0x20fa, 0x2101, 0x2108, 0x210f, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x2116, 0x211b, 0x2120, 0x2127, 0x212e, 0x2135, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ee9,
+   0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed,
+   0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1,
+   0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x0006, 0x0efb,
+   0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff,
+   0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05,
+   0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0c56,
+   0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70,
+   0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5,
+   0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9,
+   0x0c8f, 0x0efd, 0x0c68, 0x0000, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26,
+   0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c,
+   0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91,
+   0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72,
+   0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7,
+   0x0cf9, 0x0ef9, 0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd,
+   0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019,
+   0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391,
+   0x0379, 0x0f09, 0x0ee9, 0x0000, 0x0c56, 0x0ca7, 0x0000, 0x0000, 0x0eeb,
+   0x0000, 0x0000, 0x0eed, 0x0c8b, 0x0000, 0x0000, 0x0c72, 0x0eef, 0x0c77,
+   0x0c79, 0x0000, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9,
+   0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0000, 0x0efd, 0x0000, 0x0369,
+   0x0c31, 0x036d, 0x0eff, 0x0000, 0x0d26, 0x0c49, 0x0000, 0x0f01, 0x0f03,
+   0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09,
+   0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e,
+   0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b,
+   0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x0006,
+   0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d,
+   0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219,
+   0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d,
+   0x0000, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0000, 0x0000, 0x0eed, 0x0c8b,
+   0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0000, 0x0ef1, 0x0ef3,
+   0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0000, 0x0006, 0x0efb, 0x0d24,
+   0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f,
+   0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07,
+   0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0000, 0x0ca7,
+   0x0c91, 0x0c93, 0x0eeb, 0x0000, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70, 0x0c95,
+   0x0000, 0x0eef, 0x0000, 0x0000, 0x0000, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8,
+   0x0ef7, 0x0cf9, 0x0ef9, 0x0000, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f,
+   0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49,
+   0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377,
+   0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93,
+   0x0eeb, 0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef,
+   0x0c77, 0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9,
+   0x0ef9, 0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68,
+   0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01,
+   0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379,
+   0x0f09, 0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a,
+   0x0c6e, 0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79,
+   0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87,
+   0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31,
+   0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f,
+   0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9,
+   0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed,
+   0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1,
+   0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x0006, 0x0efb,
+   0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff,
+   0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05,
+   0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0c56,
+   0x0ca7, 0x0c91, 0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70,
+   0x0c95, 0x0c72, 0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5,
+   0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9, 0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9,
+   0x0c8f, 0x0efd, 0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26,
+   0x0c49, 0x0019, 0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c,
+   0x0377, 0x0391, 0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91,
+   0x0c93, 0x0eeb, 0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72,
+   0x0eef, 0x0c77, 0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7,
+   0x0cf9, 0x0ef9, 0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd,
+   0x0c68, 0x0369, 0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019,
+   0x0f01, 0x0f03, 0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391,
+   0x0379, 0x0f09, 0x0ee9, 0x0c8d, 0x0c56, 0x0ca7, 0x0c91, 0x0c93, 0x0eeb,
+   0x0c6a, 0x0c6e, 0x0eed, 0x0c8b, 0x0c70, 0x0c95, 0x0c72, 0x0eef, 0x0c77,
+   0x0c79, 0x0c7b, 0x0ef1, 0x0ef3, 0x0ef5, 0x0ce8, 0x0ef7, 0x0cf9, 0x0ef9,
+   0x0c87, 0x0006, 0x0efb, 0x0d24, 0x0ca9, 0x0c8f, 0x0efd, 0x0c68, 0x0369,
+   0x0c31, 0x036d, 0x0eff, 0x038f, 0x0d26, 0x0c49, 0x0019, 0x0f01, 0x0f03,
+   0x036f, 0x0219, 0x0f05, 0x0f07, 0x0d0c, 0x0377, 0x0391, 0x0379, 0x0f09,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x213c, 0x213e, 0x0ca1, 0x2140, 0x2142,
+   0x2144, 0x2146, 0x03f9, 0x2148, 0x214a, 0x214c, 0x214e, 0x2150, 0x2152,
+   0x2154, 0x0ca3, 0x2156, 0x03f9, 0x2158, 0x215a, 0x03ed, 0x215c, 0x215e,
+   0x2160, 0x0c89, 0x2162, 0x2164, 0x03e9, 0x0c9f, 0x2166, 0x03fb, 0x2168,
+   0x216a, 0x03eb, 0x0b62, 0x03f3, 0x216c, 0x0012, 0x216e, 0x2170, 0x2172,
+   0x03f1, 0x03f5, 0x03f7, 0x2174, 0x2176, 0x2178, 0x03ef, 0x217a, 0x217c,
+   0x217e, 0x2180, 0x03fb, 0x03eb, 0x03f3, 0x03ef, 0x03f5, 0x03f1, 0x213c,
+   0x213e, 0x0ca1, 0x2140, 0x2142, 0x2144, 0x2146, 0x03f9, 0x2148, 0x214a,
+   0x214c, 0x214e, 0x2150, 0x2152, 0x2154, 0x0ca3, 0x2156, 0x03f9, 0x2158,
+   0x215a, 0x03ed, 0x215c, 0x215e, 0x2160, 0x0c89, 0x2162, 0x2164, 0x03e9,
+   0x0c9f, 0x2166, 0x03fb, 0x2168, 0x216a, 0x03eb, 0x0b62, 0x03f3, 0x216c,
+   0x0012, 0x216e, 0x2170, 0x2172, 0x03f1, 0x03f5, 0x03f7, 0x2174, 0x2176,
+   0x2178, 0x03ef, 0x217a, 0x217c, 0x217e, 0x2180, 0x03fb, 0x03eb, 0x03f3,
+   0x03ef, 0x03f5, 0x03f1, 0x213c, 0x213e, 0x0ca1, 0x2140, 0x2142, 0x2144,
+   0x2146, 0x03f9, 0x2148, 0x214a, 0x214c, 0x214e, 0x2150, 0x2152, 0x2154,
+   0x0ca3, 0x2156, 0x03f9, 0x2158, 0x215a, 0x03ed, 0x215c, 0x215e, 0x2160,
+   0x0c89, 0x2162, 0x2164, 0x03e9, 0x0c9f, 0x2166, 0x03fb, 0x2168, 0x216a,
+   0x03eb, 0x0b62, 0x03f3, 0x216c, 0x0012, 0x216e, 0x2170, 0x2172, 0x03f1,
+   0x03f5, 0x03f7, 0x2174, 0x2176, 0x2178, 0x03ef, 0x217a, 0x217c, 0x217e,
+   0x2180, 0x03fb, 0x03eb, 0x03f3, 0x03ef, 0x03f5, 0x03f1, 0x213c, 0x213e,
+   0x0ca1, 0x2140, 0x2142, 0x2144, 0x2146, 0x03f9, 0x2148, 0x214a, 0x214c,
+   0x214e, 0x2150, 0x2152, 0x2154, 0x0ca3, 0x2156, 0x03f9, 0x2158, 0x215a,
+   0x03ed, 0x215c, 0x215e, 0x2160, 0x0c89, 0x2162, 0x2164, 0x03e9, 0x0c9f,
+   0x2166, 0x03fb, 0x2168, 0x216a, 0x03eb, 0x0b62, 0x03f3, 0x216c, 0x0012,
+   0x216e, 0x2170, 0x2172, 0x03f1, 0x03f5, 0x03f7, 0x2174, 0x2176, 0x2178,
+   0x03ef, 0x217a, 0x217c, 0x217e, 0x2180, 0x03fb, 0x03eb, 0x03f3, 0x03ef,
+   0x03f5, 0x03f1, 0x213c, 0x213e, 0x0ca1, 0x2140, 0x2142, 0x2144, 0x2146,
+   0x03f9, 0x2148, 0x214a, 0x214c, 0x214e, 0x2150, 0x2152, 0x2154, 0x0ca3,
+   0x2156, 0x03f9, 0x2158, 0x215a, 0x03ed, 0x215c, 0x215e, 0x2160, 0x0c89,
+   0x2162, 0x2164, 0x03e9, 0x0c9f, 0x2166, 0x03fb, 0x2168, 0x216a, 0x03eb,
+   0x0b62, 0x03f3, 0x216c, 0x0012, 0x216e, 0x2170, 0x2172, 0x03f1, 0x03f5,
+   0x03f7, 0x2174, 0x2176, 0x2178, 0x03ef, 0x217a, 0x217c, 0x217e, 0x2180,
+   0x03fb, 0x03eb, 0x03f3, 0x03ef, 0x03f5, 0x03f1, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0c2f, 0x0017, 0x000b, 0x000d, 0x0c33, 0x0c35, 0x0c37, 0x0c39,
+   0x0c3b, 0x0c3d, 0x0c2f, 0x0017, 0x000b, 0x000d, 0x0c33, 0x0c35, 0x0c37,
+   0x0c39, 0x0c3b, 0x0c3d, 0x0c2f, 0x0017, 0x000b, 0x000d, 0x0c33, 0x0c35,
+   0x0c37, 0x0c39, 0x0c3b, 0x0c3d, 0x0c2f, 0x0017, 0x000b, 0x000d, 0x0c33,
+   0x0c35, 0x0c37, 0x0c39, 0x0c3b, 0x0c3d, 0x0c2f, 0x0017, 0x000b, 0x000d,
+   0x0c33, 0x0c35, 0x0c37, 0x0c39, 0x0c3b, 0x0c3d, 0x2182, 0x2184, 0x2186,
+   0x2188, 0x218b, 0x1aba, 0x218d, 0x218f, 0x2191, 0x2193, 0x1abc, 0x2195,
+   0x2197, 0x2199, 0x1abe, 0x219c, 0x219e, 0x21a0, 0x21a2, 0x21a5, 0x21a7,
+   0x21a9, 0x21ab, 0x21ae, 0x21b0, 0x21b2, 0x21b4, 0x21b6, 0x21b8, 0x0f42,
+   0x21bb, 0x21bd, 0x21bf, 0x21c1, 0x21c3, 0x21c5, 0x21c7, 0x21c9, 0x1ac0,
+   0x1ac2, 0x21cb, 0x21cd, 0x21cf, 0x1958, 0x21d1, 0x1ac4, 0x21d3, 0x21d5,
+   0x21d7, 0x21d9, 0x21d9, 0x21d9, 0x21db, 0x21de, 0x21e0, 0x21e2, 0x21e4,
+   0x21e7, 0x21e9, 0x21eb, 0x21ed, 0x21ef, 0x21f1, 0x21f3, 0x21f5, 0x21f7,
+   0x21f9, 0x21fb, 0x21fd, 0x21ff, 0x21ff, 0x2201, 0x2203, 0x2205, 0x2207,
+   0x2209, 0x1ac8, 0x220b, 0x220d, 0x220f, 0x1a7c, 0x2211, 0x2213, 0x2215,
+   0x2217, 0x2219, 0x221b, 0x221d, 0x221f, 0x2221, 0x2224, 0x2226, 0x2228,
+   0x222a, 0x222c, 0x222e, 0x2230, 0x2233, 0x2236, 0x2238, 0x223a, 0x223c,
+   0x223e, 0x2240, 0x2242, 0x2245, 0x2247, 0x2247, 0x2249, 0x224c, 0x224e,
+   0x1950, 0x2250, 0x2252, 0x2255, 0x2257, 0x2259, 0x0f76, 0x225b, 0x225d,
+   0x0f7a, 0x225f, 0x2261, 0x2263, 0x2266, 0x2268, 0x226b, 0x226d, 0x226f,
+   0x2271, 0x2273, 0x2275, 0x2277, 0x2279, 0x227b, 0x227d, 0x227f, 0x2281,
+   0x2284, 0x2286, 0x2288, 0x228a, 0x18e8, 0x228c, 0x0f8e, 0x228f, 0x228f,
+   0x2292, 0x2294, 0x2294, 0x2296, 0x2298, 0x229b, 0x229e, 0x22a0, 0x22a2,
+   0x22a4, 0x22a6, 0x22a8, 0x22aa, 0x22ac, 0x22ae, 0x22b0, 0x1ad2, 0x22b2,
+   0x22b5, 0x22b7, 0x22b9, 0x22bb, 0x22b9, 0x22bd, 0x1ad6, 0x22bf, 0x22c1,
+   0x22c3, 0x22c5, 0x1ad8, 0x18b2, 0x22c7, 0x22c9, 0x22cb, 0x22cd, 0x22cf,
+   0x22d1, 0x22d3, 0x22d6, 0x22d8, 0x22da, 0x22dc, 0x22de, 0x22e0, 0x22e3,
+   0x22e5, 0x22e7, 0x22e9, 0x22eb, 0x22ed, 0x22ef, 0x22f1, 0x22f3, 0x1ada,
+   0x22f5, 0x22f7, 0x22fa, 0x22fc, 0x22fe, 0x2300, 0x1ade, 0x2302, 0x2304,
+   0x2306, 0x2308, 0x230a, 0x230c, 0x230e, 0x2310, 0x18ea, 0x2312, 0x2314,
+   0x2316, 0x2318, 0x231a, 0x231d, 0x231f, 0x2321, 0x2323, 0x1ae0, 0x2325,
+   0x2328, 0x232a, 0x232c, 0x232e, 0x2330, 0x2332, 0x2334, 0x2336, 0x2338,
+   0x233b, 0x233d, 0x233f, 0x2341, 0x2344, 0x2346, 0x2348, 0x234a, 0x1972,
+   0x234c, 0x234e, 0x2351, 0x2354, 0x2357, 0x2359, 0x235c, 0x235e, 0x2360,
+   0x2362, 0x2364, 0x1ae2, 0x1a18, 0x2366, 0x2368, 0x236a, 0x236c, 0x236f,
+   0x2371, 0x2373, 0x2375, 0x2377, 0x2379, 0x237b, 0x237e, 0x2380, 0x2382,
+   0x2385, 0x2388, 0x238a, 0x238c, 0x238e, 0x2390, 0x2392, 0x2394, 0x2396,
+   0x2398, 0x239a, 0x239d, 0x239f, 0x23a2, 0x23a4, 0x23a6, 0x23a8, 0x23aa,
+   0x23ac, 0x23af, 0x23b1, 0x23b3, 0x23b6, 0x23b9, 0x23bb, 0x23bd, 0x23bf,
+   0x23c1, 0x23c1, 0x23c3, 0x23c5, 0x23c7, 0x23c9, 0x23cb, 0x23cd, 0x23cf,
+   0x23d1, 0x23d4, 0x23d6, 0x1956, 0x23d9, 0x23dc, 0x23de, 0x23e1, 0x23e4,
+   0x23e7, 0x23e9, 0x23eb, 0x23ed, 0x23f0, 0x23f3, 0x23f6, 0x23f9, 0x23fb,
+   0x23fb, 0x23fd, 0x23ff, 0x2401, 0x2403, 0x2405, 0x2407, 0x240a, 0x190c,
+   0x240c, 0x240e, 0x2410, 0x1af6, 0x2413, 0x2416, 0x1aa4, 0x2419, 0x241b,
+   0x1afc, 0x241d, 0x241f, 0x2421, 0x2424, 0x2424, 0x2427, 0x2429, 0x242b,
+   0x242e, 0x2430, 0x2432, 0x2434, 0x2437, 0x2439, 0x243b, 0x243d, 0x243f,
+   0x2441, 0x2444, 0x2446, 0x2448, 0x244a, 0x244c, 0x244e, 0x2450, 0x2453,
+   0x2456, 0x2458, 0x245b, 0x245d, 0x2460, 0x2462, 0x1b08, 0x2464, 0x2467,
+   0x246a, 0x246c, 0x246f, 0x2471, 0x2474, 0x2476, 0x2478, 0x247a, 0x247c,
+   0x247e, 0x2480, 0x2483, 0x2486, 0x2489, 0x2292, 0x248c, 0x248e, 0x2490,
+   0x2492, 0x2494, 0x2496, 0x2498, 0x249a, 0x249c, 0x249e, 0x24a0, 0x24a2,
+   0x1978, 0x24a5, 0x24a7, 0x24a9, 0x24ab, 0x24ad, 0x24af, 0x1b0e, 0x24b1,
+   0x24b3, 0x24b5, 0x24b7, 0x24b9, 0x24bc, 0x24bf, 0x24c2, 0x24c4, 0x24c6,
+   0x24c8, 0x24ca, 0x24cd, 0x24cf, 0x24d2, 0x24d4, 0x24d6, 0x24d9, 0x24dc,
+   0x24de, 0x1902, 0x24e0, 0x24e2, 0x24e4, 0x24e6, 0x24e8, 0x24ea, 0x24ec,
+   0x24ee, 0x24f0, 0x24f2, 0x24f4, 0x24f6, 0x24f8, 0x24fa, 0x24fc, 0x1042,
+   0x24fe, 0x2501, 0x2503, 0x2505, 0x2507, 0x2509, 0x250b, 0x250e, 0x2511,
+   0x2513, 0x2515, 0x2517, 0x2519, 0x1050, 0x251b, 0x251e, 0x2520, 0x2522,
+   0x2524, 0x2526, 0x2529, 0x252c, 0x252e, 0x2530, 0x2532, 0x2535, 0x2537,
+   0x2539, 0x253c, 0x253f, 0x2541, 0x2543, 0x2545, 0x2548, 0x254a, 0x254c,
+   0x254e, 0x2550, 0x2552, 0x2554, 0x2556, 0x2559, 0x255b, 0x255d, 0x255f,
+   0x2562, 0x2564, 0x2566, 0x2568, 0x256a, 0x256d, 0x2570, 0x2572, 0x2574,
+   0x2576, 0x2579, 0x257b, 0x257e, 0x257e, 0x2580, 0x2582, 0x2585, 0x2587,
+   0x2589, 0x258b, 0x258d, 0x258f, 0x2591, 0x2593, 0x2596, 0x2598, 0x259a,
+   0x259c, 0x259e, 0x25a0, 0x25a2, 0x25a5, 0x25a7, 0x25aa, 0x25ad, 0x10b0,
+   0x25b0, 0x10b8, 0x25b2, 0x25b4, 0x25b6, 0x25b8, 0x10c2, 0x25ba, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+static const uint16_t mongoc_saslprep_decomp_pool[9661] = {
+   0x0000, 0x0001, 0x0020, 0x0002, 0x0020, 0x0308, 0x0001, 0x0061, 0x0002,
+   0x0020, 0x0304, 0x0001, 0x0032, 0x0001, 0x0033, 0x0002, 0x0020, 0x0301,
+   0x0001, 0x03bc, 0x0002, 0x0020, 0x0327, 0x0001, 0x0031, 0x0001, 0x006f,
+   0x0003, 0x0031, 0x2044, 0x0034, 0x0003, 0x0031, 0x2044, 0x0032, 0x0003,
+   0x0033, 0x2044, 0x0034, 0x0002, 0x0041, 0x0300, 0x0002, 0x0041, 0x0301,
+   0x0002, 0x0041, 0x0302, 0x0002, 0x0041, 0x0303, 0x0002, 0x0041, 0x0308,
+   0x0002, 0x0041, 0x030a, 0x0002, 0x0043, 0x0327, 0x0002, 0x0045, 0x0300,
+   0x0002, 0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002, 0x0045, 0x0308,
+   0x0002, 0x0049, 0x0300, 0x0002, 0x0049, 0x0301, 0x0002, 0x0049, 0x0302,
+   0x0002, 0x0049, 0x0308, 0x0002, 0x004e, 0x0303, 0x0002, 0x004f, 0x0300,
+   0x0002, 0x004f, 0x0301, 0x0002, 0x004f, 0x0302, 0x0002, 0x004f, 0x0303,
+   0x0002, 0x004f, 0x0308, 0x0002, 0x0055, 0x0300, 0x0002, 0x0055, 0x0301,
+   0x0002, 0x0055, 0x0302, 0x0002, 0x0055, 0x0308, 0x0002, 0x0059, 0x0301,
+   0x0002, 0x0061, 0x0300, 0x0002, 0x0061, 0x0301, 0x0002, 0x0061, 0x0302,
+   0x0002, 0x0061, 0x0303, 0x0002, 0x0061, 0x0308, 0x0002, 0x0061, 0x030a,
+   0x0002, 0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002, 0x0065, 0x0301,
+   0x0002, 0x0065, 0x0302, 0x0002, 0x0065, 0x0308, 0x0002, 0x0069, 0x0300,
+   0x0002, 0x0069, 0x0301, 0x0002, 0x0069, 0x0302, 0x0002, 0x0069, 0x0308,
+   0x0002, 0x006e, 0x0303, 0x0002, 0x006f, 0x0300, 0x0002, 0x006f, 0x0301,
+   0x0002, 0x006f, 0x0302, 0x0002, 0x006f, 0x0303, 0x0002, 0x006f, 0x0308,
+   0x0002, 0x0075, 0x0300, 0x0002, 0x0075, 0x0301, 0x0002, 0x0075, 0x0302,
+   0x0002, 0x0075, 0x0308, 0x0002, 0x0079, 0x0301, 0x0002, 0x0079, 0x0308,
+   0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304, 0x0002, 0x0041, 0x0306,
+   0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002, 0x0061, 0x0328,
+   0x0002, 0x0043, 0x0301, 0x0002, 0x0063, 0x0301, 0x0002, 0x0043, 0x0302,
+   0x0002, 0x0063, 0x0302, 0x0002, 0x0043, 0x0307, 0x0002, 0x0063, 0x0307,
+   0x0002, 0x0043, 0x030c, 0x0002, 0x0063, 0x030c, 0x0002, 0x0044, 0x030c,
+   0x0002, 0x0064, 0x030c, 0x0002, 0x0045, 0x0304, 0x0002, 0x0065, 0x0304,
+   0x0002, 0x0045, 0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307,
+   0x0002, 0x0065, 0x0307, 0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328,
+   0x0002, 0x0045, 0x030c, 0x0002, 0x0065, 0x030c, 0x0002, 0x0047, 0x0302,
+   0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002, 0x0067, 0x0306,
+   0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307, 0x0002, 0x0047, 0x0327,
+   0x0002, 0x0067, 0x0327, 0x0002, 0x0048, 0x0302, 0x0002, 0x0068, 0x0302,
+   0x0002, 0x0049, 0x0303, 0x0002, 0x0069, 0x0303, 0x0002, 0x0049, 0x0304,
+   0x0002, 0x0069, 0x0304, 0x0002, 0x0049, 0x0306, 0x0002, 0x0069, 0x0306,
+   0x0002, 0x0049, 0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307,
+   0x0002, 0x0049, 0x004a, 0x0002, 0x0069, 0x006a, 0x0002, 0x004a, 0x0302,
+   0x0002, 0x006a, 0x0302, 0x0002, 0x004b, 0x0327, 0x0002, 0x006b, 0x0327,
+   0x0002, 0x004c, 0x0301, 0x0002, 0x006c, 0x0301, 0x0002, 0x004c, 0x0327,
+   0x0002, 0x006c, 0x0327, 0x0002, 0x004c, 0x030c, 0x0002, 0x006c, 0x030c,
+   0x0002, 0x004c, 0x00b7, 0x0002, 0x006c, 0x00b7, 0x0002, 0x004e, 0x0301,
+   0x0002, 0x006e, 0x0301, 0x0002, 0x004e, 0x0327, 0x0002, 0x006e, 0x0327,
+   0x0002, 0x004e, 0x030c, 0x0002, 0x006e, 0x030c, 0x0002, 0x02bc, 0x006e,
+   0x0002, 0x004f, 0x0304, 0x0002, 0x006f, 0x0304, 0x0002, 0x004f, 0x0306,
+   0x0002, 0x006f, 0x0306, 0x0002, 0x004f, 0x030b, 0x0002, 0x006f, 0x030b,
+   0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301, 0x0002, 0x0052, 0x0327,
+   0x0002, 0x0072, 0x0327, 0x0002, 0x0052, 0x030c, 0x0002, 0x0072, 0x030c,
+   0x0002, 0x0053, 0x0301, 0x0002, 0x0073, 0x0301, 0x0002, 0x0053, 0x0302,
+   0x0002, 0x0073, 0x0302, 0x0002, 0x0053, 0x0327, 0x0002, 0x0073, 0x0327,
+   0x0002, 0x0053, 0x030c, 0x0002, 0x0073, 0x030c, 0x0002, 0x0054, 0x0327,
+   0x0002, 0x0074, 0x0327, 0x0002, 0x0054, 0x030c, 0x0002, 0x0074, 0x030c,
+   0x0002, 0x0055, 0x0303, 0x0002, 0x0075, 0x0303, 0x0002, 0x0055, 0x0304,
+   0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075, 0x0306,
+   0x0002, 0x0055, 0x030a, 0x0002, 0x0075, 0x030a, 0x0002, 0x0055, 0x030b,
+   0x0002, 0x0075, 0x030b, 0x0002, 0x0055, 0x0328, 0x0002, 0x0075, 0x0328,
+   0x0002, 0x0057, 0x0302, 0x0002, 0x0077, 0x0302, 0x0002, 0x0059, 0x0302,
+   0x0002, 0x0079, 0x0302, 0x0002, 0x0059, 0x0308, 0x0002, 0x005a, 0x0301,
+   0x0002, 0x007a, 0x0301, 0x0002, 0x005a, 0x0307, 0x0002, 0x007a, 0x0307,
+   0x0002, 0x005a, 0x030c, 0x0002, 0x007a, 0x030c, 0x0001, 0x0073, 0x0002,
+   0x004f, 0x031b, 0x0002, 0x006f, 0x031b, 0x0002, 0x0055, 0x031b, 0x0002,
+   0x0075, 0x031b, 0x0003, 0x0044, 0x005a, 0x030c, 0x0003, 0x0044, 0x007a,
+   0x030c, 0x0003, 0x0064, 0x007a, 0x030c, 0x0002, 0x004c, 0x004a, 0x0002,
+   0x004c, 0x006a, 0x0002, 0x006c, 0x006a, 0x0002, 0x004e, 0x004a, 0x0002,
+   0x004e, 0x006a, 0x0002, 0x006e, 0x006a, 0x0002, 0x0041, 0x030c, 0x0002,
+   0x0061, 0x030c, 0x0002, 0x0049, 0x030c, 0x0002, 0x0069, 0x030c, 0x0002,
+   0x004f, 0x030c, 0x0002, 0x006f, 0x030c, 0x0002, 0x0055, 0x030c, 0x0002,
+   0x0075, 0x030c, 0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308,
+   0x0304, 0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075, 0x0308, 0x0301,
+   0x0003, 0x0055, 0x0308, 0x030c, 0x0003, 0x0075, 0x0308, 0x030c, 0x0003,
+   0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308, 0x0300, 0x0003, 0x0041,
+   0x0308, 0x0304, 0x0003, 0x0061, 0x0308, 0x0304, 0x0003, 0x0041, 0x0307,
+   0x0304, 0x0003, 0x0061, 0x0307, 0x0304, 0x0002, 0x00c6, 0x0304, 0x0002,
+   0x00e6, 0x0304, 0x0002, 0x0047, 0x030c, 0x0002, 0x0067, 0x030c, 0x0002,
+   0x004b, 0x030c, 0x0002, 0x006b, 0x030c, 0x0002, 0x004f, 0x0328, 0x0002,
+   0x006f, 0x0328, 0x0003, 0x004f, 0x0328, 0x0304, 0x0003, 0x006f, 0x0328,
+   0x0304, 0x0002, 0x01b7, 0x030c, 0x0002, 0x0292, 0x030c, 0x0002, 0x006a,
+   0x030c, 0x0002, 0x0044, 0x005a, 0x0002, 0x0044, 0x007a, 0x0002, 0x0064,
+   0x007a, 0x0002, 0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0002, 0x004e,
+   0x0300, 0x0002, 0x006e, 0x0300, 0x0003, 0x0041, 0x030a, 0x0301, 0x0003,
+   0x0061, 0x030a, 0x0301, 0x0002, 0x00c6, 0x0301, 0x0002, 0x00e6, 0x0301,
+   0x0002, 0x00d8, 0x0301, 0x0002, 0x00f8, 0x0301, 0x0002, 0x0041, 0x030f,
+   0x0002, 0x0061, 0x030f, 0x0002, 0x0041, 0x0311, 0x0002, 0x0061, 0x0311,
+   0x0002, 0x0045, 0x030f, 0x0002, 0x0065, 0x030f, 0x0002, 0x0045, 0x0311,
+   0x0002, 0x0065, 0x0311, 0x0002, 0x0049, 0x030f, 0x0002, 0x0069, 0x030f,
+   0x0002, 0x0049, 0x0311, 0x0002, 0x0069, 0x0311, 0x0002, 0x004f, 0x030f,
+   0x0002, 0x006f, 0x030f, 0x0002, 0x004f, 0x0311, 0x0002, 0x006f, 0x0311,
+   0x0002, 0x0052, 0x030f, 0x0002, 0x0072, 0x030f, 0x0002, 0x0052, 0x0311,
+   0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030f, 0x0002, 0x0075, 0x030f,
+   0x0002, 0x0055, 0x0311, 0x0002, 0x0075, 0x0311, 0x0002, 0x0053, 0x0326,
+   0x0002, 0x0073, 0x0326, 0x0002, 0x0054, 0x0326, 0x0002, 0x0074, 0x0326,
+   0x0002, 0x0048, 0x030c, 0x0002, 0x0068, 0x030c, 0x0002, 0x0041, 0x0307,
+   0x0002, 0x0061, 0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327,
+   0x0003, 0x004f, 0x0308, 0x0304, 0x0003, 0x006f, 0x0308, 0x0304, 0x0003,
+   0x004f, 0x0303, 0x0304, 0x0003, 0x006f, 0x0303, 0x0304, 0x0002, 0x004f,
+   0x0307, 0x0002, 0x006f, 0x0307, 0x0003, 0x004f, 0x0307, 0x0304, 0x0003,
+   0x006f, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304, 0x0002, 0x0079, 0x0304,
+   0x0001, 0x0068, 0x0001, 0x0266, 0x0001, 0x006a, 0x0001, 0x0072, 0x0001,
+   0x0279, 0x0001, 0x027b, 0x0001, 0x0281, 0x0001, 0x0077, 0x0001, 0x0079,
+   0x0002, 0x0020, 0x0306, 0x0002, 0x0020, 0x0307, 0x0002, 0x0020, 0x030a,
+   0x0002, 0x0020, 0x0328, 0x0002, 0x0020, 0x0303, 0x0002, 0x0020, 0x030b,
+   0x0001, 0x0263, 0x0001, 0x006c, 0x0001, 0x0078, 0x0001, 0x0295, 0x0001,
+   0x0300, 0x0001, 0x0301, 0x0001, 0x0313, 0x0002, 0x0308, 0x0301, 0x0001,
+   0x02b9, 0x0002, 0x0020, 0x0345, 0x0001, 0x003b, 0x0003, 0x0020, 0x0308,
+   0x0301, 0x0002, 0x0391, 0x0301, 0x0001, 0x00b7, 0x0002, 0x0395, 0x0301,
+   0x0002, 0x0397, 0x0301, 0x0002, 0x0399, 0x0301, 0x0002, 0x039f, 0x0301,
+   0x0002, 0x03a5, 0x0301, 0x0002, 0x03a9, 0x0301, 0x0003, 0x03b9, 0x0308,
+   0x0301, 0x0002, 0x0399, 0x0308, 0x0002, 0x03a5, 0x0308, 0x0002, 0x03b1,
+   0x0301, 0x0002, 0x03b5, 0x0301, 0x0002, 0x03b7, 0x0301, 0x0002, 0x03b9,
+   0x0301, 0x0003, 0x03c5, 0x0308, 0x0301, 0x0002, 0x03b9, 0x0308, 0x0002,
+   0x03c5, 0x0308, 0x0002, 0x03bf, 0x0301, 0x0002, 0x03c5, 0x0301, 0x0002,
+   0x03c9, 0x0301, 0x0001, 0x03b2, 0x0001, 0x03b8, 0x0001, 0x03a5, 0x0001,
+   0x03c6, 0x0001, 0x03c0, 0x0001, 0x03ba, 0x0001, 0x03c1, 0x0001, 0x03c2,
+   0x0001, 0x0398, 0x0001, 0x03b5, 0x0002, 0x0415, 0x0300, 0x0002, 0x0415,
+   0x0308, 0x0002, 0x0413, 0x0301, 0x0002, 0x0406, 0x0308, 0x0002, 0x041a,
+   0x0301, 0x0002, 0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418,
+   0x0306, 0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002, 0x0435,
+   0x0308, 0x0002, 0x0433, 0x0301, 0x0002, 0x0456, 0x0308, 0x0002, 0x043a,
+   0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443, 0x0306, 0x0002, 0x0474,
+   0x030f, 0x0002, 0x0475, 0x030f, 0x0002, 0x0416, 0x0306, 0x0002, 0x0436,
+   0x0306, 0x0002, 0x0410, 0x0306, 0x0002, 0x0430, 0x0306, 0x0002, 0x0410,
+   0x0308, 0x0002, 0x0430, 0x0308, 0x0002, 0x0415, 0x0306, 0x0002, 0x0435,
+   0x0306, 0x0002, 0x04d8, 0x0308, 0x0002, 0x04d9, 0x0308, 0x0002, 0x0416,
+   0x0308, 0x0002, 0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437,
+   0x0308, 0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002, 0x0418,
+   0x0308, 0x0002, 0x0438, 0x0308, 0x0002, 0x041e, 0x0308, 0x0002, 0x043e,
+   0x0308, 0x0002, 0x04e8, 0x0308, 0x0002, 0x04e9, 0x0308, 0x0002, 0x042d,
+   0x0308, 0x0002, 0x044d, 0x0308, 0x0002, 0x0423, 0x0304, 0x0002, 0x0443,
+   0x0304, 0x0002, 0x0423, 0x0308, 0x0002, 0x0443, 0x0308, 0x0002, 0x0423,
+   0x030b, 0x0002, 0x0443, 0x030b, 0x0002, 0x0427, 0x0308, 0x0002, 0x0447,
+   0x0308, 0x0002, 0x042b, 0x0308, 0x0002, 0x044b, 0x0308, 0x0002, 0x0565,
+   0x0582, 0x0002, 0x0627, 0x0653, 0x0002, 0x0627, 0x0654, 0x0002, 0x0648,
+   0x0654, 0x0002, 0x0627, 0x0655, 0x0002, 0x064a, 0x0654, 0x0002, 0x0627,
+   0x0674, 0x0002, 0x0648, 0x0674, 0x0002, 0x06c7, 0x0674, 0x0002, 0x064a,
+   0x0674, 0x0002, 0x06d5, 0x0654, 0x0002, 0x06c1, 0x0654, 0x0002, 0x06d2,
+   0x0654, 0x0002, 0x0928, 0x093c, 0x0002, 0x0930, 0x093c, 0x0002, 0x0933,
+   0x093c, 0x0002, 0x0915, 0x093c, 0x0002, 0x0916, 0x093c, 0x0002, 0x0917,
+   0x093c, 0x0002, 0x091c, 0x093c, 0x0002, 0x0921, 0x093c, 0x0002, 0x0922,
+   0x093c, 0x0002, 0x092b, 0x093c, 0x0002, 0x092f, 0x093c, 0x0002, 0x09c7,
+   0x09be, 0x0002, 0x09c7, 0x09d7, 0x0002, 0x09a1, 0x09bc, 0x0002, 0x09a2,
+   0x09bc, 0x0002, 0x09af, 0x09bc, 0x0002, 0x0a32, 0x0a3c, 0x0002, 0x0a38,
+   0x0a3c, 0x0002, 0x0a16, 0x0a3c, 0x0002, 0x0a17, 0x0a3c, 0x0002, 0x0a1c,
+   0x0a3c, 0x0002, 0x0a2b, 0x0a3c, 0x0002, 0x0b47, 0x0b56, 0x0002, 0x0b47,
+   0x0b3e, 0x0002, 0x0b47, 0x0b57, 0x0002, 0x0b21, 0x0b3c, 0x0002, 0x0b22,
+   0x0b3c, 0x0002, 0x0b92, 0x0bd7, 0x0002, 0x0bc6, 0x0bbe, 0x0002, 0x0bc7,
+   0x0bbe, 0x0002, 0x0bc6, 0x0bd7, 0x0002, 0x0c46, 0x0c56, 0x0002, 0x0cbf,
+   0x0cd5, 0x0002, 0x0cc6, 0x0cd5, 0x0002, 0x0cc6, 0x0cd6, 0x0002, 0x0cc6,
+   0x0cc2, 0x0003, 0x0cc6, 0x0cc2, 0x0cd5, 0x0002, 0x0d46, 0x0d3e, 0x0002,
+   0x0d47, 0x0d3e, 0x0002, 0x0d46, 0x0d57, 0x0002, 0x0dd9, 0x0dca, 0x0002,
+   0x0dd9, 0x0dcf, 0x0003, 0x0dd9, 0x0dcf, 0x0dca, 0x0002, 0x0dd9, 0x0ddf,
+   0x0002, 0x0e4d, 0x0e32, 0x0002, 0x0ecd, 0x0eb2, 0x0002, 0x0eab, 0x0e99,
+   0x0002, 0x0eab, 0x0ea1, 0x0001, 0x0f0b, 0x0002, 0x0f42, 0x0fb7, 0x0002,
+   0x0f4c, 0x0fb7, 0x0002, 0x0f51, 0x0fb7, 0x0002, 0x0f56, 0x0fb7, 0x0002,
+   0x0f5b, 0x0fb7, 0x0002, 0x0f40, 0x0fb5, 0x0002, 0x0f71, 0x0f72, 0x0002,
+   0x0f71, 0x0f74, 0x0002, 0x0fb2, 0x0f80, 0x0003, 0x0fb2, 0x0f71, 0x0f80,
+   0x0002, 0x0fb3, 0x0f80, 0x0003, 0x0fb3, 0x0f71, 0x0f80, 0x0002, 0x0f71,
+   0x0f80, 0x0002, 0x0f92, 0x0fb7, 0x0002, 0x0f9c, 0x0fb7, 0x0002, 0x0fa1,
+   0x0fb7, 0x0002, 0x0fa6, 0x0fb7, 0x0002, 0x0fab, 0x0fb7, 0x0002, 0x0f90,
+   0x0fb5, 0x0002, 0x1025, 0x102e, 0x0002, 0x0041, 0x0325, 0x0002, 0x0061,
+   0x0325, 0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042,
+   0x0323, 0x0002, 0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002, 0x0062,
+   0x0331, 0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063, 0x0327, 0x0301,
+   0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307, 0x0002, 0x0044, 0x0323,
+   0x0002, 0x0064, 0x0323, 0x0002, 0x0044, 0x0331, 0x0002, 0x0064, 0x0331,
+   0x0002, 0x0044, 0x0327, 0x0002, 0x0064, 0x0327, 0x0002, 0x0044, 0x032d,
+   0x0002, 0x0064, 0x032d, 0x0003, 0x0045, 0x0304, 0x0300, 0x0003, 0x0065,
+   0x0304, 0x0300, 0x0003, 0x0045, 0x0304, 0x0301, 0x0003, 0x0065, 0x0304,
+   0x0301, 0x0002, 0x0045, 0x032d, 0x0002, 0x0065, 0x032d, 0x0002, 0x0045,
+   0x0330, 0x0002, 0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306, 0x0003,
+   0x0065, 0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002, 0x0066, 0x0307,
+   0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304, 0x0002, 0x0048, 0x0307,
+   0x0002, 0x0068, 0x0307, 0x0002, 0x0048, 0x0323, 0x0002, 0x0068, 0x0323,
+   0x0002, 0x0048, 0x0308, 0x0002, 0x0068, 0x0308, 0x0002, 0x0048, 0x0327,
+   0x0002, 0x0068, 0x0327, 0x0002, 0x0048, 0x032e, 0x0002, 0x0068, 0x032e,
+   0x0002, 0x0049, 0x0330, 0x0002, 0x0069, 0x0330, 0x0003, 0x0049, 0x0308,
+   0x0301, 0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004b, 0x0301, 0x0002,
+   0x006b, 0x0301, 0x0002, 0x004b, 0x0323, 0x0002, 0x006b, 0x0323, 0x0002,
+   0x004b, 0x0331, 0x0002, 0x006b, 0x0331, 0x0002, 0x004c, 0x0323, 0x0002,
+   0x006c, 0x0323, 0x0003, 0x004c, 0x0323, 0x0304, 0x0003, 0x006c, 0x0323,
+   0x0304, 0x0002, 0x004c, 0x0331, 0x0002, 0x006c, 0x0331, 0x0002, 0x004c,
+   0x032d, 0x0002, 0x006c, 0x032d, 0x0002, 0x004d, 0x0301, 0x0002, 0x006d,
+   0x0301, 0x0002, 0x004d, 0x0307, 0x0002, 0x006d, 0x0307, 0x0002, 0x004d,
+   0x0323, 0x0002, 0x006d, 0x0323, 0x0002, 0x004e, 0x0307, 0x0002, 0x006e,
+   0x0307, 0x0002, 0x004e, 0x0323, 0x0002, 0x006e, 0x0323, 0x0002, 0x004e,
+   0x0331, 0x0002, 0x006e, 0x0331, 0x0002, 0x004e, 0x032d, 0x0002, 0x006e,
+   0x032d, 0x0003, 0x004f, 0x0303, 0x0301, 0x0003, 0x006f, 0x0303, 0x0301,
+   0x0003, 0x004f, 0x0303, 0x0308, 0x0003, 0x006f, 0x0303, 0x0308, 0x0003,
+   0x004f, 0x0304, 0x0300, 0x0003, 0x006f, 0x0304, 0x0300, 0x0003, 0x004f,
+   0x0304, 0x0301, 0x0003, 0x006f, 0x0304, 0x0301, 0x0002, 0x0050, 0x0301,
+   0x0002, 0x0070, 0x0301, 0x0002, 0x0050, 0x0307, 0x0002, 0x0070, 0x0307,
+   0x0002, 0x0052, 0x0307, 0x0002, 0x0072, 0x0307, 0x0002, 0x0052, 0x0323,
+   0x0002, 0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072,
+   0x0323, 0x0304, 0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331, 0x0002,
+   0x0053, 0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053, 0x0323, 0x0002,
+   0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307, 0x0003, 0x0073, 0x0301,
+   0x0307, 0x0003, 0x0053, 0x030c, 0x0307, 0x0003, 0x0073, 0x030c, 0x0307,
+   0x0003, 0x0053, 0x0323, 0x0307, 0x0003, 0x0073, 0x0323, 0x0307, 0x0002,
+   0x0054, 0x0307, 0x0002, 0x0074, 0x0307, 0x0002, 0x0054, 0x0323, 0x0002,
+   0x0074, 0x0323, 0x0002, 0x0054, 0x0331, 0x0002, 0x0074, 0x0331, 0x0002,
+   0x0054, 0x032d, 0x0002, 0x0074, 0x032d, 0x0002, 0x0055, 0x0324, 0x0002,
+   0x0075, 0x0324, 0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330, 0x0002,
+   0x0055, 0x032d, 0x0002, 0x0075, 0x032d, 0x0003, 0x0055, 0x0303, 0x0301,
+   0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055, 0x0304, 0x0308, 0x0003,
+   0x0075, 0x0304, 0x0308, 0x0002, 0x0056, 0x0303, 0x0002, 0x0076, 0x0303,
+   0x0002, 0x0056, 0x0323, 0x0002, 0x0076, 0x0323, 0x0002, 0x0057, 0x0300,
+   0x0002, 0x0077, 0x0300, 0x0002, 0x0057, 0x0301, 0x0002, 0x0077, 0x0301,
+   0x0002, 0x0057, 0x0308, 0x0002, 0x0077, 0x0308, 0x0002, 0x0057, 0x0307,
+   0x0002, 0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323,
+   0x0002, 0x0058, 0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058, 0x0308,
+   0x0002, 0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002, 0x0079, 0x0307,
+   0x0002, 0x005a, 0x0302, 0x0002, 0x007a, 0x0302, 0x0002, 0x005a, 0x0323,
+   0x0002, 0x007a, 0x0323, 0x0002, 0x005a, 0x0331, 0x0002, 0x007a, 0x0331,
+   0x0002, 0x0068, 0x0331, 0x0002, 0x0074, 0x0308, 0x0002, 0x0077, 0x030a,
+   0x0002, 0x0079, 0x030a, 0x0002, 0x0061, 0x02be, 0x0002, 0x0041, 0x0323,
+   0x0002, 0x0061, 0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309,
+   0x0003, 0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301, 0x0003,
+   0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300, 0x0003, 0x0041,
+   0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309, 0x0003, 0x0041, 0x0302,
+   0x0303, 0x0003, 0x0061, 0x0302, 0x0303, 0x0003, 0x0041, 0x0323, 0x0302,
+   0x0003, 0x0061, 0x0323, 0x0302, 0x0003, 0x0041, 0x0306, 0x0301, 0x0003,
+   0x0061, 0x0306, 0x0301, 0x0003, 0x0041, 0x0306, 0x0300, 0x0003, 0x0061,
+   0x0306, 0x0300, 0x0003, 0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306,
+   0x0309, 0x0003, 0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303,
+   0x0003, 0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306, 0x0002,
+   0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045, 0x0309, 0x0002,
+   0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002, 0x0065, 0x0303, 0x0003,
+   0x0045, 0x0302, 0x0301, 0x0003, 0x0065, 0x0302, 0x0301, 0x0003, 0x0045,
+   0x0302, 0x0300, 0x0003, 0x0065, 0x0302, 0x0300, 0x0003, 0x0045, 0x0302,
+   0x0309, 0x0003, 0x0065, 0x0302, 0x0309, 0x0003, 0x0045, 0x0302, 0x0303,
+   0x0003, 0x0065, 0x0302, 0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003,
+   0x0065, 0x0323, 0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309,
+   0x0002, 0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004f, 0x0323,
+   0x0002, 0x006f, 0x0323, 0x0002, 0x004f, 0x0309, 0x0002, 0x006f, 0x0309,
+   0x0003, 0x004f, 0x0302, 0x0301, 0x0003, 0x006f, 0x0302, 0x0301, 0x0003,
+   0x004f, 0x0302, 0x0300, 0x0003, 0x006f, 0x0302, 0x0300, 0x0003, 0x004f,
+   0x0302, 0x0309, 0x0003, 0x006f, 0x0302, 0x0309, 0x0003, 0x004f, 0x0302,
+   0x0303, 0x0003, 0x006f, 0x0302, 0x0303, 0x0003, 0x004f, 0x0323, 0x0302,
+   0x0003, 0x006f, 0x0323, 0x0302, 0x0003, 0x004f, 0x031b, 0x0301, 0x0003,
+   0x006f, 0x031b, 0x0301, 0x0003, 0x004f, 0x031b, 0x0300, 0x0003, 0x006f,
+   0x031b, 0x0300, 0x0003, 0x004f, 0x031b, 0x0309, 0x0003, 0x006f, 0x031b,
+   0x0309, 0x0003, 0x004f, 0x031b, 0x0303, 0x0003, 0x006f, 0x031b, 0x0303,
+   0x0003, 0x004f, 0x031b, 0x0323, 0x0003, 0x006f, 0x031b, 0x0323, 0x0002,
+   0x0055, 0x0323, 0x0002, 0x0075, 0x0323, 0x0002, 0x0055, 0x0309, 0x0002,
+   0x0075, 0x0309, 0x0003, 0x0055, 0x031b, 0x0301, 0x0003, 0x0075, 0x031b,
+   0x0301, 0x0003, 0x0055, 0x031b, 0x0300, 0x0003, 0x0075, 0x031b, 0x0300,
+   0x0003, 0x0055, 0x031b, 0x0309, 0x0003, 0x0075, 0x031b, 0x0309, 0x0003,
+   0x0055, 0x031b, 0x0303, 0x0003, 0x0075, 0x031b, 0x0303, 0x0003, 0x0055,
+   0x031b, 0x0323, 0x0003, 0x0075, 0x031b, 0x0323, 0x0002, 0x0059, 0x0300,
+   0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002, 0x0079, 0x0323,
+   0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309, 0x0002, 0x0059, 0x0303,
+   0x0002, 0x0079, 0x0303, 0x0002, 0x03b1, 0x0313, 0x0002, 0x03b1, 0x0314,
+   0x0003, 0x03b1, 0x0313, 0x0300, 0x0003, 0x03b1, 0x0314, 0x0300, 0x0003,
+   0x03b1, 0x0313, 0x0301, 0x0003, 0x03b1, 0x0314, 0x0301, 0x0003, 0x03b1,
+   0x0313, 0x0342, 0x0003, 0x03b1, 0x0314, 0x0342, 0x0002, 0x0391, 0x0313,
+   0x0002, 0x0391, 0x0314, 0x0003, 0x0391, 0x0313, 0x0300, 0x0003, 0x0391,
+   0x0314, 0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391, 0x0314,
+   0x0301, 0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391, 0x0314, 0x0342,
+   0x0002, 0x03b5, 0x0313, 0x0002, 0x03b5, 0x0314, 0x0003, 0x03b5, 0x0313,
+   0x0300, 0x0003, 0x03b5, 0x0314, 0x0300, 0x0003, 0x03b5, 0x0313, 0x0301,
+   0x0003, 0x03b5, 0x0314, 0x0301, 0x0002, 0x0395, 0x0313, 0x0002, 0x0395,
+   0x0314, 0x0003, 0x0395, 0x0313, 0x0300, 0x0003, 0x0395, 0x0314, 0x0300,
+   0x0003, 0x0395, 0x0313, 0x0301, 0x0003, 0x0395, 0x0314, 0x0301, 0x0002,
+   0x03b7, 0x0313, 0x0002, 0x03b7, 0x0314, 0x0003, 0x03b7, 0x0313, 0x0300,
+   0x0003, 0x03b7, 0x0314, 0x0300, 0x0003, 0x03b7, 0x0313, 0x0301, 0x0003,
+   0x03b7, 0x0314, 0x0301, 0x0003, 0x03b7, 0x0313, 0x0342, 0x0003, 0x03b7,
+   0x0314, 0x0342, 0x0002, 0x0397, 0x0313, 0x0002, 0x0397, 0x0314, 0x0003,
+   0x0397, 0x0313, 0x0300, 0x0003, 0x0397, 0x0314, 0x0300, 0x0003, 0x0397,
+   0x0313, 0x0301, 0x0003, 0x0397, 0x0314, 0x0301, 0x0003, 0x0397, 0x0313,
+   0x0342, 0x0003, 0x0397, 0x0314, 0x0342, 0x0002, 0x03b9, 0x0313, 0x0002,
+   0x03b9, 0x0314, 0x0003, 0x03b9, 0x0313, 0x0300, 0x0003, 0x03b9, 0x0314,
+   0x0300, 0x0003, 0x03b9, 0x0313, 0x0301, 0x0003, 0x03b9, 0x0314, 0x0301,
+   0x0003, 0x03b9, 0x0313, 0x0342, 0x0003, 0x03b9, 0x0314, 0x0342, 0x0002,
+   0x0399, 0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399, 0x0313, 0x0300,
+   0x0003, 0x0399, 0x0314, 0x0300, 0x0003, 0x0399, 0x0313, 0x0301, 0x0003,
+   0x0399, 0x0314, 0x0301, 0x0003, 0x0399, 0x0313, 0x0342, 0x0003, 0x0399,
+   0x0314, 0x0342, 0x0002, 0x03bf, 0x0313, 0x0002, 0x03bf, 0x0314, 0x0003,
+   0x03bf, 0x0313, 0x0300, 0x0003, 0x03bf, 0x0314, 0x0300, 0x0003, 0x03bf,
+   0x0313, 0x0301, 0x0003, 0x03bf, 0x0314, 0x0301, 0x0002, 0x039f, 0x0313,
+   0x0002, 0x039f, 0x0314, 0x0003, 0x039f, 0x0313, 0x0300, 0x0003, 0x039f,
+   0x0314, 0x0300, 0x0003, 0x039f, 0x0313, 0x0301, 0x0003, 0x039f, 0x0314,
+   0x0301, 0x0002, 0x03c5, 0x0313, 0x0002, 0x03c5, 0x0314, 0x0003, 0x03c5,
+   0x0313, 0x0300, 0x0003, 0x03c5, 0x0314, 0x0300, 0x0003, 0x03c5, 0x0313,
+   0x0301, 0x0003, 0x03c5, 0x0314, 0x0301, 0x0003, 0x03c5, 0x0313, 0x0342,
+   0x0003, 0x03c5, 0x0314, 0x0342, 0x0002, 0x03a5, 0x0314, 0x0003, 0x03a5,
+   0x0314, 0x0300, 0x0003, 0x03a5, 0x0314, 0x0301, 0x0003, 0x03a5, 0x0314,
+   0x0342, 0x0002, 0x03c9, 0x0313, 0x0002, 0x03c9, 0x0314, 0x0003, 0x03c9,
+   0x0313, 0x0300, 0x0003, 0x03c9, 0x0314, 0x0300, 0x0003, 0x03c9, 0x0313,
+   0x0301, 0x0003, 0x03c9, 0x0314, 0x0301, 0x0003, 0x03c9, 0x0313, 0x0342,
+   0x0003, 0x03c9, 0x0314, 0x0342, 0x0002, 0x03a9, 0x0313, 0x0002, 0x03a9,
+   0x0314, 0x0003, 0x03a9, 0x0313, 0x0300, 0x0003, 0x03a9, 0x0314, 0x0300,
+   0x0003, 0x03a9, 0x0313, 0x0301, 0x0003, 0x03a9, 0x0314, 0x0301, 0x0003,
+   0x03a9, 0x0313, 0x0342, 0x0003, 0x03a9, 0x0314, 0x0342, 0x0002, 0x03b1,
+   0x0300, 0x0002, 0x03b5, 0x0300, 0x0002, 0x03b7, 0x0300, 0x0002, 0x03b9,
+   0x0300, 0x0002, 0x03bf, 0x0300, 0x0002, 0x03c5, 0x0300, 0x0002, 0x03c9,
+   0x0300, 0x0003, 0x03b1, 0x0313, 0x0345, 0x0003, 0x03b1, 0x0314, 0x0345,
+   0x0004, 0x03b1, 0x0313, 0x0300, 0x0345, 0x0004, 0x03b1, 0x0314, 0x0300,
+   0x0345, 0x0004, 0x03b1, 0x0313, 0x0301, 0x0345, 0x0004, 0x03b1, 0x0314,
+   0x0301, 0x0345, 0x0004, 0x03b1, 0x0313, 0x0342, 0x0345, 0x0004, 0x03b1,
+   0x0314, 0x0342, 0x0345, 0x0003, 0x0391, 0x0313, 0x0345, 0x0003, 0x0391,
+   0x0314, 0x0345, 0x0004, 0x0391, 0x0313, 0x0300, 0x0345, 0x0004, 0x0391,
+   0x0314, 0x0300, 0x0345, 0x0004, 0x0391, 0x0313, 0x0301, 0x0345, 0x0004,
+   0x0391, 0x0314, 0x0301, 0x0345, 0x0004, 0x0391, 0x0313, 0x0342, 0x0345,
+   0x0004, 0x0391, 0x0314, 0x0342, 0x0345, 0x0003, 0x03b7, 0x0313, 0x0345,
+   0x0003, 0x03b7, 0x0314, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0300, 0x0345,
+   0x0004, 0x03b7, 0x0314, 0x0300, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0301,
+   0x0345, 0x0004, 0x03b7, 0x0314, 0x0301, 0x0345, 0x0004, 0x03b7, 0x0313,
+   0x0342, 0x0345, 0x0004, 0x03b7, 0x0314, 0x0342, 0x0345, 0x0003, 0x0397,
+   0x0313, 0x0345, 0x0003, 0x0397, 0x0314, 0x0345, 0x0004, 0x0397, 0x0313,
+   0x0300, 0x0345, 0x0004, 0x0397, 0x0314, 0x0300, 0x0345, 0x0004, 0x0397,
+   0x0313, 0x0301, 0x0345, 0x0004, 0x0397, 0x0314, 0x0301, 0x0345, 0x0004,
+   0x0397, 0x0313, 0x0342, 0x0345, 0x0004, 0x0397, 0x0314, 0x0342, 0x0345,
+   0x0003, 0x03c9, 0x0313, 0x0345, 0x0003, 0x03c9, 0x0314, 0x0345, 0x0004,
+   0x03c9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03c9, 0x0314, 0x0300, 0x0345,
+   0x0004, 0x03c9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03c9, 0x0314, 0x0301,
+   0x0345, 0x0004, 0x03c9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03c9, 0x0314,
+   0x0342, 0x0345, 0x0003, 0x03a9, 0x0313, 0x0345, 0x0003, 0x03a9, 0x0314,
+   0x0345, 0x0004, 0x03a9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03a9, 0x0314,
+   0x0300, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03a9,
+   0x0314, 0x0301, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0342, 0x0345, 0x0004,
+   0x03a9, 0x0314, 0x0342, 0x0345, 0x0002, 0x03b1, 0x0306, 0x0002, 0x03b1,
+   0x0304, 0x0003, 0x03b1, 0x0300, 0x0345, 0x0002, 0x03b1, 0x0345, 0x0003,
+   0x03b1, 0x0301, 0x0345, 0x0002, 0x03b1, 0x0342, 0x0003, 0x03b1, 0x0342,
+   0x0345, 0x0002, 0x0391, 0x0306, 0x0002, 0x0391, 0x0304, 0x0002, 0x0391,
+   0x0300, 0x0002, 0x0391, 0x0345, 0x0002, 0x0020, 0x0313, 0x0001, 0x03b9,
+   0x0002, 0x0020, 0x0342, 0x0003, 0x0020, 0x0308, 0x0342, 0x0003, 0x03b7,
+   0x0300, 0x0345, 0x0002, 0x03b7, 0x0345, 0x0003, 0x03b7, 0x0301, 0x0345,
+   0x0002, 0x03b7, 0x0342, 0x0003, 0x03b7, 0x0342, 0x0345, 0x0002, 0x0395,
+   0x0300, 0x0002, 0x0397, 0x0300, 0x0002, 0x0397, 0x0345, 0x0003, 0x0020,
+   0x0313, 0x0300, 0x0003, 0x0020, 0x0313, 0x0301, 0x0003, 0x0020, 0x0313,
+   0x0342, 0x0002, 0x03b9, 0x0306, 0x0002, 0x03b9, 0x0304, 0x0003, 0x03b9,
+   0x0308, 0x0300, 0x0002, 0x03b9, 0x0342, 0x0003, 0x03b9, 0x0308, 0x0342,
+   0x0002, 0x0399, 0x0306, 0x0002, 0x0399, 0x0304, 0x0002, 0x0399, 0x0300,
+   0x0003, 0x0020, 0x0314, 0x0300, 0x0003, 0x0020, 0x0314, 0x0301, 0x0003,
+   0x0020, 0x0314, 0x0342, 0x0002, 0x03c5, 0x0306, 0x0002, 0x03c5, 0x0304,
+   0x0003, 0x03c5, 0x0308, 0x0300, 0x0002, 0x03c1, 0x0313, 0x0002, 0x03c1,
+   0x0314, 0x0002, 0x03c5, 0x0342, 0x0003, 0x03c5, 0x0308, 0x0342, 0x0002,
+   0x03a5, 0x0306, 0x0002, 0x03a5, 0x0304, 0x0002, 0x03a5, 0x0300, 0x0002,
+   0x03a1, 0x0314, 0x0003, 0x0020, 0x0308, 0x0300, 0x0001, 0x0060, 0x0003,
+   0x03c9, 0x0300, 0x0345, 0x0002, 0x03c9, 0x0345, 0x0003, 0x03c9, 0x0301,
+   0x0345, 0x0002, 0x03c9, 0x0342, 0x0003, 0x03c9, 0x0342, 0x0345, 0x0002,
+   0x039f, 0x0300, 0x0002, 0x03a9, 0x0300, 0x0002, 0x03a9, 0x0345, 0x0002,
+   0x0020, 0x0314, 0x0001, 0x2010, 0x0002, 0x0020, 0x0333, 0x0001, 0x002e,
+   0x0002, 0x002e, 0x002e, 0x0003, 0x002e, 0x002e, 0x002e, 0x0002, 0x2032,
+   0x2032, 0x0003, 0x2032, 0x2032, 0x2032, 0x0002, 0x2035, 0x2035, 0x0003,
+   0x2035, 0x2035, 0x2035, 0x0002, 0x0021, 0x0021, 0x0002, 0x0020, 0x0305,
+   0x0002, 0x003f, 0x003f, 0x0002, 0x003f, 0x0021, 0x0002, 0x0021, 0x003f,
+   0x0004, 0x2032, 0x2032, 0x2032, 0x2032, 0x0001, 0x0030, 0x0001, 0x0069,
+   0x0001, 0x0034, 0x0001, 0x0035, 0x0001, 0x0036, 0x0001, 0x0037, 0x0001,
+   0x0038, 0x0001, 0x0039, 0x0001, 0x002b, 0x0001, 0x2212, 0x0001, 0x003d,
+   0x0001, 0x0028, 0x0001, 0x0029, 0x0001, 0x006e, 0x0002, 0x0052, 0x0073,
+   0x0003, 0x0061, 0x002f, 0x0063, 0x0003, 0x0061, 0x002f, 0x0073, 0x0001,
+   0x0043, 0x0002, 0x00b0, 0x0043, 0x0003, 0x0063, 0x002f, 0x006f, 0x0003,
+   0x0063, 0x002f, 0x0075, 0x0001, 0x0190, 0x0002, 0x00b0, 0x0046, 0x0001,
+   0x0067, 0x0001, 0x0048, 0x0001, 0x0127, 0x0001, 0x0049, 0x0001, 0x004c,
+   0x0001, 0x004e, 0x0002, 0x004e, 0x006f, 0x0001, 0x0050, 0x0001, 0x0051,
+   0x0001, 0x0052, 0x0002, 0x0053, 0x004d, 0x0003, 0x0054, 0x0045, 0x004c,
+   0x0002, 0x0054, 0x004d, 0x0001, 0x005a, 0x0001, 0x03a9, 0x0001, 0x004b,
+   0x0001, 0x0042, 0x0001, 0x0065, 0x0001, 0x0045, 0x0001, 0x0046, 0x0001,
+   0x004d, 0x0001, 0x05d0, 0x0001, 0x05d1, 0x0001, 0x05d2, 0x0001, 0x05d3,
+   0x0001, 0x03b3, 0x0001, 0x0393, 0x0001, 0x03a0, 0x0001, 0x2211, 0x0001,
+   0x0044, 0x0001, 0x0064, 0x0003, 0x0031, 0x2044, 0x0033, 0x0003, 0x0032,
+   0x2044, 0x0033, 0x0003, 0x0031, 0x2044, 0x0035, 0x0003, 0x0032, 0x2044,
+   0x0035, 0x0003, 0x0033, 0x2044, 0x0035, 0x0003, 0x0034, 0x2044, 0x0035,
+   0x0003, 0x0031, 0x2044, 0x0036, 0x0003, 0x0035, 0x2044, 0x0036, 0x0003,
+   0x0031, 0x2044, 0x0038, 0x0003, 0x0033, 0x2044, 0x0038, 0x0003, 0x0035,
+   0x2044, 0x0038, 0x0003, 0x0037, 0x2044, 0x0038, 0x0002, 0x0031, 0x2044,
+   0x0002, 0x0049, 0x0049, 0x0003, 0x0049, 0x0049, 0x0049, 0x0002, 0x0049,
+   0x0056, 0x0001, 0x0056, 0x0002, 0x0056, 0x0049, 0x0003, 0x0056, 0x0049,
+   0x0049, 0x0004, 0x0056, 0x0049, 0x0049, 0x0049, 0x0002, 0x0049, 0x0058,
+   0x0001, 0x0058, 0x0002, 0x0058, 0x0049, 0x0003, 0x0058, 0x0049, 0x0049,
+   0x0002, 0x0069, 0x0069, 0x0003, 0x0069, 0x0069, 0x0069, 0x0002, 0x0069,
+   0x0076, 0x0001, 0x0076, 0x0002, 0x0076, 0x0069, 0x0003, 0x0076, 0x0069,
+   0x0069, 0x0004, 0x0076, 0x0069, 0x0069, 0x0069, 0x0002, 0x0069, 0x0078,
+   0x0002, 0x0078, 0x0069, 0x0003, 0x0078, 0x0069, 0x0069, 0x0001, 0x0063,
+   0x0001, 0x006d, 0x0002, 0x2190, 0x0338, 0x0002, 0x2192, 0x0338, 0x0002,
+   0x2194, 0x0338, 0x0002, 0x21d0, 0x0338, 0x0002, 0x21d4, 0x0338, 0x0002,
+   0x21d2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338, 0x0002,
+   0x220b, 0x0338, 0x0002, 0x2223, 0x0338, 0x0002, 0x2225, 0x0338, 0x0002,
+   0x222b, 0x222b, 0x0003, 0x222b, 0x222b, 0x222b, 0x0002, 0x222e, 0x222e,
+   0x0003, 0x222e, 0x222e, 0x222e, 0x0002, 0x223c, 0x0338, 0x0002, 0x2243,
+   0x0338, 0x0002, 0x2245, 0x0338, 0x0002, 0x2248, 0x0338, 0x0002, 0x003d,
+   0x0338, 0x0002, 0x2261, 0x0338, 0x0002, 0x224d, 0x0338, 0x0002, 0x003c,
+   0x0338, 0x0002, 0x003e, 0x0338, 0x0002, 0x2264, 0x0338, 0x0002, 0x2265,
+   0x0338, 0x0002, 0x2272, 0x0338, 0x0002, 0x2273, 0x0338, 0x0002, 0x2276,
+   0x0338, 0x0002, 0x2277, 0x0338, 0x0002, 0x227a, 0x0338, 0x0002, 0x227b,
+   0x0338, 0x0002, 0x2282, 0x0338, 0x0002, 0x2283, 0x0338, 0x0002, 0x2286,
+   0x0338, 0x0002, 0x2287, 0x0338, 0x0002, 0x22a2, 0x0338, 0x0002, 0x22a8,
+   0x0338, 0x0002, 0x22a9, 0x0338, 0x0002, 0x22ab, 0x0338, 0x0002, 0x227c,
+   0x0338, 0x0002, 0x227d, 0x0338, 0x0002, 0x2291, 0x0338, 0x0002, 0x2292,
+   0x0338, 0x0002, 0x22b2, 0x0338, 0x0002, 0x22b3, 0x0338, 0x0002, 0x22b4,
+   0x0338, 0x0002, 0x22b5, 0x0338, 0x0001, 0x3008, 0x0001, 0x3009, 0x0002,
+   0x0031, 0x0030, 0x0002, 0x0031, 0x0031, 0x0002, 0x0031, 0x0032, 0x0002,
+   0x0031, 0x0033, 0x0002, 0x0031, 0x0034, 0x0002, 0x0031, 0x0035, 0x0002,
+   0x0031, 0x0036, 0x0002, 0x0031, 0x0037, 0x0002, 0x0031, 0x0038, 0x0002,
+   0x0031, 0x0039, 0x0002, 0x0032, 0x0030, 0x0003, 0x0028, 0x0031, 0x0029,
+   0x0003, 0x0028, 0x0032, 0x0029, 0x0003, 0x0028, 0x0033, 0x0029, 0x0003,
+   0x0028, 0x0034, 0x0029, 0x0003, 0x0028, 0x0035, 0x0029, 0x0003, 0x0028,
+   0x0036, 0x0029, 0x0003, 0x0028, 0x0037, 0x0029, 0x0003, 0x0028, 0x0038,
+   0x0029, 0x0003, 0x0028, 0x0039, 0x0029, 0x0004, 0x0028, 0x0031, 0x0030,
+   0x0029, 0x0004, 0x0028, 0x0031, 0x0031, 0x0029, 0x0004, 0x0028, 0x0031,
+   0x0032, 0x0029, 0x0004, 0x0028, 0x0031, 0x0033, 0x0029, 0x0004, 0x0028,
+   0x0031, 0x0034, 0x0029, 0x0004, 0x0028, 0x0031, 0x0035, 0x0029, 0x0004,
+   0x0028, 0x0031, 0x0036, 0x0029, 0x0004, 0x0028, 0x0031, 0x0037, 0x0029,
+   0x0004, 0x0028, 0x0031, 0x0038, 0x0029, 0x0004, 0x0028, 0x0031, 0x0039,
+   0x0029, 0x0004, 0x0028, 0x0032, 0x0030, 0x0029, 0x0002, 0x0031, 0x002e,
+   0x0002, 0x0032, 0x002e, 0x0002, 0x0033, 0x002e, 0x0002, 0x0034, 0x002e,
+   0x0002, 0x0035, 0x002e, 0x0002, 0x0036, 0x002e, 0x0002, 0x0037, 0x002e,
+   0x0002, 0x0038, 0x002e, 0x0002, 0x0039, 0x002e, 0x0003, 0x0031, 0x0030,
+   0x002e, 0x0003, 0x0031, 0x0031, 0x002e, 0x0003, 0x0031, 0x0032, 0x002e,
+   0x0003, 0x0031, 0x0033, 0x002e, 0x0003, 0x0031, 0x0034, 0x002e, 0x0003,
+   0x0031, 0x0035, 0x002e, 0x0003, 0x0031, 0x0036, 0x002e, 0x0003, 0x0031,
+   0x0037, 0x002e, 0x0003, 0x0031, 0x0038, 0x002e, 0x0003, 0x0031, 0x0039,
+   0x002e, 0x0003, 0x0032, 0x0030, 0x002e, 0x0003, 0x0028, 0x0061, 0x0029,
+   0x0003, 0x0028, 0x0062, 0x0029, 0x0003, 0x0028, 0x0063, 0x0029, 0x0003,
+   0x0028, 0x0064, 0x0029, 0x0003, 0x0028, 0x0065, 0x0029, 0x0003, 0x0028,
+   0x0066, 0x0029, 0x0003, 0x0028, 0x0067, 0x0029, 0x0003, 0x0028, 0x0068,
+   0x0029, 0x0003, 0x0028, 0x0069, 0x0029, 0x0003, 0x0028, 0x006a, 0x0029,
+   0x0003, 0x0028, 0x006b, 0x0029, 0x0003, 0x0028, 0x006c, 0x0029, 0x0003,
+   0x0028, 0x006d, 0x0029, 0x0003, 0x0028, 0x006e, 0x0029, 0x0003, 0x0028,
+   0x006f, 0x0029, 0x0003, 0x0028, 0x0070, 0x0029, 0x0003, 0x0028, 0x0071,
+   0x0029, 0x0003, 0x0028, 0x0072, 0x0029, 0x0003, 0x0028, 0x0073, 0x0029,
+   0x0003, 0x0028, 0x0074, 0x0029, 0x0003, 0x0028, 0x0075, 0x0029, 0x0003,
+   0x0028, 0x0076, 0x0029, 0x0003, 0x0028, 0x0077, 0x0029, 0x0003, 0x0028,
+   0x0078, 0x0029, 0x0003, 0x0028, 0x0079, 0x0029, 0x0003, 0x0028, 0x007a,
+   0x0029, 0x0001, 0x0041, 0x0001, 0x0047, 0x0001, 0x004a, 0x0001, 0x004f,
+   0x0001, 0x0053, 0x0001, 0x0054, 0x0001, 0x0055, 0x0001, 0x0057, 0x0001,
+   0x0059, 0x0001, 0x0062, 0x0001, 0x0066, 0x0001, 0x006b, 0x0001, 0x0070,
+   0x0001, 0x0071, 0x0001, 0x0074, 0x0001, 0x0075, 0x0001, 0x007a, 0x0004,
+   0x222b, 0x222b, 0x222b, 0x222b, 0x0003, 0x003a, 0x003a, 0x003d, 0x0002,
+   0x003d, 0x003d, 0x0003, 0x003d, 0x003d, 0x003d, 0x0002, 0x2add, 0x0338,
+   0x0001, 0x6bcd, 0x0001, 0x9f9f, 0x0001, 0x4e00, 0x0001, 0x4e28, 0x0001,
+   0x4e36, 0x0001, 0x4e3f, 0x0001, 0x4e59, 0x0001, 0x4e85, 0x0001, 0x4e8c,
+   0x0001, 0x4ea0, 0x0001, 0x4eba, 0x0001, 0x513f, 0x0001, 0x5165, 0x0001,
+   0x516b, 0x0001, 0x5182, 0x0001, 0x5196, 0x0001, 0x51ab, 0x0001, 0x51e0,
+   0x0001, 0x51f5, 0x0001, 0x5200, 0x0001, 0x529b, 0x0001, 0x52f9, 0x0001,
+   0x5315, 0x0001, 0x531a, 0x0001, 0x5338, 0x0001, 0x5341, 0x0001, 0x535c,
+   0x0001, 0x5369, 0x0001, 0x5382, 0x0001, 0x53b6, 0x0001, 0x53c8, 0x0001,
+   0x53e3, 0x0001, 0x56d7, 0x0001, 0x571f, 0x0001, 0x58eb, 0x0001, 0x5902,
+   0x0001, 0x590a, 0x0001, 0x5915, 0x0001, 0x5927, 0x0001, 0x5973, 0x0001,
+   0x5b50, 0x0001, 0x5b80, 0x0001, 0x5bf8, 0x0001, 0x5c0f, 0x0001, 0x5c22,
+   0x0001, 0x5c38, 0x0001, 0x5c6e, 0x0001, 0x5c71, 0x0001, 0x5ddb, 0x0001,
+   0x5de5, 0x0001, 0x5df1, 0x0001, 0x5dfe, 0x0001, 0x5e72, 0x0001, 0x5e7a,
+   0x0001, 0x5e7f, 0x0001, 0x5ef4, 0x0001, 0x5efe, 0x0001, 0x5f0b, 0x0001,
+   0x5f13, 0x0001, 0x5f50, 0x0001, 0x5f61, 0x0001, 0x5f73, 0x0001, 0x5fc3,
+   0x0001, 0x6208, 0x0001, 0x6236, 0x0001, 0x624b, 0x0001, 0x652f, 0x0001,
+   0x6534, 0x0001, 0x6587, 0x0001, 0x6597, 0x0001, 0x65a4, 0x0001, 0x65b9,
+   0x0001, 0x65e0, 0x0001, 0x65e5, 0x0001, 0x66f0, 0x0001, 0x6708, 0x0001,
+   0x6728, 0x0001, 0x6b20, 0x0001, 0x6b62, 0x0001, 0x6b79, 0x0001, 0x6bb3,
+   0x0001, 0x6bcb, 0x0001, 0x6bd4, 0x0001, 0x6bdb, 0x0001, 0x6c0f, 0x0001,
+   0x6c14, 0x0001, 0x6c34, 0x0001, 0x706b, 0x0001, 0x722a, 0x0001, 0x7236,
+   0x0001, 0x723b, 0x0001, 0x723f, 0x0001, 0x7247, 0x0001, 0x7259, 0x0001,
+   0x725b, 0x0001, 0x72ac, 0x0001, 0x7384, 0x0001, 0x7389, 0x0001, 0x74dc,
+   0x0001, 0x74e6, 0x0001, 0x7518, 0x0001, 0x751f, 0x0001, 0x7528, 0x0001,
+   0x7530, 0x0001, 0x758b, 0x0001, 0x7592, 0x0001, 0x7676, 0x0001, 0x767d,
+   0x0001, 0x76ae, 0x0001, 0x76bf, 0x0001, 0x76ee, 0x0001, 0x77db, 0x0001,
+   0x77e2, 0x0001, 0x77f3, 0x0001, 0x793a, 0x0001, 0x79b8, 0x0001, 0x79be,
+   0x0001, 0x7a74, 0x0001, 0x7acb, 0x0001, 0x7af9, 0x0001, 0x7c73, 0x0001,
+   0x7cf8, 0x0001, 0x7f36, 0x0001, 0x7f51, 0x0001, 0x7f8a, 0x0001, 0x7fbd,
+   0x0001, 0x8001, 0x0001, 0x800c, 0x0001, 0x8012, 0x0001, 0x8033, 0x0001,
+   0x807f, 0x0001, 0x8089, 0x0001, 0x81e3, 0x0001, 0x81ea, 0x0001, 0x81f3,
+   0x0001, 0x81fc, 0x0001, 0x820c, 0x0001, 0x821b, 0x0001, 0x821f, 0x0001,
+   0x826e, 0x0001, 0x8272, 0x0001, 0x8278, 0x0001, 0x864d, 0x0001, 0x866b,
+   0x0001, 0x8840, 0x0001, 0x884c, 0x0001, 0x8863, 0x0001, 0x897e, 0x0001,
+   0x898b, 0x0001, 0x89d2, 0x0001, 0x8a00, 0x0001, 0x8c37, 0x0001, 0x8c46,
+   0x0001, 0x8c55, 0x0001, 0x8c78, 0x0001, 0x8c9d, 0x0001, 0x8d64, 0x0001,
+   0x8d70, 0x0001, 0x8db3, 0x0001, 0x8eab, 0x0001, 0x8eca, 0x0001, 0x8f9b,
+   0x0001, 0x8fb0, 0x0001, 0x8fb5, 0x0001, 0x9091, 0x0001, 0x9149, 0x0001,
+   0x91c6, 0x0001, 0x91cc, 0x0001, 0x91d1, 0x0001, 0x9577, 0x0001, 0x9580,
+   0x0001, 0x961c, 0x0001, 0x96b6, 0x0001, 0x96b9, 0x0001, 0x96e8, 0x0001,
+   0x9751, 0x0001, 0x975e, 0x0001, 0x9762, 0x0001, 0x9769, 0x0001, 0x97cb,
+   0x0001, 0x97ed, 0x0001, 0x97f3, 0x0001, 0x9801, 0x0001, 0x98a8, 0x0001,
+   0x98db, 0x0001, 0x98df, 0x0001, 0x9996, 0x0001, 0x9999, 0x0001, 0x99ac,
+   0x0001, 0x9aa8, 0x0001, 0x9ad8, 0x0001, 0x9adf, 0x0001, 0x9b25, 0x0001,
+   0x9b2f, 0x0001, 0x9b32, 0x0001, 0x9b3c, 0x0001, 0x9b5a, 0x0001, 0x9ce5,
+   0x0001, 0x9e75, 0x0001, 0x9e7f, 0x0001, 0x9ea5, 0x0001, 0x9ebb, 0x0001,
+   0x9ec3, 0x0001, 0x9ecd, 0x0001, 0x9ed1, 0x0001, 0x9ef9, 0x0001, 0x9efd,
+   0x0001, 0x9f0e, 0x0001, 0x9f13, 0x0001, 0x9f20, 0x0001, 0x9f3b, 0x0001,
+   0x9f4a, 0x0001, 0x9f52, 0x0001, 0x9f8d, 0x0001, 0x9f9c, 0x0001, 0x9fa0,
+   0x0001, 0x3012, 0x0001, 0x5344, 0x0001, 0x5345, 0x0002, 0x304b, 0x3099,
+   0x0002, 0x304d, 0x3099, 0x0002, 0x304f, 0x3099, 0x0002, 0x3051, 0x3099,
+   0x0002, 0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057, 0x3099,
+   0x0002, 0x3059, 0x3099, 0x0002, 0x305b, 0x3099, 0x0002, 0x305d, 0x3099,
+   0x0002, 0x305f, 0x3099, 0x0002, 0x3061, 0x3099, 0x0002, 0x3064, 0x3099,
+   0x0002, 0x3066, 0x3099, 0x0002, 0x3068, 0x3099, 0x0002, 0x306f, 0x3099,
+   0x0002, 0x306f, 0x309a, 0x0002, 0x3072, 0x3099, 0x0002, 0x3072, 0x309a,
+   0x0002, 0x3075, 0x3099, 0x0002, 0x3075, 0x309a, 0x0002, 0x3078, 0x3099,
+   0x0002, 0x3078, 0x309a, 0x0002, 0x307b, 0x3099, 0x0002, 0x307b, 0x309a,
+   0x0002, 0x3046, 0x3099, 0x0002, 0x0020, 0x3099, 0x0002, 0x0020, 0x309a,
+   0x0002, 0x309d, 0x3099, 0x0002, 0x3088, 0x308a, 0x0002, 0x30ab, 0x3099,
+   0x0002, 0x30ad, 0x3099, 0x0002, 0x30af, 0x3099, 0x0002, 0x30b1, 0x3099,
+   0x0002, 0x30b3, 0x3099, 0x0002, 0x30b5, 0x3099, 0x0002, 0x30b7, 0x3099,
+   0x0002, 0x30b9, 0x3099, 0x0002, 0x30bb, 0x3099, 0x0002, 0x30bd, 0x3099,
+   0x0002, 0x30bf, 0x3099, 0x0002, 0x30c1, 0x3099, 0x0002, 0x30c4, 0x3099,
+   0x0002, 0x30c6, 0x3099, 0x0002, 0x30c8, 0x3099, 0x0002, 0x30cf, 0x3099,
+   0x0002, 0x30cf, 0x309a, 0x0002, 0x30d2, 0x3099, 0x0002, 0x30d2, 0x309a,
+   0x0002, 0x30d5, 0x3099, 0x0002, 0x30d5, 0x309a, 0x0002, 0x30d8, 0x3099,
+   0x0002, 0x30d8, 0x309a, 0x0002, 0x30db, 0x3099, 0x0002, 0x30db, 0x309a,
+   0x0002, 0x30a6, 0x3099, 0x0002, 0x30ef, 0x3099, 0x0002, 0x30f0, 0x3099,
+   0x0002, 0x30f1, 0x3099, 0x0002, 0x30f2, 0x3099, 0x0002, 0x30fd, 0x3099,
+   0x0002, 0x30b3, 0x30c8, 0x0001, 0x1100, 0x0001, 0x1101, 0x0001, 0x11aa,
+   0x0001, 0x1102, 0x0001, 0x11ac, 0x0001, 0x11ad, 0x0001, 0x1103, 0x0001,
+   0x1104, 0x0001, 0x1105, 0x0001, 0x11b0, 0x0001, 0x11b1, 0x0001, 0x11b2,
+   0x0001, 0x11b3, 0x0001, 0x11b4, 0x0001, 0x11b5, 0x0001, 0x111a, 0x0001,
+   0x1106, 0x0001, 0x1107, 0x0001, 0x1108, 0x0001, 0x1121, 0x0001, 0x1109,
+   0x0001, 0x110a, 0x0001, 0x110b, 0x0001, 0x110c, 0x0001, 0x110d, 0x0001,
+   0x110e, 0x0001, 0x110f, 0x0001, 0x1110, 0x0001, 0x1111, 0x0001, 0x1112,
+   0x0001, 0x1161, 0x0001, 0x1162, 0x0001, 0x1163, 0x0001, 0x1164, 0x0001,
+   0x1165, 0x0001, 0x1166, 0x0001, 0x1167, 0x0001, 0x1168, 0x0001, 0x1169,
+   0x0001, 0x116a, 0x0001, 0x116b, 0x0001, 0x116c, 0x0001, 0x116d, 0x0001,
+   0x116e, 0x0001, 0x116f, 0x0001, 0x1170, 0x0001, 0x1171, 0x0001, 0x1172,
+   0x0001, 0x1173, 0x0001, 0x1174, 0x0001, 0x1175, 0x0001, 0x1160, 0x0001,
+   0x1114, 0x0001, 0x1115, 0x0001, 0x11c7, 0x0001, 0x11c8, 0x0001, 0x11cc,
+   0x0001, 0x11ce, 0x0001, 0x11d3, 0x0001, 0x11d7, 0x0001, 0x11d9, 0x0001,
+   0x111c, 0x0001, 0x11dd, 0x0001, 0x11df, 0x0001, 0x111d, 0x0001, 0x111e,
+   0x0001, 0x1120, 0x0001, 0x1122, 0x0001, 0x1123, 0x0001, 0x1127, 0x0001,
+   0x1129, 0x0001, 0x112b, 0x0001, 0x112c, 0x0001, 0x112d, 0x0001, 0x112e,
+   0x0001, 0x112f, 0x0001, 0x1132, 0x0001, 0x1136, 0x0001, 0x1140, 0x0001,
+   0x1147, 0x0001, 0x114c, 0x0001, 0x11f1, 0x0001, 0x11f2, 0x0001, 0x1157,
+   0x0001, 0x1158, 0x0001, 0x1159, 0x0001, 0x1184, 0x0001, 0x1185, 0x0001,
+   0x1188, 0x0001, 0x1191, 0x0001, 0x1192, 0x0001, 0x1194, 0x0001, 0x119e,
+   0x0001, 0x11a1, 0x0001, 0x4e09, 0x0001, 0x56db, 0x0001, 0x4e0a, 0x0001,
+   0x4e2d, 0x0001, 0x4e0b, 0x0001, 0x7532, 0x0001, 0x4e19, 0x0001, 0x4e01,
+   0x0001, 0x5929, 0x0001, 0x5730, 0x0003, 0x0028, 0x1100, 0x0029, 0x0003,
+   0x0028, 0x1102, 0x0029, 0x0003, 0x0028, 0x1103, 0x0029, 0x0003, 0x0028,
+   0x1105, 0x0029, 0x0003, 0x0028, 0x1106, 0x0029, 0x0003, 0x0028, 0x1107,
+   0x0029, 0x0003, 0x0028, 0x1109, 0x0029, 0x0003, 0x0028, 0x110b, 0x0029,
+   0x0003, 0x0028, 0x110c, 0x0029, 0x0003, 0x0028, 0x110e, 0x0029, 0x0003,
+   0x0028, 0x110f, 0x0029, 0x0003, 0x0028, 0x1110, 0x0029, 0x0003, 0x0028,
+   0x1111, 0x0029, 0x0003, 0x0028, 0x1112, 0x0029, 0x0004, 0x0028, 0x1100,
+   0x1161, 0x0029, 0x0004, 0x0028, 0x1102, 0x1161, 0x0029, 0x0004, 0x0028,
+   0x1103, 0x1161, 0x0029, 0x0004, 0x0028, 0x1105, 0x1161, 0x0029, 0x0004,
+   0x0028, 0x1106, 0x1161, 0x0029, 0x0004, 0x0028, 0x1107, 0x1161, 0x0029,
+   0x0004, 0x0028, 0x1109, 0x1161, 0x0029, 0x0004, 0x0028, 0x110b, 0x1161,
+   0x0029, 0x0004, 0x0028, 0x110c, 0x1161, 0x0029, 0x0004, 0x0028, 0x110e,
+   0x1161, 0x0029, 0x0004, 0x0028, 0x110f, 0x1161, 0x0029, 0x0004, 0x0028,
+   0x1110, 0x1161, 0x0029, 0x0004, 0x0028, 0x1111, 0x1161, 0x0029, 0x0004,
+   0x0028, 0x1112, 0x1161, 0x0029, 0x0004, 0x0028, 0x110c, 0x116e, 0x0029,
+   0x0003, 0x0028, 0x4e00, 0x0029, 0x0003, 0x0028, 0x4e8c, 0x0029, 0x0003,
+   0x0028, 0x4e09, 0x0029, 0x0003, 0x0028, 0x56db, 0x0029, 0x0003, 0x0028,
+   0x4e94, 0x0029, 0x0003, 0x0028, 0x516d, 0x0029, 0x0003, 0x0028, 0x4e03,
+   0x0029, 0x0003, 0x0028, 0x516b, 0x0029, 0x0003, 0x0028, 0x4e5d, 0x0029,
+   0x0003, 0x0028, 0x5341, 0x0029, 0x0003, 0x0028, 0x6708, 0x0029, 0x0003,
+   0x0028, 0x706b, 0x0029, 0x0003, 0x0028, 0x6c34, 0x0029, 0x0003, 0x0028,
+   0x6728, 0x0029, 0x0003, 0x0028, 0x91d1, 0x0029, 0x0003, 0x0028, 0x571f,
+   0x0029, 0x0003, 0x0028, 0x65e5, 0x0029, 0x0003, 0x0028, 0x682a, 0x0029,
+   0x0003, 0x0028, 0x6709, 0x0029, 0x0003, 0x0028, 0x793e, 0x0029, 0x0003,
+   0x0028, 0x540d, 0x0029, 0x0003, 0x0028, 0x7279, 0x0029, 0x0003, 0x0028,
+   0x8ca1, 0x0029, 0x0003, 0x0028, 0x795d, 0x0029, 0x0003, 0x0028, 0x52b4,
+   0x0029, 0x0003, 0x0028, 0x4ee3, 0x0029, 0x0003, 0x0028, 0x547c, 0x0029,
+   0x0003, 0x0028, 0x5b66, 0x0029, 0x0003, 0x0028, 0x76e3, 0x0029, 0x0003,
+   0x0028, 0x4f01, 0x0029, 0x0003, 0x0028, 0x8cc7, 0x0029, 0x0003, 0x0028,
+   0x5354, 0x0029, 0x0003, 0x0028, 0x796d, 0x0029, 0x0003, 0x0028, 0x4f11,
+   0x0029, 0x0003, 0x0028, 0x81ea, 0x0029, 0x0003, 0x0028, 0x81f3, 0x0029,
+   0x0002, 0x0032, 0x0031, 0x0002, 0x0032, 0x0032, 0x0002, 0x0032, 0x0033,
+   0x0002, 0x0032, 0x0034, 0x0002, 0x0032, 0x0035, 0x0002, 0x0032, 0x0036,
+   0x0002, 0x0032, 0x0037, 0x0002, 0x0032, 0x0038, 0x0002, 0x0032, 0x0039,
+   0x0002, 0x0033, 0x0030, 0x0002, 0x0033, 0x0031, 0x0002, 0x0033, 0x0032,
+   0x0002, 0x0033, 0x0033, 0x0002, 0x0033, 0x0034, 0x0002, 0x0033, 0x0035,
+   0x0002, 0x1100, 0x1161, 0x0002, 0x1102, 0x1161, 0x0002, 0x1103, 0x1161,
+   0x0002, 0x1105, 0x1161, 0x0002, 0x1106, 0x1161, 0x0002, 0x1107, 0x1161,
+   0x0002, 0x1109, 0x1161, 0x0002, 0x110b, 0x1161, 0x0002, 0x110c, 0x1161,
+   0x0002, 0x110e, 0x1161, 0x0002, 0x110f, 0x1161, 0x0002, 0x1110, 0x1161,
+   0x0002, 0x1111, 0x1161, 0x0002, 0x1112, 0x1161, 0x0001, 0x4e94, 0x0001,
+   0x516d, 0x0001, 0x4e03, 0x0001, 0x4e5d, 0x0001, 0x682a, 0x0001, 0x6709,
+   0x0001, 0x793e, 0x0001, 0x540d, 0x0001, 0x7279, 0x0001, 0x8ca1, 0x0001,
+   0x795d, 0x0001, 0x52b4, 0x0001, 0x79d8, 0x0001, 0x7537, 0x0001, 0x9069,
+   0x0001, 0x512a, 0x0001, 0x5370, 0x0001, 0x6ce8, 0x0001, 0x9805, 0x0001,
+   0x4f11, 0x0001, 0x5199, 0x0001, 0x6b63, 0x0001, 0x5de6, 0x0001, 0x53f3,
+   0x0001, 0x533b, 0x0001, 0x5b97, 0x0001, 0x5b66, 0x0001, 0x76e3, 0x0001,
+   0x4f01, 0x0001, 0x8cc7, 0x0001, 0x5354, 0x0001, 0x591c, 0x0002, 0x0033,
+   0x0036, 0x0002, 0x0033, 0x0037, 0x0002, 0x0033, 0x0038, 0x0002, 0x0033,
+   0x0039, 0x0002, 0x0034, 0x0030, 0x0002, 0x0034, 0x0031, 0x0002, 0x0034,
+   0x0032, 0x0002, 0x0034, 0x0033, 0x0002, 0x0034, 0x0034, 0x0002, 0x0034,
+   0x0035, 0x0002, 0x0034, 0x0036, 0x0002, 0x0034, 0x0037, 0x0002, 0x0034,
+   0x0038, 0x0002, 0x0034, 0x0039, 0x0002, 0x0035, 0x0030, 0x0002, 0x0031,
+   0x6708, 0x0002, 0x0032, 0x6708, 0x0002, 0x0033, 0x6708, 0x0002, 0x0034,
+   0x6708, 0x0002, 0x0035, 0x6708, 0x0002, 0x0036, 0x6708, 0x0002, 0x0037,
+   0x6708, 0x0002, 0x0038, 0x6708, 0x0002, 0x0039, 0x6708, 0x0003, 0x0031,
+   0x0030, 0x6708, 0x0003, 0x0031, 0x0031, 0x6708, 0x0003, 0x0031, 0x0032,
+   0x6708, 0x0001, 0x30a2, 0x0001, 0x30a4, 0x0001, 0x30a6, 0x0001, 0x30a8,
+   0x0001, 0x30aa, 0x0001, 0x30ab, 0x0001, 0x30ad, 0x0001, 0x30af, 0x0001,
+   0x30b1, 0x0001, 0x30b3, 0x0001, 0x30b5, 0x0001, 0x30b7, 0x0001, 0x30b9,
+   0x0001, 0x30bb, 0x0001, 0x30bd, 0x0001, 0x30bf, 0x0001, 0x30c1, 0x0001,
+   0x30c4, 0x0001, 0x30c6, 0x0001, 0x30c8, 0x0001, 0x30ca, 0x0001, 0x30cb,
+   0x0001, 0x30cc, 0x0001, 0x30cd, 0x0001, 0x30ce, 0x0001, 0x30cf, 0x0001,
+   0x30d2, 0x0001, 0x30d5, 0x0001, 0x30d8, 0x0001, 0x30db, 0x0001, 0x30de,
+   0x0001, 0x30df, 0x0001, 0x30e0, 0x0001, 0x30e1, 0x0001, 0x30e2, 0x0001,
+   0x30e4, 0x0001, 0x30e6, 0x0001, 0x30e8, 0x0001, 0x30e9, 0x0001, 0x30ea,
+   0x0001, 0x30eb, 0x0001, 0x30ec, 0x0001, 0x30ed, 0x0001, 0x30ef, 0x0001,
+   0x30f0, 0x0001, 0x30f1, 0x0001, 0x30f2, 0x0005, 0x30a2, 0x30cf, 0x309a,
+   0x30fc, 0x30c8, 0x0004, 0x30a2, 0x30eb, 0x30d5, 0x30a1, 0x0005, 0x30a2,
+   0x30f3, 0x30d8, 0x309a, 0x30a2, 0x0003, 0x30a2, 0x30fc, 0x30eb, 0x0005,
+   0x30a4, 0x30cb, 0x30f3, 0x30af, 0x3099, 0x0003, 0x30a4, 0x30f3, 0x30c1,
+   0x0003, 0x30a6, 0x30a9, 0x30f3, 0x0006, 0x30a8, 0x30b9, 0x30af, 0x30fc,
+   0x30c8, 0x3099, 0x0004, 0x30a8, 0x30fc, 0x30ab, 0x30fc, 0x0003, 0x30aa,
+   0x30f3, 0x30b9, 0x0003, 0x30aa, 0x30fc, 0x30e0, 0x0003, 0x30ab, 0x30a4,
+   0x30ea, 0x0004, 0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x0004, 0x30ab, 0x30ed,
+   0x30ea, 0x30fc, 0x0004, 0x30ab, 0x3099, 0x30ed, 0x30f3, 0x0004, 0x30ab,
+   0x3099, 0x30f3, 0x30de, 0x0004, 0x30ad, 0x3099, 0x30ab, 0x3099, 0x0004,
+   0x30ad, 0x3099, 0x30cb, 0x30fc, 0x0004, 0x30ad, 0x30e5, 0x30ea, 0x30fc,
+   0x0006, 0x30ad, 0x3099, 0x30eb, 0x30bf, 0x3099, 0x30fc, 0x0002, 0x30ad,
+   0x30ed, 0x0006, 0x30ad, 0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x0006,
+   0x30ad, 0x30ed, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x0005, 0x30ad, 0x30ed,
+   0x30ef, 0x30c3, 0x30c8, 0x0004, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x0006,
+   0x30af, 0x3099, 0x30e9, 0x30e0, 0x30c8, 0x30f3, 0x0006, 0x30af, 0x30eb,
+   0x30bb, 0x3099, 0x30a4, 0x30ed, 0x0004, 0x30af, 0x30ed, 0x30fc, 0x30cd,
+   0x0003, 0x30b1, 0x30fc, 0x30b9, 0x0003, 0x30b3, 0x30eb, 0x30ca, 0x0004,
+   0x30b3, 0x30fc, 0x30db, 0x309a, 0x0004, 0x30b5, 0x30a4, 0x30af, 0x30eb,
+   0x0005, 0x30b5, 0x30f3, 0x30c1, 0x30fc, 0x30e0, 0x0005, 0x30b7, 0x30ea,
+   0x30f3, 0x30af, 0x3099, 0x0003, 0x30bb, 0x30f3, 0x30c1, 0x0003, 0x30bb,
+   0x30f3, 0x30c8, 0x0004, 0x30bf, 0x3099, 0x30fc, 0x30b9, 0x0003, 0x30c6,
+   0x3099, 0x30b7, 0x0003, 0x30c8, 0x3099, 0x30eb, 0x0002, 0x30c8, 0x30f3,
+   0x0002, 0x30ca, 0x30ce, 0x0003, 0x30ce, 0x30c3, 0x30c8, 0x0003, 0x30cf,
+   0x30a4, 0x30c4, 0x0006, 0x30cf, 0x309a, 0x30fc, 0x30bb, 0x30f3, 0x30c8,
+   0x0004, 0x30cf, 0x309a, 0x30fc, 0x30c4, 0x0005, 0x30cf, 0x3099, 0x30fc,
+   0x30ec, 0x30eb, 0x0006, 0x30d2, 0x309a, 0x30a2, 0x30b9, 0x30c8, 0x30eb,
+   0x0004, 0x30d2, 0x309a, 0x30af, 0x30eb, 0x0003, 0x30d2, 0x309a, 0x30b3,
+   0x0003, 0x30d2, 0x3099, 0x30eb, 0x0006, 0x30d5, 0x30a1, 0x30e9, 0x30c3,
+   0x30c8, 0x3099, 0x0004, 0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x0006, 0x30d5,
+   0x3099, 0x30c3, 0x30b7, 0x30a7, 0x30eb, 0x0003, 0x30d5, 0x30e9, 0x30f3,
+   0x0005, 0x30d8, 0x30af, 0x30bf, 0x30fc, 0x30eb, 0x0003, 0x30d8, 0x309a,
+   0x30bd, 0x0004, 0x30d8, 0x309a, 0x30cb, 0x30d2, 0x0003, 0x30d8, 0x30eb,
+   0x30c4, 0x0004, 0x30d8, 0x309a, 0x30f3, 0x30b9, 0x0005, 0x30d8, 0x309a,
+   0x30fc, 0x30b7, 0x3099, 0x0004, 0x30d8, 0x3099, 0x30fc, 0x30bf, 0x0005,
+   0x30db, 0x309a, 0x30a4, 0x30f3, 0x30c8, 0x0004, 0x30db, 0x3099, 0x30eb,
+   0x30c8, 0x0002, 0x30db, 0x30f3, 0x0005, 0x30db, 0x309a, 0x30f3, 0x30c8,
+   0x3099, 0x0003, 0x30db, 0x30fc, 0x30eb, 0x0003, 0x30db, 0x30fc, 0x30f3,
+   0x0004, 0x30de, 0x30a4, 0x30af, 0x30ed, 0x0003, 0x30de, 0x30a4, 0x30eb,
+   0x0003, 0x30de, 0x30c3, 0x30cf, 0x0003, 0x30de, 0x30eb, 0x30af, 0x0005,
+   0x30de, 0x30f3, 0x30b7, 0x30e7, 0x30f3, 0x0004, 0x30df, 0x30af, 0x30ed,
+   0x30f3, 0x0002, 0x30df, 0x30ea, 0x0006, 0x30df, 0x30ea, 0x30cf, 0x3099,
+   0x30fc, 0x30eb, 0x0003, 0x30e1, 0x30ab, 0x3099, 0x0005, 0x30e1, 0x30ab,
+   0x3099, 0x30c8, 0x30f3, 0x0004, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x0004,
+   0x30e4, 0x30fc, 0x30c8, 0x3099, 0x0003, 0x30e4, 0x30fc, 0x30eb, 0x0003,
+   0x30e6, 0x30a2, 0x30f3, 0x0004, 0x30ea, 0x30c3, 0x30c8, 0x30eb, 0x0002,
+   0x30ea, 0x30e9, 0x0004, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x0005, 0x30eb,
+   0x30fc, 0x30d5, 0x3099, 0x30eb, 0x0002, 0x30ec, 0x30e0, 0x0006, 0x30ec,
+   0x30f3, 0x30c8, 0x30b1, 0x3099, 0x30f3, 0x0003, 0x30ef, 0x30c3, 0x30c8,
+   0x0002, 0x0030, 0x70b9, 0x0002, 0x0031, 0x70b9, 0x0002, 0x0032, 0x70b9,
+   0x0002, 0x0033, 0x70b9, 0x0002, 0x0034, 0x70b9, 0x0002, 0x0035, 0x70b9,
+   0x0002, 0x0036, 0x70b9, 0x0002, 0x0037, 0x70b9, 0x0002, 0x0038, 0x70b9,
+   0x0002, 0x0039, 0x70b9, 0x0003, 0x0031, 0x0030, 0x70b9, 0x0003, 0x0031,
+   0x0031, 0x70b9, 0x0003, 0x0031, 0x0032, 0x70b9, 0x0003, 0x0031, 0x0033,
+   0x70b9, 0x0003, 0x0031, 0x0034, 0x70b9, 0x0003, 0x0031, 0x0035, 0x70b9,
+   0x0003, 0x0031, 0x0036, 0x70b9, 0x0003, 0x0031, 0x0037, 0x70b9, 0x0003,
+   0x0031, 0x0038, 0x70b9, 0x0003, 0x0031, 0x0039, 0x70b9, 0x0003, 0x0032,
+   0x0030, 0x70b9, 0x0003, 0x0032, 0x0031, 0x70b9, 0x0003, 0x0032, 0x0032,
+   0x70b9, 0x0003, 0x0032, 0x0033, 0x70b9, 0x0003, 0x0032, 0x0034, 0x70b9,
+   0x0003, 0x0068, 0x0050, 0x0061, 0x0002, 0x0064, 0x0061, 0x0002, 0x0041,
+   0x0055, 0x0003, 0x0062, 0x0061, 0x0072, 0x0002, 0x006f, 0x0056, 0x0002,
+   0x0070, 0x0063, 0x0002, 0x5e73, 0x6210, 0x0002, 0x662d, 0x548c, 0x0002,
+   0x5927, 0x6b63, 0x0002, 0x660e, 0x6cbb, 0x0004, 0x682a, 0x5f0f, 0x4f1a,
+   0x793e, 0x0002, 0x0070, 0x0041, 0x0002, 0x006e, 0x0041, 0x0002, 0x03bc,
+   0x0041, 0x0002, 0x006d, 0x0041, 0x0002, 0x006b, 0x0041, 0x0002, 0x004b,
+   0x0042, 0x0002, 0x004d, 0x0042, 0x0002, 0x0047, 0x0042, 0x0003, 0x0063,
+   0x0061, 0x006c, 0x0004, 0x006b, 0x0063, 0x0061, 0x006c, 0x0002, 0x0070,
+   0x0046, 0x0002, 0x006e, 0x0046, 0x0002, 0x03bc, 0x0046, 0x0002, 0x03bc,
+   0x0067, 0x0002, 0x006d, 0x0067, 0x0002, 0x006b, 0x0067, 0x0002, 0x0048,
+   0x007a, 0x0003, 0x006b, 0x0048, 0x007a, 0x0003, 0x004d, 0x0048, 0x007a,
+   0x0003, 0x0047, 0x0048, 0x007a, 0x0003, 0x0054, 0x0048, 0x007a, 0x0002,
+   0x03bc, 0x006c, 0x0002, 0x006d, 0x006c, 0x0002, 0x0064, 0x006c, 0x0002,
+   0x006b, 0x006c, 0x0002, 0x0066, 0x006d, 0x0002, 0x006e, 0x006d, 0x0002,
+   0x03bc, 0x006d, 0x0002, 0x006d, 0x006d, 0x0002, 0x0063, 0x006d, 0x0002,
+   0x006b, 0x006d, 0x0003, 0x006d, 0x006d, 0x0032, 0x0003, 0x0063, 0x006d,
+   0x0032, 0x0002, 0x006d, 0x0032, 0x0003, 0x006b, 0x006d, 0x0032, 0x0003,
+   0x006d, 0x006d, 0x0033, 0x0003, 0x0063, 0x006d, 0x0033, 0x0002, 0x006d,
+   0x0033, 0x0003, 0x006b, 0x006d, 0x0033, 0x0003, 0x006d, 0x2215, 0x0073,
+   0x0004, 0x006d, 0x2215, 0x0073, 0x0032, 0x0002, 0x0050, 0x0061, 0x0003,
+   0x006b, 0x0050, 0x0061, 0x0003, 0x004d, 0x0050, 0x0061, 0x0003, 0x0047,
+   0x0050, 0x0061, 0x0003, 0x0072, 0x0061, 0x0064, 0x0005, 0x0072, 0x0061,
+   0x0064, 0x2215, 0x0073, 0x0006, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073,
+   0x0032, 0x0002, 0x0070, 0x0073, 0x0002, 0x006e, 0x0073, 0x0002, 0x03bc,
+   0x0073, 0x0002, 0x006d, 0x0073, 0x0002, 0x0070, 0x0056, 0x0002, 0x006e,
+   0x0056, 0x0002, 0x03bc, 0x0056, 0x0002, 0x006d, 0x0056, 0x0002, 0x006b,
+   0x0056, 0x0002, 0x004d, 0x0056, 0x0002, 0x0070, 0x0057, 0x0002, 0x006e,
+   0x0057, 0x0002, 0x03bc, 0x0057, 0x0002, 0x006d, 0x0057, 0x0002, 0x006b,
+   0x0057, 0x0002, 0x004d, 0x0057, 0x0002, 0x006b, 0x03a9, 0x0002, 0x004d,
+   0x03a9, 0x0004, 0x0061, 0x002e, 0x006d, 0x002e, 0x0002, 0x0042, 0x0071,
+   0x0002, 0x0063, 0x0063, 0x0002, 0x0063, 0x0064, 0x0004, 0x0043, 0x2215,
+   0x006b, 0x0067, 0x0003, 0x0043, 0x006f, 0x002e, 0x0002, 0x0064, 0x0042,
+   0x0002, 0x0047, 0x0079, 0x0002, 0x0068, 0x0061, 0x0002, 0x0048, 0x0050,
+   0x0002, 0x0069, 0x006e, 0x0002, 0x004b, 0x004b, 0x0002, 0x004b, 0x004d,
+   0x0002, 0x006b, 0x0074, 0x0002, 0x006c, 0x006d, 0x0002, 0x006c, 0x006e,
+   0x0003, 0x006c, 0x006f, 0x0067, 0x0002, 0x006c, 0x0078, 0x0002, 0x006d,
+   0x0062, 0x0003, 0x006d, 0x0069, 0x006c, 0x0003, 0x006d, 0x006f, 0x006c,
+   0x0002, 0x0050, 0x0048, 0x0004, 0x0070, 0x002e, 0x006d, 0x002e, 0x0003,
+   0x0050, 0x0050, 0x004d, 0x0002, 0x0050, 0x0052, 0x0002, 0x0073, 0x0072,
+   0x0002, 0x0053, 0x0076, 0x0002, 0x0057, 0x0062, 0x0002, 0x0031, 0x65e5,
+   0x0002, 0x0032, 0x65e5, 0x0002, 0x0033, 0x65e5, 0x0002, 0x0034, 0x65e5,
+   0x0002, 0x0035, 0x65e5, 0x0002, 0x0036, 0x65e5, 0x0002, 0x0037, 0x65e5,
+   0x0002, 0x0038, 0x65e5, 0x0002, 0x0039, 0x65e5, 0x0003, 0x0031, 0x0030,
+   0x65e5, 0x0003, 0x0031, 0x0031, 0x65e5, 0x0003, 0x0031, 0x0032, 0x65e5,
+   0x0003, 0x0031, 0x0033, 0x65e5, 0x0003, 0x0031, 0x0034, 0x65e5, 0x0003,
+   0x0031, 0x0035, 0x65e5, 0x0003, 0x0031, 0x0036, 0x65e5, 0x0003, 0x0031,
+   0x0037, 0x65e5, 0x0003, 0x0031, 0x0038, 0x65e5, 0x0003, 0x0031, 0x0039,
+   0x65e5, 0x0003, 0x0032, 0x0030, 0x65e5, 0x0003, 0x0032, 0x0031, 0x65e5,
+   0x0003, 0x0032, 0x0032, 0x65e5, 0x0003, 0x0032, 0x0033, 0x65e5, 0x0003,
+   0x0032, 0x0034, 0x65e5, 0x0003, 0x0032, 0x0035, 0x65e5, 0x0003, 0x0032,
+   0x0036, 0x65e5, 0x0003, 0x0032, 0x0037, 0x65e5, 0x0003, 0x0032, 0x0038,
+   0x65e5, 0x0003, 0x0032, 0x0039, 0x65e5, 0x0003, 0x0033, 0x0030, 0x65e5,
+   0x0003, 0x0033, 0x0031, 0x65e5, 0x0001, 0x8c48, 0x0001, 0x66f4, 0x0001,
+   0x8cc8, 0x0001, 0x6ed1, 0x0001, 0x4e32, 0x0001, 0x53e5, 0x0001, 0x5951,
+   0x0001, 0x5587, 0x0001, 0x5948, 0x0001, 0x61f6, 0x0001, 0x7669, 0x0001,
+   0x7f85, 0x0001, 0x863f, 0x0001, 0x87ba, 0x0001, 0x88f8, 0x0001, 0x908f,
+   0x0001, 0x6a02, 0x0001, 0x6d1b, 0x0001, 0x70d9, 0x0001, 0x73de, 0x0001,
+   0x843d, 0x0001, 0x916a, 0x0001, 0x99f1, 0x0001, 0x4e82, 0x0001, 0x5375,
+   0x0001, 0x6b04, 0x0001, 0x721b, 0x0001, 0x862d, 0x0001, 0x9e1e, 0x0001,
+   0x5d50, 0x0001, 0x6feb, 0x0001, 0x85cd, 0x0001, 0x8964, 0x0001, 0x62c9,
+   0x0001, 0x81d8, 0x0001, 0x881f, 0x0001, 0x5eca, 0x0001, 0x6717, 0x0001,
+   0x6d6a, 0x0001, 0x72fc, 0x0001, 0x90ce, 0x0001, 0x4f86, 0x0001, 0x51b7,
+   0x0001, 0x52de, 0x0001, 0x64c4, 0x0001, 0x6ad3, 0x0001, 0x7210, 0x0001,
+   0x76e7, 0x0001, 0x8606, 0x0001, 0x865c, 0x0001, 0x8def, 0x0001, 0x9732,
+   0x0001, 0x9b6f, 0x0001, 0x9dfa, 0x0001, 0x788c, 0x0001, 0x797f, 0x0001,
+   0x7da0, 0x0001, 0x83c9, 0x0001, 0x9304, 0x0001, 0x8ad6, 0x0001, 0x58df,
+   0x0001, 0x5f04, 0x0001, 0x7c60, 0x0001, 0x807e, 0x0001, 0x7262, 0x0001,
+   0x78ca, 0x0001, 0x8cc2, 0x0001, 0x96f7, 0x0001, 0x58d8, 0x0001, 0x5c62,
+   0x0001, 0x6a13, 0x0001, 0x6dda, 0x0001, 0x6f0f, 0x0001, 0x7d2f, 0x0001,
+   0x7e37, 0x0001, 0x964b, 0x0001, 0x52d2, 0x0001, 0x808b, 0x0001, 0x51dc,
+   0x0001, 0x51cc, 0x0001, 0x7a1c, 0x0001, 0x7dbe, 0x0001, 0x83f1, 0x0001,
+   0x9675, 0x0001, 0x8b80, 0x0001, 0x62cf, 0x0001, 0x8afe, 0x0001, 0x4e39,
+   0x0001, 0x5be7, 0x0001, 0x6012, 0x0001, 0x7387, 0x0001, 0x7570, 0x0001,
+   0x5317, 0x0001, 0x78fb, 0x0001, 0x4fbf, 0x0001, 0x5fa9, 0x0001, 0x4e0d,
+   0x0001, 0x6ccc, 0x0001, 0x6578, 0x0001, 0x7d22, 0x0001, 0x53c3, 0x0001,
+   0x585e, 0x0001, 0x7701, 0x0001, 0x8449, 0x0001, 0x8aaa, 0x0001, 0x6bba,
+   0x0001, 0x6c88, 0x0001, 0x62fe, 0x0001, 0x82e5, 0x0001, 0x63a0, 0x0001,
+   0x7565, 0x0001, 0x4eae, 0x0001, 0x5169, 0x0001, 0x51c9, 0x0001, 0x6881,
+   0x0001, 0x7ce7, 0x0001, 0x826f, 0x0001, 0x8ad2, 0x0001, 0x91cf, 0x0001,
+   0x52f5, 0x0001, 0x5442, 0x0001, 0x5eec, 0x0001, 0x65c5, 0x0001, 0x6ffe,
+   0x0001, 0x792a, 0x0001, 0x95ad, 0x0001, 0x9a6a, 0x0001, 0x9e97, 0x0001,
+   0x9ece, 0x0001, 0x66c6, 0x0001, 0x6b77, 0x0001, 0x8f62, 0x0001, 0x5e74,
+   0x0001, 0x6190, 0x0001, 0x6200, 0x0001, 0x649a, 0x0001, 0x6f23, 0x0001,
+   0x7149, 0x0001, 0x7489, 0x0001, 0x79ca, 0x0001, 0x7df4, 0x0001, 0x806f,
+   0x0001, 0x8f26, 0x0001, 0x84ee, 0x0001, 0x9023, 0x0001, 0x934a, 0x0001,
+   0x5217, 0x0001, 0x52a3, 0x0001, 0x54bd, 0x0001, 0x70c8, 0x0001, 0x88c2,
+   0x0001, 0x5ec9, 0x0001, 0x5ff5, 0x0001, 0x637b, 0x0001, 0x6bae, 0x0001,
+   0x7c3e, 0x0001, 0x7375, 0x0001, 0x4ee4, 0x0001, 0x56f9, 0x0001, 0x5dba,
+   0x0001, 0x601c, 0x0001, 0x73b2, 0x0001, 0x7469, 0x0001, 0x7f9a, 0x0001,
+   0x8046, 0x0001, 0x9234, 0x0001, 0x96f6, 0x0001, 0x9748, 0x0001, 0x9818,
+   0x0001, 0x4f8b, 0x0001, 0x79ae, 0x0001, 0x91b4, 0x0001, 0x96b8, 0x0001,
+   0x60e1, 0x0001, 0x4e86, 0x0001, 0x50da, 0x0001, 0x5bee, 0x0001, 0x5c3f,
+   0x0001, 0x6599, 0x0001, 0x71ce, 0x0001, 0x7642, 0x0001, 0x84fc, 0x0001,
+   0x907c, 0x0001, 0x6688, 0x0001, 0x962e, 0x0001, 0x5289, 0x0001, 0x677b,
+   0x0001, 0x67f3, 0x0001, 0x6d41, 0x0001, 0x6e9c, 0x0001, 0x7409, 0x0001,
+   0x7559, 0x0001, 0x786b, 0x0001, 0x7d10, 0x0001, 0x985e, 0x0001, 0x622e,
+   0x0001, 0x9678, 0x0001, 0x502b, 0x0001, 0x5d19, 0x0001, 0x6dea, 0x0001,
+   0x8f2a, 0x0001, 0x5f8b, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001, 0x9686,
+   0x0001, 0x5229, 0x0001, 0x540f, 0x0001, 0x5c65, 0x0001, 0x6613, 0x0001,
+   0x674e, 0x0001, 0x68a8, 0x0001, 0x6ce5, 0x0001, 0x7406, 0x0001, 0x75e2,
+   0x0001, 0x7f79, 0x0001, 0x88cf, 0x0001, 0x88e1, 0x0001, 0x96e2, 0x0001,
+   0x533f, 0x0001, 0x6eba, 0x0001, 0x541d, 0x0001, 0x71d0, 0x0001, 0x7498,
+   0x0001, 0x85fa, 0x0001, 0x96a3, 0x0001, 0x9c57, 0x0001, 0x9e9f, 0x0001,
+   0x6797, 0x0001, 0x6dcb, 0x0001, 0x81e8, 0x0001, 0x7b20, 0x0001, 0x7c92,
+   0x0001, 0x72c0, 0x0001, 0x7099, 0x0001, 0x8b58, 0x0001, 0x4ec0, 0x0001,
+   0x8336, 0x0001, 0x523a, 0x0001, 0x5207, 0x0001, 0x5ea6, 0x0001, 0x62d3,
+   0x0001, 0x7cd6, 0x0001, 0x5b85, 0x0001, 0x6d1e, 0x0001, 0x66b4, 0x0001,
+   0x8f3b, 0x0001, 0x964d, 0x0001, 0x5ed3, 0x0001, 0x5140, 0x0001, 0x55c0,
+   0x0001, 0x585a, 0x0001, 0x6674, 0x0001, 0x51de, 0x0001, 0x732a, 0x0001,
+   0x76ca, 0x0001, 0x793c, 0x0001, 0x795e, 0x0001, 0x7965, 0x0001, 0x798f,
+   0x0001, 0x9756, 0x0001, 0x7cbe, 0x0001, 0x8612, 0x0001, 0x8af8, 0x0001,
+   0x9038, 0x0001, 0x90fd, 0x0001, 0x98ef, 0x0001, 0x98fc, 0x0001, 0x9928,
+   0x0001, 0x9db4, 0x0001, 0x4fae, 0x0001, 0x50e7, 0x0001, 0x514d, 0x0001,
+   0x52c9, 0x0001, 0x52e4, 0x0001, 0x5351, 0x0001, 0x559d, 0x0001, 0x5606,
+   0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58a8, 0x0001, 0x5c64, 0x0001,
+   0x6094, 0x0001, 0x6168, 0x0001, 0x618e, 0x0001, 0x61f2, 0x0001, 0x654f,
+   0x0001, 0x65e2, 0x0001, 0x6691, 0x0001, 0x6885, 0x0001, 0x6d77, 0x0001,
+   0x6e1a, 0x0001, 0x6f22, 0x0001, 0x716e, 0x0001, 0x722b, 0x0001, 0x7422,
+   0x0001, 0x7891, 0x0001, 0x7949, 0x0001, 0x7948, 0x0001, 0x7950, 0x0001,
+   0x7956, 0x0001, 0x798d, 0x0001, 0x798e, 0x0001, 0x7a40, 0x0001, 0x7a81,
+   0x0001, 0x7bc0, 0x0001, 0x7e09, 0x0001, 0x7e41, 0x0001, 0x7f72, 0x0001,
+   0x8005, 0x0001, 0x81ed, 0x0001, 0x8279, 0x0001, 0x8457, 0x0001, 0x8910,
+   0x0001, 0x8996, 0x0001, 0x8b01, 0x0001, 0x8b39, 0x0001, 0x8cd3, 0x0001,
+   0x8d08, 0x0001, 0x8fb6, 0x0001, 0x96e3, 0x0001, 0x97ff, 0x0001, 0x983b,
+   0x0002, 0x0066, 0x0066, 0x0002, 0x0066, 0x0069, 0x0002, 0x0066, 0x006c,
+   0x0003, 0x0066, 0x0066, 0x0069, 0x0003, 0x0066, 0x0066, 0x006c, 0x0002,
+   0x0073, 0x0074, 0x0002, 0x0574, 0x0576, 0x0002, 0x0574, 0x0565, 0x0002,
+   0x0574, 0x056b, 0x0002, 0x057e, 0x0576, 0x0002, 0x0574, 0x056d, 0x0002,
+   0x05d9, 0x05b4, 0x0002, 0x05f2, 0x05b7, 0x0001, 0x05e2, 0x0001, 0x05d4,
+   0x0001, 0x05db, 0x0001, 0x05dc, 0x0001, 0x05dd, 0x0001, 0x05e8, 0x0001,
+   0x05ea, 0x0002, 0x05e9, 0x05c1, 0x0002, 0x05e9, 0x05c2, 0x0003, 0x05e9,
+   0x05bc, 0x05c1, 0x0003, 0x05e9, 0x05bc, 0x05c2, 0x0002, 0x05d0, 0x05b7,
+   0x0002, 0x05d0, 0x05b8, 0x0002, 0x05d0, 0x05bc, 0x0002, 0x05d1, 0x05bc,
+   0x0002, 0x05d2, 0x05bc, 0x0002, 0x05d3, 0x05bc, 0x0002, 0x05d4, 0x05bc,
+   0x0002, 0x05d5, 0x05bc, 0x0002, 0x05d6, 0x05bc, 0x0002, 0x05d8, 0x05bc,
+   0x0002, 0x05d9, 0x05bc, 0x0002, 0x05da, 0x05bc, 0x0002, 0x05db, 0x05bc,
+   0x0002, 0x05dc, 0x05bc, 0x0002, 0x05de, 0x05bc, 0x0002, 0x05e0, 0x05bc,
+   0x0002, 0x05e1, 0x05bc, 0x0002, 0x05e3, 0x05bc, 0x0002, 0x05e4, 0x05bc,
+   0x0002, 0x05e6, 0x05bc, 0x0002, 0x05e7, 0x05bc, 0x0002, 0x05e8, 0x05bc,
+   0x0002, 0x05e9, 0x05bc, 0x0002, 0x05ea, 0x05bc, 0x0002, 0x05d5, 0x05b9,
+   0x0002, 0x05d1, 0x05bf, 0x0002, 0x05db, 0x05bf, 0x0002, 0x05e4, 0x05bf,
+   0x0002, 0x05d0, 0x05dc, 0x0001, 0x0671, 0x0001, 0x067b, 0x0001, 0x067e,
+   0x0001, 0x0680, 0x0001, 0x067a, 0x0001, 0x067f, 0x0001, 0x0679, 0x0001,
+   0x06a4, 0x0001, 0x06a6, 0x0001, 0x0684, 0x0001, 0x0683, 0x0001, 0x0686,
+   0x0001, 0x0687, 0x0001, 0x068d, 0x0001, 0x068c, 0x0001, 0x068e, 0x0001,
+   0x0688, 0x0001, 0x0698, 0x0001, 0x0691, 0x0001, 0x06a9, 0x0001, 0x06af,
+   0x0001, 0x06b3, 0x0001, 0x06b1, 0x0001, 0x06ba, 0x0001, 0x06bb, 0x0001,
+   0x06c1, 0x0001, 0x06be, 0x0001, 0x06d2, 0x0001, 0x06ad, 0x0001, 0x06c7,
+   0x0001, 0x06c6, 0x0001, 0x06c8, 0x0001, 0x06cb, 0x0001, 0x06c5, 0x0001,
+   0x06c9, 0x0001, 0x06d0, 0x0001, 0x0649, 0x0003, 0x064a, 0x0654, 0x0627,
+   0x0003, 0x064a, 0x0654, 0x06d5, 0x0003, 0x064a, 0x0654, 0x0648, 0x0003,
+   0x064a, 0x0654, 0x06c7, 0x0003, 0x064a, 0x0654, 0x06c6, 0x0003, 0x064a,
+   0x0654, 0x06c8, 0x0003, 0x064a, 0x0654, 0x06d0, 0x0003, 0x064a, 0x0654,
+   0x0649, 0x0001, 0x06cc, 0x0003, 0x064a, 0x0654, 0x062c, 0x0003, 0x064a,
+   0x0654, 0x062d, 0x0003, 0x064a, 0x0654, 0x0645, 0x0003, 0x064a, 0x0654,
+   0x064a, 0x0002, 0x0628, 0x062c, 0x0002, 0x0628, 0x062d, 0x0002, 0x0628,
+   0x062e, 0x0002, 0x0628, 0x0645, 0x0002, 0x0628, 0x0649, 0x0002, 0x0628,
+   0x064a, 0x0002, 0x062a, 0x062c, 0x0002, 0x062a, 0x062d, 0x0002, 0x062a,
+   0x062e, 0x0002, 0x062a, 0x0645, 0x0002, 0x062a, 0x0649, 0x0002, 0x062a,
+   0x064a, 0x0002, 0x062b, 0x062c, 0x0002, 0x062b, 0x0645, 0x0002, 0x062b,
+   0x0649, 0x0002, 0x062b, 0x064a, 0x0002, 0x062c, 0x062d, 0x0002, 0x062c,
+   0x0645, 0x0002, 0x062d, 0x062c, 0x0002, 0x062d, 0x0645, 0x0002, 0x062e,
+   0x062c, 0x0002, 0x062e, 0x062d, 0x0002, 0x062e, 0x0645, 0x0002, 0x0633,
+   0x062c, 0x0002, 0x0633, 0x062d, 0x0002, 0x0633, 0x062e, 0x0002, 0x0633,
+   0x0645, 0x0002, 0x0635, 0x062d, 0x0002, 0x0635, 0x0645, 0x0002, 0x0636,
+   0x062c, 0x0002, 0x0636, 0x062d, 0x0002, 0x0636, 0x062e, 0x0002, 0x0636,
+   0x0645, 0x0002, 0x0637, 0x062d, 0x0002, 0x0637, 0x0645, 0x0002, 0x0638,
+   0x0645, 0x0002, 0x0639, 0x062c, 0x0002, 0x0639, 0x0645, 0x0002, 0x063a,
+   0x062c, 0x0002, 0x063a, 0x0645, 0x0002, 0x0641, 0x062c, 0x0002, 0x0641,
+   0x062d, 0x0002, 0x0641, 0x062e, 0x0002, 0x0641, 0x0645, 0x0002, 0x0641,
+   0x0649, 0x0002, 0x0641, 0x064a, 0x0002, 0x0642, 0x062d, 0x0002, 0x0642,
+   0x0645, 0x0002, 0x0642, 0x0649, 0x0002, 0x0642, 0x064a, 0x0002, 0x0643,
+   0x0627, 0x0002, 0x0643, 0x062c, 0x0002, 0x0643, 0x062d, 0x0002, 0x0643,
+   0x062e, 0x0002, 0x0643, 0x0644, 0x0002, 0x0643, 0x0645, 0x0002, 0x0643,
+   0x0649, 0x0002, 0x0643, 0x064a, 0x0002, 0x0644, 0x062c, 0x0002, 0x0644,
+   0x062d, 0x0002, 0x0644, 0x062e, 0x0002, 0x0644, 0x0645, 0x0002, 0x0644,
+   0x0649, 0x0002, 0x0644, 0x064a, 0x0002, 0x0645, 0x062c, 0x0002, 0x0645,
+   0x062d, 0x0002, 0x0645, 0x062e, 0x0002, 0x0645, 0x0645, 0x0002, 0x0645,
+   0x0649, 0x0002, 0x0645, 0x064a, 0x0002, 0x0646, 0x062c, 0x0002, 0x0646,
+   0x062d, 0x0002, 0x0646, 0x062e, 0x0002, 0x0646, 0x0645, 0x0002, 0x0646,
+   0x0649, 0x0002, 0x0646, 0x064a, 0x0002, 0x0647, 0x062c, 0x0002, 0x0647,
+   0x0645, 0x0002, 0x0647, 0x0649, 0x0002, 0x0647, 0x064a, 0x0002, 0x064a,
+   0x062c, 0x0002, 0x064a, 0x062d, 0x0002, 0x064a, 0x062e, 0x0002, 0x064a,
+   0x0645, 0x0002, 0x064a, 0x0649, 0x0002, 0x064a, 0x064a, 0x0002, 0x0630,
+   0x0670, 0x0002, 0x0631, 0x0670, 0x0002, 0x0649, 0x0670, 0x0003, 0x0020,
+   0x064c, 0x0651, 0x0003, 0x0020, 0x064d, 0x0651, 0x0003, 0x0020, 0x064e,
+   0x0651, 0x0003, 0x0020, 0x064f, 0x0651, 0x0003, 0x0020, 0x0650, 0x0651,
+   0x0003, 0x0020, 0x0651, 0x0670, 0x0003, 0x064a, 0x0654, 0x0631, 0x0003,
+   0x064a, 0x0654, 0x0632, 0x0003, 0x064a, 0x0654, 0x0646, 0x0002, 0x0628,
+   0x0631, 0x0002, 0x0628, 0x0632, 0x0002, 0x0628, 0x0646, 0x0002, 0x062a,
+   0x0631, 0x0002, 0x062a, 0x0632, 0x0002, 0x062a, 0x0646, 0x0002, 0x062b,
+   0x0631, 0x0002, 0x062b, 0x0632, 0x0002, 0x062b, 0x0646, 0x0002, 0x0645,
+   0x0627, 0x0002, 0x0646, 0x0631, 0x0002, 0x0646, 0x0632, 0x0002, 0x0646,
+   0x0646, 0x0002, 0x064a, 0x0631, 0x0002, 0x064a, 0x0632, 0x0002, 0x064a,
+   0x0646, 0x0003, 0x064a, 0x0654, 0x062e, 0x0003, 0x064a, 0x0654, 0x0647,
+   0x0002, 0x0628, 0x0647, 0x0002, 0x062a, 0x0647, 0x0002, 0x0635, 0x062e,
+   0x0002, 0x0644, 0x0647, 0x0002, 0x0646, 0x0647, 0x0002, 0x0647, 0x0670,
+   0x0002, 0x064a, 0x0647, 0x0002, 0x062b, 0x0647, 0x0002, 0x0633, 0x0647,
+   0x0002, 0x0634, 0x0645, 0x0002, 0x0634, 0x0647, 0x0003, 0x0640, 0x064e,
+   0x0651, 0x0003, 0x0640, 0x064f, 0x0651, 0x0003, 0x0640, 0x0650, 0x0651,
+   0x0002, 0x0637, 0x0649, 0x0002, 0x0637, 0x064a, 0x0002, 0x0639, 0x0649,
+   0x0002, 0x0639, 0x064a, 0x0002, 0x063a, 0x0649, 0x0002, 0x063a, 0x064a,
+   0x0002, 0x0633, 0x0649, 0x0002, 0x0633, 0x064a, 0x0002, 0x0634, 0x0649,
+   0x0002, 0x0634, 0x064a, 0x0002, 0x062d, 0x0649, 0x0002, 0x062d, 0x064a,
+   0x0002, 0x062c, 0x0649, 0x0002, 0x062c, 0x064a, 0x0002, 0x062e, 0x0649,
+   0x0002, 0x062e, 0x064a, 0x0002, 0x0635, 0x0649, 0x0002, 0x0635, 0x064a,
+   0x0002, 0x0636, 0x0649, 0x0002, 0x0636, 0x064a, 0x0002, 0x0634, 0x062c,
+   0x0002, 0x0634, 0x062d, 0x0002, 0x0634, 0x062e, 0x0002, 0x0634, 0x0631,
+   0x0002, 0x0633, 0x0631, 0x0002, 0x0635, 0x0631, 0x0002, 0x0636, 0x0631,
+   0x0002, 0x0627, 0x064b, 0x0003, 0x062a, 0x062c, 0x0645, 0x0003, 0x062a,
+   0x062d, 0x062c, 0x0003, 0x062a, 0x062d, 0x0645, 0x0003, 0x062a, 0x062e,
+   0x0645, 0x0003, 0x062a, 0x0645, 0x062c, 0x0003, 0x062a, 0x0645, 0x062d,
+   0x0003, 0x062a, 0x0645, 0x062e, 0x0003, 0x062c, 0x0645, 0x062d, 0x0003,
+   0x062d, 0x0645, 0x064a, 0x0003, 0x062d, 0x0645, 0x0649, 0x0003, 0x0633,
+   0x062d, 0x062c, 0x0003, 0x0633, 0x062c, 0x062d, 0x0003, 0x0633, 0x062c,
+   0x0649, 0x0003, 0x0633, 0x0645, 0x062d, 0x0003, 0x0633, 0x0645, 0x062c,
+   0x0003, 0x0633, 0x0645, 0x0645, 0x0003, 0x0635, 0x062d, 0x062d, 0x0003,
+   0x0635, 0x0645, 0x0645, 0x0003, 0x0634, 0x062d, 0x0645, 0x0003, 0x0634,
+   0x062c, 0x064a, 0x0003, 0x0634, 0x0645, 0x062e, 0x0003, 0x0634, 0x0645,
+   0x0645, 0x0003, 0x0636, 0x062d, 0x0649, 0x0003, 0x0636, 0x062e, 0x0645,
+   0x0003, 0x0637, 0x0645, 0x062d, 0x0003, 0x0637, 0x0645, 0x0645, 0x0003,
+   0x0637, 0x0645, 0x064a, 0x0003, 0x0639, 0x062c, 0x0645, 0x0003, 0x0639,
+   0x0645, 0x0645, 0x0003, 0x0639, 0x0645, 0x0649, 0x0003, 0x063a, 0x0645,
+   0x0645, 0x0003, 0x063a, 0x0645, 0x064a, 0x0003, 0x063a, 0x0645, 0x0649,
+   0x0003, 0x0641, 0x062e, 0x0645, 0x0003, 0x0642, 0x0645, 0x062d, 0x0003,
+   0x0642, 0x0645, 0x0645, 0x0003, 0x0644, 0x062d, 0x0645, 0x0003, 0x0644,
+   0x062d, 0x064a, 0x0003, 0x0644, 0x062d, 0x0649, 0x0003, 0x0644, 0x062c,
+   0x062c, 0x0003, 0x0644, 0x062e, 0x0645, 0x0003, 0x0644, 0x0645, 0x062d,
+   0x0003, 0x0645, 0x062d, 0x062c, 0x0003, 0x0645, 0x062d, 0x0645, 0x0003,
+   0x0645, 0x062d, 0x064a, 0x0003, 0x0645, 0x062c, 0x062d, 0x0003, 0x0645,
+   0x062c, 0x0645, 0x0003, 0x0645, 0x062e, 0x062c, 0x0003, 0x0645, 0x062e,
+   0x0645, 0x0003, 0x0645, 0x062c, 0x062e, 0x0003, 0x0647, 0x0645, 0x062c,
+   0x0003, 0x0647, 0x0645, 0x0645, 0x0003, 0x0646, 0x062d, 0x0645, 0x0003,
+   0x0646, 0x062d, 0x0649, 0x0003, 0x0646, 0x062c, 0x0645, 0x0003, 0x0646,
+   0x062c, 0x0649, 0x0003, 0x0646, 0x0645, 0x064a, 0x0003, 0x0646, 0x0645,
+   0x0649, 0x0003, 0x064a, 0x0645, 0x0645, 0x0003, 0x0628, 0x062e, 0x064a,
+   0x0003, 0x062a, 0x062c, 0x064a, 0x0003, 0x062a, 0x062c, 0x0649, 0x0003,
+   0x062a, 0x062e, 0x064a, 0x0003, 0x062a, 0x062e, 0x0649, 0x0003, 0x062a,
+   0x0645, 0x064a, 0x0003, 0x062a, 0x0645, 0x0649, 0x0003, 0x062c, 0x0645,
+   0x064a, 0x0003, 0x062c, 0x062d, 0x0649, 0x0003, 0x062c, 0x0645, 0x0649,
+   0x0003, 0x0633, 0x062e, 0x0649, 0x0003, 0x0635, 0x062d, 0x064a, 0x0003,
+   0x0634, 0x062d, 0x064a, 0x0003, 0x0636, 0x062d, 0x064a, 0x0003, 0x0644,
+   0x062c, 0x064a, 0x0003, 0x0644, 0x0645, 0x064a, 0x0003, 0x064a, 0x062d,
+   0x064a, 0x0003, 0x064a, 0x062c, 0x064a, 0x0003, 0x064a, 0x0645, 0x064a,
+   0x0003, 0x0645, 0x0645, 0x064a, 0x0003, 0x0642, 0x0645, 0x064a, 0x0003,
+   0x0646, 0x062d, 0x064a, 0x0003, 0x0639, 0x0645, 0x064a, 0x0003, 0x0643,
+   0x0645, 0x064a, 0x0003, 0x0646, 0x062c, 0x062d, 0x0003, 0x0645, 0x062e,
+   0x064a, 0x0003, 0x0644, 0x062c, 0x0645, 0x0003, 0x0643, 0x0645, 0x0645,
+   0x0003, 0x062c, 0x062d, 0x064a, 0x0003, 0x062d, 0x062c, 0x064a, 0x0003,
+   0x0645, 0x062c, 0x064a, 0x0003, 0x0641, 0x0645, 0x064a, 0x0003, 0x0628,
+   0x062d, 0x064a, 0x0003, 0x0633, 0x062e, 0x064a, 0x0003, 0x0646, 0x062c,
+   0x064a, 0x0003, 0x0635, 0x0644, 0x06d2, 0x0003, 0x0642, 0x0644, 0x06d2,
+   0x0004, 0x0627, 0x0644, 0x0644, 0x0647, 0x0004, 0x0627, 0x0643, 0x0628,
+   0x0631, 0x0004, 0x0645, 0x062d, 0x0645, 0x062f, 0x0004, 0x0635, 0x0644,
+   0x0639, 0x0645, 0x0004, 0x0631, 0x0633, 0x0648, 0x0644, 0x0004, 0x0639,
+   0x0644, 0x064a, 0x0647, 0x0004, 0x0648, 0x0633, 0x0644, 0x0645, 0x0003,
+   0x0635, 0x0644, 0x0649, 0x0012, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627,
+   0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064a, 0x0647, 0x0020,
+   0x0648, 0x0633, 0x0644, 0x0645, 0x0008, 0x062c, 0x0644, 0x0020, 0x062c,
+   0x0644, 0x0627, 0x0644, 0x0647, 0x0004, 0x0631, 0x06cc, 0x0627, 0x0644,
+   0x0001, 0x2014, 0x0001, 0x2013, 0x0001, 0x005f, 0x0001, 0x007b, 0x0001,
+   0x007d, 0x0001, 0x3014, 0x0001, 0x3015, 0x0001, 0x3010, 0x0001, 0x3011,
+   0x0001, 0x300a, 0x0001, 0x300b, 0x0001, 0x300c, 0x0001, 0x300d, 0x0001,
+   0x300e, 0x0001, 0x300f, 0x0001, 0x002c, 0x0001, 0x3001, 0x0001, 0x003a,
+   0x0001, 0x003f, 0x0001, 0x0021, 0x0001, 0x0023, 0x0001, 0x0026, 0x0001,
+   0x002a, 0x0001, 0x002d, 0x0001, 0x003c, 0x0001, 0x003e, 0x0001, 0x005c,
+   0x0001, 0x0024, 0x0001, 0x0025, 0x0001, 0x0040, 0x0002, 0x0020, 0x064b,
+   0x0002, 0x0640, 0x064b, 0x0002, 0x0020, 0x064c, 0x0002, 0x0020, 0x064d,
+   0x0002, 0x0020, 0x064e, 0x0002, 0x0640, 0x064e, 0x0002, 0x0020, 0x064f,
+   0x0002, 0x0640, 0x064f, 0x0002, 0x0020, 0x0650, 0x0002, 0x0640, 0x0650,
+   0x0002, 0x0020, 0x0651, 0x0002, 0x0640, 0x0651, 0x0002, 0x0020, 0x0652,
+   0x0002, 0x0640, 0x0652, 0x0001, 0x0621, 0x0001, 0x0627, 0x0001, 0x0628,
+   0x0001, 0x0629, 0x0001, 0x062a, 0x0001, 0x062b, 0x0001, 0x062c, 0x0001,
+   0x062d, 0x0001, 0x062e, 0x0001, 0x062f, 0x0001, 0x0630, 0x0001, 0x0631,
+   0x0001, 0x0632, 0x0001, 0x0633, 0x0001, 0x0634, 0x0001, 0x0635, 0x0001,
+   0x0636, 0x0001, 0x0637, 0x0001, 0x0638, 0x0001, 0x0639, 0x0001, 0x063a,
+   0x0001, 0x0641, 0x0001, 0x0642, 0x0001, 0x0643, 0x0001, 0x0644, 0x0001,
+   0x0645, 0x0001, 0x0646, 0x0001, 0x0647, 0x0001, 0x0648, 0x0001, 0x064a,
+   0x0003, 0x0644, 0x0627, 0x0653, 0x0003, 0x0644, 0x0627, 0x0654, 0x0003,
+   0x0644, 0x0627, 0x0655, 0x0002, 0x0644, 0x0627, 0x0001, 0x0022, 0x0001,
+   0x0027, 0x0001, 0x002f, 0x0001, 0x005b, 0x0001, 0x005d, 0x0001, 0x005e,
+   0x0001, 0x007c, 0x0001, 0x007e, 0x0001, 0x2985, 0x0001, 0x2986, 0x0001,
+   0x3002, 0x0001, 0x30fb, 0x0001, 0x30a1, 0x0001, 0x30a3, 0x0001, 0x30a5,
+   0x0001, 0x30a7, 0x0001, 0x30a9, 0x0001, 0x30e3, 0x0001, 0x30e5, 0x0001,
+   0x30e7, 0x0001, 0x30c3, 0x0001, 0x30fc, 0x0001, 0x30f3, 0x0001, 0x3099,
+   0x0001, 0x309a, 0x0001, 0x00a2, 0x0001, 0x00a3, 0x0001, 0x00ac, 0x0001,
+   0x00a6, 0x0001, 0x00a5, 0x0001, 0x20a9, 0x0001, 0x2502, 0x0001, 0x2190,
+   0x0001, 0x2191, 0x0001, 0x2192, 0x0001, 0x2193, 0x0001, 0x25a0, 0x0001,
+   0x25cb, 0x0004, 0xd834, 0xdd57, 0xd834, 0xdd65, 0x0004, 0xd834, 0xdd58,
+   0xd834, 0xdd65, 0x0006, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd6e,
+   0x0006, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd6f, 0x0006, 0xd834,
+   0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd70, 0x0006, 0xd834, 0xdd58, 0xd834,
+   0xdd65, 0xd834, 0xdd71, 0x0006, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834,
+   0xdd72, 0x0004, 0xd834, 0xddb9, 0xd834, 0xdd65, 0x0004, 0xd834, 0xddba,
+   0xd834, 0xdd65, 0x0006, 0xd834, 0xddb9, 0xd834, 0xdd65, 0xd834, 0xdd6e,
+   0x0006, 0xd834, 0xddba, 0xd834, 0xdd65, 0xd834, 0xdd6e, 0x0006, 0xd834,
+   0xddb9, 0xd834, 0xdd65, 0xd834, 0xdd6f, 0x0006, 0xd834, 0xddba, 0xd834,
+   0xdd65, 0xd834, 0xdd6f, 0x0001, 0x0391, 0x0001, 0x0392, 0x0001, 0x0394,
+   0x0001, 0x0395, 0x0001, 0x0396, 0x0001, 0x0397, 0x0001, 0x0399, 0x0001,
+   0x039a, 0x0001, 0x039b, 0x0001, 0x039c, 0x0001, 0x039d, 0x0001, 0x039e,
+   0x0001, 0x039f, 0x0001, 0x03a1, 0x0001, 0x03a3, 0x0001, 0x03a4, 0x0001,
+   0x03a6, 0x0001, 0x03a7, 0x0001, 0x03a8, 0x0001, 0x2207, 0x0001, 0x03b1,
+   0x0001, 0x03b4, 0x0001, 0x03b6, 0x0001, 0x03b7, 0x0001, 0x03bb, 0x0001,
+   0x03bd, 0x0001, 0x03be, 0x0001, 0x03bf, 0x0001, 0x03c3, 0x0001, 0x03c4,
+   0x0001, 0x03c5, 0x0001, 0x03c7, 0x0001, 0x03c8, 0x0001, 0x03c9, 0x0001,
+   0x2202, 0x0001, 0x4e3d, 0x0001, 0x4e38, 0x0001, 0x4e41, 0x0002, 0xd840,
+   0xdd22, 0x0001, 0x4f60, 0x0001, 0x4fbb, 0x0001, 0x5002, 0x0001, 0x507a,
+   0x0001, 0x5099, 0x0001, 0x50cf, 0x0001, 0x349e, 0x0002, 0xd841, 0xde3a,
+   0x0001, 0x5154, 0x0001, 0x5164, 0x0001, 0x5177, 0x0002, 0xd841, 0xdd1c,
+   0x0001, 0x34b9, 0x0001, 0x5167, 0x0001, 0x518d, 0x0002, 0xd841, 0xdd4b,
+   0x0001, 0x5197, 0x0001, 0x51a4, 0x0001, 0x4ecc, 0x0001, 0x51ac, 0x0001,
+   0x51b5, 0x0002, 0xd864, 0xdddf, 0x0001, 0x5203, 0x0001, 0x34df, 0x0001,
+   0x523b, 0x0001, 0x5246, 0x0001, 0x5272, 0x0001, 0x5277, 0x0001, 0x3515,
+   0x0001, 0x52c7, 0x0001, 0x52fa, 0x0001, 0x5305, 0x0001, 0x5306, 0x0001,
+   0x5349, 0x0001, 0x535a, 0x0001, 0x5373, 0x0001, 0x537d, 0x0001, 0x537f,
+   0x0002, 0xd842, 0xde2c, 0x0001, 0x7070, 0x0001, 0x53ca, 0x0001, 0x53df,
+   0x0002, 0xd842, 0xdf63, 0x0001, 0x53eb, 0x0001, 0x53f1, 0x0001, 0x5406,
+   0x0001, 0x549e, 0x0001, 0x5438, 0x0001, 0x5448, 0x0001, 0x5468, 0x0001,
+   0x54a2, 0x0001, 0x54f6, 0x0001, 0x5510, 0x0001, 0x5553, 0x0001, 0x5563,
+   0x0001, 0x5584, 0x0001, 0x5599, 0x0001, 0x55ab, 0x0001, 0x55b3, 0x0001,
+   0x55c2, 0x0001, 0x5716, 0x0001, 0x5717, 0x0001, 0x5651, 0x0001, 0x5674,
+   0x0001, 0x58ee, 0x0001, 0x57ce, 0x0001, 0x57f4, 0x0001, 0x580d, 0x0001,
+   0x578b, 0x0001, 0x5832, 0x0001, 0x5831, 0x0001, 0x58ac, 0x0002, 0xd845,
+   0xdce4, 0x0001, 0x58f2, 0x0001, 0x58f7, 0x0001, 0x5906, 0x0001, 0x591a,
+   0x0001, 0x5922, 0x0001, 0x5962, 0x0002, 0xd845, 0xdea8, 0x0002, 0xd845,
+   0xdeea, 0x0001, 0x59ec, 0x0001, 0x5a1b, 0x0001, 0x5a27, 0x0001, 0x59d8,
+   0x0001, 0x5a66, 0x0001, 0x36ee, 0x0002, 0xd844, 0xdf6a, 0x0001, 0x5b08,
+   0x0001, 0x5b3e, 0x0002, 0xd846, 0xddc8, 0x0001, 0x5bc3, 0x0001, 0x5bd8,
+   0x0001, 0x5bf3, 0x0002, 0xd846, 0xdf18, 0x0001, 0x5bff, 0x0001, 0x5c06,
+   0x0001, 0x5f33, 0x0001, 0x3781, 0x0001, 0x5c60, 0x0001, 0x5cc0, 0x0001,
+   0x5c8d, 0x0002, 0xd847, 0xdde4, 0x0001, 0x5d43, 0x0002, 0xd847, 0xdde6,
+   0x0001, 0x5d6e, 0x0001, 0x5d6b, 0x0001, 0x5d7c, 0x0001, 0x5de1, 0x0001,
+   0x5de2, 0x0001, 0x382f, 0x0001, 0x5dfd, 0x0001, 0x5e28, 0x0001, 0x5e3d,
+   0x0001, 0x5e69, 0x0001, 0x3862, 0x0002, 0xd848, 0xdd83, 0x0001, 0x387c,
+   0x0001, 0x5eb0, 0x0001, 0x5eb3, 0x0001, 0x5eb6, 0x0002, 0xd868, 0xdf92,
+   0x0002, 0xd848, 0xdf31, 0x0001, 0x8201, 0x0001, 0x5f22, 0x0001, 0x38c7,
+   0x0002, 0xd84c, 0xdeb8, 0x0002, 0xd858, 0xddda, 0x0001, 0x5f62, 0x0001,
+   0x5f6b, 0x0001, 0x38e3, 0x0001, 0x5f9a, 0x0001, 0x5fcd, 0x0001, 0x5fd7,
+   0x0001, 0x5ff9, 0x0001, 0x6081, 0x0001, 0x393a, 0x0001, 0x391c, 0x0002,
+   0xd849, 0xded4, 0x0001, 0x60c7, 0x0001, 0x6148, 0x0001, 0x614c, 0x0001,
+   0x614e, 0x0001, 0x617a, 0x0001, 0x61b2, 0x0001, 0x61a4, 0x0001, 0x61af,
+   0x0001, 0x61de, 0x0001, 0x6210, 0x0001, 0x621b, 0x0001, 0x625d, 0x0001,
+   0x62b1, 0x0001, 0x62d4, 0x0001, 0x6350, 0x0002, 0xd84a, 0xdf0c, 0x0001,
+   0x633d, 0x0001, 0x62fc, 0x0001, 0x6368, 0x0001, 0x6383, 0x0001, 0x63e4,
+   0x0002, 0xd84a, 0xdff1, 0x0001, 0x6422, 0x0001, 0x63c5, 0x0001, 0x63a9,
+   0x0001, 0x3a2e, 0x0001, 0x6469, 0x0001, 0x647e, 0x0001, 0x649d, 0x0001,
+   0x6477, 0x0001, 0x3a6c, 0x0001, 0x656c, 0x0002, 0xd84c, 0xdc0a, 0x0001,
+   0x65e3, 0x0001, 0x66f8, 0x0001, 0x6649, 0x0001, 0x3b19, 0x0001, 0x3b08,
+   0x0001, 0x3ae4, 0x0001, 0x5192, 0x0001, 0x5195, 0x0001, 0x6700, 0x0001,
+   0x669c, 0x0001, 0x80ad, 0x0001, 0x43d9, 0x0001, 0x671b, 0x0001, 0x6721,
+   0x0001, 0x675e, 0x0001, 0x6753, 0x0002, 0xd84c, 0xdfc3, 0x0001, 0x3b49,
+   0x0001, 0x67fa, 0x0001, 0x6785, 0x0001, 0x6852, 0x0002, 0xd84d, 0xdc6d,
+   0x0001, 0x688e, 0x0001, 0x681f, 0x0001, 0x6914, 0x0001, 0x3b9d, 0x0001,
+   0x6942, 0x0001, 0x69a3, 0x0001, 0x69ea, 0x0001, 0x6aa8, 0x0002, 0xd84d,
+   0xdea3, 0x0001, 0x6adb, 0x0001, 0x3c18, 0x0001, 0x6b21, 0x0002, 0xd84e,
+   0xdca7, 0x0001, 0x6b54, 0x0001, 0x3c4e, 0x0001, 0x6b72, 0x0001, 0x6b9f,
+   0x0001, 0x6bbb, 0x0002, 0xd84e, 0xde8d, 0x0002, 0xd847, 0xdd0b, 0x0002,
+   0xd84e, 0xdefa, 0x0001, 0x6c4e, 0x0002, 0xd84f, 0xdcbc, 0x0001, 0x6cbf,
+   0x0001, 0x6ccd, 0x0001, 0x6c67, 0x0001, 0x6d16, 0x0001, 0x6d3e, 0x0001,
+   0x6d69, 0x0001, 0x6d78, 0x0001, 0x6d85, 0x0002, 0xd84f, 0xdd1e, 0x0001,
+   0x6d34, 0x0001, 0x6e2f, 0x0001, 0x6e6e, 0x0001, 0x3d33, 0x0001, 0x6ecb,
+   0x0001, 0x6ec7, 0x0002, 0xd84f, 0xded1, 0x0001, 0x6df9, 0x0001, 0x6f6e,
+   0x0002, 0xd84f, 0xdf5e, 0x0002, 0xd84f, 0xdf8e, 0x0001, 0x6fc6, 0x0001,
+   0x7039, 0x0001, 0x701e, 0x0001, 0x701b, 0x0001, 0x3d96, 0x0001, 0x704a,
+   0x0001, 0x707d, 0x0001, 0x7077, 0x0001, 0x70ad, 0x0002, 0xd841, 0xdd25,
+   0x0001, 0x7145, 0x0002, 0xd850, 0xde63, 0x0001, 0x719c, 0x0001, 0x43ab,
+   0x0001, 0x7228, 0x0001, 0x7235, 0x0001, 0x7250, 0x0002, 0xd851, 0xde08,
+   0x0001, 0x7280, 0x0001, 0x7295, 0x0002, 0xd851, 0xdf35, 0x0002, 0xd852,
+   0xdc14, 0x0001, 0x737a, 0x0001, 0x738b, 0x0001, 0x3eac, 0x0001, 0x73a5,
+   0x0001, 0x3eb8, 0x0001, 0x7447, 0x0001, 0x745c, 0x0001, 0x7471, 0x0001,
+   0x7485, 0x0001, 0x74ca, 0x0001, 0x3f1b, 0x0001, 0x7524, 0x0002, 0xd853,
+   0xdc36, 0x0001, 0x753e, 0x0002, 0xd853, 0xdc92, 0x0002, 0xd848, 0xdd9f,
+   0x0001, 0x7610, 0x0002, 0xd853, 0xdfa1, 0x0002, 0xd853, 0xdfb8, 0x0002,
+   0xd854, 0xdc44, 0x0001, 0x3ffc, 0x0001, 0x4008, 0x0001, 0x76f4, 0x0002,
+   0xd854, 0xdcf3, 0x0002, 0xd854, 0xdcf2, 0x0002, 0xd854, 0xdd19, 0x0002,
+   0xd854, 0xdd33, 0x0001, 0x771e, 0x0001, 0x771f, 0x0001, 0x774a, 0x0001,
+   0x4039, 0x0001, 0x778b, 0x0001, 0x4046, 0x0001, 0x4096, 0x0002, 0xd855,
+   0xdc1d, 0x0001, 0x784e, 0x0001, 0x78cc, 0x0001, 0x40e3, 0x0002, 0xd855,
+   0xde26, 0x0002, 0xd855, 0xde9a, 0x0002, 0xd855, 0xdec5, 0x0001, 0x79eb,
+   0x0001, 0x412f, 0x0001, 0x7a4a, 0x0001, 0x7a4f, 0x0002, 0xd856, 0xdd7c,
+   0x0002, 0xd856, 0xdea7, 0x0001, 0x7aae, 0x0001, 0x4202, 0x0002, 0xd856,
+   0xdfab, 0x0001, 0x7bc6, 0x0001, 0x7bc9, 0x0001, 0x4227, 0x0002, 0xd857,
+   0xdc80, 0x0001, 0x7cd2, 0x0001, 0x42a0, 0x0001, 0x7ce8, 0x0001, 0x7ce3,
+   0x0001, 0x7d00, 0x0002, 0xd857, 0xdf86, 0x0001, 0x7d63, 0x0001, 0x4301,
+   0x0001, 0x7dc7, 0x0001, 0x7e02, 0x0001, 0x7e45, 0x0001, 0x4334, 0x0002,
+   0xd858, 0xde28, 0x0002, 0xd858, 0xde47, 0x0001, 0x4359, 0x0002, 0xd858,
+   0xded9, 0x0001, 0x7f7a, 0x0002, 0xd858, 0xdf3e, 0x0001, 0x7f95, 0x0001,
+   0x7ffa, 0x0002, 0xd859, 0xdcda, 0x0002, 0xd859, 0xdd23, 0x0001, 0x8060,
+   0x0002, 0xd859, 0xdda8, 0x0001, 0x8070, 0x0002, 0xd84c, 0xdf5f, 0x0001,
+   0x43d5, 0x0001, 0x80b2, 0x0001, 0x8103, 0x0001, 0x440b, 0x0001, 0x813e,
+   0x0001, 0x5ab5, 0x0002, 0xd859, 0xdfa7, 0x0002, 0xd859, 0xdfb5, 0x0002,
+   0xd84c, 0xdf93, 0x0002, 0xd84c, 0xdf9c, 0x0001, 0x8204, 0x0001, 0x8f9e,
+   0x0001, 0x446b, 0x0001, 0x8291, 0x0001, 0x828b, 0x0001, 0x829d, 0x0001,
+   0x52b3, 0x0001, 0x82b1, 0x0001, 0x82b3, 0x0001, 0x82bd, 0x0001, 0x82e6,
+   0x0002, 0xd85a, 0xdf3c, 0x0001, 0x831d, 0x0001, 0x8363, 0x0001, 0x83ad,
+   0x0001, 0x8323, 0x0001, 0x83bd, 0x0001, 0x83e7, 0x0001, 0x8353, 0x0001,
+   0x83ca, 0x0001, 0x83cc, 0x0001, 0x83dc, 0x0002, 0xd85b, 0xdc36, 0x0002,
+   0xd85b, 0xdd6b, 0x0002, 0xd85b, 0xdcd5, 0x0001, 0x452b, 0x0001, 0x84f1,
+   0x0001, 0x84f3, 0x0001, 0x8516, 0x0002, 0xd85c, 0xdfca, 0x0001, 0x8564,
+   0x0002, 0xd85b, 0xdf2c, 0x0001, 0x455d, 0x0001, 0x4561, 0x0002, 0xd85b,
+   0xdfb1, 0x0002, 0xd85c, 0xdcd2, 0x0001, 0x456b, 0x0001, 0x8650, 0x0001,
+   0x8667, 0x0001, 0x8669, 0x0001, 0x86a9, 0x0001, 0x8688, 0x0001, 0x870e,
+   0x0001, 0x86e2, 0x0001, 0x8779, 0x0001, 0x8728, 0x0001, 0x876b, 0x0001,
+   0x8786, 0x0001, 0x4d57, 0x0001, 0x87e1, 0x0001, 0x8801, 0x0001, 0x45f9,
+   0x0001, 0x8860, 0x0002, 0xd85d, 0xde67, 0x0001, 0x88d7, 0x0001, 0x88de,
+   0x0001, 0x4635, 0x0001, 0x88fa, 0x0001, 0x34bb, 0x0002, 0xd85e, 0xdcae,
+   0x0002, 0xd85e, 0xdd66, 0x0001, 0x46be, 0x0001, 0x46c7, 0x0001, 0x8aa0,
+   0x0001, 0x8aed, 0x0001, 0x8b8a, 0x0002, 0xd85f, 0xdca8, 0x0001, 0x8cab,
+   0x0001, 0x8cc1, 0x0001, 0x8d1b, 0x0001, 0x8d77, 0x0002, 0xd85f, 0xdf2f,
+   0x0002, 0xd842, 0xdc04, 0x0001, 0x8dcb, 0x0001, 0x8dbc, 0x0001, 0x8df0,
+   0x0002, 0xd842, 0xdcde, 0x0001, 0x8ed4, 0x0001, 0x8f38, 0x0002, 0xd861,
+   0xddd2, 0x0002, 0xd861, 0xdded, 0x0001, 0x9094, 0x0001, 0x90f1, 0x0001,
+   0x9111, 0x0002, 0xd861, 0xdf2e, 0x0001, 0x911b, 0x0001, 0x9238, 0x0001,
+   0x92d7, 0x0001, 0x92d8, 0x0001, 0x927c, 0x0001, 0x93f9, 0x0001, 0x9415,
+   0x0002, 0xd862, 0xdffa, 0x0001, 0x958b, 0x0001, 0x4995, 0x0001, 0x95b7,
+   0x0002, 0xd863, 0xdd77, 0x0001, 0x49e6, 0x0001, 0x96c3, 0x0001, 0x5db2,
+   0x0001, 0x9723, 0x0002, 0xd864, 0xdd45, 0x0002, 0xd864, 0xde1a, 0x0001,
+   0x4a6e, 0x0001, 0x4a76, 0x0001, 0x97e0, 0x0002, 0xd865, 0xdc0a, 0x0001,
+   0x4ab2, 0x0002, 0xd865, 0xdc96, 0x0001, 0x980b, 0x0001, 0x9829, 0x0002,
+   0xd865, 0xddb6, 0x0001, 0x98e2, 0x0001, 0x4b33, 0x0001, 0x9929, 0x0001,
+   0x99a7, 0x0001, 0x99c2, 0x0001, 0x99fe, 0x0001, 0x4bce, 0x0002, 0xd866,
+   0xdf30, 0x0001, 0x9b12, 0x0001, 0x9c40, 0x0001, 0x9cfd, 0x0001, 0x4cce,
+   0x0001, 0x4ced, 0x0001, 0x9d67, 0x0002, 0xd868, 0xdcce, 0x0001, 0x4cf8,
+   0x0002, 0xd868, 0xdd05, 0x0002, 0xd868, 0xde0e, 0x0002, 0xd868, 0xde91,
+   0x0001, 0x4d56, 0x0001, 0x9efe, 0x0001, 0x9f05, 0x0001, 0x9f0f, 0x0001,
+   0x9f16, 0x0002, 0xd869, 0xde00,
+};
+
+/* the first and second code points of each pair, sorted */
+static const uint32_t mongoc_saslprep_compose_keys[917] = {
+   0x003c0338, 0x003d0338, 0x003e0338, 0x00410300, 0x00410301, 0x00410302,
+   0x00410303, 0x00410304, 0x00410306, 0x00410307, 0x00410308, 0x00410309,
+   0x0041030a, 0x0041030c, 0x0041030f, 0x00410311, 0x00410323, 0x00410325,
+   0x00410328, 0x00420307, 0x00420323, 0x00420331, 0x00430301, 0x00430302,
+   0x00430307, 0x0043030c, 0x00430327, 0x00440307, 0x0044030c, 0x00440323,
+   0x00440327, 0x0044032d, 0x00440331, 0x00450300, 0x00450301, 0x00450302,
+   0x00450303, 0x00450304, 0x00450306, 0x00450307, 0x00450308, 0x00450309,
+   0x0045030c, 0x0045030f, 0x00450311, 0x00450323, 0x00450327, 0x00450328,
+   0x0045032d, 0x00450330, 0x00460307, 0x00470301, 0x00470302, 0x00470304,
+   0x00470306, 0x00470307, 0x0047030c, 0x00470327, 0x00480302, 0x00480307,
+   0x00480308, 0x0048030c, 0x00480323, 0x00480327, 0x0048032e, 0x00490300,
+   0x00490301, 0x00490302, 0x00490303, 0x00490304, 0x00490306, 0x00490307,
+   0x00490308, 0x00490309, 0x0049030c, 0x0049030f, 0x00490311, 0x00490323,
+   0x00490328, 0x00490330, 0x004a0302, 0x004b0301, 0x004b030c, 0x004b0323,
+   0x004b0327, 0x004b0331, 0x004c0301, 0x004c030c, 0x004c0323, 0x004c0327,
+   0x004c032d, 0x004c0331, 0x004d0301, 0x004d0307, 0x004d0323, 0x004e0300,
+   0x004e0301, 0x004e0303, 0x004e0307, 0x004e030c, 0x004e0323, 0x004e0327,
+   0x004e032d, 0x004e0331, 0x004f0300, 0x004f0301, 0x004f0302, 0x004f0303,
+   0x004f0304, 0x004f0306, 0x004f0307, 0x004f0308, 0x004f0309, 0x004f030b,
+   0x004f030c, 0x004f030f, 0x004f0311, 0x004f031b, 0x004f0323, 0x004f0328,
+   0x00500301, 0x00500307, 0x00520301, 0x00520307, 0x0052030c, 0x0052030f,
+   0x00520311, 0x00520323, 0x00520327, 0x00520331, 0x00530301, 0x00530302,
+   0x00530307, 0x0053030c, 0x00530323, 0x00530326, 0x00530327, 0x00540307,
+   0x0054030c, 0x00540323, 0x00540326, 0x00540327, 0x0054032d, 0x00540331,
+   0x00550300, 0x00550301, 0x00550302, 0x00550303, 0x00550304, 0x00550306,
+   0x00550308, 0x00550309, 0x0055030a, 0x0055030b, 0x0055030c, 0x0055030f,
+   0x00550311, 0x0055031b, 0x00550323, 0x00550324, 0x00550328, 0x0055032d,
+   0x00550330, 0x00560303, 0x00560323, 0x00570300, 0x00570301, 0x00570302,
+   0x00570307, 0x00570308, 0x00570323, 0x00580307, 0x00580308, 0x00590300,
+   0x00590301, 0x00590302, 0x00590303, 0x00590304, 0x00590307, 0x00590308,
+   0x00590309, 0x00590323, 0x005a0301, 0x005a0302, 0x005a0307, 0x005a030c,
+   0x005a0323, 0x005a0331, 0x00610300, 0x00610301, 0x00610302, 0x00610303,
+   0x00610304, 0x00610306, 0x00610307, 0x00610308, 0x00610309, 0x0061030a,
+   0x0061030c, 0x0061030f, 0x00610311, 0x00610323, 0x00610325, 0x00610328,
+   0x00620307, 0x00620323, 0x00620331, 0x00630301, 0x00630302, 0x00630307,
+   0x0063030c, 0x00630327, 0x00640307, 0x0064030c, 0x00640323, 0x00640327,
+   0x0064032d, 0x00640331, 0x00650300, 0x00650301, 0x00650302, 0x00650303,
+   0x00650304, 0x00650306, 0x00650307, 0x00650308, 0x00650309, 0x0065030c,
+   0x0065030f, 0x00650311, 0x00650323, 0x00650327, 0x00650328, 0x0065032d,
+   0x00650330, 0x00660307, 0x00670301, 0x00670302, 0x00670304, 0x00670306,
+   0x00670307, 0x0067030c, 0x00670327, 0x00680302, 0x00680307, 0x00680308,
+   0x0068030c, 0x00680323, 0x00680327, 0x0068032e, 0x00680331, 0x00690300,
+   0x00690301, 0x00690302, 0x00690303, 0x00690304, 0x00690306, 0x00690308,
+   0x00690309, 0x0069030c, 0x0069030f, 0x00690311, 0x00690323, 0x00690328,
+   0x00690330, 0x006a0302, 0x006a030c, 0x006b0301, 0x006b030c, 0x006b0323,
+   0x006b0327, 0x006b0331, 0x006c0301, 0x006c030c, 0x006c0323, 0x006c0327,
+   0x006c032d, 0x006c0331, 0x006d0301, 0x006d0307, 0x006d0323, 0x006e0300,
+   0x006e0301, 0x006e0303, 0x006e0307, 0x006e030c, 0x006e0323, 0x006e0327,
+   0x006e032d, 0x006e0331, 0x006f0300, 0x006f0301, 0x006f0302, 0x006f0303,
+   0x006f0304, 0x006f0306, 0x006f0307, 0x006f0308, 0x006f0309, 0x006f030b,
+   0x006f030c, 0x006f030f, 0x006f0311, 0x006f031b, 0x006f0323, 0x006f0328,
+   0x00700301, 0x00700307, 0x00720301, 0x00720307, 0x0072030c, 0x0072030f,
+   0x00720311, 0x00720323, 0x00720327, 0x00720331, 0x00730301, 0x00730302,
+   0x00730307, 0x0073030c, 0x00730323, 0x00730326, 0x00730327, 0x00740307,
+   0x00740308, 0x0074030c, 0x00740323, 0x00740326, 0x00740327, 0x0074032d,
+   0x00740331, 0x00750300, 0x00750301, 0x00750302, 0x00750303, 0x00750304,
+   0x00750306, 0x00750308, 0x00750309, 0x0075030a, 0x0075030b, 0x0075030c,
+   0x0075030f, 0x00750311, 0x0075031b, 0x00750323, 0x00750324, 0x00750328,
+   0x0075032d, 0x00750330, 0x00760303, 0x00760323, 0x00770300, 0x00770301,
+   0x00770302, 0x00770307, 0x00770308, 0x0077030a, 0x00770323, 0x00780307,
+   0x00780308, 0x00790300, 0x00790301, 0x00790302, 0x00790303, 0x00790304,
+   0x00790307, 0x00790308, 0x00790309, 0x0079030a, 0x00790323, 0x007a0301,
+   0x007a0302, 0x007a0307, 0x007a030c, 0x007a0323, 0x007a0331, 0x00a80300,
+   0x00a80301, 0x00a80342, 0x00c20300, 0x00c20301, 0x00c20303, 0x00c20309,
+   0x00c40304, 0x00c50301, 0x00c60301, 0x00c60304, 0x00c70301, 0x00ca0300,
+   0x00ca0301, 0x00ca0303, 0x00ca0309, 0x00cf0301, 0x00d40300, 0x00d40301,
+   0x00d40303, 0x00d40309, 0x00d50301, 0x00d50304, 0x00d50308, 0x00d60304,
+   0x00d80301, 0x00dc0300, 0x00dc0301, 0x00dc0304, 0x00dc030c, 0x00e20300,
+   0x00e20301, 0x00e20303, 0x00e20309, 0x00e40304, 0x00e50301, 0x00e60301,
+   0x00e60304, 0x00e70301, 0x00ea0300, 0x00ea0301, 0x00ea0303, 0x00ea0309,
+   0x00ef0301, 0x00f40300, 0x00f40301, 0x00f40303, 0x00f40309, 0x00f50301,
+   0x00f50304, 0x00f50308, 0x00f60304, 0x00f80301, 0x00fc0300, 0x00fc0301,
+   0x00fc0304, 0x00fc030c, 0x01020300, 0x01020301, 0x01020303, 0x01020309,
+   0x01030300, 0x01030301, 0x01030303, 0x01030309, 0x01120300, 0x01120301,
+   0x01130300, 0x01130301, 0x014c0300, 0x014c0301, 0x014d0300, 0x014d0301,
+   0x015a0307, 0x015b0307, 0x01600307, 0x01610307, 0x01680301, 0x01690301,
+   0x016a0308, 0x016b0308, 0x017f0307, 0x01a00300, 0x01a00301, 0x01a00303,
+   0x01a00309, 0x01a00323, 0x01a10300, 0x01a10301, 0x01a10303, 0x01a10309,
+   0x01a10323, 0x01af0300, 0x01af0301, 0x01af0303, 0x01af0309, 0x01af0323,
+   0x01b00300, 0x01b00301, 0x01b00303, 0x01b00309, 0x01b00323, 0x01b7030c,
+   0x01ea0304, 0x01eb0304, 0x02260304, 0x02270304, 0x02280306, 0x02290306,
+   0x022e0304, 0x022f0304, 0x0292030c, 0x03910300, 0x03910301, 0x03910304,
+   0x03910306, 0x03910313, 0x03910314, 0x03910345, 0x03950300, 0x03950301,
+   0x03950313, 0x03950314, 0x03970300, 0x03970301, 0x03970313, 0x03970314,
+   0x03970345, 0x03990300, 0x03990301, 0x03990304, 0x03990306, 0x03990308,
+   0x03990313, 0x03990314, 0x039f0300, 0x039f0301, 0x039f0313, 0x039f0314,
+   0x03a10314, 0x03a50300, 0x03a50301, 0x03a50304, 0x03a50306, 0x03a50308,
+   0x03a50314, 0x03a90300, 0x03a90301, 0x03a90313, 0x03a90314, 0x03a90345,
+   0x03ac0345, 0x03ae0345, 0x03b10300, 0x03b10301, 0x03b10304, 0x03b10306,
+   0x03b10313, 0x03b10314, 0x03b10342, 0x03b10345, 0x03b50300, 0x03b50301,
+   0x03b50313, 0x03b50314, 0x03b70300, 0x03b70301, 0x03b70313, 0x03b70314,
+   0x03b70342, 0x03b70345, 0x03b90300, 0x03b90301, 0x03b90304, 0x03b90306,
+   0x03b90308, 0x03b90313, 0x03b90314, 0x03b90342, 0x03bf0300, 0x03bf0301,
+   0x03bf0313, 0x03bf0314, 0x03c10313, 0x03c10314, 0x03c50300, 0x03c50301,
+   0x03c50304, 0x03c50306, 0x03c50308, 0x03c50313, 0x03c50314, 0x03c50342,
+   0x03c90300, 0x03c90301, 0x03c90313, 0x03c90314, 0x03c90342, 0x03c90345,
+   0x03ca0300, 0x03ca0301, 0x03ca0342, 0x03cb0300, 0x03cb0301, 0x03cb0342,
+   0x03ce0345, 0x03d20301, 0x03d20308, 0x04060308, 0x04100306, 0x04100308,
+   0x04130301, 0x04150300, 0x04150306, 0x04150308, 0x04160306, 0x04160308,
+   0x04170308, 0x04180300, 0x04180304, 0x04180306, 0x04180308, 0x041a0301,
+   0x041e0308, 0x04230304, 0x04230306, 0x04230308, 0x0423030b, 0x04270308,
+   0x042b0308, 0x042d0308, 0x04300306, 0x04300308, 0x04330301, 0x04350300,
+   0x04350306, 0x04350308, 0x04360306, 0x04360308, 0x04370308, 0x04380300,
+   0x04380304, 0x04380306, 0x04380308, 0x043a0301, 0x043e0308, 0x04430304,
+   0x04430306, 0x04430308, 0x0443030b, 0x04470308, 0x044b0308, 0x044d0308,
+   0x04560308, 0x0474030f, 0x0475030f, 0x04d80308, 0x04d90308, 0x04e80308,
+   0x04e90308, 0x06270653, 0x06270654, 0x06270655, 0x06480654, 0x064a0654,
+   0x06c10654, 0x06d20654, 0x06d50654, 0x0928093c, 0x0930093c, 0x0933093c,
+   0x09c709be, 0x09c709d7, 0x0b470b3e, 0x0b470b56, 0x0b470b57, 0x0b920bd7,
+   0x0bc60bbe, 0x0bc60bd7, 0x0bc70bbe, 0x0c460c56, 0x0cbf0cd5, 0x0cc60cc2,
+   0x0cc60cd5, 0x0cc60cd6, 0x0cca0cd5, 0x0d460d3e, 0x0d460d57, 0x0d470d3e,
+   0x0dd90dca, 0x0dd90dcf, 0x0dd90ddf, 0x0ddc0dca, 0x1025102e, 0x1e360304,
+   0x1e370304, 0x1e5a0304, 0x1e5b0304, 0x1e620307, 0x1e630307, 0x1ea00302,
+   0x1ea00306, 0x1ea10302, 0x1ea10306, 0x1eb80302, 0x1eb90302, 0x1ecc0302,
+   0x1ecd0302, 0x1f000300, 0x1f000301, 0x1f000342, 0x1f000345, 0x1f010300,
+   0x1f010301, 0x1f010342, 0x1f010345, 0x1f020345, 0x1f030345, 0x1f040345,
+   0x1f050345, 0x1f060345, 0x1f070345, 0x1f080300, 0x1f080301, 0x1f080342,
+   0x1f080345, 0x1f090300, 0x1f090301, 0x1f090342, 0x1f090345, 0x1f0a0345,
+   0x1f0b0345, 0x1f0c0345, 0x1f0d0345, 0x1f0e0345, 0x1f0f0345, 0x1f100300,
+   0x1f100301, 0x1f110300, 0x1f110301, 0x1f180300, 0x1f180301, 0x1f190300,
+   0x1f190301, 0x1f200300, 0x1f200301, 0x1f200342, 0x1f200345, 0x1f210300,
+   0x1f210301, 0x1f210342, 0x1f210345, 0x1f220345, 0x1f230345, 0x1f240345,
+   0x1f250345, 0x1f260345, 0x1f270345, 0x1f280300, 0x1f280301, 0x1f280342,
+   0x1f280345, 0x1f290300, 0x1f290301, 0x1f290342, 0x1f290345, 0x1f2a0345,
+   0x1f2b0345, 0x1f2c0345, 0x1f2d0345, 0x1f2e0345, 0x1f2f0345, 0x1f300300,
+   0x1f300301, 0x1f300342, 0x1f310300, 0x1f310301, 0x1f310342, 0x1f380300,
+   0x1f380301, 0x1f380342, 0x1f390300, 0x1f390301, 0x1f390342, 0x1f400300,
+   0x1f400301, 0x1f410300, 0x1f410301, 0x1f480300, 0x1f480301, 0x1f490300,
+   0x1f490301, 0x1f500300, 0x1f500301, 0x1f500342, 0x1f510300, 0x1f510301,
+   0x1f510342, 0x1f590300, 0x1f590301, 0x1f590342, 0x1f600300, 0x1f600301,
+   0x1f600342, 0x1f600345, 0x1f610300, 0x1f610301, 0x1f610342, 0x1f610345,
+   0x1f620345, 0x1f630345, 0x1f640345, 0x1f650345, 0x1f660345, 0x1f670345,
+   0x1f680300, 0x1f680301, 0x1f680342, 0x1f680345, 0x1f690300, 0x1f690301,
+   0x1f690342, 0x1f690345, 0x1f6a0345, 0x1f6b0345, 0x1f6c0345, 0x1f6d0345,
+   0x1f6e0345, 0x1f6f0345, 0x1f700345, 0x1f740345, 0x1f7c0345, 0x1fb60345,
+   0x1fbf0300, 0x1fbf0301, 0x1fbf0342, 0x1fc60345, 0x1ff60345, 0x1ffe0300,
+   0x1ffe0301, 0x1ffe0342, 0x21900338, 0x21920338, 0x21940338, 0x21d00338,
+   0x21d20338, 0x21d40338, 0x22030338, 0x22080338, 0x220b0338, 0x22230338,
+   0x22250338, 0x223c0338, 0x22430338, 0x22450338, 0x22480338, 0x224d0338,
+   0x22610338, 0x22640338, 0x22650338, 0x22720338, 0x22730338, 0x22760338,
+   0x22770338, 0x227a0338, 0x227b0338, 0x227c0338, 0x227d0338, 0x22820338,
+   0x22830338, 0x22860338, 0x22870338, 0x22910338, 0x22920338, 0x22a20338,
+   0x22a80338, 0x22a90338, 0x22ab0338, 0x22b20338, 0x22b30338, 0x22b40338,
+   0x22b50338, 0x30463099, 0x304b3099, 0x304d3099, 0x304f3099, 0x30513099,
+   0x30533099, 0x30553099, 0x30573099, 0x30593099, 0x305b3099, 0x305d3099,
+   0x305f3099, 0x30613099, 0x30643099, 0x30663099, 0x30683099, 0x306f3099,
+   0x306f309a, 0x30723099, 0x3072309a, 0x30753099, 0x3075309a, 0x30783099,
+   0x3078309a, 0x307b3099, 0x307b309a, 0x309d3099, 0x30a63099, 0x30ab3099,
+   0x30ad3099, 0x30af3099, 0x30b13099, 0x30b33099, 0x30b53099, 0x30b73099,
+   0x30b93099, 0x30bb3099, 0x30bd3099, 0x30bf3099, 0x30c13099, 0x30c43099,
+   0x30c63099, 0x30c83099, 0x30cf3099, 0x30cf309a, 0x30d23099, 0x30d2309a,
+   0x30d53099, 0x30d5309a, 0x30d83099, 0x30d8309a, 0x30db3099, 0x30db309a,
+   0x30ef3099, 0x30f03099, 0x30f13099, 0x30f23099, 0x30fd3099,
+};
+
+static const uint16_t mongoc_saslprep_compose_values[917] = {
+   0x226e, 0x2260, 0x226f, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x0100, 0x0102,
+   0x0226, 0x00c4, 0x1ea2, 0x00c5, 0x01cd, 0x0200, 0x0202, 0x1ea0, 0x1e00,
+   0x0104, 0x1e02, 0x1e04, 0x1e06, 0x0106, 0x0108, 0x010a, 0x010c, 0x00c7,
+   0x1e0a, 0x010e, 0x1e0c, 0x1e10, 0x1e12, 0x1e0e, 0x00c8, 0x00c9, 0x00ca,
+   0x1ebc, 0x0112, 0x0114, 0x0116, 0x00cb, 0x1eba, 0x011a, 0x0204, 0x0206,
+   0x1eb8, 0x0228, 0x0118, 0x1e18, 0x1e1a, 0x1e1e, 0x01f4, 0x011c, 0x1e20,
+   0x011e, 0x0120, 0x01e6, 0x0122, 0x0124, 0x1e22, 0x1e26, 0x021e, 0x1e24,
+   0x1e28, 0x1e2a, 0x00cc, 0x00cd, 0x00ce, 0x0128, 0x012a, 0x012c, 0x0130,
+   0x00cf, 0x1ec8, 0x01cf, 0x0208, 0x020a, 0x1eca, 0x012e, 0x1e2c, 0x0134,
+   0x1e30, 0x01e8, 0x1e32, 0x0136, 0x1e34, 0x0139, 0x013d, 0x1e36, 0x013b,
+   0x1e3c, 0x1e3a, 0x1e3e, 0x1e40, 0x1e42, 0x01f8, 0x0143, 0x00d1, 0x1e44,
+   0x0147, 0x1e46, 0x0145, 0x1e4a, 0x1e48, 0x00d2, 0x00d3, 0x00d4, 0x00d5,
+   0x014c, 0x014e, 0x022e, 0x00d6, 0x1ece, 0x0150, 0x01d1, 0x020c, 0x020e,
+   0x01a0, 0x1ecc, 0x01ea, 0x1e54, 0x1e56, 0x0154, 0x1e58, 0x0158, 0x0210,
+   0x0212, 0x1e5a, 0x0156, 0x1e5e, 0x015a, 0x015c, 0x1e60, 0x0160, 0x1e62,
+   0x0218, 0x015e, 0x1e6a, 0x0164, 0x1e6c, 0x021a, 0x0162, 0x1e70, 0x1e6e,
+   0x00d9, 0x00da, 0x00db, 0x0168, 0x016a, 0x016c, 0x00dc, 0x1ee6, 0x016e,
+   0x0170, 0x01d3, 0x0214, 0x0216, 0x01af, 0x1ee4, 0x1e72, 0x0172, 0x1e76,
+   0x1e74, 0x1e7c, 0x1e7e, 0x1e80, 0x1e82, 0x0174, 0x1e86, 0x1e84, 0x1e88,
+   0x1e8a, 0x1e8c, 0x1ef2, 0x00dd, 0x0176, 0x1ef8, 0x0232, 0x1e8e, 0x0178,
+   0x1ef6, 0x1ef4, 0x0179, 0x1e90, 0x017b, 0x017d, 0x1e92, 0x1e94, 0x00e0,
+   0x00e1, 0x00e2, 0x00e3, 0x0101, 0x0103, 0x0227, 0x00e4, 0x1ea3, 0x00e5,
+   0x01ce, 0x0201, 0x0203, 0x1ea1, 0x1e01, 0x0105, 0x1e03, 0x1e05, 0x1e07,
+   0x0107, 0x0109, 0x010b, 0x010d, 0x00e7, 0x1e0b, 0x010f, 0x1e0d, 0x1e11,
+   0x1e13, 0x1e0f, 0x00e8, 0x00e9, 0x00ea, 0x1ebd, 0x0113, 0x0115, 0x0117,
+   0x00eb, 0x1ebb, 0x011b, 0x0205, 0x0207, 0x1eb9, 0x0229, 0x0119, 0x1e19,
+   0x1e1b, 0x1e1f, 0x01f5, 0x011d, 0x1e21, 0x011f, 0x0121, 0x01e7, 0x0123,
+   0x0125, 0x1e23, 0x1e27, 0x021f, 0x1e25, 0x1e29, 0x1e2b, 0x1e96, 0x00ec,
+   0x00ed, 0x00ee, 0x0129, 0x012b, 0x012d, 0x00ef, 0x1ec9, 0x01d0, 0x0209,
+   0x020b, 0x1ecb, 0x012f, 0x1e2d, 0x0135, 0x01f0, 0x1e31, 0x01e9, 0x1e33,
+   0x0137, 0x1e35, 0x013a, 0x013e, 0x1e37, 0x013c, 0x1e3d, 0x1e3b, 0x1e3f,
+   0x1e41, 0x1e43, 0x01f9, 0x0144, 0x00f1, 0x1e45, 0x0148, 0x1e47, 0x0146,
+   0x1e4b, 0x1e49, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x014d, 0x014f, 0x022f,
+   0x00f6, 0x1ecf, 0x0151, 0x01d2, 0x020d, 0x020f, 0x01a1, 0x1ecd, 0x01eb,
+   0x1e55, 0x1e57, 0x0155, 0x1e59, 0x0159, 0x0211, 0x0213, 0x1e5b, 0x0157,
+   0x1e5f, 0x015b, 0x015d, 0x1e61, 0x0161, 0x1e63, 0x0219, 0x015f, 0x1e6b,
+   0x1e97, 0x0165, 0x1e6d, 0x021b, 0x0163, 0x1e71, 0x1e6f, 0x00f9, 0x00fa,
+   0x00fb, 0x0169, 0x016b, 0x016d, 0x00fc, 0x1ee7, 0x016f, 0x0171, 0x01d4,
+   0x0215, 0x0217, 0x01b0, 0x1ee5, 0x1e73, 0x0173, 0x1e77, 0x1e75, 0x1e7d,
+   0x1e7f, 0x1e81, 0x1e83, 0x0175, 0x1e87, 0x1e85, 0x1e98, 0x1e89, 0x1e8b,
+   0x1e8d, 0x1ef3, 0x00fd, 0x0177, 0x1ef9, 0x0233, 0x1e8f, 0x00ff, 0x1ef7,
+   0x1e99, 0x1ef5, 0x017a, 0x1e91, 0x017c, 0x017e, 0x1e93, 0x1e95, 0x1fed,
+   0x0385, 0x1fc1, 0x1ea6, 0x1ea4, 0x1eaa, 0x1ea8, 0x01de, 0x01fa, 0x01fc,
+   0x01e2, 0x1e08, 0x1ec0, 0x1ebe, 0x1ec4, 0x1ec2, 0x1e2e, 0x1ed2, 0x1ed0,
+   0x1ed6, 0x1ed4, 0x1e4c, 0x022c, 0x1e4e, 0x022a, 0x01fe, 0x01db, 0x01d7,
+   0x01d5, 0x01d9, 0x1ea7, 0x1ea5, 0x1eab, 0x1ea9, 0x01df, 0x01fb, 0x01fd,
+   0x01e3, 0x1e09, 0x1ec1, 0x1ebf, 0x1ec5, 0x1ec3, 0x1e2f, 0x1ed3, 0x1ed1,
+   0x1ed7, 0x1ed5, 0x1e4d, 0x022d, 0x1e4f, 0x022b, 0x01ff, 0x01dc, 0x01d8,
+   0x01d6, 0x01da, 0x1eb0, 0x1eae, 0x1eb4, 0x1eb2, 0x1eb1, 0x1eaf, 0x1eb5,
+   0x1eb3, 0x1e14, 0x1e16, 0x1e15, 0x1e17, 0x1e50, 0x1e52, 0x1e51, 0x1e53,
+   0x1e64, 0x1e65, 0x1e66, 0x1e67, 0x1e78, 0x1e79, 0x1e7a, 0x1e7b, 0x1e9b,
+   0x1edc, 0x1eda, 0x1ee0, 0x1ede, 0x1ee2, 0x1edd, 0x1edb, 0x1ee1, 0x1edf,
+   0x1ee3, 0x1eea, 0x1ee8, 0x1eee, 0x1eec, 0x1ef0, 0x1eeb, 0x1ee9, 0x1eef,
+   0x1eed, 0x1ef1, 0x01ee, 0x01ec, 0x01ed, 0x01e0, 0x01e1, 0x1e1c, 0x1e1d,
+   0x0230, 0x0231, 0x01ef, 0x1fba, 0x0386, 0x1fb9, 0x1fb8, 0x1f08, 0x1f09,
+   0x1fbc, 0x1fc8, 0x0388, 0x1f18, 0x1f19, 0x1fca, 0x0389, 0x1f28, 0x1f29,
+   0x1fcc, 0x1fda, 0x038a, 0x1fd9, 0x1fd8, 0x03aa, 0x1f38, 0x1f39, 0x1ff8,
+   0x038c, 0x1f48, 0x1f49, 0x1fec, 0x1fea, 0x038e, 0x1fe9, 0x1fe8, 0x03ab,
+   0x1f59, 0x1ffa, 0x038f, 0x1f68, 0x1f69, 0x1ffc, 0x1fb4, 0x1fc4, 0x1f70,
+   0x03ac, 0x1fb1, 0x1fb0, 0x1f00, 0x1f01, 0x1fb6, 0x1fb3, 0x1f72, 0x03ad,
+   0x1f10, 0x1f11, 0x1f74, 0x03ae, 0x1f20, 0x1f21, 0x1fc6, 0x1fc3, 0x1f76,
+   0x03af, 0x1fd1, 0x1fd0, 0x03ca, 0x1f30, 0x1f31, 0x1fd6, 0x1f78, 0x03cc,
+   0x1f40, 0x1f41, 0x1fe4, 0x1fe5, 0x1f7a, 0x03cd, 0x1fe1, 0x1fe0, 0x03cb,
+   0x1f50, 0x1f51, 0x1fe6, 0x1f7c, 0x03ce, 0x1f60, 0x1f61, 0x1ff6, 0x1ff3,
+   0x1fd2, 0x0390, 0x1fd7, 0x1fe2, 0x03b0, 0x1fe7, 0x1ff4, 0x03d3, 0x03d4,
+   0x0407, 0x04d0, 0x04d2, 0x0403, 0x0400, 0x04d6, 0x0401, 0x04c1, 0x04dc,
+   0x04de, 0x040d, 0x04e2, 0x0419, 0x04e4, 0x040c, 0x04e6, 0x04ee, 0x040e,
+   0x04f0, 0x04f2, 0x04f4, 0x04f8, 0x04ec, 0x04d1, 0x04d3, 0x0453, 0x0450,
+   0x04d7, 0x0451, 0x04c2, 0x04dd, 0x04df, 0x045d, 0x04e3, 0x0439, 0x04e5,
+   0x045c, 0x04e7, 0x04ef, 0x045e, 0x04f1, 0x04f3, 0x04f5, 0x04f9, 0x04ed,
+   0x0457, 0x0476, 0x0477, 0x04da, 0x04db, 0x04ea, 0x04eb, 0x0622, 0x0623,
+   0x0625, 0x0624, 0x0626, 0x06c2, 0x06d3, 0x06c0, 0x0929, 0x0931, 0x0934,
+   0x09cb, 0x09cc, 0x0b4b, 0x0b48, 0x0b4c, 0x0b94, 0x0bca, 0x0bcc, 0x0bcb,
+   0x0c48, 0x0cc0, 0x0cca, 0x0cc7, 0x0cc8, 0x0ccb, 0x0d4a, 0x0d4c, 0x0d4b,
+   0x0dda, 0x0ddc, 0x0dde, 0x0ddd, 0x1026, 0x1e38, 0x1e39, 0x1e5c, 0x1e5d,
+   0x1e68, 0x1e69, 0x1eac, 0x1eb6, 0x1ead, 0x1eb7, 0x1ec6, 0x1ec7, 0x1ed8,
+   0x1ed9, 0x1f02, 0x1f04, 0x1f06, 0x1f80, 0x1f03, 0x1f05, 0x1f07, 0x1f81,
+   0x1f82, 0x1f83, 0x1f84, 0x1f85, 0x1f86, 0x1f87, 0x1f0a, 0x1f0c, 0x1f0e,
+   0x1f88, 0x1f0b, 0x1f0d, 0x1f0f, 0x1f89, 0x1f8a, 0x1f8b, 0x1f8c, 0x1f8d,
+   0x1f8e, 0x1f8f, 0x1f12, 0x1f14, 0x1f13, 0x1f15, 0x1f1a, 0x1f1c, 0x1f1b,
+   0x1f1d, 0x1f22, 0x1f24, 0x1f26, 0x1f90, 0x1f23, 0x1f25, 0x1f27, 0x1f91,
+   0x1f92, 0x1f93, 0x1f94, 0x1f95, 0x1f96, 0x1f97, 0x1f2a, 0x1f2c, 0x1f2e,
+   0x1f98, 0x1f2b, 0x1f2d, 0x1f2f, 0x1f99, 0x1f9a, 0x1f9b, 0x1f9c, 0x1f9d,
+   0x1f9e, 0x1f9f, 0x1f32, 0x1f34, 0x1f36, 0x1f33, 0x1f35, 0x1f37, 0x1f3a,
+   0x1f3c, 0x1f3e, 0x1f3b, 0x1f3d, 0x1f3f, 0x1f42, 0x1f44, 0x1f43, 0x1f45,
+   0x1f4a, 0x1f4c, 0x1f4b, 0x1f4d, 0x1f52, 0x1f54, 0x1f56, 0x1f53, 0x1f55,
+   0x1f57, 0x1f5b, 0x1f5d, 0x1f5f, 0x1f62, 0x1f64, 0x1f66, 0x1fa0, 0x1f63,
+   0x1f65, 0x1f67, 0x1fa1, 0x1fa2, 0x1fa3, 0x1fa4, 0x1fa5, 0x1fa6, 0x1fa7,
+   0x1f6a, 0x1f6c, 0x1f6e, 0x1fa8, 0x1f6b, 0x1f6d, 0x1f6f, 0x1fa9, 0x1faa,
+   0x1fab, 0x1fac, 0x1fad, 0x1fae, 0x1faf, 0x1fb2, 0x1fc2, 0x1ff2, 0x1fb7,
+   0x1fcd, 0x1fce, 0x1fcf, 0x1fc7, 0x1ff7, 0x1fdd, 0x1fde, 0x1fdf, 0x219a,
+   0x219b, 0x21ae, 0x21cd, 0x21cf, 0x21ce, 0x2204, 0x2209, 0x220c, 0x2224,
+   0x2226, 0x2241, 0x2244, 0x2247, 0x2249, 0x226d, 0x2262, 0x2270, 0x2271,
+   0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x22e0, 0x22e1, 0x2284,
+   0x2285, 0x2288, 0x2289, 0x22e2, 0x22e3, 0x22ac, 0x22ad, 0x22ae, 0x22af,
+   0x22ea, 0x22eb, 0x22ec, 0x22ed, 0x3094, 0x304c, 0x304e, 0x3050, 0x3052,
+   0x3054, 0x3056, 0x3058, 0x305a, 0x305c, 0x305e, 0x3060, 0x3062, 0x3065,
+   0x3067, 0x3069, 0x3070, 0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079,
+   0x307a, 0x307c, 0x307d, 0x309e, 0x30f4, 0x30ac, 0x30ae, 0x30b0, 0x30b2,
+   0x30b4, 0x30b6, 0x30b8, 0x30ba, 0x30bc, 0x30be, 0x30c0, 0x30c2, 0x30c5,
+   0x30c7, 0x30c9, 0x30d0, 0x30d1, 0x30d3, 0x30d4, 0x30d6, 0x30d7, 0x30d9,
+   0x30da, 0x30dc, 0x30dd, 0x30f7, 0x30f8, 0x30f9, 0x30fa, 0x30fe,
+};
+
+#endif /* MONGOC_SASLPREP_TABLES_PRIVATE_H */
@@ -0,0 +1,441 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+
+#include "mongoc-scram.h"
+#include "mongoc-saslprep-tables-private.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * SASLprep (RFC 4013) of UTF-8 strings, with the tables that
+ * generate-saslprep-tables.py generates: map, normalize with NFKC, then check
+ * for prohibited code points and bidirectional text. Strings of up to
+ * MONGOC_SASLPREP_STACK_LEN code points, after mapping and decomposing, are
+ * prepared on the stack; only the result is allocated.
+ */
+
+#define MONGOC_SASLPREP_STACK_LEN 256
+
+/* Hangul syllables decompose and compose by arithmetic, see Unicode 3.12 */
+#define MONGOC_SASLPREP_HANGUL_S_BASE 0xAC00
+#define MONGOC_SASLPREP_HANGUL_L_BASE 0x1100
+#define MONGOC_SASLPREP_HANGUL_V_BASE 0x1161
+#define MONGOC_SASLPREP_HANGUL_T_BASE 0x11A7
+#define MONGOC_SASLPREP_HANGUL_L_COUNT 19
+#define MONGOC_SASLPREP_HANGUL_V_COUNT 21
+#define MONGOC_SASLPREP_HANGUL_T_COUNT 28
+#define MONGOC_SASLPREP_HANGUL_N_COUNT \
+   (MONGOC_SASLPREP_HANGUL_V_COUNT * MONGOC_SASLPREP_HANGUL_T_COUNT)
+#define MONGOC_SASLPREP_HANGUL_S_COUNT \
+   (MONGOC_SASLPREP_HANGUL_L_COUNT * MONGOC_SASLPREP_HANGUL_N_COUNT)
+
+#define MONGOC_SASLPREP_TRIE(table, shift, cp)                  \
+   (table##_blocks[((uint32_t) table##_index[(cp) >> (shift)] \
+                    << (shift)) |                               \
+                   ((cp) & ((1u << (shift)) - 1))])
+
+/* the code points being prepared */
+typedef struct _mongoc_saslprep_buf_t {
+   uint32_t *cps;
+   size_t len;
+   size_t cap;
+   uint32_t local[MONGOC_SASLPREP_STACK_LEN];
+} mongoc_saslprep_buf_t;
+
+
+static uint8_t
+_mongoc_saslprep_props (uint32_t cp)
+{
+   return MONGOC_SASLPREP_TRIE (
+      mongoc_saslprep_props, MONGOC_SASLPREP_PROPS_SHIFT, cp);
+}
+
+
+static uint8_t
+_mongoc_saslprep_ccc (uint32_t cp)
+{
+   return MONGOC_SASLPREP_TRIE (
+      mongoc_saslprep_ccc, MONGOC_SASLPREP_CCC_SHIFT, cp);
+}
+
+
+static my_bool
+_mongoc_saslprep_append (mongoc_saslprep_buf_t *buf, uint32_t cp)
+{
+   uint32_t *cps;
+
+   if (buf->len == buf->cap) {
+      if (buf->cps == buf->local) {
+         cps = malloc (2 * buf->cap * sizeof (uint32_t));
+         if (cps) {
+            memcpy (cps, buf->local, buf->len * sizeof (uint32_t));
+         }
+      } else {
+         cps = realloc (buf->cps, 2 * buf->cap * sizeof (uint32_t));
+      }
+      if (!cps) {
+         return FALSE;
+      }
+      buf->cps = cps;
+      buf->cap *= 2;
+   }
+
+   buf->cps[buf->len++] = cp;
+   return TRUE;
+}
+
+
+/* decodes the code point at *in and moves past it. Returns FALSE for
+ * anything but the shortest encoding of a code point that isn't a surrogate,
+ * as ICU does. */
+static my_bool
+_mongoc_saslprep_decode (const uint8_t **in, const uint8_t *end, uint32_t *cp)
+{
+   const uint8_t *p = *in;
+   uint32_t c = *p++;
+   uint32_t min;
+   int n;
+
+   if (c < 0x80) {
+      n = 0;
+      min = 0;
+   } else if ((c & 0xE0) == 0xC0) {
+      n = 1;
+      c &= 0x1F;
+      min = 0x80;
+   } else if ((c & 0xF0) == 0xE0) {
+      n = 2;
+      c &= 0x0F;
+      min = 0x800;
+   } else if ((c & 0xF8) == 0xF0) {
+      n = 3;
+      c &= 0x07;
+      min = 0x10000;
+   } else {
+      return FALSE;
+   }
+
+   if (end - p < n) {
+      return FALSE;
+   }
+
+   while (n--) {
+      if ((*p & 0xC0) != 0x80) {
+         return FALSE;
+      }
+      c = (c << 6) | (*p++ & 0x3F);
+   }
+
+   if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+      return FALSE;
+   }
+
+   *cp = c;
+   *in = p;
+   return TRUE;
+}
+
+
+/* appends the compatibility decomposition of cp */
+static my_bool
+_mongoc_saslprep_decompose (mongoc_saslprep_buf_t *buf, uint32_t cp)
+{
+   const uint16_t *units;
+   uint32_t s, u;
+   uint16_t offset, i, n;
+
+   if (cp >= MONGOC_SASLPREP_HANGUL_S_BASE &&
+       cp < MONGOC_SASLPREP_HANGUL_S_BASE + MONGOC_SASLPREP_HANGUL_S_COUNT) {
+      s = cp - MONGOC_SASLPREP_HANGUL_S_BASE;
+      return _mongoc_saslprep_append (buf,
+                                      MONGOC_SASLPREP_HANGUL_L_BASE +
+                                         s / MONGOC_SASLPREP_HANGUL_N_COUNT) &&
+             _mongoc_saslprep_append (
+                buf,
+                MONGOC_SASLPREP_HANGUL_V_BASE +
+                   s % MONGOC_SASLPREP_HANGUL_N_COUNT /
+                      MONGOC_SASLPREP_HANGUL_T_COUNT) &&
+             (s % MONGOC_SASLPREP_HANGUL_T_COUNT == 0 ||
+              _mongoc_saslprep_append (buf,
+                                       MONGOC_SASLPREP_HANGUL_T_BASE +
+                                          s % MONGOC_SASLPREP_HANGUL_T_COUNT));
+   }
+
+   offset = MONGOC_SASLPREP_TRIE (
+      mongoc_saslprep_decomp, MONGOC_SASLPREP_DECOMP_SHIFT, cp);
+   if (!offset) {
+      return _mongoc_saslprep_append (buf, cp);
+   }
+
+   /* the pool holds UTF-16, for decompositions outside the BMP */
+   n = mongoc_saslprep_decomp_pool[offset];
+   units = &mongoc_saslprep_decomp_pool[offset + 1];
+   for (i = 0; i < n; i++) {
+      u = units[i];
+      if (u >= 0xD800 && u <= 0xDBFF) {
+         u = 0x10000 + ((u - 0xD800) << 10) + (units[++i] - 0xDC00);
+      }
+      if (!_mongoc_saslprep_append (buf, u)) {
+         return FALSE;
+      }
+   }
+
+   return TRUE;
+}
+
+
+/* sorts each run of combining marks by combining class, stably */
+static void
+_mongoc_saslprep_reorder (mongoc_saslprep_buf_t *buf)
+{
+   uint32_t cp;
+   uint8_t ccc;
+   size_t i, j;
+
+   for (i = 1; i < buf->len; i++) {
+      cp = buf->cps[i];
+      ccc = _mongoc_saslprep_ccc (cp);
+      if (!ccc) {
+         continue;
+      }
+      for (j = i; j > 0 && _mongoc_saslprep_ccc (buf->cps[j - 1]) > ccc; j--) {
+         buf->cps[j] = buf->cps[j - 1];
+      }
+      buf->cps[j] = cp;
+   }
+}
+
+
+/* the primary composite of first and second, or 0 */
+static uint32_t
+_mongoc_saslprep_compose_pair (uint32_t first, uint32_t second)
+{
+   uint32_t key;
+   size_t lo, hi, mid;
+
+   if (first >= MONGOC_SASLPREP_HANGUL_L_BASE &&
+       first < MONGOC_SASLPREP_HANGUL_L_BASE + MONGOC_SASLPREP_HANGUL_L_COUNT &&
+       second >= MONGOC_SASLPREP_HANGUL_V_BASE &&
+       second < MONGOC_SASLPREP_HANGUL_V_BASE + MONGOC_SASLPREP_HANGUL_V_COUNT) {
+      return MONGOC_SASLPREP_HANGUL_S_BASE +
+             ((first - MONGOC_SASLPREP_HANGUL_L_BASE) *
+                 MONGOC_SASLPREP_HANGUL_V_COUNT +
+              (second - MONGOC_SASLPREP_HANGUL_V_BASE)) *
+                MONGOC_SASLPREP_HANGUL_T_COUNT;
+   }
+
+   if (first >= MONGOC_SASLPREP_HANGUL_S_BASE &&
+       first < MONGOC_SASLPREP_HANGUL_S_BASE + MONGOC_SASLPREP_HANGUL_S_COUNT &&
+       (first - MONGOC_SASLPREP_HANGUL_S_BASE) %
+             MONGOC_SASLPREP_HANGUL_T_COUNT ==
+          0 &&
+       second > MONGOC_SASLPREP_HANGUL_T_BASE &&
+       second < MONGOC_SASLPREP_HANGUL_T_BASE + MONGOC_SASLPREP_HANGUL_T_COUNT) {
+      return first + (second - MONGOC_SASLPREP_HANGUL_T_BASE);
+   }
+
+   /* every pair that composes is in the BMP */
+   if (first > 0xFFFF || second > 0xFFFF) {
+      return 0;
+   }
+
+   key = (first << 16) | second;
+   lo = 0;
+   hi = sizeof mongoc_saslprep_compose_keys /
+        sizeof mongoc_saslprep_compose_keys[0];
+   while (lo < hi) {
+      mid = lo + (hi - lo) / 2;
+      if (mongoc_saslprep_compose_keys[mid] < key) {
+         lo = mid + 1;
+      } else if (mongoc_saslprep_compose_keys[mid] > key) {
+         hi = mid;
+      } else {
+         return mongoc_saslprep_compose_values[mid];
+      }
+   }
+
+   return 0;
+}
+
+
+/* canonical composition, in place */
+static void
+_mongoc_saslprep_compose (mongoc_saslprep_buf_t *buf)
+{
+   size_t starter = 0;
+   size_t out = 1;
+   size_t i;
+   uint32_t cp, composite;
+   /* the class of the last code point kept since the starter, 0 if none
+    * was, or 256 to block composing with a first code point that isn't a
+    * starter */
+   int last_ccc;
+   int ccc;
+
+   if (!buf->len) {
+      return;
+   }
+
+   last_ccc = _mongoc_saslprep_ccc (buf->cps[0]) ? 256 : 0;
+
+   for (i = 1; i < buf->len; i++) {
+      cp = buf->cps[i];
+      ccc = _mongoc_saslprep_ccc (cp);
+      if (last_ccc < ccc || last_ccc == 0) {
+         composite = _mongoc_saslprep_compose_pair (buf->cps[starter], cp);
+         if (composite) {
+            buf->cps[starter] = composite;
+            continue;
+         }
+      }
+      if (!ccc) {
+         starter = out;
+      }
+      last_ccc = ccc;
+      buf->cps[out++] = cp;
+   }
+
+   buf->len = out;
+}
+
+
+static size_t
+_mongoc_saslprep_encode (uint32_t cp, char *out)
+{
+   if (cp < 0x80) {
+      out[0] = (char) cp;
+      return 1;
+   }
+   if (cp < 0x800) {
+      out[0] = (char) (0xC0 | (cp >> 6));
+      out[1] = (char) (0x80 | (cp & 0x3F));
+      return 2;
+   }
+   if (cp < 0x10000) {
+      out[0] = (char) (0xE0 | (cp >> 12));
+      out[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+      out[2] = (char) (0x80 | (cp & 0x3F));
+      return 3;
+   }
+   out[0] = (char) (0xF0 | (cp >> 18));
+   out[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+   out[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+   out[3] = (char) (0x80 | (cp & 0x3F));
+   return 4;
+}
+
+
+char *
+_mongoc_sasl_prep_native (const char *name,
+                          const char *in_utf8,
+                          int in_utf8_len,
+                          bson_error_t *err)
+{
+   const uint8_t *in = (const uint8_t *) in_utf8;
+   const uint8_t *end = in + in_utf8_len;
+   mongoc_saslprep_buf_t buf;
+   const char *msg = NULL;
+   my_bool rand_al = FALSE;
+   my_bool l = FALSE;
+   char *out = NULL;
+   size_t out_len = 0;
+   size_t i;
+   uint32_t cp;
+   uint8_t props;
+   char encoded[4];
+
+   buf.cps = buf.local;
+   buf.len = 0;
+   buf.cap = MONGOC_SASLPREP_STACK_LEN;
+
+   /* 1. map, refusing unassigned code points, and decompose. */
+   while (in < end) {
+      if (!_mongoc_saslprep_decode (&in, end, &cp)) {
+         msg = "could not decode %s as UTF-8";
+         goto done;
+      }
+      props = _mongoc_saslprep_props (cp);
+      if (props & MONGOC_SASLPREP_UNASSIGNED) {
+         msg = "unassigned code point in %s";
+         goto done;
+      }
+      if (props & MONGOC_SASLPREP_MAP_TO_NOTHING) {
+         continue;
+      }
+      if (props & MONGOC_SASLPREP_MAP_TO_SPACE) {
+         cp = ' ';
+      }
+      if (!_mongoc_saslprep_decompose (&buf, cp)) {
+         msg = "could not allocate SASLPrep buffer for %s";
+         goto done;
+      }
+   }
+
+   /* 2. finish NFKC. */
+   _mongoc_saslprep_reorder (&buf);
+   _mongoc_saslprep_compose (&buf);
+
+   /* 3. check the output, bidi included as ICU does it: text with a
+    * right-to-left character has no left-to-right one, and starts and ends
+    * right-to-left. */
+   for (i = 0; i < buf.len; i++) {
+      props = _mongoc_saslprep_props (buf.cps[i]);
+      if (props & MONGOC_SASLPREP_PROHIBITED) {
+         msg = "prohibited code point in %s";
+         goto done;
+      }
+      rand_al |= !!(props & MONGOC_SASLPREP_RAND_AL);
+      l |= !!(props & MONGOC_SASLPREP_L);
+      out_len += _mongoc_saslprep_encode (buf.cps[i], encoded);
+   }
+
+   if (rand_al &&
+       (l ||
+        !(_mongoc_saslprep_props (buf.cps[0]) & MONGOC_SASLPREP_RAND_AL) ||
+        !(_mongoc_saslprep_props (buf.cps[buf.len - 1]) &
+          MONGOC_SASLPREP_RAND_AL))) {
+      msg = "invalid bidirectional text in %s";
+      goto done;
+   }
+
+   /* 4. convert back to UTF-8. */
+   out = malloc (out_len + 1);
+   if (!out) {
+      msg = "could not allocate SASLPrep output for %s";
+      goto done;
+   }
+   out_len = 0;
+   for (i = 0; i < buf.len; i++) {
+      out_len += _mongoc_saslprep_encode (buf.cps[i], out + out_len);
+   }
+   out[out_len] = '\0';
+
+done:
+   if (buf.cps != buf.local) {
+      free (buf.cps);
+   }
+
+   if (msg) {
+      bson_set_error (
+         err, MONGOC_ERROR_SCRAM, MONGOC_ERROR_SCRAM_PROTOCOL_ERROR, msg, name);
+      return NULL;
+   }
+
+   return out;
+}
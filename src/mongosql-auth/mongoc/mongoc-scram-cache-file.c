@@ -0,0 +1,541 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+
+#include "mongoc-scram-cache-private.h"
+#include "mongoc-scram.h"
+
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mongoc-memcmp-private.h"
+#include "mongoc-rand-private.h"
+#include "mongoc-thread-private.h"
+
+#define MONGOC_SCRAM_CACHE_FILE_MAGIC "MSQLSCRM"
+#define MONGOC_SCRAM_CACHE_FILE_VERSION 1
+/* how many slots after its home slot an entry may land in */
+#define MONGOC_SCRAM_CACHE_FILE_PROBES 8
+#define MONGOC_SCRAM_CACHE_FILE_KEY_MAX 4096
+#define MONGOC_SCRAM_CACHE_FILE_KEY_MIN 32
+
+#define MONGOC_SCRAM_CACHE_FILE_SECRETS_SIZE (3 * MONGOC_SCRAM_HASH_MAX_SIZE)
+
+typedef struct _mongoc_scram_cache_file_header_t {
+   char magic[8];
+   uint32_t version;
+   uint32_t slots;
+   /* HMAC of the magic under the MAC key, to recognize the key in use */
+   uint8_t key_check[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t reserved[16];
+} mongoc_scram_cache_file_header_t;
+
+typedef struct _mongoc_scram_cache_file_slot_t {
+   /* HMAC of the entry id under the MAC key; all zero if the slot is free */
+   uint8_t tag[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   int64_t expires;
+   uint8_t nonce[16];
+   uint8_t secrets[MONGOC_SCRAM_CACHE_FILE_SECRETS_SIZE];
+   /* HMAC of all the fields above under the MAC key */
+   uint8_t mac[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+} mongoc_scram_cache_file_slot_t;
+
+#define MONGOC_SCRAM_CACHE_FILE_SIZE                \
+   (sizeof (mongoc_scram_cache_file_header_t) +     \
+    MONGOC_SCRAM_CACHE_FILE_SLOTS * sizeof (mongoc_scram_cache_file_slot_t))
+
+/* fcntl() locks are held per process, so threads also take the mutex */
+static mongoc_mutex_t _mongoc_scram_cache_file_mutex = MONGOC_MUTEX_INITIALIZER;
+static int _mongoc_scram_cache_file_fd = -1;
+static uint8_t *_mongoc_scram_cache_file_map;
+static uint32_t _mongoc_scram_cache_file_ttl;
+static uint8_t _mongoc_scram_cache_file_enc_key[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+static uint8_t _mongoc_scram_cache_file_mac_key[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+
+
+static void
+_mongoc_scram_cache_file_hmac (const uint8_t *key,
+                               const void *data,
+                               size_t data_len,
+                               uint8_t *out)
+{
+   mongoc_crypto_t crypto;
+
+   mongoc_crypto_init (&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+   mongoc_crypto_hmac (&crypto,
+                       key,
+                       MONGOC_SCRAM_SHA_256_HASH_SIZE,
+                       (const unsigned char *) data,
+                       (int) data_len,
+                       out);
+   mongoc_crypto_destroy (&crypto);
+}
+
+
+/* XORs the slot's secrets with HMAC(enc_key, nonce || counter) blocks */
+static void
+_mongoc_scram_cache_file_crypt (mongoc_scram_cache_file_slot_t *slot)
+{
+   uint8_t block_input[sizeof slot->nonce + 4];
+   uint8_t keystream[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint32_t counter;
+   size_t i;
+
+   memcpy (block_input, slot->nonce, sizeof slot->nonce);
+
+   for (counter = 0; counter * sizeof keystream < sizeof slot->secrets;
+        counter++) {
+      memcpy (block_input + sizeof slot->nonce, &counter, 4);
+      _mongoc_scram_cache_file_hmac (_mongoc_scram_cache_file_enc_key,
+                                     block_input,
+                                     sizeof block_input,
+                                     keystream);
+
+      for (i = 0; i < sizeof keystream; i++) {
+         slot->secrets[counter * sizeof keystream + i] ^= keystream[i];
+      }
+   }
+
+   memset (keystream, 0, sizeof keystream);
+}
+
+
+static void
+_mongoc_scram_cache_file_slot_mac (const mongoc_scram_cache_file_slot_t *slot,
+                                   uint8_t *mac)
+{
+   _mongoc_scram_cache_file_hmac (_mongoc_scram_cache_file_mac_key,
+                                  slot,
+                                  offsetof (mongoc_scram_cache_file_slot_t, mac),
+                                  mac);
+}
+
+
+static int
+_mongoc_scram_cache_file_lock (int type)
+{
+   struct flock lock;
+
+   memset (&lock, 0, sizeof lock);
+   lock.l_type = (short) type;
+   lock.l_whence = SEEK_SET;
+
+   while (fcntl (_mongoc_scram_cache_file_fd, F_SETLKW, &lock) == -1) {
+      if (errno != EINTR) {
+         return -1;
+      }
+   }
+
+   return 0;
+}
+
+
+static mongoc_scram_cache_file_slot_t *
+_mongoc_scram_cache_file_slot (uint32_t i)
+{
+   return (mongoc_scram_cache_file_slot_t *) (
+             _mongoc_scram_cache_file_map +
+             sizeof (mongoc_scram_cache_file_header_t)) +
+          (i % MONGOC_SCRAM_CACHE_FILE_SLOTS);
+}
+
+
+/* the file must be ours, and nobody else's to read */
+static my_bool
+_mongoc_scram_cache_file_check (int fd,
+                                const char *path,
+                                struct stat *st,
+                                bson_error_t *error)
+{
+   if (fstat (fd, st) != 0) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: cannot stat %s: %s",
+                      path,
+                      strerror (errno));
+      return FALSE;
+   }
+
+   if (!S_ISREG (st->st_mode) || st->st_uid != geteuid () ||
+       (st->st_mode & (S_IRWXG | S_IRWXO))) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: %s must be a regular file owned by the "
+                      "current user with no group or other permissions",
+                      path);
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+static my_bool
+_mongoc_scram_cache_file_read_key (const char *key_path,
+                                   struct stat *st,
+                                   bson_error_t *error)
+{
+   uint8_t contents[MONGOC_SCRAM_CACHE_FILE_KEY_MAX];
+   uint8_t master_key[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   mongoc_crypto_t crypto;
+   ssize_t len;
+   int fd;
+
+   fd = open (key_path, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+   if (fd == -1) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: cannot open key file %s: %s",
+                      key_path,
+                      strerror (errno));
+      return FALSE;
+   }
+
+   if (!_mongoc_scram_cache_file_check (fd, key_path, st, error)) {
+      close (fd);
+      return FALSE;
+   }
+
+   len = read (fd, contents, sizeof contents);
+   close (fd);
+
+   if (len < MONGOC_SCRAM_CACHE_FILE_KEY_MIN) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: key file %s must hold at least %d bytes",
+                      key_path,
+                      MONGOC_SCRAM_CACHE_FILE_KEY_MIN);
+      memset (contents, 0, sizeof contents);
+      return FALSE;
+   }
+
+   /* separate keys for encryption and authentication */
+   mongoc_crypto_init (&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+   mongoc_crypto_hash (&crypto, contents, (size_t) len, master_key);
+   mongoc_crypto_destroy (&crypto);
+
+   _mongoc_scram_cache_file_hmac (
+      master_key, "encryption", 10, _mongoc_scram_cache_file_enc_key);
+   _mongoc_scram_cache_file_hmac (
+      master_key, "authentication", 14, _mongoc_scram_cache_file_mac_key);
+
+   memset (contents, 0, sizeof contents);
+   memset (master_key, 0, sizeof master_key);
+
+   return TRUE;
+}
+
+
+/* called with the mutex held */
+static void
+_mongoc_scram_cache_file_unmap (void)
+{
+   if (_mongoc_scram_cache_file_map) {
+      munmap (_mongoc_scram_cache_file_map, MONGOC_SCRAM_CACHE_FILE_SIZE);
+      _mongoc_scram_cache_file_map = NULL;
+   }
+
+   if (_mongoc_scram_cache_file_fd != -1) {
+      close (_mongoc_scram_cache_file_fd);
+      _mongoc_scram_cache_file_fd = -1;
+   }
+
+   memset (_mongoc_scram_cache_file_enc_key,
+           0,
+           sizeof _mongoc_scram_cache_file_enc_key);
+   memset (_mongoc_scram_cache_file_mac_key,
+           0,
+           sizeof _mongoc_scram_cache_file_mac_key);
+}
+
+
+my_bool
+_mongoc_scram_cache_file_open (const char *path,
+                               const char *key_path,
+                               uint32_t ttl,
+                               bson_error_t *error)
+{
+   mongoc_scram_cache_file_header_t expected;
+   struct stat key_st;
+   struct stat st;
+   void *map;
+   int fd;
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_file_mutex);
+
+   _mongoc_scram_cache_file_unmap ();
+
+   if (!_mongoc_scram_cache_file_read_key (key_path, &key_st, error)) {
+      goto FAIL;
+   }
+
+   fd = open (path, O_RDWR | O_CREAT | O_NOFOLLOW | O_CLOEXEC, 0600);
+   if (fd == -1) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: cannot open %s: %s",
+                      path,
+                      strerror (errno));
+      goto FAIL;
+   }
+   _mongoc_scram_cache_file_fd = fd;
+
+   if (!_mongoc_scram_cache_file_check (fd, path, &st, error)) {
+      goto FAIL;
+   }
+
+   if (st.st_dev == key_st.st_dev && st.st_ino == key_st.st_ino) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: the key file cannot be the cache file");
+      goto FAIL;
+   }
+
+   if (_mongoc_scram_cache_file_lock (F_WRLCK) != 0) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: cannot lock %s: %s",
+                      path,
+                      strerror (errno));
+      goto FAIL;
+   }
+
+   if ((size_t) st.st_size != MONGOC_SCRAM_CACHE_FILE_SIZE &&
+       (ftruncate (fd, 0) != 0 ||
+        ftruncate (fd, (off_t) MONGOC_SCRAM_CACHE_FILE_SIZE) != 0)) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: cannot size %s: %s",
+                      path,
+                      strerror (errno));
+      _mongoc_scram_cache_file_lock (F_UNLCK);
+      goto FAIL;
+   }
+
+   map = mmap (NULL,
+               MONGOC_SCRAM_CACHE_FILE_SIZE,
+               PROT_READ | PROT_WRITE,
+               MAP_SHARED,
+               fd,
+               0);
+   if (map == MAP_FAILED) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_CACHE_FILE,
+                      "SCRAM cache: cannot map %s: %s",
+                      path,
+                      strerror (errno));
+      _mongoc_scram_cache_file_lock (F_UNLCK);
+      goto FAIL;
+   }
+   _mongoc_scram_cache_file_map = (uint8_t *) map;
+
+   /* start over if the file is new, from another version or another key */
+   memset (&expected, 0, sizeof expected);
+   memcpy (expected.magic, MONGOC_SCRAM_CACHE_FILE_MAGIC, sizeof expected.magic);
+   expected.version = MONGOC_SCRAM_CACHE_FILE_VERSION;
+   expected.slots = MONGOC_SCRAM_CACHE_FILE_SLOTS;
+   _mongoc_scram_cache_file_hmac (_mongoc_scram_cache_file_mac_key,
+                                  expected.magic,
+                                  sizeof expected.magic,
+                                  expected.key_check);
+
+   if (memcmp (map, &expected, sizeof expected)) {
+      MONGOC_LOG ("%s", "initializing the SCRAM cache file");
+      memset (map, 0, MONGOC_SCRAM_CACHE_FILE_SIZE);
+      memcpy (map, &expected, sizeof expected);
+   }
+
+   _mongoc_scram_cache_file_lock (F_UNLCK);
+
+   _mongoc_scram_cache_file_ttl = ttl;
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+   return TRUE;
+
+FAIL:
+   _mongoc_scram_cache_file_unmap ();
+   mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+   return FALSE;
+}
+
+
+void
+_mongoc_scram_cache_file_close (void)
+{
+   mongoc_mutex_lock (&_mongoc_scram_cache_file_mutex);
+   _mongoc_scram_cache_file_unmap ();
+   mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+}
+
+
+my_bool
+_mongoc_scram_cache_file_get (const uint8_t *id, uint8_t *secrets)
+{
+   mongoc_scram_cache_file_slot_t slot;
+   mongoc_scram_cache_file_slot_t *candidate;
+   uint8_t tag[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t mac[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint32_t home;
+   my_bool found = FALSE;
+   int i;
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_file_mutex);
+
+   if (!_mongoc_scram_cache_file_map ||
+       _mongoc_scram_cache_file_lock (F_RDLCK) != 0) {
+      mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+      return FALSE;
+   }
+
+   _mongoc_scram_cache_file_hmac (
+      _mongoc_scram_cache_file_mac_key, id, MONGOC_SCRAM_SHA_256_HASH_SIZE, tag);
+   memcpy (&home, tag, sizeof home);
+
+   for (i = 0; i < MONGOC_SCRAM_CACHE_FILE_PROBES; i++) {
+      candidate = _mongoc_scram_cache_file_slot (home + i);
+      if (mongoc_memcmp (candidate->tag, tag, sizeof tag)) {
+         continue;
+      }
+
+      /* copy out, then check it is intact, unexpired, and decrypt */
+      memcpy (&slot, candidate, sizeof slot);
+      _mongoc_scram_cache_file_slot_mac (&slot, mac);
+      if (mongoc_memcmp (mac, slot.mac, sizeof mac) == 0 &&
+          slot.expires > (int64_t) time (NULL)) {
+         _mongoc_scram_cache_file_crypt (&slot);
+         memcpy (secrets, slot.secrets, sizeof slot.secrets);
+         found = TRUE;
+      }
+
+      memset (&slot, 0, sizeof slot);
+      break;
+   }
+
+   _mongoc_scram_cache_file_lock (F_UNLCK);
+   mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+
+   return found;
+}
+
+
+void
+_mongoc_scram_cache_file_put (const uint8_t *id, const uint8_t *secrets)
+{
+   mongoc_scram_cache_file_slot_t slot;
+   mongoc_scram_cache_file_slot_t *candidate;
+   mongoc_scram_cache_file_slot_t *target = NULL;
+   const int64_t now = (int64_t) time (NULL);
+   uint32_t home;
+   int i;
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_file_mutex);
+
+   if (!_mongoc_scram_cache_file_map) {
+      mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+      return;
+   }
+
+   memset (&slot, 0, sizeof slot);
+   _mongoc_scram_cache_file_hmac (_mongoc_scram_cache_file_mac_key,
+                                  id,
+                                  MONGOC_SCRAM_SHA_256_HASH_SIZE,
+                                  slot.tag);
+   slot.expires = now + _mongoc_scram_cache_file_ttl;
+   memcpy (slot.secrets, secrets, sizeof slot.secrets);
+   if (_mongoc_rand_bytes (slot.nonce, (int) sizeof slot.nonce) != 1) {
+      goto CLEANUP;
+   }
+   _mongoc_scram_cache_file_crypt (&slot);
+   _mongoc_scram_cache_file_slot_mac (&slot, slot.mac);
+
+   if (_mongoc_scram_cache_file_lock (F_WRLCK) != 0) {
+      goto CLEANUP;
+   }
+
+   /* replace this entry if present, else take the slot that expires first;
+    * free slots never expire later than anything */
+   memcpy (&home, slot.tag, sizeof home);
+   for (i = 0; i < MONGOC_SCRAM_CACHE_FILE_PROBES; i++) {
+      candidate = _mongoc_scram_cache_file_slot (home + i);
+      if (0 == memcmp (candidate->tag, slot.tag, sizeof slot.tag)) {
+         target = candidate;
+         break;
+      }
+      if (!target || candidate->expires < target->expires) {
+         target = candidate;
+      }
+   }
+
+   memcpy (target, &slot, sizeof slot);
+
+   _mongoc_scram_cache_file_lock (F_UNLCK);
+
+CLEANUP:
+   memset (&slot, 0, sizeof slot);
+   mongoc_mutex_unlock (&_mongoc_scram_cache_file_mutex);
+}
+
+#else
+
+my_bool
+_mongoc_scram_cache_file_open (const char *path,
+                               const char *key_path,
+                               uint32_t ttl,
+                               bson_error_t *error)
+{
+   bson_set_error (error,
+                   MONGOC_ERROR_SCRAM,
+                   MONGOC_ERROR_SCRAM_CACHE_FILE,
+                   "SCRAM cache: cache files are not supported on Windows");
+   return FALSE;
+}
+
+
+void
+_mongoc_scram_cache_file_close (void)
+{
+}
+
+
+my_bool
+_mongoc_scram_cache_file_get (const uint8_t *id, uint8_t *secrets)
+{
+   return FALSE;
+}
+
+
+void
+_mongoc_scram_cache_file_put (const uint8_t *id, const uint8_t *secrets)
+{
+}
+
+#endif
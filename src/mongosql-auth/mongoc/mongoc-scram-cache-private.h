@@ -0,0 +1,174 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOC_SCRAM_CACHE_PRIVATE_H
+#define MONGOC_SCRAM_CACHE_PRIVATE_H
+
+#include "mongoc-misc.h"
+#include "mongoc-crypto-private.h"
+
+/* the most SCRAM secrets the process keeps at once */
+#define MONGOC_SCRAM_CACHE_SIZE 64
+
+/* slots in a cache file, and how long its entries live by default */
+#define MONGOC_SCRAM_CACHE_FILE_SLOTS 256
+#define MONGOC_SCRAM_CACHE_FILE_TTL_DEFAULT 3600
+
+/*
+ * A process-wide cache of SCRAM secrets, so reconnecting with the same
+ * credentials skips Hi().
+ *
+ * Entries are keyed by algorithm, user name, the SHA-256 of the prepared
+ * password, salt and iteration count, and hold SaltedPassword, ClientKey and
+ * ServerKey. When the cache is full the least recently used entry is wiped
+ * and replaced.
+ *
+ * Optionally the cache is backed by a file shared by every process of the
+ * user on the host, so short-lived processes benefit from each other's
+ * derivations. The file is a fixed array of slots, mapped into memory and
+ * guarded by fcntl() locks. Each slot is found by an HMAC of the cache key,
+ * and holds the secrets encrypted with an HMAC-SHA-256 keystream, an expiry
+ * time and a MAC over all of it. The keys come from a separate key file, so
+ * the cache file alone reveals nothing. The file cache is not available on
+ * Windows.
+ *
+ * Derivations of the same secrets are coalesced: the first thread to miss
+ * claims them, and any other thread that misses meanwhile waits for it to
+ * put them rather than run the same Hi() again. Secrets are only put once
+ * the server has proven it shares them; until then the claimant holds its
+ * claim, and others claiming the secrets take them uncached without waiting.
+ */
+
+typedef struct _mongoc_scram_cache_stats_t {
+   uint64_t hits;
+   /* misses in memory that the cache file answered */
+   uint64_t file_hits;
+   /* misses answered by waiting for another thread's derivation */
+   uint64_t coalesced;
+   uint64_t misses;
+   uint64_t evictions;
+} mongoc_scram_cache_stats_t;
+
+/* copies the secrets for these parameters into the three hash-sized outputs
+ * and returns TRUE, or returns FALSE if they aren't cached */
+my_bool
+_mongoc_scram_cache_get (mongoc_crypto_hash_algorithm_t algorithm,
+                         const char *user,
+                         const char *password,
+                         const uint8_t *salt,
+                         uint32_t salt_len,
+                         uint32_t iterations,
+                         uint8_t *salted_password,
+                         uint8_t *client_key,
+                         uint8_t *server_key);
+
+typedef enum {
+   /* the secrets were cached, or another thread has just derived them */
+   MONGOC_SCRAM_CACHE_HIT,
+   /* the caller derives them, and must end with _mongoc_scram_cache_put or
+    * _mongoc_scram_cache_abandon */
+   MONGOC_SCRAM_CACHE_CLAIMED,
+   /* another thread is deriving them, and the caller asked not to wait */
+   MONGOC_SCRAM_CACHE_BUSY,
+   /* another thread has derived them but not yet verified its server; the
+    * caller may use them, and caches them once its own server is verified */
+   MONGOC_SCRAM_CACHE_PENDING
+} mongoc_scram_cache_claim_t;
+
+/* as _mongoc_scram_cache_get, but on a miss claims the derivation of the
+ * secrets, or if another thread already has, waits for its result unless
+ * wait is FALSE */
+mongoc_scram_cache_claim_t
+_mongoc_scram_cache_claim (mongoc_crypto_hash_algorithm_t algorithm,
+                           const char *user,
+                           const char *password,
+                           const uint8_t *salt,
+                           uint32_t salt_len,
+                           uint32_t iterations,
+                           my_bool wait,
+                           uint8_t *salted_password,
+                           uint8_t *client_key,
+                           uint8_t *server_key);
+
+/* stores the secrets, ending any claim on them */
+void
+_mongoc_scram_cache_put (mongoc_crypto_hash_algorithm_t algorithm,
+                         const char *user,
+                         const char *password,
+                         const uint8_t *salt,
+                         uint32_t salt_len,
+                         uint32_t iterations,
+                         const uint8_t *salted_password,
+                         const uint8_t *client_key,
+                         const uint8_t *server_key);
+
+/* keeps a claim open while the claimant's server is verified, handing the
+ * derived secrets to threads claiming them meanwhile instead of making them
+ * wait; the claim still ends with _mongoc_scram_cache_put or
+ * _mongoc_scram_cache_abandon */
+void
+_mongoc_scram_cache_hold (mongoc_crypto_hash_algorithm_t algorithm,
+                          const char *user,
+                          const char *password,
+                          const uint8_t *salt,
+                          uint32_t salt_len,
+                          uint32_t iterations,
+                          const uint8_t *salted_password,
+                          const uint8_t *client_key,
+                          const uint8_t *server_key);
+
+/* gives up a claim without secrets; a waiting thread then claims them */
+void
+_mongoc_scram_cache_abandon (mongoc_crypto_hash_algorithm_t algorithm,
+                             const char *user,
+                             const char *password,
+                             const uint8_t *salt,
+                             uint32_t salt_len,
+                             uint32_t iterations);
+
+void
+_mongoc_scram_cache_stats (mongoc_scram_cache_stats_t *stats);
+
+/* wipes every entry; the counters are kept */
+void
+_mongoc_scram_cache_clear (void);
+
+/*
+ * Backs the cache with the file at path, creating it if needed, with keys
+ * derived from the contents of the file at key_path. Both files must be
+ * regular files owned by the current user and inaccessible to anyone else.
+ * A file written under another key is reset. Entries expire ttl seconds
+ * after they are stored. Any previously opened file is closed first.
+ */
+my_bool
+_mongoc_scram_cache_file_open (const char *path,
+                               const char *key_path,
+                               uint32_t ttl,
+                               bson_error_t *error);
+
+void
+_mongoc_scram_cache_file_close (void);
+
+/* looks up the secrets stored under a 32-byte entry id; secrets holds
+ * SaltedPassword, ClientKey and ServerKey, each MONGOC_SCRAM_HASH_MAX_SIZE
+ * bytes apart */
+my_bool
+_mongoc_scram_cache_file_get (const uint8_t *id, uint8_t *secrets);
+
+void
+_mongoc_scram_cache_file_put (const uint8_t *id, const uint8_t *secrets);
+
+#endif /* MONGOC_SCRAM_CACHE_PRIVATE_H */
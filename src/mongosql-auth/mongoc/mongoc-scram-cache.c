@@ -0,0 +1,644 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongoc-config.h"
+
+#include "mongoc-scram-cache-private.h"
+#include "mongoc-scram.h"
+#include "mongoc-memcmp-private.h"
+#include "mongoc-thread-private.h"
+
+typedef struct _mongoc_scram_cache_entry_t {
+   /* 0 if the slot is free, else when the entry was last used */
+   uint64_t last_used;
+   mongoc_crypto_hash_algorithm_t algorithm;
+   char *user;
+   uint8_t password_digest[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t salt[MONGOC_SCRAM_HASH_MAX_SIZE];
+   uint32_t salt_len;
+   uint32_t iterations;
+   uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
+   uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+   uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+} mongoc_scram_cache_entry_t;
+
+/* a derivation claimed by some thread and not yet put or abandoned */
+typedef struct _mongoc_scram_cache_flight_t {
+   /* the entry id of the secrets being derived */
+   uint8_t id[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   /* derived and awaiting the claimant's server verification; the secrets
+    * are laid out as in the cache file */
+   my_bool held;
+   uint8_t secrets[3 * MONGOC_SCRAM_HASH_MAX_SIZE];
+   struct _mongoc_scram_cache_flight_t *next;
+} mongoc_scram_cache_flight_t;
+
+static mongoc_mutex_t _mongoc_scram_cache_mutex = MONGOC_MUTEX_INITIALIZER;
+static mongoc_scram_cache_entry_t _mongoc_scram_cache[MONGOC_SCRAM_CACHE_SIZE];
+static uint64_t _mongoc_scram_cache_clock;
+static mongoc_scram_cache_stats_t _mongoc_scram_cache_counters;
+static mongoc_scram_cache_flight_t *_mongoc_scram_cache_flights;
+/* signalled when a flight ends or is held */
+static mongoc_cond_t _mongoc_scram_cache_flight_cond = MONGOC_COND_INITIALIZER;
+
+
+static size_t
+_mongoc_scram_cache_hash_size (mongoc_crypto_hash_algorithm_t algorithm)
+{
+   return algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1
+             ? MONGOC_SCRAM_SHA_1_HASH_SIZE
+             : MONGOC_SCRAM_SHA_256_HASH_SIZE;
+}
+
+
+/* the cache never holds the password itself, only its digest */
+static void
+_mongoc_scram_cache_digest (const char *password, uint8_t *digest)
+{
+   mongoc_crypto_t crypto;
+
+   mongoc_crypto_init (&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+   mongoc_crypto_hash (
+      &crypto, (const unsigned char *) password, strlen (password), digest);
+   mongoc_crypto_destroy (&crypto);
+}
+
+
+static void
+_mongoc_scram_cache_wipe (mongoc_scram_cache_entry_t *entry)
+{
+   if (entry->user) {
+      memset (entry->user, 0, strlen (entry->user));
+      free (entry->user);
+   }
+
+   memset (entry, 0, sizeof *entry);
+}
+
+
+/* called with the mutex held */
+static mongoc_scram_cache_entry_t *
+_mongoc_scram_cache_find (mongoc_crypto_hash_algorithm_t algorithm,
+                          const char *user,
+                          const uint8_t *password_digest,
+                          const uint8_t *salt,
+                          uint32_t salt_len,
+                          uint32_t iterations)
+{
+   mongoc_scram_cache_entry_t *entry;
+   int i;
+
+   for (i = 0; i < MONGOC_SCRAM_CACHE_SIZE; i++) {
+      entry = &_mongoc_scram_cache[i];
+
+      if (entry->last_used && entry->algorithm == algorithm &&
+          entry->iterations == iterations && entry->salt_len == salt_len &&
+          0 == memcmp (entry->salt, salt, salt_len) &&
+          0 == strcmp (entry->user, user) &&
+          0 == mongoc_memcmp (entry->password_digest,
+                              password_digest,
+                              sizeof entry->password_digest)) {
+         return entry;
+      }
+   }
+
+   return NULL;
+}
+
+
+/* the key of an entry in the cache file: a digest of every lookup field.
+ * returns FALSE if out of memory */
+static my_bool
+_mongoc_scram_cache_entry_id (mongoc_crypto_hash_algorithm_t algorithm,
+                              const char *user,
+                              const uint8_t *password_digest,
+                              const uint8_t *salt,
+                              uint32_t salt_len,
+                              uint32_t iterations,
+                              uint8_t *id)
+{
+   const size_t user_len = strlen (user);
+   const size_t len = 12 + MONGOC_SCRAM_SHA_256_HASH_SIZE + salt_len + user_len;
+   const uint32_t algorithm_id = (uint32_t) algorithm;
+   mongoc_crypto_t crypto;
+   uint8_t *buf;
+   uint8_t *ptr;
+
+   ptr = buf = (uint8_t *) malloc (len);
+   if (!buf) {
+      return FALSE;
+   }
+
+   memcpy (ptr, &algorithm_id, 4);
+   memcpy (ptr + 4, &iterations, 4);
+   memcpy (ptr + 8, &salt_len, 4);
+   ptr += 12;
+   memcpy (ptr, password_digest, MONGOC_SCRAM_SHA_256_HASH_SIZE);
+   ptr += MONGOC_SCRAM_SHA_256_HASH_SIZE;
+   memcpy (ptr, salt, salt_len);
+   ptr += salt_len;
+   memcpy (ptr, user, user_len);
+
+   mongoc_crypto_init (&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+   mongoc_crypto_hash (&crypto, buf, len, id);
+   mongoc_crypto_destroy (&crypto);
+
+   memset (buf, 0, len);
+   free (buf);
+
+   return TRUE;
+}
+
+
+/* called with the mutex held */
+static mongoc_scram_cache_flight_t **
+_mongoc_scram_cache_flight_find (const uint8_t *id)
+{
+   mongoc_scram_cache_flight_t **link;
+
+   for (link = &_mongoc_scram_cache_flights; *link; link = &(*link)->next) {
+      if (0 == memcmp ((*link)->id, id, sizeof (*link)->id)) {
+         return link;
+      }
+   }
+
+   return NULL;
+}
+
+
+/* ends the flight for id, if there is one, and wakes its waiters. a NULL id,
+ * for a claimant that can't tell which flight is its own, ends them all;
+ * their waiters just claim the secrets again */
+static void
+_mongoc_scram_cache_flight_end (const uint8_t *id)
+{
+   mongoc_scram_cache_flight_t **link;
+   mongoc_scram_cache_flight_t *flight;
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+
+   if (!id) {
+      while ((flight = _mongoc_scram_cache_flights) != NULL) {
+         _mongoc_scram_cache_flights = flight->next;
+         memset (flight->secrets, 0, sizeof flight->secrets);
+         free (flight);
+      }
+      mongoc_cond_broadcast (&_mongoc_scram_cache_flight_cond);
+   } else if ((link = _mongoc_scram_cache_flight_find (id)) != NULL) {
+      flight = *link;
+      *link = flight->next;
+      memset (flight->secrets, 0, sizeof flight->secrets);
+      free (flight);
+      mongoc_cond_broadcast (&_mongoc_scram_cache_flight_cond);
+   }
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+}
+
+
+/* inserts or refreshes an entry in memory */
+static void
+_mongoc_scram_cache_store (mongoc_crypto_hash_algorithm_t algorithm,
+                           const char *user,
+                           const uint8_t *password_digest,
+                           const uint8_t *salt,
+                           uint32_t salt_len,
+                           uint32_t iterations,
+                           const uint8_t *salted_password,
+                           const uint8_t *client_key,
+                           const uint8_t *server_key)
+{
+   const size_t hash_size = _mongoc_scram_cache_hash_size (algorithm);
+   mongoc_scram_cache_entry_t *entry;
+   char *user_copy;
+   int i;
+
+   user_copy = strdup (user);
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+
+   entry = _mongoc_scram_cache_find (
+      algorithm, user, password_digest, salt, salt_len, iterations);
+
+   if (!entry) {
+      /* an entry needs its own copy of user; without one, skip caching */
+      if (!user_copy) {
+         mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+         return;
+      }
+
+      /* take a free slot, or else the least recently used one */
+      entry = &_mongoc_scram_cache[0];
+      for (i = 0; i < MONGOC_SCRAM_CACHE_SIZE && entry->last_used; i++) {
+         if (_mongoc_scram_cache[i].last_used < entry->last_used) {
+            entry = &_mongoc_scram_cache[i];
+         }
+      }
+
+      if (entry->last_used) {
+         _mongoc_scram_cache_counters.evictions++;
+      }
+
+      _mongoc_scram_cache_wipe (entry);
+
+      entry->algorithm = algorithm;
+      entry->user = user_copy;
+      user_copy = NULL;
+      memcpy (entry->password_digest,
+              password_digest,
+              sizeof entry->password_digest);
+      memcpy (entry->salt, salt, salt_len);
+      entry->salt_len = salt_len;
+      entry->iterations = iterations;
+   }
+
+   memcpy (entry->salted_password, salted_password, hash_size);
+   memcpy (entry->client_key, client_key, hash_size);
+   memcpy (entry->server_key, server_key, hash_size);
+   entry->last_used = ++_mongoc_scram_cache_clock;
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+
+   free (user_copy);
+}
+
+
+my_bool
+_mongoc_scram_cache_get (mongoc_crypto_hash_algorithm_t algorithm,
+                         const char *user,
+                         const char *password,
+                         const uint8_t *salt,
+                         uint32_t salt_len,
+                         uint32_t iterations,
+                         uint8_t *salted_password,
+                         uint8_t *client_key,
+                         uint8_t *server_key)
+{
+   uint8_t password_digest[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t id[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t secrets[3 * MONGOC_SCRAM_HASH_MAX_SIZE];
+   const size_t hash_size = _mongoc_scram_cache_hash_size (algorithm);
+   mongoc_scram_cache_entry_t *entry;
+   my_bool found;
+
+   if (salt_len > MONGOC_SCRAM_HASH_MAX_SIZE) {
+      return FALSE;
+   }
+
+   _mongoc_scram_cache_digest (password, password_digest);
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+
+   entry = _mongoc_scram_cache_find (
+      algorithm, user, password_digest, salt, salt_len, iterations);
+   if (entry) {
+      entry->last_used = ++_mongoc_scram_cache_clock;
+      memcpy (salted_password, entry->salted_password, hash_size);
+      memcpy (client_key, entry->client_key, hash_size);
+      memcpy (server_key, entry->server_key, hash_size);
+      _mongoc_scram_cache_counters.hits++;
+   }
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+
+   found = entry != NULL;
+
+   /* fall back to the cache file, and keep what it has in memory */
+   if (!found) {
+      found = _mongoc_scram_cache_entry_id (algorithm,
+                                            user,
+                                            password_digest,
+                                            salt,
+                                            salt_len,
+                                            iterations,
+                                            id) &&
+              _mongoc_scram_cache_file_get (id, secrets);
+      if (found) {
+         memcpy (salted_password, secrets, hash_size);
+         memcpy (client_key, secrets + MONGOC_SCRAM_HASH_MAX_SIZE, hash_size);
+         memcpy (
+            server_key, secrets + 2 * MONGOC_SCRAM_HASH_MAX_SIZE, hash_size);
+         _mongoc_scram_cache_store (algorithm,
+                                    user,
+                                    password_digest,
+                                    salt,
+                                    salt_len,
+                                    iterations,
+                                    salted_password,
+                                    client_key,
+                                    server_key);
+         memset (secrets, 0, sizeof secrets);
+      }
+
+      mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+      if (found) {
+         _mongoc_scram_cache_counters.file_hits++;
+      } else {
+         _mongoc_scram_cache_counters.misses++;
+      }
+      mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+   }
+
+   memset (password_digest, 0, sizeof password_digest);
+
+   return found;
+}
+
+
+mongoc_scram_cache_claim_t
+_mongoc_scram_cache_claim (mongoc_crypto_hash_algorithm_t algorithm,
+                           const char *user,
+                           const char *password,
+                           const uint8_t *salt,
+                           uint32_t salt_len,
+                           uint32_t iterations,
+                           my_bool wait,
+                           uint8_t *salted_password,
+                           uint8_t *client_key,
+                           uint8_t *server_key)
+{
+   uint8_t password_digest[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t id[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t secrets[3 * MONGOC_SCRAM_HASH_MAX_SIZE];
+   const size_t hash_size = _mongoc_scram_cache_hash_size (algorithm);
+   mongoc_scram_cache_entry_t *entry;
+   mongoc_scram_cache_flight_t **link;
+   mongoc_scram_cache_flight_t *flight;
+   mongoc_scram_cache_claim_t result;
+   my_bool waited = FALSE;
+
+   /* too long to cache, so nothing to coalesce on either */
+   if (salt_len > MONGOC_SCRAM_HASH_MAX_SIZE) {
+      return MONGOC_SCRAM_CACHE_CLAIMED;
+   }
+
+   _mongoc_scram_cache_digest (password, password_digest);
+
+   /* nor without the flight's id, so derive without coalescing */
+   if (!_mongoc_scram_cache_entry_id (
+          algorithm, user, password_digest, salt, salt_len, iterations, id)) {
+      memset (password_digest, 0, sizeof password_digest);
+      return MONGOC_SCRAM_CACHE_CLAIMED;
+   }
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+
+   for (;;) {
+      entry = _mongoc_scram_cache_find (
+         algorithm, user, password_digest, salt, salt_len, iterations);
+      if (entry) {
+         entry->last_used = ++_mongoc_scram_cache_clock;
+         memcpy (salted_password, entry->salted_password, hash_size);
+         memcpy (client_key, entry->client_key, hash_size);
+         memcpy (server_key, entry->server_key, hash_size);
+         if (waited) {
+            _mongoc_scram_cache_counters.coalesced++;
+         } else {
+            _mongoc_scram_cache_counters.hits++;
+         }
+         result = MONGOC_SCRAM_CACHE_HIT;
+         break;
+      }
+
+      link = _mongoc_scram_cache_flight_find (id);
+      if (!link) {
+         /* without a flight the derivation just isn't coalesced */
+         flight = (mongoc_scram_cache_flight_t *) calloc (1, sizeof *flight);
+         if (flight) {
+            memcpy (flight->id, id, sizeof flight->id);
+            flight->next = _mongoc_scram_cache_flights;
+            _mongoc_scram_cache_flights = flight;
+         }
+         result = MONGOC_SCRAM_CACHE_CLAIMED;
+         break;
+      }
+
+      /* the claimant's server has yet to answer, which nobody waits for */
+      if ((*link)->held) {
+         flight = *link;
+         memcpy (salted_password, flight->secrets, hash_size);
+         memcpy (client_key,
+                 flight->secrets + MONGOC_SCRAM_HASH_MAX_SIZE,
+                 hash_size);
+         memcpy (server_key,
+                 flight->secrets + 2 * MONGOC_SCRAM_HASH_MAX_SIZE,
+                 hash_size);
+         _mongoc_scram_cache_counters.coalesced++;
+         result = MONGOC_SCRAM_CACHE_PENDING;
+         break;
+      }
+
+      if (!wait) {
+         result = MONGOC_SCRAM_CACHE_BUSY;
+         break;
+      }
+
+      /* the claimant puts the secrets or gives up, and either ends the
+       * flight; if it gave up, the next pass claims them here */
+      waited = TRUE;
+      mongoc_cond_wait (&_mongoc_scram_cache_flight_cond,
+                        &_mongoc_scram_cache_mutex);
+   }
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+
+   /* the cache file may have them, which answers the claim at once */
+   if (result == MONGOC_SCRAM_CACHE_CLAIMED) {
+      if (_mongoc_scram_cache_file_get (id, secrets)) {
+         memcpy (salted_password, secrets, hash_size);
+         memcpy (client_key, secrets + MONGOC_SCRAM_HASH_MAX_SIZE, hash_size);
+         memcpy (
+            server_key, secrets + 2 * MONGOC_SCRAM_HASH_MAX_SIZE, hash_size);
+         _mongoc_scram_cache_store (algorithm,
+                                    user,
+                                    password_digest,
+                                    salt,
+                                    salt_len,
+                                    iterations,
+                                    salted_password,
+                                    client_key,
+                                    server_key);
+         _mongoc_scram_cache_flight_end (id);
+         memset (secrets, 0, sizeof secrets);
+         result = MONGOC_SCRAM_CACHE_HIT;
+      }
+
+      mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+      if (result == MONGOC_SCRAM_CACHE_HIT) {
+         _mongoc_scram_cache_counters.file_hits++;
+      } else {
+         _mongoc_scram_cache_counters.misses++;
+      }
+      mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+   }
+
+   memset (password_digest, 0, sizeof password_digest);
+
+   return result;
+}
+
+
+void
+_mongoc_scram_cache_put (mongoc_crypto_hash_algorithm_t algorithm,
+                         const char *user,
+                         const char *password,
+                         const uint8_t *salt,
+                         uint32_t salt_len,
+                         uint32_t iterations,
+                         const uint8_t *salted_password,
+                         const uint8_t *client_key,
+                         const uint8_t *server_key)
+{
+   uint8_t password_digest[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t id[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t secrets[3 * MONGOC_SCRAM_HASH_MAX_SIZE] = {0};
+   const size_t hash_size = _mongoc_scram_cache_hash_size (algorithm);
+
+   if (salt_len > MONGOC_SCRAM_HASH_MAX_SIZE) {
+      return;
+   }
+
+   _mongoc_scram_cache_digest (password, password_digest);
+
+   _mongoc_scram_cache_store (algorithm,
+                              user,
+                              password_digest,
+                              salt,
+                              salt_len,
+                              iterations,
+                              salted_password,
+                              client_key,
+                              server_key);
+
+   /* stored first, so the waiters find the secrets once they wake */
+   if (_mongoc_scram_cache_entry_id (
+          algorithm, user, password_digest, salt, salt_len, iterations, id)) {
+      memcpy (secrets, salted_password, hash_size);
+      memcpy (secrets + MONGOC_SCRAM_HASH_MAX_SIZE, client_key, hash_size);
+      memcpy (
+         secrets + 2 * MONGOC_SCRAM_HASH_MAX_SIZE, server_key, hash_size);
+      _mongoc_scram_cache_file_put (id, secrets);
+      _mongoc_scram_cache_flight_end (id);
+   } else {
+      _mongoc_scram_cache_flight_end (NULL);
+   }
+
+   memset (secrets, 0, sizeof secrets);
+   memset (password_digest, 0, sizeof password_digest);
+}
+
+
+void
+_mongoc_scram_cache_hold (mongoc_crypto_hash_algorithm_t algorithm,
+                          const char *user,
+                          const char *password,
+                          const uint8_t *salt,
+                          uint32_t salt_len,
+                          uint32_t iterations,
+                          const uint8_t *salted_password,
+                          const uint8_t *client_key,
+                          const uint8_t *server_key)
+{
+   uint8_t password_digest[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t id[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   const size_t hash_size = _mongoc_scram_cache_hash_size (algorithm);
+   mongoc_scram_cache_flight_t **link;
+
+   if (salt_len > MONGOC_SCRAM_HASH_MAX_SIZE) {
+      return;
+   }
+
+   _mongoc_scram_cache_digest (password, password_digest);
+
+   /* waiters mustn't be left waiting on a flight that can't be found */
+   if (!_mongoc_scram_cache_entry_id (
+          algorithm, user, password_digest, salt, salt_len, iterations, id)) {
+      memset (password_digest, 0, sizeof password_digest);
+      _mongoc_scram_cache_flight_end (NULL);
+      return;
+   }
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+
+   link = _mongoc_scram_cache_flight_find (id);
+   if (link) {
+      memcpy ((*link)->secrets, salted_password, hash_size);
+      memcpy ((*link)->secrets + MONGOC_SCRAM_HASH_MAX_SIZE,
+              client_key,
+              hash_size);
+      memcpy ((*link)->secrets + 2 * MONGOC_SCRAM_HASH_MAX_SIZE,
+              server_key,
+              hash_size);
+      (*link)->held = TRUE;
+      mongoc_cond_broadcast (&_mongoc_scram_cache_flight_cond);
+   }
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+
+   memset (password_digest, 0, sizeof password_digest);
+}
+
+
+void
+_mongoc_scram_cache_abandon (mongoc_crypto_hash_algorithm_t algorithm,
+                             const char *user,
+                             const char *password,
+                             const uint8_t *salt,
+                             uint32_t salt_len,
+                             uint32_t iterations)
+{
+   uint8_t password_digest[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+   uint8_t id[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+
+   if (salt_len > MONGOC_SCRAM_HASH_MAX_SIZE) {
+      return;
+   }
+
+   _mongoc_scram_cache_digest (password, password_digest);
+
+   if (_mongoc_scram_cache_entry_id (
+          algorithm, user, password_digest, salt, salt_len, iterations, id)) {
+      _mongoc_scram_cache_flight_end (id);
+   } else {
+      _mongoc_scram_cache_flight_end (NULL);
+   }
+
+   memset (password_digest, 0, sizeof password_digest);
+}
+
+
+void
+_mongoc_scram_cache_stats (mongoc_scram_cache_stats_t *stats)
+{
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+   *stats = _mongoc_scram_cache_counters;
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+}
+
+
+void
+_mongoc_scram_cache_clear (void)
+{
+   int i;
+
+   mongoc_mutex_lock (&_mongoc_scram_cache_mutex);
+
+   for (i = 0; i < MONGOC_SCRAM_CACHE_SIZE; i++) {
+      _mongoc_scram_cache_wipe (&_mongoc_scram_cache[i]);
+   }
+
+   mongoc_mutex_unlock (&_mongoc_scram_cache_mutex);
+}
@@ -18,19 +18,45 @@
 #include "mongoc-scram.h"
 #include "mongoc-rand-private.h"
 #include "mongoc-crypto-private.h"
+#include "mongoc-pbkdf2-private.h"
+#include "mongoc-kdf-scheduler-private.h"
+#include "mongoc-scram-cache-private.h"
 #include "mongoc-b64.h"
 #include "mongoc-memcmp-private.h"
+#include "mongoc-thread-private.h"
+#include "mongoc-arena-private.h"
 
 #ifdef MONGOC_ENABLE_ICU
 #include <unicode/usprep.h>
 #include <unicode/ustring.h>
 #endif
 
+/* SSE2 and NEON are part of the baseline on x86-64 and AArch64 */
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MONGOC_SASL_PREP_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MONGOC_SASL_PREP_NEON 1
+#endif
+
+/* n in every byte of a word */
+#define MONGOC_SASL_PREP_BYTES(n) ((uint64_t) 0x0101010101010101ULL * (n))
+
 #define MONGOC_SCRAM_SERVER_KEY "Server Key"
 #define MONGOC_SCRAM_CLIENT_KEY "Client Key"
 
+/* how many iterations a derivation with a budget runs between clock checks */
+#define MONGOC_SCRAM_KDF_SLICE 8192
+
+/* the limits new scrams start with, see _mongoc_scram_set_default_* */
+static mongoc_mutex_t _mongoc_scram_limits_mutex = MONGOC_MUTEX_INITIALIZER;
+static uint32_t _mongoc_scram_max_iterations =
+   MONGOC_SCRAM_MAX_ITERATIONS_DEFAULT;
+static uint32_t _mongoc_scram_kdf_budget_ms = 0;
+
 static int
-_scram_hash_size (mongoc_scram_t *scram)
+_scram_hash_size (const mongoc_scram_t *scram)
 {
   if (scram->crypto.algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
     return MONGOC_SCRAM_SHA_1_HASH_SIZE;
@@ -55,10 +81,10 @@ _mongoc_scram_set_pass (mongoc_scram_t *scram, const char *pass)
 
    if (scram->pass) {
       memset (scram->pass, 0, strlen (scram->pass));
-      free (scram->pass);
+      _mongoc_arena_free (scram->arena, scram->pass);
    }
 
-   scram->pass = pass ? strdup (pass) : NULL;
+   scram->pass = pass ? _mongoc_arena_strdup (scram->arena, pass) : NULL;
 }
 
 
@@ -67,8 +93,15 @@ _mongoc_scram_set_user (mongoc_scram_t *scram, const char *user)
 {
    
 
-   free (scram->user);
-   scram->user = user ? strdup (user) : NULL;
+   _mongoc_arena_free (scram->arena, scram->user);
+   scram->user = user ? _mongoc_arena_strdup (scram->arena, user) : NULL;
+}
+
+
+void
+_mongoc_scram_set_arena (mongoc_scram_t *scram, mongoc_arena_t *arena)
+{
+   scram->arena = arena;
 }
 
 
@@ -80,22 +113,133 @@ _mongoc_scram_init (mongoc_scram_t *scram, mongoc_crypto_hash_algorithm_t algo)
    memset (scram, 0, sizeof *scram);
 
    mongoc_crypto_init (&scram->crypto, algo);
+
+   mongoc_mutex_lock (&_mongoc_scram_limits_mutex);
+   scram->max_iterations = _mongoc_scram_max_iterations;
+   scram->kdf_budget_ms = _mongoc_scram_kdf_budget_ms;
+   mongoc_mutex_unlock (&_mongoc_scram_limits_mutex);
+}
+
+
+void
+_mongoc_scram_set_kdf_limits (mongoc_scram_t *scram,
+                              uint32_t max_iterations,
+                              uint32_t kdf_budget_ms)
+{
+   scram->max_iterations = max_iterations;
+   scram->kdf_budget_ms = kdf_budget_ms;
+}
+
+
+void
+_mongoc_scram_set_kdf_priority (mongoc_scram_t *scram, int32_t priority)
+{
+   scram->kdf_priority = priority;
+}
+
+
+void
+_mongoc_scram_set_default_max_iterations (uint32_t max_iterations)
+{
+   mongoc_mutex_lock (&_mongoc_scram_limits_mutex);
+   _mongoc_scram_max_iterations = max_iterations;
+   mongoc_mutex_unlock (&_mongoc_scram_limits_mutex);
+}
+
+
+void
+_mongoc_scram_set_default_kdf_budget (uint32_t kdf_budget_ms)
+{
+   mongoc_mutex_lock (&_mongoc_scram_limits_mutex);
+   _mongoc_scram_kdf_budget_ms = kdf_budget_ms;
+   mongoc_mutex_unlock (&_mongoc_scram_limits_mutex);
+}
+
+
+/* Hands the derived secrets to other threads claiming them while step 3
+ * verifies the server, if this scram holds their claim. */
+static void
+_mongoc_scram_hold_claim (mongoc_scram_t *scram)
+{
+   if (scram->claimed) {
+      _mongoc_scram_cache_hold (scram->crypto.algorithm,
+                                scram->user ? scram->user : "",
+                                scram->hashed_password,
+                                scram->decoded_salt,
+                                scram->decoded_salt_len,
+                                scram->iterations,
+                                scram->salted_password,
+                                scram->client_key,
+                                scram->server_key);
+   }
+}
+
+
+/* Gives up this scram's claim on its secrets, if it holds one, so that the
+ * next thread to claim them derives them again. */
+static void
+_mongoc_scram_abandon_claim (mongoc_scram_t *scram)
+{
+   if (scram->claimed) {
+      _mongoc_scram_cache_abandon (scram->crypto.algorithm,
+                                   scram->user ? scram->user : "",
+                                   scram->hashed_password,
+                                   scram->decoded_salt,
+                                   scram->decoded_salt_len,
+                                   scram->iterations);
+      scram->claimed = FALSE;
+   }
+}
+
+
+/* Caches the secrets once step 3 has verified the server with them, ending
+ * this scram's claim on them if it holds one. */
+static void
+_mongoc_scram_cache_verified (mongoc_scram_t *scram)
+{
+   if (!scram->cached && scram->iterations) {
+      _mongoc_scram_cache_put (scram->crypto.algorithm,
+                               scram->user ? scram->user : "",
+                               scram->hashed_password,
+                               scram->decoded_salt,
+                               scram->decoded_salt_len,
+                               scram->iterations,
+                               scram->salted_password,
+                               scram->client_key,
+                               scram->server_key);
+      scram->cached = TRUE;
+   }
+
+   scram->claimed = FALSE;
 }
 
 
 void
 _mongoc_scram_destroy (mongoc_scram_t *scram)
 {
-   
+   /* a handshake that ended before step 3 leaves its claim for others */
+   _mongoc_scram_abandon_claim (scram);
 
-   free (scram->user);
+   _mongoc_arena_free (scram->arena, scram->user);
 
-   if (scram->pass) {
+   /* in an arena, the password is wiped along with the arena */
+   if (scram->pass && !scram->arena) {
       memset (scram->pass, 0, strlen (scram->pass));
-      free (scram->pass);
    }
+   _mongoc_arena_free (scram->arena, scram->pass);
+
+   if (scram->hashed_password) {
+      memset (scram->hashed_password, 0, strlen (scram->hashed_password));
+      free (scram->hashed_password);
+   }
+
+   _mongoc_arena_free (scram->arena, scram->auth_message);
+
+   memset (scram->salted_password, 0, sizeof scram->salted_password);
+   memset (scram->client_key, 0, sizeof scram->client_key);
+   memset (scram->server_key, 0, sizeof scram->server_key);
 
-   free (scram->auth_message);
+   mongoc_crypto_destroy (&scram->crypto);
 }
 
 
@@ -122,6 +266,133 @@ _mongoc_scram_buf_write (const char *src,
 }
 
 
+my_bool
+_mongoc_scram_parse_message (const uint8_t *msg,
+                             uint32_t msglen,
+                             const char *keys,
+                             mongoc_scram_slice_t *values,
+                             int step,
+                             bson_error_t *error)
+{
+   const uint8_t *ptr = msg;
+   const uint8_t *end = msg + msglen;
+   const uint8_t *value;
+   const uint8_t *next_comma;
+   const char *known;
+   size_t i;
+
+   for (i = 0; keys[i]; i++) {
+      values[i].value = NULL;
+      values[i].len = 0;
+   }
+
+   while (ptr < end) {
+      /* attr-val = ALPHA "=" value */
+      if (end - ptr < 2 || !isalpha (ptr[0]) || ptr[1] != '=') {
+         bson_set_error (error,
+                         MONGOC_ERROR_SCRAM,
+                         MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+                         "SCRAM Failure: invalid parse state in sasl step %d",
+                         step);
+         return FALSE;
+      }
+
+      value = ptr + 2;
+      next_comma = (const uint8_t *) memchr (value, ',', end - value);
+      if (!next_comma) {
+         next_comma = end;
+      }
+
+      known = strchr (keys, ptr[0]);
+      if (known) {
+         i = (size_t) (known - keys);
+         if (values[i].value) {
+            bson_set_error (error,
+                            MONGOC_ERROR_SCRAM,
+                            MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+                            "SCRAM Failure: duplicate key (%c) in sasl step %d",
+                            ptr[0],
+                            step);
+            return FALSE;
+         }
+
+         values[i].value = value;
+         values[i].len = (uint32_t) (next_comma - value);
+      } else if (ptr[0] == 'm') {
+         /* RFC 5802: m= is reserved for mandatory extensions, and its
+          * presence must fail authentication when none are supported */
+         bson_set_error (error,
+                         MONGOC_ERROR_SCRAM,
+                         MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+                         "SCRAM Failure: unsupported mandatory extension in "
+                         "sasl step %d",
+                         step);
+         return FALSE;
+      }
+      /* anything else is an extension this client ignores */
+
+      ptr = next_comma == end ? end : next_comma + 1;
+   }
+
+   return TRUE;
+}
+
+
+/* Decodes a base64 salt into decoded_salt, returning its length or -1. */
+static int32_t
+_mongoc_scram_decode_salt (const mongoc_scram_slice_t *salt,
+                           uint8_t *decoded_salt,
+                           size_t decoded_salt_max)
+{
+   /* mongoc_b64_pton wants a terminated string; a salt is short enough to
+    * terminate on the stack */
+   char encoded[MONGOC_SCRAM_B64_HASH_MAX_SIZE + 1];
+
+   if (salt->len >= sizeof encoded) {
+      return -1;
+   }
+
+   memcpy (encoded, salt->value, salt->len);
+   encoded[salt->len] = '\0';
+
+   return mongoc_b64_pton (encoded, decoded_salt, decoded_salt_max);
+}
+
+
+/* Parses a decimal iteration count, with an optional sign. Counts too large
+ * for an int64_t saturate at INT64_MAX. Returns FALSE if it isn't a number. */
+static my_bool
+_mongoc_scram_parse_iterations (const mongoc_scram_slice_t *val,
+                                int64_t *iterations)
+{
+   my_bool negative = FALSE;
+   uint32_t i = 0;
+   int64_t n = 0;
+
+   if (val->len && val->value[0] == '-') {
+      negative = TRUE;
+      i++;
+   }
+
+   if (i == val->len) {
+      return FALSE;
+   }
+
+   for (; i < val->len; i++) {
+      if (val->value[i] < '0' || val->value[i] > '9') {
+         return FALSE;
+      }
+
+      n = n > (INT64_MAX - 9) / 10 ? INT64_MAX
+                                   : n * 10 + (val->value[i] - '0');
+   }
+
+   *iterations = negative ? -n : n;
+
+   return TRUE;
+}
+
+
 /* generate client-first-message:
  * n,a=authzid,n=encoded-username,r=client-nonce
  *
@@ -139,7 +410,8 @@ _mongoc_scram_start (mongoc_scram_t *scram,
    my_bool rval = TRUE;
 
    /* auth message is as big as the outbuf just because */
-   scram->auth_message = (uint8_t *) malloc (outbufmax);
+   scram->auth_message =
+      (uint8_t *) _mongoc_arena_alloc (scram->arena, outbufmax);
    scram->auth_messagemax = outbufmax;
 
    /* the server uses a 24 byte random nonce, so we do as well */
@@ -258,108 +530,681 @@ CLEANUP:
 }
 
 
-/* Compute the SCRAM step Hi() as defined in RFC5802 */
-static void
-_mongoc_scram_salt_password (mongoc_scram_t *scram,
-                             const char *password,
-                             uint32_t password_len,
-                             const uint8_t *salt,
-                             uint32_t salt_len,
-                             uint32_t iterations)
+/* Keys the single-block PBKDF2 kernel in mongoc-pbkdf2.c. Passwords longer
+ * than a block are hashed first, as HMAC does with long keys. */
+static my_bool
+_mongoc_scram_pbkdf2_init (mongoc_scram_t *scram,
+                           mongoc_pbkdf2_t *pbkdf2,
+                           const char *password,
+                           uint32_t password_len,
+                           const uint8_t *salt,
+                           uint32_t salt_len)
+{
+   uint8_t hashed_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+   const uint8_t *key = (const uint8_t *) password;
+   size_t key_len = password_len;
+   my_bool ret;
+
+   if (key_len > MONGOC_PBKDF2_BLOCK_SIZE) {
+      if (!mongoc_crypto_hash (
+             &scram->crypto, key, key_len, (unsigned char *) hashed_key)) {
+         return FALSE;
+      }
+
+      key = hashed_key;
+      key_len = _scram_hash_size (scram);
+   }
+
+   ret = _mongoc_pbkdf2_init (
+      pbkdf2, scram->crypto.algorithm, key, key_len, salt, salt_len);
+
+   memset (hashed_key, 0, sizeof hashed_key);
+
+   return ret;
+}
+
+
+/* Runs batch[i] to iterations[i] as _mongoc_pbkdf2_run_batch does, but in
+ * slices, so that a kernel whose owner's kdf_budget_ms runs out can be
+ * abandoned: it is wiped and its owner marked kdf_expired. Budgets count
+ * from each owner's kdf_start. Without any budget the whole batch is run
+ * at once. */
+static void
+_mongoc_scram_run_kernels (mongoc_scram_t **owners,
+                           mongoc_pbkdf2_t **batch,
+                           const uint32_t *iterations,
+                           size_t n)
+{
+   uint8_t discard[MONGOC_SCRAM_HASH_MAX_SIZE];
+   mongoc_pbkdf2_t **slice = NULL;
+   uint32_t *targets = NULL;
+   uint32_t *done = NULL;
+   my_bool budgeted = FALSE;
+   size_t num_slice;
+   int64_t elapsed_ms;
+   size_t i;
+
+   for (i = 0; i < n; i++) {
+      budgeted = budgeted || owners[i]->kdf_budget_ms;
+   }
+
+   if (budgeted) {
+      slice = (mongoc_pbkdf2_t **) malloc (n * sizeof (*slice));
+      targets = (uint32_t *) malloc (n * sizeof (*targets));
+      done = (uint32_t *) calloc (n, sizeof (*done));
+   }
+
+   if (!slice || !targets || !done) {
+      _mongoc_pbkdf2_run_batch (batch, iterations, n);
+      goto CLEANUP;
+   }
+
+   for (;;) {
+      num_slice = 0;
+
+      for (i = 0; i < n; i++) {
+         if (done[i] == iterations[i] || owners[i]->kdf_expired) {
+            continue;
+         }
+
+         elapsed_ms =
+            (bson_get_monotonic_time () - owners[i]->kdf_start) / 1000;
+
+         if (owners[i]->kdf_budget_ms &&
+             elapsed_ms >= (int64_t) owners[i]->kdf_budget_ms) {
+            MONGOC_LOG ("abandoning a derivation after %d ms", (int) elapsed_ms);
+            _mongoc_pbkdf2_finish (batch[i], discard);
+            owners[i]->kdf_expired = TRUE;
+            continue;
+         }
+
+         done[i] = iterations[i] - done[i] > MONGOC_SCRAM_KDF_SLICE
+                      ? done[i] + MONGOC_SCRAM_KDF_SLICE
+                      : iterations[i];
+         targets[num_slice] = done[i];
+         slice[num_slice++] = batch[i];
+      }
+
+      if (!num_slice) {
+         break;
+      }
+
+      _mongoc_pbkdf2_run_batch (slice, targets, num_slice);
+   }
+
+   memset (discard, 0, sizeof discard);
+
+CLEANUP:
+   free (slice);
+   free (targets);
+   free (done);
+}
+
+
+/* Takes a KDF scheduler slot for the derivations of scrams[0..n), queued at
+ * the highest of their priorities. It waits no longer than the longest of
+ * their budgets, and for as long as it takes if any has none. Returns FALSE
+ * with every scram marked kdf_expired if the wait timed out. */
+static my_bool
+_mongoc_scram_kdf_acquire (mongoc_scram_t **scrams, size_t n)
+{
+   const int64_t now = bson_get_monotonic_time ();
+   int32_t priority = INT32_MIN;
+   uint32_t timeout_ms = 0;
+   my_bool bounded = TRUE;
+   size_t i;
+
+   for (i = 0; i < n; i++) {
+      scrams[i]->kdf_start = now;
+      if (scrams[i]->kdf_priority > priority) {
+         priority = scrams[i]->kdf_priority;
+      }
+      if (!scrams[i]->kdf_budget_ms) {
+         bounded = FALSE;
+      } else if (scrams[i]->kdf_budget_ms > timeout_ms) {
+         timeout_ms = scrams[i]->kdf_budget_ms;
+      }
+   }
+
+   if (_mongoc_kdf_scheduler_acquire (priority, bounded ? timeout_ms : 0)) {
+      return TRUE;
+   }
+
+   MONGOC_LOG ("gave up waiting %d ms for a KDF slot", (int) timeout_ms);
+
+   for (i = 0; i < n; i++) {
+      scrams[i]->kdf_expired = TRUE;
+   }
+
+   return FALSE;
+}
+
+
+/* Hi() through the kernel, as a batch of one. It can still share SIMD lanes
+ * with concurrent handshakes elsewhere in the process. Returns FALSE if the
+ * kernel can't be used or the derivation's budget ran out. */
+static my_bool
+_mongoc_scram_salt_password_kernel (mongoc_scram_t *scram,
+                                    const char *password,
+                                    uint32_t password_len,
+                                    const uint8_t *salt,
+                                    uint32_t salt_len,
+                                    uint32_t iterations)
+{
+   mongoc_pbkdf2_t pbkdf2;
+   mongoc_pbkdf2_t *batch = &pbkdf2;
+
+   if (iterations < 1 ||
+       !_mongoc_scram_pbkdf2_init (
+          scram, &pbkdf2, password, password_len, salt, salt_len)) {
+      return FALSE;
+   }
+
+   _mongoc_scram_run_kernels (&scram, &batch, &iterations, 1);
+   if (scram->kdf_expired) {
+      return FALSE;
+   }
+
+   _mongoc_pbkdf2_finish (&pbkdf2, scram->salted_password);
+
+   return TRUE;
+}
+
+
+/* Compute the SCRAM step Hi() as defined in RFC5802, holding a KDF
+ * scheduler slot */
+static my_bool
+_mongoc_scram_salt_password_admitted (mongoc_scram_t *scram,
+                                      const char *password,
+                                      uint32_t password_len,
+                                      const uint8_t *salt,
+                                      uint32_t salt_len,
+                                      uint32_t iterations)
+{
+   uint8_t intermediate_digest[MONGOC_SCRAM_HASH_MAX_SIZE];
+   uint8_t start_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+
+   int i;
+   int k;
+   uint8_t *output = scram->salted_password;
+   const int hash_size = _scram_hash_size (scram);
+
+   /* with SHA-NI or the ARMv8 crypto extensions, the built-in kernel beats
+    * any general purpose HMAC implementation. it is also the only path that
+    * can be stopped part way, so a derivation with a budget always takes it */
+   if ((_mongoc_pbkdf2_accelerated () || scram->kdf_budget_ms) &&
+       _mongoc_scram_salt_password_kernel (
+          scram, password, password_len, salt, salt_len, iterations)) {
+      return TRUE;
+   }
+
+   if (scram->kdf_expired) {
+      return FALSE;
+   }
+
+   /* otherwise prefer the crypto library's own PBKDF2, which keeps the HMAC
+    * state internal; the loop below is the fallback when it is unavailable */
+   if (mongoc_crypto_pbkdf2 (&scram->crypto,
+                             password,
+                             password_len,
+                             salt,
+                             salt_len,
+                             iterations,
+                             (size_t) hash_size,
+                             output)) {
+      return TRUE;
+   }
+
+   memcpy (start_key, salt, salt_len);
+
+   start_key[salt_len] = 0;
+   start_key[salt_len + 1] = 0;
+   start_key[salt_len + 2] = 0;
+   start_key[salt_len + 3] = 1;
+
+   /* the password is the HMAC key of every iteration, so its pads are only
+    * hashed once here rather than once per call */
+   if (!mongoc_crypto_hmac_set_key (&scram->crypto, password, password_len)) {
+      return FALSE;
+   }
+
+   if (!mongoc_crypto_hmac_keyed (&scram->crypto, start_key, hash_size, output)) {
+      memset (output, 0, hash_size);
+      return FALSE;
+   }
+
+   memcpy (intermediate_digest, output, hash_size);
+
+   /* output contains the accumulated XOR:ed result */
+   for (i = 2; i <= iterations; i++) {
+      if (!mongoc_crypto_hmac_keyed (&scram->crypto,
+                                     intermediate_digest,
+                                     hash_size,
+                                     intermediate_digest)) {
+         memset (intermediate_digest, 0, sizeof intermediate_digest);
+         memset (output, 0, hash_size);
+         return FALSE;
+      }
+
+      for (k = 0; k < hash_size; k++) {
+         output[k] ^= intermediate_digest[k];
+      }
+   }
+
+   memset (intermediate_digest, 0, sizeof intermediate_digest);
+
+   return TRUE;
+}
+
+
+static my_bool
+_mongoc_scram_salt_password (mongoc_scram_t *scram,
+                             const char *password,
+                             uint32_t password_len,
+                             const uint8_t *salt,
+                             uint32_t salt_len,
+                             uint32_t iterations)
+{
+   my_bool ret;
+
+   if (!_mongoc_scram_kdf_acquire (&scram, 1)) {
+      return FALSE;
+   }
+
+   ret = _mongoc_scram_salt_password_admitted (
+      scram, password, password_len, salt, salt_len, iterations);
+
+   _mongoc_kdf_scheduler_release ();
+
+   return ret;
+}
+
+
+/* ClientKey := HMAC(SaltedPassword, "Client Key")
+ * ServerKey := HMAC(SaltedPassword, "Server Key")
+ *
+ * both are keyed on the salted password, so they share one keyed context */
+static my_bool
+_mongoc_scram_generate_keys (mongoc_scram_t *scram)
+{
+   if (!mongoc_crypto_hmac_set_key (&scram->crypto,
+                                    scram->salted_password,
+                                    _scram_hash_size (scram))) {
+      return FALSE;
+   }
+
+   /* a key left half-written would be taken for a generated one */
+   if (!mongoc_crypto_hmac_keyed (&scram->crypto,
+                                  (uint8_t *) MONGOC_SCRAM_CLIENT_KEY,
+                                  (int) strlen (MONGOC_SCRAM_CLIENT_KEY),
+                                  scram->client_key) ||
+       !mongoc_crypto_hmac_keyed (&scram->crypto,
+                                  (uint8_t *) MONGOC_SCRAM_SERVER_KEY,
+                                  (int) strlen (MONGOC_SCRAM_SERVER_KEY),
+                                  scram->server_key)) {
+      memset (scram->client_key, 0, sizeof scram->client_key);
+      memset (scram->server_key, 0, sizeof scram->server_key);
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+static my_bool
+_mongoc_scram_generate_client_proof (mongoc_scram_t *scram,
+                                     uint8_t *outbuf,
+                                     uint32_t outbufmax,
+                                     uint32_t *outbuflen)
+{
+   uint8_t stored_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+   uint8_t client_signature[MONGOC_SCRAM_HASH_MAX_SIZE];
+   unsigned char client_proof[MONGOC_SCRAM_HASH_MAX_SIZE];
+   int i;
+   int r = 0;
+
+   if (!*scram->client_key && !_mongoc_scram_generate_keys (scram)) {
+      return FALSE;
+   }
+
+   /* StoredKey := H(client_key) */
+   mongoc_crypto_hash (&scram->crypto,
+                       scram->client_key,
+                       (size_t) _scram_hash_size (scram),
+                       stored_key);
+
+   /* ClientSignature := HMAC(StoredKey, AuthMessage) */
+   mongoc_crypto_hmac (&scram->crypto,
+                       stored_key,
+                       _scram_hash_size (scram),
+                       scram->auth_message,
+                       scram->auth_messagelen,
+                       client_signature);
+
+   /* ClientProof := ClientKey XOR ClientSignature */
+
+   for (i = 0; i < _scram_hash_size (scram); i++) {
+      client_proof[i] = scram->client_key[i] ^ client_signature[i];
+   }
+
+   r = mongoc_b64_ntop (client_proof,
+                        _scram_hash_size (scram),
+                        (char *) outbuf + *outbuflen,
+                        outbufmax - *outbuflen);
+
+   if (-1 == r) {
+      return FALSE;
+   }
+
+   *outbuflen += r;
+
+   return TRUE;
+}
+
+
+my_bool
+_mongoc_scram_prepare_password (mongoc_scram_t *scram, bson_error_t *error)
+{
+   char *tmp;
+
+   if (scram->hashed_password) {
+      return TRUE;
+   }
+
+   if (scram->crypto.algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
+      /* Auth spec for SCRAM-SHA-1: "The password variable MUST be the mongodb
+       * hashed variant. The mongo hashed variant is computed as hash = HEX(
+       * MD5( UTF8( username + ':mongo:' + plain_text_password )))" */
+      tmp = bson_strdup_printf ("%s:mongo:%s", scram->user, scram->pass);
+      scram->hashed_password = _mongoc_hex_md5 (tmp);
+      memset (tmp, 0, strlen (tmp));
+      free (tmp);
+   } else if (scram->crypto.algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
+      /* Auth spec for SCRAM-SHA-256: "Passwords MUST be prepared with SASLprep,
+       * per RFC 5802. Passwords are used directly for key derivation; they
+       * MUST NOT be digested as they are in SCRAM-SHA-1." */
+      scram->hashed_password =
+         _mongoc_sasl_prep (scram->pass, (int) strlen (scram->pass), error);
+   }
+
+   return scram->hashed_password != NULL;
+}
+
+
+void
+_mongoc_scram_share_password (mongoc_scram_t *scram,
+                              const mongoc_scram_t *source)
+{
+   if (scram->hashed_password || !source->hashed_password ||
+       scram->crypto.algorithm != source->crypto.algorithm ||
+       !scram->user || !source->user || strcmp (scram->user, source->user) ||
+       !scram->pass || !source->pass || strcmp (scram->pass, source->pass)) {
+      return;
+   }
+
+   scram->hashed_password = strdup (source->hashed_password);
+}
+
+
+my_bool
+_mongoc_scram_prepare_derivation (mongoc_scram_t *scram,
+                                  const uint8_t *inbuf,
+                                  uint32_t inbuflen)
+{
+   mongoc_scram_slice_t vals[2];
+   int32_t decoded_salt_len;
+   int64_t iterations;
+   bson_error_t error;
+
+   /* step 2 is still to come, and this wasn't called yet; the salt may
+    * arrive ahead of server-first */
+   if (scram->step > 1 || scram->derived || scram->iterations) {
+      return FALSE;
+   }
+
+   /* only s and i are needed here; step 2 validates the rest */
+   if (!_mongoc_scram_parse_message (inbuf, inbuflen, "si", vals, 2, &error) ||
+       !vals[0].value || !vals[1].value ||
+       !_mongoc_scram_parse_iterations (&vals[1], &iterations)) {
+      return FALSE;
+   }
+
+   decoded_salt_len = _mongoc_scram_decode_salt (
+      &vals[0], scram->decoded_salt, sizeof (scram->decoded_salt));
+
+   if (decoded_salt_len != _scram_hash_size (scram) - 4 || iterations < 4096 ||
+       iterations > INT32_MAX ||
+       (scram->max_iterations && iterations > scram->max_iterations)) {
+      return FALSE;
+   }
+
+   if (!_mongoc_scram_prepare_password (scram, &error)) {
+      return FALSE;
+   }
+
+   scram->decoded_salt_len = (uint32_t) decoded_salt_len;
+   scram->iterations = (uint32_t) iterations;
+
+   if (_mongoc_scram_cache_get (scram->crypto.algorithm,
+                                scram->user ? scram->user : "",
+                                scram->hashed_password,
+                                scram->decoded_salt,
+                                scram->decoded_salt_len,
+                                scram->iterations,
+                                scram->salted_password,
+                                scram->client_key,
+                                scram->server_key)) {
+      scram->derived = TRUE;
+      scram->cached = TRUE;
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+my_bool
+_mongoc_scram_same_derivation (const mongoc_scram_t *a, const mongoc_scram_t *b)
+{
+   return a->iterations && a->iterations == b->iterations &&
+          a->crypto.algorithm == b->crypto.algorithm && a->hashed_password &&
+          b->hashed_password && a->decoded_salt_len == b->decoded_salt_len &&
+          0 == memcmp (a->decoded_salt, b->decoded_salt, a->decoded_salt_len) &&
+          0 == strcmp (a->hashed_password, b->hashed_password);
+}
+
+
+void
+_mongoc_scram_copy_derivation (mongoc_scram_t *scram,
+                               const mongoc_scram_t *source)
 {
-   uint8_t intermediate_digest[MONGOC_SCRAM_HASH_MAX_SIZE];
-   uint8_t start_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+   if (!_mongoc_scram_same_derivation (scram, source)) {
+      return;
+   }
 
-   int i;
-   int k;
-   uint8_t *output = scram->salted_password;
+   /* the shared derivation ran out of budget for every conversation */
+   if (source->kdf_expired) {
+      scram->kdf_expired = TRUE;
+      return;
+   }
 
-   memcpy (start_key, salt, salt_len);
+   if (!source->derived) {
+      return;
+   }
 
-   start_key[salt_len] = 0;
-   start_key[salt_len + 1] = 0;
-   start_key[salt_len + 2] = 0;
-   start_key[salt_len + 3] = 1;
+   memcpy (scram->salted_password,
+           source->salted_password,
+           sizeof scram->salted_password);
+   memcpy (scram->client_key, source->client_key, sizeof scram->client_key);
+   memcpy (scram->server_key, source->server_key, sizeof scram->server_key);
+   scram->cached = source->cached;
+   scram->derived = TRUE;
+}
 
-   mongoc_crypto_hmac (&scram->crypto,
-                        password,
-                        password_len,
-                        start_key,
-                        _scram_hash_size (scram),
-                        output);
 
-   memcpy (intermediate_digest, output, _scram_hash_size (scram));
+/* Claims the secrets of a prepared scram in the SCRAM cache, taking them at
+ * once if they are already there or derived by another thread. */
+static mongoc_scram_cache_claim_t
+_mongoc_scram_claim_prepared (mongoc_scram_t *scram, my_bool wait)
+{
+   mongoc_scram_cache_claim_t claim;
+
+   claim = _mongoc_scram_cache_claim (scram->crypto.algorithm,
+                                      scram->user ? scram->user : "",
+                                      scram->hashed_password,
+                                      scram->decoded_salt,
+                                      scram->decoded_salt_len,
+                                      scram->iterations,
+                                      wait,
+                                      scram->salted_password,
+                                      scram->client_key,
+                                      scram->server_key);
+
+   switch (claim) {
+   case MONGOC_SCRAM_CACHE_HIT:
+      scram->derived = TRUE;
+      scram->cached = TRUE;
+      break;
+   case MONGOC_SCRAM_CACHE_PENDING:
+      scram->derived = TRUE;
+      break;
+   case MONGOC_SCRAM_CACHE_CLAIMED:
+      scram->claimed = TRUE;
+      break;
+   default:
+      break;
+   }
 
-   /* output contains the accumulated XOR:ed result */
-   for (i = 2; i <= iterations; i++) {
-      mongoc_crypto_hmac (&scram->crypto,
-                               password,
-                               password_len,
-                               intermediate_digest,
-                               _scram_hash_size (scram),
-                               intermediate_digest);
-
-      for (k = 0; k < _scram_hash_size (scram); k++) {
-         output[k] ^= intermediate_digest[k];
-      }
+   return claim;
+}
+
+
+/* Ends the claim on a prepared scram's secrets if they couldn't be derived,
+ * giving it to the next thread waiting for it, or else holds it for step 3. */
+static void
+_mongoc_scram_settle_prepared (mongoc_scram_t *scram)
+{
+   if (scram->derived && _mongoc_scram_generate_keys (scram)) {
+      _mongoc_scram_hold_claim (scram);
+   } else {
+      _mongoc_scram_abandon_claim (scram);
    }
 }
 
 
-static my_bool
-_mongoc_scram_generate_client_proof (mongoc_scram_t *scram,
-                                     uint8_t *outbuf,
-                                     uint32_t outbufmax,
-                                     uint32_t *outbuflen)
+void
+_mongoc_scram_derive_batch (mongoc_scram_t **scrams, size_t n)
 {
-   uint8_t stored_key[MONGOC_SCRAM_HASH_MAX_SIZE];
-   uint8_t client_signature[MONGOC_SCRAM_HASH_MAX_SIZE];
-   unsigned char client_proof[MONGOC_SCRAM_HASH_MAX_SIZE];
-   int i;
-   int r = 0;
+   uint8_t discard[MONGOC_SCRAM_HASH_MAX_SIZE];
+   mongoc_pbkdf2_t *kernels;
+   mongoc_pbkdf2_t **batch;
+   uint32_t *iterations;
+   mongoc_scram_t **owners;
+   mongoc_scram_t **busy;
+   size_t num_kernels = 0;
+   size_t num_busy = 0;
+   size_t i;
+
+   /* a lone derivation takes the fastest single path, or waits for another
+    * thread already deriving the same secrets */
+   if (n == 1) {
+      if (scrams[0]->iterations && !scrams[0]->derived &&
+          !scrams[0]->kdf_expired &&
+          _mongoc_scram_claim_prepared (scrams[0], TRUE) ==
+             MONGOC_SCRAM_CACHE_CLAIMED) {
+         if (_mongoc_scram_salt_password (
+                scrams[0],
+                scrams[0]->hashed_password,
+                (uint32_t) strlen (scrams[0]->hashed_password),
+                scrams[0]->decoded_salt,
+                scrams[0]->decoded_salt_len,
+                scrams[0]->iterations)) {
+            scrams[0]->derived = TRUE;
+         }
+         _mongoc_scram_settle_prepared (scrams[0]);
+      }
+      return;
+   }
 
-   if (!*scram->client_key) {
-      /* ClientKey := HMAC(saltedPassword, "Client Key") */
-      mongoc_crypto_hmac (&scram->crypto,
-                          scram->salted_password,
-                          _scram_hash_size (scram),
-                          (uint8_t *) MONGOC_SCRAM_CLIENT_KEY,
-                          (int) strlen (MONGOC_SCRAM_CLIENT_KEY),
-                          scram->client_key);
+   kernels = (mongoc_pbkdf2_t *) malloc (n * sizeof (*kernels));
+   batch = (mongoc_pbkdf2_t **) malloc (n * sizeof (*batch));
+   iterations = (uint32_t *) calloc (n, sizeof (*iterations));
+   owners = (mongoc_scram_t **) malloc (n * sizeof (*owners));
+   busy = (mongoc_scram_t **) malloc (n * sizeof (*busy));
+
+   if (!kernels || !batch || !iterations || !owners || !busy) {
+      goto CLEANUP;
    }
 
-   /* StoredKey := H(client_key) */
-   mongoc_crypto_hash (&scram->crypto,
-                       scram->client_key,
-                       (size_t) _scram_hash_size (scram),
-                       stored_key);
+   /* claim what this batch derives without waiting, since a thread waiting
+    * while it holds claims of its own could wait on one that waits on it */
+   for (i = 0; i < n; i++) {
+      if (!scrams[i]->iterations || scrams[i]->derived ||
+          scrams[i]->kdf_expired) {
+         continue;
+      }
 
-   /* ClientSignature := HMAC(StoredKey, AuthMessage) */
-   mongoc_crypto_hmac (&scram->crypto,
-                       stored_key,
-                       _scram_hash_size (scram),
-                       scram->auth_message,
-                       scram->auth_messagelen,
-                       client_signature);
+      switch (_mongoc_scram_claim_prepared (scrams[i], FALSE)) {
+      case MONGOC_SCRAM_CACHE_HIT:
+      case MONGOC_SCRAM_CACHE_PENDING:
+         continue;
+      case MONGOC_SCRAM_CACHE_BUSY:
+         busy[num_busy++] = scrams[i];
+         continue;
+      default:
+         break;
+      }
 
-   /* ClientProof := ClientKey XOR ClientSignature */
+      if (!_mongoc_scram_pbkdf2_init (
+             scrams[i],
+             &kernels[num_kernels],
+             scrams[i]->hashed_password,
+             (uint32_t) strlen (scrams[i]->hashed_password),
+             scrams[i]->decoded_salt,
+             scrams[i]->decoded_salt_len)) {
+         _mongoc_scram_settle_prepared (scrams[i]);
+         continue;
+      }
 
-   for (i = 0; i < _scram_hash_size (scram); i++) {
-      client_proof[i] = scram->client_key[i] ^ client_signature[i];
+      batch[num_kernels] = &kernels[num_kernels];
+      iterations[num_kernels] = scrams[i]->iterations;
+      owners[num_kernels] = scrams[i];
+      num_kernels++;
    }
 
-   r = mongoc_b64_ntop (client_proof,
-                        _scram_hash_size (scram),
-                        (char *) outbuf + *outbuflen,
-                        outbufmax - *outbuflen);
+   MONGOC_LOG ("deriving %d SCRAM keys in one batch", (int) num_kernels);
 
-   if (-1 == r) {
-      return FALSE;
+   if (num_kernels) {
+      if (_mongoc_scram_kdf_acquire (owners, num_kernels)) {
+         _mongoc_scram_run_kernels (owners, batch, iterations, num_kernels);
+         _mongoc_kdf_scheduler_release ();
+      } else {
+         for (i = 0; i < num_kernels; i++) {
+            _mongoc_pbkdf2_finish (&kernels[i], discard);
+         }
+         memset (discard, 0, sizeof discard);
+      }
    }
 
-   *outbuflen += r;
+   for (i = 0; i < num_kernels; i++) {
+      if (!owners[i]->kdf_expired) {
+         _mongoc_pbkdf2_finish (&kernels[i], owners[i]->salted_password);
+         owners[i]->derived = TRUE;
+      }
+      _mongoc_scram_settle_prepared (owners[i]);
+   }
 
-   return TRUE;
+   /* with this batch's claims settled, wait for the other threads' */
+   for (i = 0; i < num_busy; i++) {
+      _mongoc_scram_derive_batch (&busy[i], 1);
+   }
+
+CLEANUP:
+   free (kernels);
+   free (batch);
+   free (iterations);
+   free (owners);
+   free (busy);
 }
 
 
@@ -378,21 +1223,13 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
                      uint32_t *outbuflen,
                      bson_error_t *error)
 {
-   uint8_t *val_r = NULL;
-   uint32_t val_r_len;
-   uint8_t *val_s = NULL;
-   uint32_t val_s_len;
-   uint8_t *val_i = NULL;
-   uint32_t val_i_len;
-
-   uint8_t **current_val;
-   uint32_t *current_val_len;
-
-   const uint8_t *ptr;
-   const uint8_t *next_comma;
+   /* r, s and i, pointing into inbuf */
+   mongoc_scram_slice_t vals[3];
+   const mongoc_scram_slice_t *val_r = &vals[0];
+   const mongoc_scram_slice_t *val_s = &vals[1];
+   const mongoc_scram_slice_t *val_i = &vals[2];
 
-   char *tmp;
-   char *hashed_password;
+   const char *hashed_password;
 
    uint8_t decoded_salt[MONGOC_SCRAM_B64_HASH_MAX_SIZE] = {0};
    int32_t decoded_salt_len;
@@ -400,31 +1237,17 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
    const int32_t expected_salt_length = _scram_hash_size (scram) - 4;
    my_bool rval = TRUE;
 
-   int iterations;
-
-   if (scram->crypto.algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_1) {
-      /* Auth spec for SCRAM-SHA-1: "The password variable MUST be the mongodb
-       * hashed variant. The mongo hashed variant is computed as hash = HEX(
-       * MD5( UTF8( username + ':mongo:' + plain_text_password )))" */
-      tmp = bson_strdup_printf ("%s:mongo:%s", scram->user, scram->pass);
-      hashed_password = _mongoc_hex_md5 (tmp);
-      memset (tmp, 0, strlen (tmp));
-      free (tmp);
-   } else if (scram->crypto.algorithm == MONGOC_CRYPTO_ALGORITHM_SHA_256) {
-      /* Auth spec for SCRAM-SHA-256: "Passwords MUST be prepared with SASLprep,
-       * per RFC 5802. Passwords are used directly for key derivation; they
-       * MUST NOT be digested as they are in SCRAM-SHA-1." */
-      hashed_password =
-         _mongoc_sasl_prep (scram->pass, (int) strlen (scram->pass), error);
+   int64_t iterations;
 
-      if (!hashed_password) {
-         goto FAIL;
-      }
-   } else {
+   /* the password may have been prepared ahead, or shared by another
+    * conversation of the handshake */
+   if (!_mongoc_scram_prepare_password (scram, error)) {
       goto FAIL;
    }
+   hashed_password = scram->hashed_password;
 
-   /* we need all of the incoming message for the final client proof */
+   /* we need all of the incoming message for the final client proof, and
+    * again in step 3, after inbuf is gone */
    if (!_mongoc_scram_buf_write ((char *) inbuf,
                                  inbuflen,
                                  scram->auth_message,
@@ -441,63 +1264,11 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
       goto BUFFER_AUTH;
    }
 
-   for (ptr = inbuf; ptr < inbuf + inbuflen;) {
-      switch (*ptr) {
-      case 'r':
-         current_val = &val_r;
-         current_val_len = &val_r_len;
-         break;
-      case 's':
-         current_val = &val_s;
-         current_val_len = &val_s_len;
-         break;
-      case 'i':
-         current_val = &val_i;
-         current_val_len = &val_i_len;
-         break;
-      default:
-         bson_set_error (error,
-                         MONGOC_ERROR_SCRAM,
-                         MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
-                         "SCRAM Failure: unknown key (%c) in sasl step 2",
-                         *ptr);
-         goto FAIL;
-      }
-
-      ptr++;
-
-      if (*ptr != '=') {
-         bson_set_error (error,
-                         MONGOC_ERROR_SCRAM,
-                         MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
-                         "SCRAM Failure: invalid parse state in sasl step 2");
-
-         goto FAIL;
-      }
-
-      ptr++;
-
-      next_comma =
-         (const uint8_t *) memchr (ptr, ',', (inbuf + inbuflen) - ptr);
-
-      if (next_comma) {
-         *current_val_len = (uint32_t) (next_comma - ptr);
-      } else {
-         *current_val_len = (uint32_t) ((inbuf + inbuflen) - ptr);
-      }
-
-      *current_val = (uint8_t *) malloc (*current_val_len + 1);
-      memcpy (*current_val, ptr, *current_val_len);
-      (*current_val)[*current_val_len] = '\0';
-
-      if (next_comma) {
-         ptr = next_comma + 1;
-      } else {
-         break;
-      }
+   if (!_mongoc_scram_parse_message (inbuf, inbuflen, "rsi", vals, 2, error)) {
+      goto FAIL;
    }
 
-   if (!val_r) {
+   if (!val_r->value) {
       bson_set_error (error,
                       MONGOC_ERROR_SCRAM,
                       MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
@@ -506,7 +1277,7 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
       goto FAIL;
    }
 
-   if (!val_s) {
+   if (!val_s->value) {
       bson_set_error (error,
                       MONGOC_ERROR_SCRAM,
                       MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
@@ -515,7 +1286,7 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
       goto FAIL;
    }
 
-   if (!val_i) {
+   if (!val_i->value) {
       bson_set_error (error,
                       MONGOC_ERROR_SCRAM,
                       MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
@@ -525,13 +1296,15 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
    }
 
    /* verify our nonce */
-   if (val_r_len < scram->encoded_nonce_len ||
-      mongoc_memcmp (val_r, scram->encoded_nonce, scram->encoded_nonce_len)) {
+   if (val_r->len < (uint32_t) scram->encoded_nonce_len ||
+       mongoc_memcmp (
+          val_r->value, scram->encoded_nonce, scram->encoded_nonce_len)) {
       bson_set_error (
          error,
          MONGOC_ERROR_SCRAM,
          MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
          "SCRAM Failure: client nonce not repeated in sasl step 2");
+      goto FAIL;
    }
 
    *outbuflen = 0;
@@ -541,8 +1314,11 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
       goto BUFFER;
    }
 
-   if (!_mongoc_scram_buf_write (
-          (char *) val_r, val_r_len, outbuf, outbufmax, outbuflen)) {
+   if (!_mongoc_scram_buf_write ((const char *) val_r->value,
+                                 val_r->len,
+                                 outbuf,
+                                 outbufmax,
+                                 outbuflen)) {
       goto BUFFER;
    }
 
@@ -559,7 +1335,7 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
    }
 
    decoded_salt_len =
-      mongoc_b64_pton ((char *) val_s, decoded_salt, sizeof (decoded_salt));
+      _mongoc_scram_decode_salt (val_s, decoded_salt, sizeof (decoded_salt));
 
    if (-1 == decoded_salt_len) {
       bson_set_error (error,
@@ -578,11 +1354,7 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
       goto FAIL;
    }
 
-   iterations = (int) bson_ascii_strtoll ((char *) val_i, &tmp, 10);
-   /* tmp holds the location of the failed to parse character.  So if it's
-    * null, we got to the end of the string and didn't have a parse error */
-
-   if (*tmp) {
+   if (!_mongoc_scram_parse_iterations (val_i, &iterations)) {
       bson_set_error (
          error,
          MONGOC_ERROR_SCRAM,
@@ -610,14 +1382,90 @@ _mongoc_scram_step2 (mongoc_scram_t *scram,
       goto FAIL;
    }
 
-   _mongoc_scram_salt_password (scram,
-                                   hashed_password,
-                                   (uint32_t) strlen (hashed_password),
-                                   decoded_salt,
-                                   decoded_salt_len,
-                                   iterations);
+   /* a server asking for far more iterations than configured would tie up
+    * this thread deriving the key */
+   if (scram->max_iterations && iterations > scram->max_iterations) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_KDF_LIMIT,
+                      "SCRAM Failure: iterations must be at most %u",
+                      scram->max_iterations);
+      goto FAIL;
+   }
+
+   if (iterations > INT32_MAX) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+                      "SCRAM Failure: iterations must be at most %d",
+                      INT32_MAX);
+      goto FAIL;
+   }
+
+   if (scram->kdf_expired) {
+      goto EXPIRED;
+   } else if (scram->derived && scram->iterations == (uint32_t) iterations &&
+              scram->decoded_salt_len == (uint32_t) decoded_salt_len &&
+              0 == memcmp (scram->decoded_salt, decoded_salt, decoded_salt_len)) {
+      MONGOC_LOG ("%s", "SaltedPassword was derived ahead of sasl step2");
+   } else {
+      /* anything prepared ahead was for another salt or count */
+      _mongoc_scram_abandon_claim (scram);
+      memcpy (scram->decoded_salt, decoded_salt, (size_t) decoded_salt_len);
+      scram->decoded_salt_len = (uint32_t) decoded_salt_len;
+      scram->iterations = (uint32_t) iterations;
+      scram->derived = FALSE;
+      scram->cached = FALSE;
+
+      switch (_mongoc_scram_claim_prepared (scram, TRUE)) {
+      case MONGOC_SCRAM_CACHE_HIT:
+         /* possibly derived meanwhile by another thread, which this one
+          * waited for */
+         MONGOC_LOG ("%s", "SaltedPassword found in the SCRAM cache");
+         break;
+      case MONGOC_SCRAM_CACHE_PENDING:
+         MONGOC_LOG ("%s", "SaltedPassword derived by another conversation");
+         break;
+      default:
+         if (!_mongoc_scram_salt_password (scram,
+                                           hashed_password,
+                                           (uint32_t) strlen (hashed_password),
+                                           decoded_salt,
+                                           decoded_salt_len,
+                                           iterations)) {
+            if (scram->kdf_expired) {
+               goto EXPIRED;
+            }
+            bson_set_error (
+               error,
+               MONGOC_ERROR_SCRAM,
+               MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+               "SCRAM Failure: unable to salt password in sasl step2");
+            goto FAIL;
+         }
+
+         if (!_mongoc_scram_generate_keys (scram)) {
+            bson_set_error (
+               error,
+               MONGOC_ERROR_SCRAM,
+               MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+               "SCRAM Failure: unable to generate keys in sasl step2");
+            goto FAIL;
+         }
+
+         scram->derived = TRUE;
+         _mongoc_scram_hold_claim (scram);
+      }
+   }
 
-   _mongoc_scram_generate_client_proof (scram, outbuf, outbufmax, outbuflen);
+   if (!_mongoc_scram_generate_client_proof (
+          scram, outbuf, outbufmax, outbuflen)) {
+      bson_set_error (error,
+                      MONGOC_ERROR_SCRAM,
+                      MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
+                      "SCRAM Failure: unable to generate client proof in sasl step2");
+      goto FAIL;
+   }
 
    goto CLEANUP;
 
@@ -638,40 +1486,37 @@ BUFFER:
 
    goto FAIL;
 
+EXPIRED:
+   bson_set_error (error,
+                   MONGOC_ERROR_SCRAM,
+                   MONGOC_ERROR_SCRAM_KDF_LIMIT,
+                   "SCRAM Failure: deriving the salted password took longer "
+                   "than %u ms",
+                   scram->kdf_budget_ms);
+
+   goto FAIL;
+
 FAIL:
+   /* the server won't be verified now */
+   _mongoc_scram_abandon_claim (scram);
    rval = FALSE;
 
 CLEANUP:
-   free (val_r);
-   free (val_s);
-   free (val_i);
-
-   if (hashed_password) {
-      memset (hashed_password, 0, strlen (hashed_password));
-      free (hashed_password);
-   }
-
    return rval;
 }
 
 
 static my_bool
 _mongoc_scram_verify_server_signature (mongoc_scram_t *scram,
-                                       uint8_t *verification,
+                                       const uint8_t *verification,
                                        uint32_t len)
 {
    char encoded_server_signature[MONGOC_SCRAM_B64_HASH_MAX_SIZE];
    int32_t encoded_server_signature_len;
    uint8_t server_signature[MONGOC_SCRAM_HASH_MAX_SIZE];
 
-   if (!*scram->server_key) {
-      /* ServerKey := HMAC(SaltedPassword, "Server Key") */
-      mongoc_crypto_hmac (&scram->crypto,
-                          scram->salted_password,
-                          _scram_hash_size (scram),
-                          (uint8_t *) MONGOC_SCRAM_SERVER_KEY,
-                          strlen (MONGOC_SCRAM_SERVER_KEY),
-                          scram->server_key);
+   if (!*scram->server_key && !_mongoc_scram_generate_keys (scram)) {
+      return FALSE;
    }
 
    /* ServerSignature := HMAC(ServerKey, AuthMessage) */
@@ -704,83 +1549,31 @@ _mongoc_scram_step3 (mongoc_scram_t *scram,
                      uint32_t *outbuflen,
                      bson_error_t *error)
 {
-   uint8_t *val_e = NULL;
-   uint32_t val_e_len;
-   uint8_t *val_v = NULL;
-   uint32_t val_v_len;
-
-   uint8_t **current_val;
-   uint32_t *current_val_len;
-
-   const uint8_t *ptr;
-   const uint8_t *next_comma;
+   /* e and v, pointing into inbuf */
+   mongoc_scram_slice_t vals[2];
+   const mongoc_scram_slice_t *val_e = &vals[0];
+   const mongoc_scram_slice_t *val_v = &vals[1];
 
    my_bool rval = TRUE;
 
-   for (ptr = inbuf; ptr < inbuf + inbuflen;) {
-      switch (*ptr) {
-      case 'e':
-         current_val = &val_e;
-         current_val_len = &val_e_len;
-         break;
-      case 'v':
-         current_val = &val_v;
-         current_val_len = &val_v_len;
-         break;
-      default:
-         bson_set_error (error,
-                         MONGOC_ERROR_SCRAM,
-                         MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
-                         "SCRAM Failure: unknown key (%c) in sasl step 3",
-                         *ptr);
-         goto FAIL;
-      }
-
-      ptr++;
-
-      if (*ptr != '=') {
-         bson_set_error (error,
-                         MONGOC_ERROR_SCRAM,
-                         MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
-                         "SCRAM Failure: invalid parse state in sasl step 3");
-         goto FAIL;
-      }
-
-      ptr++;
-
-      next_comma =
-         (const uint8_t *) memchr (ptr, ',', (inbuf + inbuflen) - ptr);
-
-      if (next_comma) {
-         *current_val_len = (uint32_t) (next_comma - ptr);
-      } else {
-         *current_val_len = (uint32_t) ((inbuf + inbuflen) - ptr);
-      }
-
-      *current_val = (uint8_t *) malloc (*current_val_len + 1);
-      memcpy (*current_val, ptr, *current_val_len);
-      (*current_val)[*current_val_len] = '\0';
-
-      if (next_comma) {
-         ptr = next_comma + 1;
-      } else {
-         break;
-      }
+   if (!_mongoc_scram_parse_message (inbuf, inbuflen, "ev", vals, 3, error)) {
+      goto FAIL;
    }
 
    *outbuflen = 0;
 
-   if (val_e) {
+   if (val_e->value) {
       bson_set_error (
          error,
          MONGOC_ERROR_SCRAM,
          MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
-         "SCRAM Failure: authentication failure in sasl step 3 : %s",
-         val_e);
+         "SCRAM Failure: authentication failure in sasl step 3 : %.*s",
+         (int) val_e->len,
+         (const char *) val_e->value);
       goto FAIL;
    }
 
-   if (!val_v) {
+   if (!val_v->value) {
       bson_set_error (error,
                       MONGOC_ERROR_SCRAM,
                       MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
@@ -788,7 +1581,8 @@ _mongoc_scram_step3 (mongoc_scram_t *scram,
       goto FAIL;
    }
 
-   if (!_mongoc_scram_verify_server_signature (scram, val_v, val_v_len)) {
+   if (!_mongoc_scram_verify_server_signature (
+          scram, val_v->value, val_v->len)) {
       bson_set_error (
          error,
          MONGOC_ERROR_SCRAM,
@@ -797,19 +1591,51 @@ _mongoc_scram_step3 (mongoc_scram_t *scram,
       goto FAIL;
    }
 
+   /* only secrets the server has proven it shares are worth keeping */
+   _mongoc_scram_cache_verified (scram);
+
    goto CLEANUP;
 
 FAIL:
+   _mongoc_scram_abandon_claim (scram);
    rval = FALSE;
 
 CLEANUP:
-   free (val_e);
-   free (val_v);
-
    return rval;
 }
 
 
+uint32_t
+_mongoc_scram_resumption_secret (mongoc_scram_t *scram, uint8_t *out)
+{
+   uint8_t *data;
+
+   if (scram->step != 3 || !scram->auth_message) {
+      return 0;
+   }
+
+   data = (uint8_t *) _mongoc_arena_alloc (scram->arena,
+                                           17 + scram->auth_messagelen);
+   if (!data) {
+      return 0;
+   }
+   memcpy (data, "Resumption Secret", 17);
+   memcpy (data + 17, scram->auth_message, scram->auth_messagelen);
+
+   /* HMAC(ClientKey, "Resumption Secret" + AuthMessage). the server learns
+    * ClientKey from the proof; an eavesdropper never does. */
+   mongoc_crypto_hmac (&scram->crypto,
+                       scram->client_key,
+                       _scram_hash_size (scram),
+                       data,
+                       17 + scram->auth_messagelen,
+                       out);
+   _mongoc_arena_free (scram->arena, data);
+
+   return _scram_hash_size (scram);
+}
+
+
 my_bool
 _mongoc_scram_step (mongoc_scram_t *scram,
                     const uint8_t *inbuf,
@@ -840,23 +1666,87 @@ _mongoc_scram_step (mongoc_scram_t *scram,
 }
 
 my_bool
-_mongoc_sasl_prep_required (const char *str)
+_mongoc_sasl_prep_required (const char *str, size_t len)
 {
+   const unsigned char *p = (const unsigned char *) str;
+   size_t i = 0;
+   uint64_t word;
    unsigned char c;
-   while (*str) {
-      c = (unsigned char) *str;
-      /* characters below 32 contain all of the control characters.
-       * characters above 127 are multibyte UTF-8 characters.
-       * character 127 is the DEL character. */
+
+   /* characters below 32 contain all of the control characters.
+    * characters above 127 are multibyte UTF-8 characters.
+    * character 127 is the DEL character.
+    * Look for any of them 16 characters at a time where we can, then 8 as
+    * the bytes of a word, then one at a time. */
+#if defined(MONGOC_SASL_PREP_SSE2)
+   for (; i + 16 <= len; i += 16) {
+      __m128i chunk = _mm_loadu_si128 ((const __m128i *) (p + i));
+      /* compared as signed bytes, so those of 128 and over are negative */
+      __m128i printable =
+         _mm_and_si128 (_mm_cmpgt_epi8 (chunk, _mm_set1_epi8 (31)),
+                        _mm_cmplt_epi8 (chunk, _mm_set1_epi8 (127)));
+      if (_mm_movemask_epi8 (printable) != 0xFFFF) {
+         return TRUE;
+      }
+   }
+#elif defined(MONGOC_SASL_PREP_NEON)
+   for (; i + 16 <= len; i += 16) {
+      uint8x16_t chunk = vld1q_u8 (p + i);
+      if (vminvq_u8 (chunk) < 32 || vmaxvq_u8 (chunk) >= 127) {
+         return TRUE;
+      }
+   }
+#endif
+
+   for (; i + 8 <= len; i += 8) {
+      memcpy (&word, p + i, sizeof word);
+      /* a byte below 32 borrows into its top bit, and one of 127 carries
+       * into it; bytes of 128 and over have it set already */
+      if ((((word - MONGOC_SASL_PREP_BYTES (32)) & ~word) |
+           (word + MONGOC_SASL_PREP_BYTES (1)) | word) &
+          MONGOC_SASL_PREP_BYTES (128)) {
+         return TRUE;
+      }
+   }
+
+   for (; i < len; i++) {
+      c = p[i];
       if (c < 32 || c >= 127) {
          return TRUE;
       }
-      str++;
    }
+
    return FALSE;
 }
 
 #ifdef MONGOC_ENABLE_ICU
+/* the SASLPrep profile, opened once and then shared by every thread; ICU
+ * never changes a profile once it is open */
+static mongoc_mutex_t _mongoc_sasl_prep_mutex = MONGOC_MUTEX_INITIALIZER;
+static UStringPrepProfile *_mongoc_sasl_prep_profile = NULL;
+
+
+static UStringPrepProfile *
+_mongoc_sasl_prep_open (void)
+{
+   UErrorCode error_code = U_ZERO_ERROR;
+   UStringPrepProfile *prep;
+
+   mongoc_mutex_lock (&_mongoc_sasl_prep_mutex);
+   if (!_mongoc_sasl_prep_profile) {
+      _mongoc_sasl_prep_profile =
+         usprep_openByType (USPREP_RFC4013_SASLPREP, &error_code);
+      if (U_FAILURE (error_code)) {
+         _mongoc_sasl_prep_profile = NULL;
+      }
+   }
+   prep = _mongoc_sasl_prep_profile;
+   mongoc_mutex_unlock (&_mongoc_sasl_prep_mutex);
+
+   return prep;
+}
+
+
 char *
 _mongoc_sasl_prep_impl (const char *name,
                         const char *in_utf8,
@@ -900,8 +1790,8 @@ _mongoc_sasl_prep_impl (const char *name,
    }
 
    /* 2. perform SASLPrep. */
-   prep = usprep_openByType (USPREP_RFC4013_SASLPREP, &error_code);
-   if (error_code) {
+   prep = _mongoc_sasl_prep_open ();
+   if (!prep) {
       free (in_utf16);
       SASL_PREP_ERR_RETURN ("could not start SASLPrep for %s");
    }
@@ -910,7 +1800,6 @@ _mongoc_sasl_prep_impl (const char *name,
       prep, in_utf16, in_utf16_len, NULL, 0, USPREP_DEFAULT, NULL, &error_code);
    if (error_code != U_BUFFER_OVERFLOW_ERROR) {
       free (in_utf16);
-      usprep_close (prep);
       SASL_PREP_ERR_RETURN ("could not calculate SASLPrep length of %s");
    }
 
@@ -928,11 +1817,9 @@ _mongoc_sasl_prep_impl (const char *name,
    if (error_code) {
       free (in_utf16);
       free (out_utf16);
-      usprep_close (prep);
       SASL_PREP_ERR_RETURN ("could not execute SASLPrep for %s");
    }
    free (in_utf16);
-   usprep_close (prep);
 
    /* 3. convert back to UTF-8. */
    /* preflight. */
@@ -963,17 +1850,28 @@ _mongoc_sasl_prep_impl (const char *name,
 char *
 _mongoc_sasl_prep (const char *in_utf8, int in_utf8_len, bson_error_t *err)
 {
+   /* printable ASCII prepares to itself */
+   if (!_mongoc_sasl_prep_required (in_utf8, (size_t) in_utf8_len)) {
+      return strdup (in_utf8);
+   }
 
 #ifdef MONGOC_ENABLE_ICU
    return _mongoc_sasl_prep_impl ("password", in_utf8, in_utf8_len, err);
 #else
-   if (_mongoc_sasl_prep_required (in_utf8)) {
-      bson_set_error (err,
-                      MONGOC_ERROR_SCRAM,
-                      MONGOC_ERROR_SCRAM_PROTOCOL_ERROR,
-                      "SCRAM Failure: ICU required to SASLPrep password");
-      return NULL;
+   return _mongoc_sasl_prep_native ("password", in_utf8, in_utf8_len, err);
+#endif
+}
+
+
+void
+_mongoc_sasl_prep_cleanup (void)
+{
+#ifdef MONGOC_ENABLE_ICU
+   mongoc_mutex_lock (&_mongoc_sasl_prep_mutex);
+   if (_mongoc_sasl_prep_profile) {
+      usprep_close (_mongoc_sasl_prep_profile);
+      _mongoc_sasl_prep_profile = NULL;
    }
-   return strdup (in_utf8);
+   mongoc_mutex_unlock (&_mongoc_sasl_prep_mutex);
 #endif
 }
@@ -20,6 +20,7 @@
 
 #include "mongoc-misc.h"
 #include "mongoc-crypto-private.h"
+#include "mongoc-arena-private.h"
 
 #define MONGOC_SCRAM_SHA_1_HASH_SIZE 20
 #define MONGOC_SCRAM_SHA_256_HASH_SIZE 32
@@ -32,6 +33,11 @@
 #define MONGOC_SCRAM_B64_HASH_MAX_SIZE \
    MONGOC_SCRAM_B64_ENCODED_SIZE (MONGOC_SCRAM_HASH_MAX_SIZE)
 
+/* The most iterations a server may ask for unless configured otherwise.
+ * Far above what servers use, yet bounded to a fraction of a second of
+ * derivation rather than the minutes INT32_MAX would take. */
+#define MONGOC_SCRAM_MAX_ITERATIONS_DEFAULT 1000000
+
 typedef struct _mongoc_scram_t {
    my_bool done;
    int step;
@@ -39,7 +45,26 @@ typedef struct _mongoc_scram_t {
    char *pass;
    char *hashed_password;
    uint8_t decoded_salt[MONGOC_SCRAM_B64_HASH_MAX_SIZE];
+   uint32_t decoded_salt_len;
    uint32_t iterations;
+   /* salted_password already holds Hi() for decoded_salt and iterations */
+   my_bool derived;
+   /* salted_password and both keys are in the SCRAM cache already */
+   my_bool cached;
+   /* holds the SCRAM cache's claim on the secrets for decoded_salt and
+    * iterations, which step 3 puts once the server is verified */
+   my_bool claimed;
+   /* the most iterations accepted from the server, and the milliseconds
+    * deriving SaltedPassword may take; 0 lifts either limit */
+   uint32_t max_iterations;
+   uint32_t kdf_budget_ms;
+   /* the derivation was abandoned when kdf_budget_ms ran out */
+   my_bool kdf_expired;
+   /* when the derivation asked for a KDF scheduler slot; the budget counts
+    * from here, so time queued for a slot is part of it */
+   int64_t kdf_start;
+   /* the derivation's place in the KDF scheduler's queue, highest first */
+   int32_t kdf_priority;
    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
    uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
    uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
@@ -49,8 +74,16 @@ typedef struct _mongoc_scram_t {
    uint32_t auth_messagemax;
    uint32_t auth_messagelen;
    mongoc_crypto_t crypto;
+   /* where strings and buffers are allocated, or NULL for the heap */
+   mongoc_arena_t *arena;
 } mongoc_scram_t;
 
+/* A value in a SCRAM message, pointing into the buffer it was parsed from */
+typedef struct _mongoc_scram_slice_t {
+   const uint8_t *value;
+   uint32_t len;
+} mongoc_scram_slice_t;
+
 void
 _mongoc_scram_startup ();
 
@@ -63,9 +96,32 @@ _mongoc_scram_set_pass (mongoc_scram_t *scram, const char *pass);
 void
 _mongoc_scram_set_user (mongoc_scram_t *scram, const char *user);
 
+/* Allocates from arena from now on; call it before setting user and pass. */
+void
+_mongoc_scram_set_arena (mongoc_scram_t *scram, mongoc_arena_t *arena);
+
 void
 _mongoc_scram_destroy (mongoc_scram_t *scram);
 
+/* Sets the iteration ceiling and derivation budget of one scram. */
+void
+_mongoc_scram_set_kdf_limits (mongoc_scram_t *scram,
+                              uint32_t max_iterations,
+                              uint32_t kdf_budget_ms);
+
+/* Sets the priority of the scram's derivation when it queues for a KDF
+ * scheduler slot; 0 by default. */
+void
+_mongoc_scram_set_kdf_priority (mongoc_scram_t *scram, int32_t priority);
+
+/* Set the limits _mongoc_scram_init gives every new scram in the process.
+ * They start out as MONGOC_SCRAM_MAX_ITERATIONS_DEFAULT and no budget. */
+void
+_mongoc_scram_set_default_max_iterations (uint32_t max_iterations);
+
+void
+_mongoc_scram_set_default_kdf_budget (uint32_t kdf_budget_ms);
+
 my_bool
 _mongoc_scram_step (mongoc_scram_t *scram,
                     const uint8_t *inbuf,
@@ -75,14 +131,94 @@ _mongoc_scram_step (mongoc_scram_t *scram,
                     uint32_t *outbuflen,
                     bson_error_t *error);
 
-/* returns false if this string does not need SASLPrep. It returns true
+/* Splits a server message of the form a=value,b=value,... in one pass,
+ * without copying it. values[i] is set to the value of the attribute named
+ * keys[i], or to a NULL value if the message has none. Other attributes are
+ * extensions and are skipped, except m=, which makes the parse fail as RFC
+ * 5802 requires. step only goes into the error messages. */
+my_bool
+_mongoc_scram_parse_message (const uint8_t *msg,
+                             uint32_t msglen,
+                             const char *keys,
+                             mongoc_scram_slice_t *values,
+                             int step,
+                             bson_error_t *error);
+
+/* Prepares the password as the SCRAM mechanism in use requires: the MongoDB
+ * MD5 digest for SCRAM-SHA-1, SASLprep for SCRAM-SHA-256. Does nothing if
+ * it is already prepared. */
+my_bool
+_mongoc_scram_prepare_password (mongoc_scram_t *scram, bson_error_t *error);
+
+/* Gives scram a copy of the password source prepared, if both have the same
+ * algorithm and credentials, so it is only prepared once. */
+void
+_mongoc_scram_share_password (mongoc_scram_t *scram,
+                              const mongoc_scram_t *source);
+
+/* Reads the salt and iteration count from the server-first-message, or from
+ * a message carrying the same s= and i= sent ahead of it, and prepares the
+ * password, so SaltedPassword can be derived ahead of step 2 by
+ * _mongoc_scram_derive_batch. Returns FALSE if step 2 has run or the
+ * message can't be used; step 2 then does the work and reports errors. If
+ * server-first brings a different salt or count, step 2 derives again. Also
+ * returns FALSE if the SCRAM cache already holds the secrets, which are
+ * then loaded and need no derivation. */
+my_bool
+_mongoc_scram_prepare_derivation (mongoc_scram_t *scram,
+                                  const uint8_t *inbuf,
+                                  uint32_t inbuflen);
+
+/* Derives SaltedPassword for all prepared scrams in one batch, so their
+ * PBKDF2 iterations can share SIMD lanes. */
+void
+_mongoc_scram_derive_batch (mongoc_scram_t **scrams, size_t n);
+
+/* TRUE if two prepared scrams would derive the same SaltedPassword */
+my_bool
+_mongoc_scram_same_derivation (const mongoc_scram_t *a, const mongoc_scram_t *b);
+
+/* Takes the secrets source derived, if it is the same derivation, so that
+ * step 2 doesn't repeat it. */
+void
+_mongoc_scram_copy_derivation (mongoc_scram_t *scram,
+                               const mongoc_scram_t *source);
+
+/* Once step 3 has verified the server, writes a secret only this client and
+ * that server can compute to out, for proving possession of a session
+ * ticket, and returns its size. Returns 0 before then. */
+uint32_t
+_mongoc_scram_resumption_secret (mongoc_scram_t *scram, uint8_t *out);
+
+/* returns false if the len bytes of str do not need SASLPrep. It returns true
  * conservatively, if str might need to be SASLPrep'ed. */
  my_bool
- _mongoc_sasl_prep_required (const char *str);
+ _mongoc_sasl_prep_required (const char *str, size_t len);
 
 /* returns the output of SASLPrep as a new string which must be freed. Returns
 * null on error and sets err. */
 char *
 _mongoc_sasl_prep (const char *in_utf8, int in_utf8_len, bson_error_t *err);
 
+/* SASLPrep with the tables in mongoc-saslprep.c, which _mongoc_sasl_prep
+ * uses without ICU. Errors call the string name. */
+char *
+_mongoc_sasl_prep_native (const char *name,
+                          const char *in_utf8,
+                          int in_utf8_len,
+                          bson_error_t *err);
+
+#ifdef MONGOC_ENABLE_ICU
+/* SASLPrep with ICU */
+char *
+_mongoc_sasl_prep_impl (const char *name,
+                        const char *in_utf8,
+                        int in_utf8_len,
+                        bson_error_t *err);
+#endif
+
+/* closes the SASLPrep profile ICU keeps open between calls */
+void
+_mongoc_sasl_prep_cleanup (void);
+
 #endif /* MONGOC_SCRAM_H */
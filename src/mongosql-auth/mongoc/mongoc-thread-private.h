@@ -0,0 +1,133 @@
+/*
+ * Copyright 2018 MongoDB, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOC_THREAD_PRIVATE_H
+#define MONGOC_THREAD_PRIVATE_H
+
+/*
+ * Minimal thread, mutex, condition variable and thread-local storage
+ * wrappers, and an atomic int. Mutexes and condition variables can be
+ * initialized statically, so process-wide state needs no separate setup
+ * call.
+ */
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+
+#define mongoc_thread_t HANDLE
+#define MONGOC_THREAD_FUN(_name, _arg) static unsigned __stdcall _name (void *_arg)
+#define MONGOC_THREAD_RETURN return 0
+#define mongoc_thread_create(_t, _fn, _arg)                                 \
+   ((*(_t) = (HANDLE) _beginthreadex (NULL, 0, (_fn), (_arg), 0, NULL)) \
+       ? 0                                                              \
+       : -1)
+#define mongoc_thread_join(_t) \
+   (WaitForSingleObject ((_t), INFINITE), CloseHandle (_t))
+
+#define mongoc_mutex_t SRWLOCK
+#define MONGOC_MUTEX_INITIALIZER SRWLOCK_INIT
+#define mongoc_mutex_init InitializeSRWLock
+#define mongoc_mutex_lock AcquireSRWLockExclusive
+#define mongoc_mutex_unlock ReleaseSRWLockExclusive
+#define mongoc_mutex_destroy(_m)
+
+#define mongoc_cond_t CONDITION_VARIABLE
+#define MONGOC_COND_INITIALIZER CONDITION_VARIABLE_INIT
+#define mongoc_cond_init InitializeConditionVariable
+#define mongoc_cond_wait(_c, _m) \
+   SleepConditionVariableSRW ((_c), (_m), INFINITE, 0)
+/* 0 if woken, nonzero once _ms milliseconds have passed */
+#define mongoc_cond_timedwait(_c, _m, _ms) \
+   (SleepConditionVariableSRW ((_c), (_m), (DWORD) (_ms), 0) ? 0 : -1)
+#define mongoc_cond_signal WakeConditionVariable
+#define mongoc_cond_broadcast WakeAllConditionVariable
+#define mongoc_cond_destroy(_c)
+
+/* a key's destructor runs on a thread's value as the thread exits */
+#define mongoc_thread_key_t DWORD
+#define MONGOC_THREAD_KEY_DTOR(_name, _arg) static void WINAPI _name (void *_arg)
+#define mongoc_thread_key_create(_k, _dtor) \
+   ((*(_k) = FlsAlloc (_dtor)) != FLS_OUT_OF_INDEXES ? 0 : -1)
+#define mongoc_thread_key_delete FlsFree
+#define mongoc_thread_getspecific FlsGetValue
+#define mongoc_thread_setspecific(_k, _v) (FlsSetValue ((_k), (_v)) ? 0 : -1)
+
+/* an int that one thread sets, under a mutex, to publish what it set up
+ * before, and that others read without one: a load sees what the store
+ * published */
+#define mongoc_atomic_int_t volatile LONG
+#define mongoc_atomic_load(_p) InterlockedCompareExchange ((_p), 0, 0)
+#define mongoc_atomic_store(_p, _v) InterlockedExchange ((_p), (_v))
+#else
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+#define mongoc_thread_t pthread_t
+#define MONGOC_THREAD_FUN(_name, _arg) static void *_name (void *_arg)
+#define MONGOC_THREAD_RETURN return NULL
+#define mongoc_thread_create(_t, _fn, _arg) \
+   pthread_create ((_t), NULL, (_fn), (_arg))
+#define mongoc_thread_join(_t) pthread_join ((_t), NULL)
+
+#define mongoc_mutex_t pthread_mutex_t
+#define MONGOC_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#define mongoc_mutex_init(_m) pthread_mutex_init ((_m), NULL)
+#define mongoc_mutex_lock pthread_mutex_lock
+#define mongoc_mutex_unlock pthread_mutex_unlock
+#define mongoc_mutex_destroy pthread_mutex_destroy
+
+#define mongoc_cond_t pthread_cond_t
+#define MONGOC_COND_INITIALIZER PTHREAD_COND_INITIALIZER
+#define mongoc_cond_init(_c) pthread_cond_init ((_c), NULL)
+#define mongoc_cond_wait pthread_cond_wait
+#define mongoc_cond_signal pthread_cond_signal
+#define mongoc_cond_broadcast pthread_cond_broadcast
+#define mongoc_cond_destroy pthread_cond_destroy
+
+#define mongoc_thread_key_t pthread_key_t
+#define MONGOC_THREAD_KEY_DTOR(_name, _arg) static void _name (void *_arg)
+#define mongoc_thread_key_create pthread_key_create
+#define mongoc_thread_key_delete pthread_key_delete
+#define mongoc_thread_getspecific pthread_getspecific
+#define mongoc_thread_setspecific pthread_setspecific
+
+#define mongoc_atomic_int_t int
+#define mongoc_atomic_load(_p) __atomic_load_n ((_p), __ATOMIC_ACQUIRE)
+#define mongoc_atomic_store(_p, _v) \
+   __atomic_store_n ((_p), (_v), __ATOMIC_RELEASE)
+
+/* 0 if woken, nonzero once ms milliseconds have passed */
+static inline int
+mongoc_cond_timedwait (pthread_cond_t *cond,
+                       pthread_mutex_t *mutex,
+                       int64_t ms)
+{
+   struct timespec to;
+
+   clock_gettime (CLOCK_REALTIME, &to);
+   to.tv_sec += (time_t) (ms / 1000);
+   to.tv_nsec += (long) (ms % 1000) * 1000000L;
+   if (to.tv_nsec >= 1000000000L) {
+      to.tv_sec++;
+      to.tv_nsec -= 1000000000L;
+   }
+
+   return pthread_cond_timedwait (cond, mutex, &to);
+}
+#endif
+
+#endif /* MONGOC_THREAD_PRIVATE_H */
@@ -19,20 +19,106 @@
 #include "mongosql-auth-sasl.h"
 #include "mongoc/mongoc-b64.h"
 
+my_bool
+_mongosql_auth_conversation_is_scram(mongosql_auth_conversation_t *conv) {
+    return strcmp(conv->mechanism_name, "SCRAM-SHA-1") == 0 ||
+           strcmp(conv->mechanism_name, "SCRAM-SHA-256") == 0;
+}
+
+/*
+ * parse a username parameter holding a limit; NULL keeps the current value
+ */
+static my_bool
+_mongosql_auth_conversation_parse_limit(const char *value, uint32_t *limit) {
+    char *end;
+    int64_t parsed;
+
+    if (value == NULL) {
+        return TRUE;
+    }
+
+    parsed = bson_ascii_strtoll(value, &end, 10);
+    if (*value == '\0' || *end != '\0' || parsed < 0 || parsed > UINT32_MAX) {
+        return FALSE;
+    }
+
+    *limit = (uint32_t) parsed;
+    return TRUE;
+}
+
+/*
+ * parse the kdfPriority username parameter, which may be negative; NULL
+ * keeps the current value
+ */
+static my_bool
+_mongosql_auth_conversation_parse_priority(const char *value, int32_t *priority) {
+    char *end;
+    int64_t parsed;
+
+    if (value == NULL) {
+        return TRUE;
+    }
+
+    parsed = bson_ascii_strtoll(value, &end, 10);
+    if (*value == '\0' || *end != '\0' || parsed < INT32_MIN || parsed > INT32_MAX) {
+        return FALSE;
+    }
+
+    *priority = (int32_t) parsed;
+    return TRUE;
+}
+
+/*
+ * override the iteration ceiling, derivation budget and derivation priority
+ * of a SCRAM conversation with the maxIterations, kdfBudgetMS and
+ * kdfPriority username parameters
+ */
+static void
+_mongosql_auth_conversation_set_kdf_limits(mongosql_auth_conversation_t *conv,
+                                           const char *max_iterations,
+                                           const char *kdf_budget_ms,
+                                           const char *kdf_priority) {
+    mongoc_scram_t *scram = &conv->mechanism.scram;
+    uint32_t max = scram->max_iterations;
+    uint32_t budget = scram->kdf_budget_ms;
+    int32_t priority = scram->kdf_priority;
+
+    if (!_mongosql_auth_conversation_parse_limit(max_iterations, &max)) {
+        _mongosql_auth_conversation_set_error(conv, "invalid value for maxIterations");
+        return;
+    }
+    if (!_mongosql_auth_conversation_parse_limit(kdf_budget_ms, &budget)) {
+        _mongosql_auth_conversation_set_error(conv, "invalid value for kdfBudgetMS");
+        return;
+    }
+    if (!_mongosql_auth_conversation_parse_priority(kdf_priority, &priority)) {
+        _mongosql_auth_conversation_set_error(conv, "invalid value for kdfPriority");
+        return;
+    }
+
+    _mongoc_scram_set_kdf_limits(scram, max, budget);
+    _mongoc_scram_set_kdf_priority(scram, priority);
+}
+
 void
 _mongosql_auth_conversation_init(mongosql_auth_conversation_t *conv,
                                  const char *username,
                                  const char *password,
                                  const char *mechanism,
-                                 const char *host) {
+                                 const char *host,
+                                 mongoc_arena_t *arena) {
     char *ptr, *target_spn, *err = NULL;
     char *service_name = NULL;
+    char *max_iterations = NULL;
+    char *kdf_budget_ms = NULL;
+    char *kdf_priority = NULL;
     uint8_t ret;
 
     /* initialize fields with provided parameters  */
-    conv->username = strdup(username);
-    conv->password = strdup(password);
-    conv->mechanism_name = strdup(mechanism);
+    conv->arena = arena;
+    conv->username = _mongoc_arena_strdup(arena, username);
+    conv->password = _mongoc_arena_strdup(arena, password);
+    conv->mechanism_name = _mongoc_arena_strdup(arena, mechanism);
 
 
     /* remove and store parameters from username */
@@ -43,6 +129,9 @@ _mongosql_auth_conversation_init(mongosql_auth_conversation_t *conv,
         // point 'ptr' to the beginning of the URL parameter list.
         ptr++;
         service_name = _mongosql_auth_conversation_find_param(ptr, "serviceName");
+        max_iterations = _mongosql_auth_conversation_find_param(ptr, "maxIterations");
+        kdf_budget_ms = _mongosql_auth_conversation_find_param(ptr, "kdfBudgetMS");
+        kdf_priority = _mongosql_auth_conversation_find_param(ptr, "kdfPriority");
     }
 
     /* fold mechanism case */
@@ -53,8 +142,11 @@ _mongosql_auth_conversation_init(mongosql_auth_conversation_t *conv,
     /* set defaults for other fields */
     conv->status = CR_OK;
     conv->done = 0;
-    conv->buf = NULL;
-    conv->buf_len = 0;
+    conv->in = NULL;
+    conv->in_len = 0;
+    conv->out = NULL;
+    conv->out_max = 0;
+    conv->out_len = 0;
     conv->error_msg = NULL;
 
     #if defined(MONGOC_ENABLE_CRYPTO_CNG)
@@ -64,11 +156,13 @@ _mongosql_auth_conversation_init(mongosql_auth_conversation_t *conv,
     if (strcmp(conv->mechanism_name, "SCRAM-SHA-1") == 0) {
         /* initialize the scram struct */
         _mongoc_scram_init(&conv->mechanism.scram, MONGOC_CRYPTO_ALGORITHM_SHA_1);
+        _mongoc_scram_set_arena(&conv->mechanism.scram, arena);
         _mongoc_scram_set_user(&conv->mechanism.scram, conv->username);
         _mongoc_scram_set_pass(&conv->mechanism.scram, conv->password);
     } else if (strcmp(conv->mechanism_name, "SCRAM-SHA-256") == 0) {
         /* initialize the scram struct */
         _mongoc_scram_init(&conv->mechanism.scram, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+        _mongoc_scram_set_arena(&conv->mechanism.scram, arena);
         _mongoc_scram_set_user(&conv->mechanism.scram, conv->username);
         _mongoc_scram_set_pass(&conv->mechanism.scram, conv->password);
 #ifdef MONGOSQL_AUTH_ENABLE_SASL
@@ -106,6 +200,14 @@ _mongosql_auth_conversation_init(mongosql_auth_conversation_t *conv,
         free(target_spn);
 #endif
     }
+
+    if (_mongosql_auth_conversation_is_scram(conv)) {
+        _mongosql_auth_conversation_set_kdf_limits(conv, max_iterations, kdf_budget_ms, kdf_priority);
+    }
+
+    free(max_iterations);
+    free(kdf_budget_ms);
+    free(kdf_priority);
 }
 
 void
@@ -114,6 +216,7 @@ _mongosql_auth_conversation_destroy(mongosql_auth_conversation_t *conv) {
     /* destroy the scram struct */
     if (strcmp(conv->mechanism_name, "SCRAM-SHA-1") == 0 ||
         strcmp(conv->mechanism_name, "SCRAM-SHA-256") == 0) {
+        _mongoc_scram_destroy(&conv->mechanism.scram);
 #ifdef MONGOSQL_AUTH_ENABLE_SASL
     } else if (strcmp(conv->mechanism_name, "GSSAPI") == 0) {
         _mongosql_auth_sasl_destroy(&conv->mechanism.sasl);
@@ -122,20 +225,19 @@ _mongosql_auth_conversation_destroy(mongosql_auth_conversation_t *conv) {
     #if defined(MONGOC_ENABLE_CRYPTO_CNG)
         mongoc_crypto_cng_cleanup ();
     #endif
-    /* zero the password's memory */
-    memset(conv->password, 0, strlen(conv->password));
-
-    /* free strduped strings and managed buffer */
-    if (conv->buf) {
-        free (conv->buf);
+    /* zero the password's memory; an arena is wiped as a whole instead */
+    if (conv->arena == NULL) {
+        memset(conv->password, 0, strlen(conv->password));
     }
-    free(conv->username);
-    free(conv->password);
-    free(conv->mechanism_name);
-    free(conv->error_msg);
+
+    /* free strduped strings */
+    _mongoc_arena_free(conv->arena, conv->username);
+    _mongoc_arena_free(conv->arena, conv->password);
+    _mongoc_arena_free(conv->arena, conv->mechanism_name);
+    _mongoc_arena_free(conv->arena, conv->error_msg);
 }
 
-/* takes the input in buf as server input and creates the server output */
+/* takes the server input in in and writes the client output to out */
 void
 _mongosql_auth_conversation_step(mongosql_auth_conversation_t *conv) {
     char *err;
@@ -165,43 +267,101 @@ _mongosql_auth_conversation_step(mongosql_auth_conversation_t *conv) {
     }
 }
 
-/* takes the input in buf as server input and creates the server output */
+size_t
+_mongosql_auth_conversation_max_response(mongosql_auth_conversation_t *conv) {
+    if (_mongosql_auth_conversation_is_scram(conv)) {
+        return MONGOSQL_SCRAM_MAX_BUF_SIZE;
+    } else if (strcmp(conv->mechanism_name, "PLAIN") == 0) {
+        return strlen(conv->username) + strlen(conv->password) + 2;
+    }
+
+    /* GSSAPI tokens are bounded like the server's messages */
+    return MONGOSQL_AUTH_MAX_BUF_SIZE;
+}
+
+/*
+ * prepare the SCRAM password of source once and give conv a copy, so the
+ * conversations of a handshake don't each digest or SASLprep it. if it
+ * can't be prepared, each conversation reports the error in its own step.
+ */
 void
-_mongosql_auth_conversation_scram_step(mongosql_auth_conversation_t *conv) {
+_mongosql_auth_conversation_share_credential(mongosql_auth_conversation_t *conv,
+                                             mongosql_auth_conversation_t *source) {
     bson_error_t error;
+
+    if (!_mongosql_auth_conversation_is_scram(conv) ||
+        !_mongosql_auth_conversation_is_scram(source) ||
+        _mongosql_auth_conversation_has_error(source)) {
+        return;
+    }
+
+    if (!_mongoc_scram_prepare_password(&source->mechanism.scram, &error)) {
+        return;
+    }
+
+    _mongoc_scram_share_password(&conv->mechanism.scram, &source->mechanism.scram);
+}
+
+/*
+ * if the next step of a SCRAM conversation derives the salted password, read
+ * its parameters from in so the derivation can run ahead of the step
+ */
+my_bool
+_mongosql_auth_conversation_prepare_derivation(mongosql_auth_conversation_t *conv) {
+    if (_mongosql_auth_conversation_is_done(conv) ||
+        _mongosql_auth_conversation_has_error(conv)) {
+        return FALSE;
+    }
+
+    if (!_mongosql_auth_conversation_is_scram(conv)) {
+        return FALSE;
+    }
+
+    return _mongoc_scram_prepare_derivation(&conv->mechanism.scram,
+                                            conv->in,
+                                            (uint32_t) conv->in_len);
+}
+
+/* takes the server input in in and writes the client output to out */
+void
+_mongosql_auth_conversation_scram_step(mongosql_auth_conversation_t *conv) {
+    bson_error_t error = {0};
     my_bool success;
-    uint8_t *outbuf;
-    size_t outbuf_len = 0;
+    char *err;
+    uint32_t out_len = 0;
     mongoc_scram_t* scram = &conv->mechanism.scram;
 
     mongosql_auth_log("Stepping mongosql_auth for '%s' mechanism", conv->mechanism_name);
 
     mongosql_auth_log("    Server challenge (%zu):", scram->step);
-    mongosql_auth_log("        buf_len: %zu", conv->buf_len);
-    mongosql_auth_log("        buf: %.*s", (int)conv->buf_len, conv->buf);
+    mongosql_auth_log("        buf_len: %zu", conv->in_len);
+    mongosql_auth_log("        buf: %.*s", (int)conv->in_len, conv->in);
 
-    outbuf = malloc(MONGOSQL_SCRAM_MAX_BUF_SIZE);
     success = _mongoc_scram_step (
         scram,
-        conv->buf,
-        (uint32_t) conv->buf_len,
-        outbuf,
-        (uint32_t)(MONGOSQL_SCRAM_MAX_BUF_SIZE * sizeof(uint8_t)),
-        (uint32_t*) &outbuf_len,
+        conv->in,
+        (uint32_t) conv->in_len,
+        conv->out,
+        (uint32_t) conv->out_max,
+        &out_len,
         &error
     );
+    conv->out_len = out_len;
 
-    // Free the input buffer.
-    if (conv->buf) {
-        free(conv->buf);
-    }
-
-    // The caller is responsible for managing the output buffer.
-    conv->buf = outbuf;
-    conv->buf_len = outbuf_len;
+    // The input points into the packet it arrived in, which the next
+    // read replaces.
+    conv->in = NULL;
+    conv->in_len = 0;
 
     if (!success) {
-        _mongosql_auth_conversation_set_error(conv, "failed while executing scram step");
+        /* spell out the limits, which the user can act on */
+        if (error.code == MONGOC_ERROR_SCRAM_KDF_LIMIT) {
+            err = bson_strdup_printf("failed while executing scram step: %s", error.message);
+            _mongosql_auth_conversation_set_error(conv, err);
+            free(err);
+        } else {
+            _mongosql_auth_conversation_set_error(conv, "failed while executing scram step");
+        }
         return;
     }
 
@@ -211,29 +371,33 @@ _mongosql_auth_conversation_scram_step(mongosql_auth_conversation_t *conv) {
 
     mongosql_auth_log("    Client response (%zu):", scram->step);
     mongosql_auth_log("        done: %d", conv->done);
-    mongosql_auth_log("        buf_len: %zu", conv->buf_len);
-    mongosql_auth_log("        buf: %.*s", (int)conv->buf_len, conv->buf);
+    mongosql_auth_log("        buf_len: %zu", conv->out_len);
+    mongosql_auth_log("        buf: %.*s", (int)conv->out_len, conv->out);
 }
 
-/* takes the input in buf as server input and creates the server output */
+/* takes the server input in in and writes the client output to out */
 void
 _mongosql_auth_conversation_plain_step(mongosql_auth_conversation_t *conv) {
-    char *str;
+    size_t username_len = strlen (conv->username);
     size_t len;
 
-    str = bson_strdup_printf ("%c%s%c%s", '\0', conv->username, '\0', conv->password);
-    len = strlen (conv->username) + strlen (conv->password) + 2;
-
-    // Free the input and set the output to the formatted string
-    if (conv->buf) {
-        free(conv->buf);
+    len = username_len + strlen (conv->password) + 2;
+    if (len > conv->out_max) {
+        _mongosql_auth_conversation_set_error(conv, "client response too large");
+        return;
     }
-    conv->buf = (uint8_t*) str;
-    conv->buf_len = len;
+
+    // Write the formatted credentials as the output.
+    conv->out[0] = '\0';
+    memcpy (conv->out + 1, conv->username, username_len + 1);
+    memcpy (conv->out + username_len + 2, conv->password, len - username_len - 2);
+    conv->out_len = len;
+    conv->in = NULL;
+    conv->in_len = 0;
     conv->done = 1;
 }
 
-/* takes the input in buf as server input and creates the server output */
+/* takes the server input in in and writes the client output to out */
 void
 _mongosql_auth_conversation_sasl_step(mongosql_auth_conversation_t *conv) {
     char *error;
@@ -244,14 +408,14 @@ _mongosql_auth_conversation_sasl_step(mongosql_auth_conversation_t *conv) {
     mongosql_auth_log("%s", "    Stepping mongosql_auth for GSSAPI mechanism");
 
     mongosql_auth_log("%s", "    Server challenge:");
-    mongosql_auth_log("        buf_len: %zu", conv->buf_len);
+    mongosql_auth_log("        buf_len: %zu", conv->in_len);
 
     // On a successful return, out_buf will point to a allocated buffer that we must manage.
     // If an error occurs, 'error' will point to an string we must manage.
     success = _mongosql_auth_sasl_step (
         &conv->mechanism.sasl,
-        conv->buf,
-        conv->buf_len,
+        (uint8_t *) conv->in,
+        conv->in_len,
         &out_buf,
         &out_buf_len,
         &error
@@ -275,12 +439,16 @@ _mongosql_auth_conversation_sasl_step(mongosql_auth_conversation_t *conv) {
     mongosql_auth_log("        done: %d", conv->done);
     mongosql_auth_log("        buf_len: %zu", out_buf_len);
 
-    // Replace the input buffer with the output buffer from the sasl step.
-    conv->buf_len = out_buf_len;
-    if (conv->buf) {
-        free (conv->buf);
+    // The sasl library allocates its own output; copy it into our slot of the frame.
+    conv->in = NULL;
+    conv->in_len = 0;
+    if (out_buf_len > conv->out_max) {
+        _mongosql_auth_conversation_set_error(conv, "client response too large");
+    } else {
+        memcpy(conv->out, out_buf, out_buf_len);
+        conv->out_len = out_buf_len;
     }
-    conv->buf = out_buf;
+    free(out_buf);
 }
 
 
@@ -289,7 +457,7 @@ _mongosql_auth_conversation_set_error(mongosql_auth_conversation_t *conv, const
     if (_mongosql_auth_conversation_has_error(conv)) {
         return;
     }
-    conv->error_msg = strdup(msg);
+    conv->error_msg = _mongoc_arena_strdup(conv->arena, msg);
     conv->status = CR_ERROR;
 }
 
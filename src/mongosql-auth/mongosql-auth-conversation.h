@@ -42,11 +42,18 @@ typedef struct mongosql_auth_conversation_t {
     char* username;
     char* password;
     uint8_t done;
-    uint8_t *buf;
-    size_t buf_len;
+    /* the server's message, pointing into the packet it arrived in */
+    const uint8_t *in;
+    size_t in_len;
+    /* where the next step writes its response, a slot of the handshake's frame */
+    uint8_t *out;
+    size_t out_max;
+    size_t out_len;
     char* error_msg;
     int status;
     uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    /* the handshake's arena, or NULL to allocate from the heap */
+    mongoc_arena_t *arena;
 } mongosql_auth_conversation_t;
 
 void
@@ -54,17 +61,33 @@ _mongosql_auth_conversation_init(mongosql_auth_conversation_t *conv,
                                  const char *username,
                                  const char *password,
                                  const char *mechanism,
-                                 const char *host);
+                                 const char *host,
+                                 mongoc_arena_t *arena);
 
 void
 _mongosql_auth_conversation_destroy(mongosql_auth_conversation_t *conv);
 
+/* whether the conversation speaks SCRAM-SHA-1 or SCRAM-SHA-256 */
+my_bool
+_mongosql_auth_conversation_is_scram(mongosql_auth_conversation_t *conv);
+
 void
 _mongosql_auth_conversation_step(mongosql_auth_conversation_t *conv);
 
+/* the most bytes a step of the conversation can write to out */
+size_t
+_mongosql_auth_conversation_max_response(mongosql_auth_conversation_t *conv);
+
 void
 _mongosql_auth_conversation_scram_step(mongosql_auth_conversation_t *conv);
 
+void
+_mongosql_auth_conversation_share_credential(mongosql_auth_conversation_t *conv,
+                                             mongosql_auth_conversation_t *source);
+
+my_bool
+_mongosql_auth_conversation_prepare_derivation(mongosql_auth_conversation_t *conv);
+
 void
 _mongosql_auth_conversation_plain_step(mongosql_auth_conversation_t *conv);
 
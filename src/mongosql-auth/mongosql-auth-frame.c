@@ -0,0 +1,117 @@
+/*
+ * Copyright 2018 MongoDB Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include "mongosql-auth-frame.h"
+
+my_bool
+_mongosql_auth_frame_init(mongosql_auth_frame_t *frame,
+                          mongoc_arena_t *arena,
+                          mongosql_auth_conversation_t *convs,
+                          uint32_t n) {
+    frame->len = 0;
+    frame->max = MONGOSQL_AUTH_FRAME_PREFIX_MAX_SIZE;
+    frame->prefix_len = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        frame->max += MONGOSQL_AUTH_FRAME_CLIENT_HEADER_SIZE +
+                      _mongosql_auth_conversation_max_response(&convs[i]);
+    }
+
+    frame->data = _mongoc_arena_alloc(arena, frame->max);
+    return frame->data != NULL;
+}
+
+void
+_mongosql_auth_frame_begin(mongosql_auth_frame_t *frame,
+                           mongosql_auth_conversation_t *convs,
+                           uint32_t n) {
+    uint8_t *slot = frame->data + frame->prefix_len;
+
+    for (uint32_t i = 0; i < n; i++) {
+        convs[i].out = slot + MONGOSQL_AUTH_FRAME_CLIENT_HEADER_SIZE;
+        convs[i].out_max = _mongosql_auth_conversation_max_response(&convs[i]);
+        convs[i].out_len = 0;
+        slot = convs[i].out + convs[i].out_max;
+    }
+    frame->len = 0;
+}
+
+void
+_mongosql_auth_frame_finish(mongosql_auth_frame_t *frame,
+                            mongosql_auth_conversation_t *convs,
+                            uint32_t n) {
+    uint8_t *pos = frame->data + frame->prefix_len;
+    uint32_t len;
+
+    for (uint32_t i = 0; i < n; i++) {
+        len = (uint32_t) convs[i].out_len;
+
+        /* slots only ever move towards the front, so nothing is overwritten
+         * before it is moved; the first slot never moves at all */
+        if (convs[i].out != pos + MONGOSQL_AUTH_FRAME_CLIENT_HEADER_SIZE) {
+            memmove(pos + MONGOSQL_AUTH_FRAME_CLIENT_HEADER_SIZE, convs[i].out, len);
+        }
+        memcpy(pos, &convs[i].done, 1);
+        memcpy(pos + 1, &len, 4);
+        pos += MONGOSQL_AUTH_FRAME_CLIENT_HEADER_SIZE + len;
+
+        /* the slots are handed out again by the next _mongosql_auth_frame_begin */
+        convs[i].out = NULL;
+        convs[i].out_max = 0;
+    }
+    frame->len = (size_t) (pos - frame->data);
+    frame->prefix_len = 0;
+}
+
+my_bool
+_mongosql_auth_frame_decode(const uint8_t *pkt,
+                            size_t pkt_len,
+                            mongosql_auth_conversation_t *convs,
+                            uint32_t n,
+                            size_t max_len,
+                            size_t *parsed,
+                            const char **error) {
+    const uint8_t *start = pkt;
+    const uint8_t *end = pkt + pkt_len;
+    uint32_t len;
+
+    for (uint32_t i = 0; i < n; i++) {
+        if ((size_t) (end - pkt) < MONGOSQL_AUTH_FRAME_SERVER_HEADER_SIZE) {
+            *error = "received truncated payload";
+            return FALSE;
+        }
+        memcpy(&len, pkt, 4);
+        pkt += MONGOSQL_AUTH_FRAME_SERVER_HEADER_SIZE;
+
+        if (len > max_len) {
+            *error = "received data size too large";
+            return FALSE;
+        }
+        if ((size_t) (end - pkt) < len) {
+            *error = "received truncated payload";
+            return FALSE;
+        }
+
+        convs[i].in = pkt;
+        convs[i].in_len = len;
+        pkt += len;
+    }
+
+    if (parsed) {
+        *parsed = (size_t) (pkt - start);
+    }
+    return TRUE;
+}
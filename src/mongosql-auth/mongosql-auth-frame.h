@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018 MongoDB Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOSQL_AUTH_FRAME_H
+#define MONGOSQL_AUTH_FRAME_H
+
+#include <my_global.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mongoc/mongoc-arena-private.h"
+#include "mongosql-auth-conversation.h"
+#include "mongosql-auth-ticket.h"
+
+/*
+ * A server payload is each conversation's message as [len u32][data]; a
+ * client payload is each conversation's response as [done u8][len u32][data].
+ */
+#define MONGOSQL_AUTH_FRAME_SERVER_HEADER_SIZE 4
+#define MONGOSQL_AUTH_FRAME_CLIENT_HEADER_SIZE 5
+
+/*
+ * the most bytes a client payload may carry ahead of the responses: the
+ * capabilities, and a session ticket with its length and proof
+ */
+#define MONGOSQL_AUTH_FRAME_PREFIX_MAX_SIZE \
+    (1 + 4 + MONGOSQL_AUTH_TICKET_MAX_SIZE + MONGOSQL_AUTH_TICKET_PROOF_SIZE)
+
+/*
+ * The buffer client payloads are built in. It is sized once per handshake
+ * for the largest response each conversation can give, and every round's
+ * responses are written straight into it.
+ */
+typedef struct mongosql_auth_frame_t {
+    uint8_t *data;
+    size_t len;
+    size_t max;
+    /* bytes at the front of the next payload, ahead of the responses; the
+     * caller sets it before _mongosql_auth_frame_begin and fills them in */
+    size_t prefix_len;
+} mongosql_auth_frame_t;
+
+/* allocates the frame from arena for the responses of n conversations */
+my_bool
+_mongosql_auth_frame_init(mongosql_auth_frame_t *frame,
+                          mongoc_arena_t *arena,
+                          mongosql_auth_conversation_t *convs,
+                          uint32_t n);
+
+/*
+ * Points each conversation's out buffer at its slot of the frame, so its
+ * next step writes the response in place.
+ */
+void
+_mongosql_auth_frame_begin(mongosql_auth_frame_t *frame,
+                           mongosql_auth_conversation_t *convs,
+                           uint32_t n);
+
+/*
+ * Writes the header in front of each response and closes the gaps left by
+ * responses shorter than their slots, leaving the payload in data[0, len).
+ * The prefix is only sent once.
+ */
+void
+_mongosql_auth_frame_finish(mongosql_auth_frame_t *frame,
+                            mongosql_auth_conversation_t *convs,
+                            uint32_t n);
+
+/*
+ * Points each conversation's in buffer at its message within pkt, which must
+ * outlive the next step, and sets parsed to the bytes the messages took up
+ * unless it is NULL. Sets error and returns FALSE if pkt is malformed or a
+ * message is longer than max_len.
+ */
+my_bool
+_mongosql_auth_frame_decode(const uint8_t *pkt,
+                            size_t pkt_len,
+                            mongosql_auth_conversation_t *convs,
+                            uint32_t n,
+                            size_t max_len,
+                            size_t *parsed,
+                            const char **error);
+
+#endif /* MONGOSQL_AUTH_FRAME_H */
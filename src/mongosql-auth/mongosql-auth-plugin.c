@@ -21,6 +21,116 @@
 #include "mongosql-auth-config.h"
 #include "mongosql-auth.h"
 #include "mongosql-auth-plugin.h"
+#include "mongosql-auth-pool.h"
+#include "mongosql-auth-ticket.h"
+#include "mongoc/mongoc-kdf-scheduler-private.h"
+#include "mongoc/mongoc-scram-cache-private.h"
+#include "mongoc/mongoc-thread-private.h"
+
+/* settings of the SCRAM cache file, from plugin options or the environment */
+static mongoc_mutex_t scram_cache_mutex = MONGOC_MUTEX_INITIALIZER;
+static char *scram_cache_file = NULL;
+static char *scram_cache_key_file = NULL;
+static int scram_cache_ttl = MONGOC_SCRAM_CACHE_FILE_TTL_DEFAULT;
+static my_bool scram_cache_configured = FALSE;
+
+/*
+ * (re)open the SCRAM cache file once both its path and key file are known.
+ * called with scram_cache_mutex held.
+ */
+static int
+_mongosql_auth_open_scram_cache(void)
+{
+    bson_error_t error;
+
+    scram_cache_configured = TRUE;
+
+    if (scram_cache_file == NULL || scram_cache_key_file == NULL) {
+        _mongoc_scram_cache_file_close();
+        return 0;
+    }
+
+    if (!_mongoc_scram_cache_file_open(scram_cache_file, scram_cache_key_file,
+                                       (uint32_t) scram_cache_ttl, &error)) {
+        mongosql_auth_log("%s", error.message);
+        return 1;
+    }
+
+    mongosql_auth_log("Using SCRAM cache file %s", scram_cache_file);
+    return 0;
+}
+
+/* apply the MONGOSQL_AUTH_SCRAM_CACHE_* variables unless options were set */
+static void
+_mongosql_auth_scram_cache_from_env(void)
+{
+    const char *ttl;
+
+    mongoc_mutex_lock(&scram_cache_mutex);
+
+    if (!scram_cache_configured) {
+        if (getenv("MONGOSQL_AUTH_SCRAM_CACHE_FILE")) {
+            scram_cache_file = strdup(getenv("MONGOSQL_AUTH_SCRAM_CACHE_FILE"));
+        }
+        if (getenv("MONGOSQL_AUTH_SCRAM_CACHE_KEY_FILE")) {
+            scram_cache_key_file = strdup(getenv("MONGOSQL_AUTH_SCRAM_CACHE_KEY_FILE"));
+        }
+        ttl = getenv("MONGOSQL_AUTH_SCRAM_CACHE_TTL");
+        if (ttl && atoi(ttl) > 0) {
+            scram_cache_ttl = atoi(ttl);
+        }
+        _mongosql_auth_open_scram_cache();
+    }
+
+    mongoc_mutex_unlock(&scram_cache_mutex);
+}
+
+/* replace a saved path with a copy of value, or clear it if value is empty */
+static void
+_mongosql_auth_set_path(char **path, const char *value)
+{
+    free(*path);
+    *path = strlen(value) ? strdup(value) : NULL;
+}
+
+/* log how the handshake went, keep its ticket and release it */
+static int
+_mongosql_auth_finish(mongosql_auth_t *plugin)
+{
+    mongoc_scram_cache_stats_t cache_stats;
+    mongoc_kdf_scheduler_stats_t kdf_stats;
+    int status;
+
+    _mongosql_auth_save_ticket(plugin);
+
+    status = plugin->status;
+    if (status == CR_OK) {
+        mongosql_auth_log("%s", "Authentication finished successfully");
+    } else {
+        mongosql_auth_log("%s", "Authentication was unsuccessful");
+        mongosql_auth_log("Error message: '%s'", plugin->error_msg);
+    }
+
+    _mongoc_scram_cache_stats(&cache_stats);
+    mongosql_auth_log("SCRAM cache: %llu hits, %llu file hits, %llu coalesced, %llu misses, %llu evictions",
+                      (unsigned long long) cache_stats.hits,
+                      (unsigned long long) cache_stats.file_hits,
+                      (unsigned long long) cache_stats.coalesced,
+                      (unsigned long long) cache_stats.misses,
+                      (unsigned long long) cache_stats.evictions);
+
+    _mongoc_kdf_scheduler_stats(&kdf_stats);
+    mongosql_auth_log("KDF scheduler: %u running, %u queued, %llu waits, %llu us waited, %llu timeouts",
+                      kdf_stats.running,
+                      kdf_stats.queued,
+                      (unsigned long long) kdf_stats.waits,
+                      (unsigned long long) kdf_stats.wait_us,
+                      (unsigned long long) kdf_stats.timeouts);
+
+    _mongosql_auth_destroy(plugin);
+
+    return status;
+}
 
 /**
   Authenticate the client using the MongoDB MySQL Authentication Plugin Protocol.
@@ -35,28 +145,354 @@
 int mongosql_auth(MYSQL_PLUGIN_VIO *vio, MYSQL *mysql)
 {
     mongosql_auth_t plugin;
-    int status;
+
+    _mongosql_auth_scram_cache_from_env();
 
     _mongosql_auth_init(&plugin, vio);
     _mongosql_auth_start(&plugin, mysql->user, mysql->passwd, mysql->host);
+    _mongosql_auth_continue(&plugin);
+
+    return _mongosql_auth_finish(&plugin);
+}
+
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+
+/*
+ * handshakes in progress through the non-blocking entry point, which the
+ * client library calls again with the same connection until they finish
+ */
+typedef struct mongosql_auth_pending_t {
+    MYSQL *mysql;
+    MYSQL_PLUGIN_VIO *vio;
+    mongosql_auth_t plugin;
+    struct mongosql_auth_pending_t *next;
+} mongosql_auth_pending_t;
+
+static mongoc_mutex_t pending_mutex = MONGOC_MUTEX_INITIALIZER;
+static mongosql_auth_pending_t *pending_handshakes = NULL;
+
+/* unlink and return the handshake of mysql, or NULL if it has none */
+static mongosql_auth_pending_t *
+_mongosql_auth_pending_take(MYSQL *mysql)
+{
+    mongosql_auth_pending_t **link;
+    mongosql_auth_pending_t *pending = NULL;
 
-    while (!_mongosql_auth_is_done(&plugin)) {
-        _mongosql_auth_step(&plugin);
-        _mongosql_auth_write_payload(&plugin);
-        _mongosql_auth_read_payload(&plugin);
+    mongoc_mutex_lock(&pending_mutex);
+    for (link = &pending_handshakes; *link; link = &(*link)->next) {
+        if ((*link)->mysql == mysql) {
+            pending = *link;
+            *link = pending->next;
+            break;
+        }
     }
+    mongoc_mutex_unlock(&pending_mutex);
 
-    status = plugin.status;
-    if (status == CR_OK) {
-        mongosql_auth_log("%s", "Authentication finished successfully");
+    return pending;
+}
+
+static void
+_mongosql_auth_pending_put(mongosql_auth_pending_t *pending)
+{
+    mongoc_mutex_lock(&pending_mutex);
+    pending->next = pending_handshakes;
+    pending_handshakes = pending;
+    mongoc_mutex_unlock(&pending_mutex);
+}
+
+/* NULL and "" alike, as the client library treats a missing credential */
+static my_bool
+_mongosql_auth_same_string(const char *a, const char *b)
+{
+    return strcmp(a ? a : "", b ? b : "") == 0;
+}
+
+/*
+ * TRUE if pending is still the handshake of mysql over vio. one over another
+ * vio, or for credentials the connection no longer has, was abandoned and
+ * the connection's handles reused for a new one.
+ */
+static my_bool
+_mongosql_auth_pending_matches(mongosql_auth_pending_t *pending, MYSQL_PLUGIN_VIO *vio, MYSQL *mysql)
+{
+    return pending->vio == vio &&
+           _mongosql_auth_same_string(pending->plugin.host, mysql->host) &&
+           _mongosql_auth_same_string(pending->plugin.user, mysql->user) &&
+           _mongosql_auth_same_string(pending->plugin.password, mysql->passwd);
+}
+
+/* abandon the handshake in progress for mysql, if it has one */
+static void
+_mongosql_auth_pending_abandon(MYSQL *mysql)
+{
+    mongosql_auth_pending_t *pending;
+
+    pending = _mongosql_auth_pending_take(mysql);
+    if (pending) {
+        _mongosql_auth_destroy(&pending->plugin);
+        free(pending);
+    }
+}
+
+/* abandon every handshake in progress */
+static void
+_mongosql_auth_pending_clear(void)
+{
+    mongosql_auth_pending_t *pending;
+
+    mongoc_mutex_lock(&pending_mutex);
+    while ((pending = pending_handshakes) != NULL) {
+        pending_handshakes = pending->next;
+        _mongosql_auth_destroy(&pending->plugin);
+        free(pending);
+    }
+    mongoc_mutex_unlock(&pending_mutex);
+}
+
+/**
+  Authenticate the client without blocking, for connections made with
+  mysql_real_connect_nonblocking().
+
+  The first call for a connection starts the handshake. It returns as soon
+  as the server has yet to send the next packet, or the connection can't
+  take the next one yet, and each further call goes on from there.
+
+  @param vio Provides plugin access to communication channel
+  @param mysql Client connection handler
+  @param result Set to CR_OK or CR_ERROR once the handshake has finished
+
+  @return NET_ASYNC_NOT_READY until the handshake has finished, then
+          NET_ASYNC_COMPLETE.
+*/
+enum net_async_status mongosql_auth_nonblocking(MYSQL_PLUGIN_VIO *vio, MYSQL *mysql, int *result)
+{
+    mongosql_auth_pending_t *pending;
+
+    pending = _mongosql_auth_pending_take(mysql);
+
+    /* the connection's last handshake was abandoned; this is a new one */
+    if (pending && !_mongosql_auth_pending_matches(pending, vio, mysql)) {
+        _mongosql_auth_destroy(&pending->plugin);
+        free(pending);
+        pending = NULL;
+    }
+
+    if (pending == NULL) {
+        pending = calloc(1, sizeof *pending);
+        if (pending == NULL) {
+            *result = CR_ERROR;
+            return NET_ASYNC_COMPLETE;
+        }
+        pending->mysql = mysql;
+        pending->vio = vio;
+
+        _mongosql_auth_scram_cache_from_env();
+
+        _mongosql_auth_init(&pending->plugin, vio);
+        pending->plugin.nonblocking = TRUE;
+        _mongosql_auth_start(&pending->plugin, mysql->user, mysql->passwd, mysql->host);
+    }
+
+    /* only a handshake still going is kept; a failed one ends here too */
+    if (!_mongosql_auth_continue(&pending->plugin) && !_mongosql_auth_has_error(&pending->plugin)) {
+        _mongosql_auth_pending_put(pending);
+        return NET_ASYNC_NOT_READY;
+    }
+
+    *result = _mongosql_auth_finish(&pending->plugin);
+    free(pending);
+    return NET_ASYNC_COMPLETE;
+}
+
+#endif /* MONGOSQL_AUTH_ENABLE_NONBLOCKING */
+
+/**
+  Set a plugin option, through mysql_plugin_options().
+
+  Supported options:
+    worker_threads (int) How many conversations of a handshake may be stepped
+                         at once. Defaults to the number of processors;
+                         1 or 0 steps them one after another.
+    scram_cache_file (const char *) Path of a file that shares derived SCRAM
+                         keys between processes. Used once
+                         scram_cache_key_file is also set; an empty string
+                         turns it off.
+    scram_cache_key_file (const char *) Path of a file holding at least 32
+                         secret bytes that the cache file is encrypted and
+                         authenticated with. Keep it apart from the cache
+                         file.
+    scram_cache_ttl (int) Seconds an entry of the cache file stays valid.
+                         Defaults to one hour.
+    scram_max_iterations (int) The most SCRAM iterations a server may ask
+                         for; more fails the handshake rather than tying up
+                         the thread. Defaults to 1000000; 0 lifts the limit.
+    scram_kdf_budget_ms (int) Milliseconds deriving a SCRAM key may take
+                         before the handshake fails, counting any time
+                         queued for the KDF scheduler. Defaults to 0, no
+                         limit.
+    scram_kdf_cpu_percent (int) The share of the processors, in percent,
+                         that SCRAM key derivations may use at once across
+                         the process; more derivations queue for a turn.
+                         Defaults to 0, no limit.
+    session_tickets (int) 1 keeps the session tickets servers issue after a
+                         SCRAM handshake, and reconnects to the same host as
+                         the same user with a ticket rather than in full,
+                         falling back if the server rejects it. Defaults to
+                         0; setting it to 0 forgets the stored tickets.
+    abandon_handshake (MYSQL *) The connection whose non-blocking handshake
+                         was given up before it finished, e.g. before
+                         closing it; the handshake's secrets are wiped at
+                         once. A new handshake on the same connection with
+                         other credentials also drops the old one.
+
+  The maxIterations and kdfBudgetMS username parameters override
+  scram_max_iterations and scram_kdf_budget_ms for one connection, e.g.
+  "user?maxIterations=100000&kdfBudgetMS=500". The kdfPriority username
+  parameter orders a connection's derivations in the KDF scheduler's queue,
+  highest first; it defaults to 0 and may be negative.
+
+  Without any scram_cache_* option, the MONGOSQL_AUTH_SCRAM_CACHE_FILE,
+  MONGOSQL_AUTH_SCRAM_CACHE_KEY_FILE and MONGOSQL_AUTH_SCRAM_CACHE_TTL
+  environment variables are used instead.
+
+  @return 0 if the option was set, 1 otherwise.
+*/
+int mongosql_auth_options(const char *option, const void *value)
+{
+    int ret = 1;
+
+    if (value == NULL) {
+        return 1;
+    }
+
+    if (strcmp(option, "worker_threads") == 0) {
+        _mongosql_auth_pool_set_size(*(const int *) value);
+        return 0;
+    }
+
+    if (strcmp(option, "scram_max_iterations") == 0 && *(const int *) value >= 0) {
+        _mongoc_scram_set_default_max_iterations((uint32_t) *(const int *) value);
+        return 0;
+    }
+
+    if (strcmp(option, "scram_kdf_budget_ms") == 0 && *(const int *) value >= 0) {
+        _mongoc_scram_set_default_kdf_budget((uint32_t) *(const int *) value);
+        return 0;
+    }
+
+    if (strcmp(option, "scram_kdf_cpu_percent") == 0 && *(const int *) value >= 0) {
+        _mongoc_kdf_scheduler_set_cpu_percent(*(const int *) value);
+        return 0;
+    }
+
+    if (strcmp(option, "session_tickets") == 0) {
+        _mongosql_auth_ticket_set_enabled(*(const int *) value != 0);
+        return 0;
+    }
+
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    if (strcmp(option, "abandon_handshake") == 0) {
+        _mongosql_auth_pending_abandon((MYSQL *) value);
+        return 0;
+    }
+#endif
+
+    mongoc_mutex_lock(&scram_cache_mutex);
+    if (strcmp(option, "scram_cache_file") == 0) {
+        _mongosql_auth_set_path(&scram_cache_file, (const char *) value);
+        ret = _mongosql_auth_open_scram_cache();
+    } else if (strcmp(option, "scram_cache_key_file") == 0) {
+        _mongosql_auth_set_path(&scram_cache_key_file, (const char *) value);
+        ret = _mongosql_auth_open_scram_cache();
+    } else if (strcmp(option, "scram_cache_ttl") == 0 && *(const int *) value > 0) {
+        scram_cache_ttl = *(const int *) value;
+        ret = _mongosql_auth_open_scram_cache();
+    }
+    mongoc_mutex_unlock(&scram_cache_mutex);
+
+    return ret;
+}
+
+/**
+  Read a plugin metric, through mysql_plugin_get_option().
+
+  Supported options:
+    scram_kdf_slots (int) How many SCRAM key derivations may run at once,
+                         or 0 without a limit.
+    scram_kdf_running (int) Derivations running now.
+    scram_kdf_queue_depth (int) Derivations queued for a turn now.
+    scram_kdf_max_queue_depth (int) The most derivations ever queued at once.
+    scram_kdf_waits (unsigned long long) Derivations that had to queue.
+    scram_kdf_wait_us (unsigned long long) Microseconds spent queued, in total.
+    scram_kdf_max_wait_us (unsigned long long) The longest time queued.
+    scram_kdf_timeouts (unsigned long long) Derivations whose kdfBudgetMS ran
+                         out while they were queued.
+
+  @return 0 if value was set, 1 otherwise.
+*/
+int mongosql_auth_get_options(const char *option, void *value)
+{
+    mongoc_kdf_scheduler_stats_t stats;
+
+    if (option == NULL || value == NULL) {
+        return 1;
+    }
+
+    _mongoc_kdf_scheduler_stats(&stats);
+
+    if (strcmp(option, "scram_kdf_slots") == 0) {
+        *(int *) value = _mongoc_kdf_scheduler_slots();
+    } else if (strcmp(option, "scram_kdf_running") == 0) {
+        *(int *) value = (int) stats.running;
+    } else if (strcmp(option, "scram_kdf_queue_depth") == 0) {
+        *(int *) value = (int) stats.queued;
+    } else if (strcmp(option, "scram_kdf_max_queue_depth") == 0) {
+        *(int *) value = (int) stats.max_queued;
+    } else if (strcmp(option, "scram_kdf_waits") == 0) {
+        *(unsigned long long *) value = stats.waits;
+    } else if (strcmp(option, "scram_kdf_wait_us") == 0) {
+        *(unsigned long long *) value = stats.wait_us;
+    } else if (strcmp(option, "scram_kdf_max_wait_us") == 0) {
+        *(unsigned long long *) value = stats.max_wait_us;
+    } else if (strcmp(option, "scram_kdf_timeouts") == 0) {
+        *(unsigned long long *) value = stats.timeouts;
     } else {
-        mongosql_auth_log("%s", "Authentication was unsuccessful");
-        mongosql_auth_log("Error message: '%s'", plugin.error_msg);
+        return 1;
     }
 
-    _mongosql_auth_destroy(&plugin);
+    return 0;
+}
 
-    return status;
+/**
+  Release process-wide resources when the client library unloads the plugin,
+  wiping any cached SCRAM secrets, session tickets and the calling thread's
+  pooled crypto contexts, and closing the SASLPrep profile.
+*/
+int mongosql_auth_deinit(void)
+{
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    _mongosql_auth_pending_clear();
+#endif
+    _mongosql_auth_pool_shutdown();
+    _mongoc_scram_cache_clear();
+    mongoc_crypto_cleanup();
+    _mongoc_sasl_prep_cleanup();
+    _mongoc_scram_set_default_max_iterations(MONGOC_SCRAM_MAX_ITERATIONS_DEFAULT);
+    _mongoc_scram_set_default_kdf_budget(0);
+    _mongoc_kdf_scheduler_set_cpu_percent(0);
+    _mongosql_auth_ticket_set_enabled(FALSE);
+
+    mongoc_mutex_lock(&scram_cache_mutex);
+    _mongoc_scram_cache_file_close();
+    free(scram_cache_file);
+    free(scram_cache_key_file);
+    scram_cache_file = NULL;
+    scram_cache_key_file = NULL;
+    scram_cache_ttl = MONGOC_SCRAM_CACHE_FILE_TTL_DEFAULT;
+    scram_cache_configured = FALSE;
+    mongoc_mutex_unlock(&scram_cache_mutex);
+
+    return 0;
 }
 
 mysql_declare_client_plugin(AUTHENTICATION)
@@ -67,7 +503,14 @@ mysql_declare_client_plugin(AUTHENTICATION)
     "Apache License, Version 2.0",
     NULL,
     NULL,
-    NULL,
-    NULL,
+    mongosql_auth_deinit,
+    mongosql_auth_options,
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    /* by name, as newer headers add members ahead of the hooks */
+    .get_options = mongosql_auth_get_options,
+    .authenticate_user = mongosql_auth,
+    .authenticate_user_nonblocking = mongosql_auth_nonblocking
+#else
     mongosql_auth
+#endif
 mysql_end_client_plugin;
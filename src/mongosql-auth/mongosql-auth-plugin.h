@@ -19,7 +19,18 @@
 
 #include <mysql/client_plugin.h>
 #include <stdint.h>
+#include "mongosql-auth.h"
 
 int mongosql_auth(MYSQL_PLUGIN_VIO *vio, MYSQL *mysql);
 
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+enum net_async_status mongosql_auth_nonblocking(MYSQL_PLUGIN_VIO *vio, MYSQL *mysql, int *result);
+#endif
+
+int mongosql_auth_options(const char *option, const void *value);
+
+int mongosql_auth_get_options(const char *option, void *value);
+
+int mongosql_auth_deinit(void);
+
 #endif /* MONGOSQL_AUTH_PLUGIN_H */
@@ -0,0 +1,296 @@
+/*
+ * Copyright 2018 MongoDB Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include "mongosql-auth.h"
+#include "mongosql-auth-pool.h"
+#include "mongoc/mongoc-misc.h"
+#include "mongoc/mongoc-thread-private.h"
+
+static mongoc_mutex_t pool_mutex = MONGOC_MUTEX_INITIALIZER;
+/* signalled when a job is queued or the pool is stopping */
+static mongoc_cond_t pool_work_cond = MONGOC_COND_INITIALIZER;
+/* signalled when a job's last call returns */
+static mongoc_cond_t pool_done_cond = MONGOC_COND_INITIALIZER;
+/* signalled when a stop has joined the threads it stopped */
+static mongoc_cond_t pool_stopped_cond = MONGOC_COND_INITIALIZER;
+
+static int pool_size = MONGOSQL_AUTH_POOL_SIZE_DEFAULT;
+static mongoc_thread_t *pool_threads = NULL;
+static int pool_num_threads = 0;
+static my_bool pool_stopping = FALSE;
+static mongosql_auth_pool_job_t *pool_jobs = NULL;
+
+/* hand out the next arg of the oldest job; the pool mutex must be held */
+static my_bool
+_mongosql_auth_pool_take(mongosql_auth_pool_job_t **job, size_t *i) {
+    mongosql_auth_pool_job_t **link;
+
+    for (link = &pool_jobs; *link; link = &(*link)->next_job) {
+        if ((*link)->next < (*link)->n) {
+            *job = *link;
+            *i = (*link)->next++;
+
+            /* nothing left to hand out, so stop offering it */
+            if ((*link)->next == (*link)->n) {
+                *link = (*link)->next_job;
+            }
+
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/* run one call outside the mutex; the pool mutex must be held */
+static void
+_mongosql_auth_pool_call(mongosql_auth_pool_job_t *job, size_t i) {
+    mongoc_mutex_unlock(&pool_mutex);
+    job->fn(job->args[i]);
+    mongoc_mutex_lock(&pool_mutex);
+
+    if (--job->pending == 0) {
+        mongoc_cond_broadcast(&pool_done_cond);
+    }
+}
+
+MONGOC_THREAD_FUN(_mongosql_auth_pool_worker, arg) {
+    mongosql_auth_pool_job_t *job;
+    size_t i;
+
+    (void) arg;
+
+    mongoc_mutex_lock(&pool_mutex);
+    while (!pool_stopping) {
+        if (_mongosql_auth_pool_take(&job, &i)) {
+            _mongosql_auth_pool_call(job, i);
+        } else {
+            mongoc_cond_wait(&pool_work_cond, &pool_mutex);
+        }
+    }
+    mongoc_mutex_unlock(&pool_mutex);
+
+    MONGOC_THREAD_RETURN;
+}
+
+/* wait out a stop in progress, which drops the mutex while it joins; the pool mutex must be held */
+static void
+_mongosql_auth_pool_wait_stopped(void) {
+    while (pool_stopping) {
+        mongoc_cond_wait(&pool_stopped_cond, &pool_mutex);
+    }
+}
+
+/* stop and join the threads; the pool mutex must be held */
+static void
+_mongosql_auth_pool_stop(void) {
+    mongoc_thread_t *threads;
+    int num_threads;
+    mongosql_auth_pool_job_t *job;
+    size_t i;
+
+    _mongosql_auth_pool_wait_stopped();
+
+    threads = pool_threads;
+    num_threads = pool_num_threads;
+    if (!threads) {
+        return;
+    }
+
+    pool_stopping = TRUE;
+    pool_threads = NULL;
+    pool_num_threads = 0;
+    mongoc_cond_broadcast(&pool_work_cond);
+
+    mongoc_mutex_unlock(&pool_mutex);
+    for (int i = 0; i < num_threads; i++) {
+        mongoc_thread_join(threads[i]);
+    }
+    mongoc_mutex_lock(&pool_mutex);
+
+    free(threads);
+    pool_stopping = FALSE;
+    mongoc_cond_broadcast(&pool_stopped_cond);
+
+    /* submitted jobs don't wait for threads that are gone */
+    while (_mongosql_auth_pool_take(&job, &i)) {
+        _mongosql_auth_pool_call(job, i);
+    }
+}
+
+/* start the threads on first use; the pool mutex must be held */
+static void
+_mongosql_auth_pool_start(int size) {
+    /* threads started now would see the stop and exit, yet stay counted */
+    _mongosql_auth_pool_wait_stopped();
+
+    if (pool_threads || size < 2) {
+        return;
+    }
+
+    /* the calling thread makes up the last member */
+    pool_threads = calloc(size - 1, sizeof(mongoc_thread_t));
+    if (!pool_threads) {
+        return;
+    }
+
+    for (pool_num_threads = 0; pool_num_threads < size - 1; pool_num_threads++) {
+        if (mongoc_thread_create(&pool_threads[pool_num_threads], _mongosql_auth_pool_worker, NULL)) {
+            mongosql_auth_log("Could only start %d of %d pool threads", pool_num_threads, size - 1);
+            break;
+        }
+    }
+
+    mongosql_auth_log("Started worker pool with %d threads", pool_num_threads);
+}
+
+/* queue job behind the others and wake the threads; the pool mutex must be held */
+static void
+_mongosql_auth_pool_queue(mongosql_auth_pool_job_t *job,
+                          mongosql_auth_pool_fn fn,
+                          void **args,
+                          size_t n) {
+    mongosql_auth_pool_job_t **tail;
+
+    job->fn = fn;
+    job->args = args;
+    job->n = n;
+    job->next = 0;
+    job->pending = n;
+    job->next_job = NULL;
+
+    for (tail = &pool_jobs; *tail; tail = &(*tail)->next_job) {
+    }
+    *tail = job;
+    mongoc_cond_broadcast(&pool_work_cond);
+}
+
+void
+_mongosql_auth_pool_set_size(int size) {
+    mongoc_mutex_lock(&pool_mutex);
+    _mongosql_auth_pool_stop();
+    pool_size = size;
+    mongoc_mutex_unlock(&pool_mutex);
+}
+
+int
+_mongosql_auth_pool_size(void) {
+    int size;
+
+    mongoc_mutex_lock(&pool_mutex);
+    size = pool_size;
+    mongoc_mutex_unlock(&pool_mutex);
+
+    if (size == MONGOSQL_AUTH_POOL_SIZE_DEFAULT) {
+        size = _mongoc_cpu_count();
+    }
+
+    return size < 1 ? 1 : size;
+}
+
+void
+_mongosql_auth_pool_run(mongosql_auth_pool_fn fn, void **args, size_t n) {
+    mongosql_auth_pool_job_t job;
+    mongosql_auth_pool_job_t *taken;
+    int size = _mongosql_auth_pool_size();
+    size_t i;
+
+    if (size < 2 || n < 2) {
+        for (i = 0; i < n; i++) {
+            fn(args[i]);
+        }
+        return;
+    }
+
+    mongoc_mutex_lock(&pool_mutex);
+    _mongosql_auth_pool_start(size);
+    _mongosql_auth_pool_queue(&job, fn, args, n);
+
+    /* help out with our own job, then wait for the calls still running */
+    while (job.next < job.n) {
+        if (!_mongosql_auth_pool_take(&taken, &i)) {
+            break;
+        }
+        _mongosql_auth_pool_call(taken, i);
+    }
+
+    while (job.pending > 0) {
+        mongoc_cond_wait(&pool_done_cond, &pool_mutex);
+    }
+
+    mongoc_mutex_unlock(&pool_mutex);
+}
+
+my_bool
+_mongosql_auth_pool_submit(mongosql_auth_pool_job_t *job, mongosql_auth_pool_fn fn, void **args, size_t n) {
+    int size = _mongosql_auth_pool_size();
+
+    if (size < 2 || n < 1) {
+        return FALSE;
+    }
+
+    mongoc_mutex_lock(&pool_mutex);
+    _mongosql_auth_pool_start(size);
+
+    /* nobody would make the calls */
+    if (pool_num_threads == 0) {
+        mongoc_mutex_unlock(&pool_mutex);
+        return FALSE;
+    }
+
+    _mongosql_auth_pool_queue(job, fn, args, n);
+    mongoc_mutex_unlock(&pool_mutex);
+
+    return TRUE;
+}
+
+my_bool
+_mongosql_auth_pool_done(mongosql_auth_pool_job_t *job) {
+    my_bool done;
+
+    mongoc_mutex_lock(&pool_mutex);
+    done = job->pending == 0;
+    mongoc_mutex_unlock(&pool_mutex);
+
+    return done;
+}
+
+void
+_mongosql_auth_pool_wait(mongosql_auth_pool_job_t *job) {
+    mongosql_auth_pool_job_t *taken;
+    size_t i;
+
+    mongoc_mutex_lock(&pool_mutex);
+
+    /* as in _mongosql_auth_pool_run, help out rather than sit idle */
+    while (job->next < job->n && _mongosql_auth_pool_take(&taken, &i)) {
+        _mongosql_auth_pool_call(taken, i);
+    }
+
+    while (job->pending > 0) {
+        mongoc_cond_wait(&pool_done_cond, &pool_mutex);
+    }
+
+    mongoc_mutex_unlock(&pool_mutex);
+}
+
+void
+_mongosql_auth_pool_shutdown(void) {
+    mongoc_mutex_lock(&pool_mutex);
+    _mongosql_auth_pool_stop();
+    mongoc_mutex_unlock(&pool_mutex);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018 MongoDB Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOSQL_AUTH_POOL_H
+#define MONGOSQL_AUTH_POOL_H
+
+#include <my_global.h>
+#include <stddef.h>
+
+/* size the pool from the number of processors */
+#define MONGOSQL_AUTH_POOL_SIZE_DEFAULT -1
+
+typedef void (*mongosql_auth_pool_fn)(void *arg);
+
+/* a batch of calls handed to the pool; its fields belong to the pool */
+typedef struct mongosql_auth_pool_job_t {
+    mongosql_auth_pool_fn fn;
+    void **args;
+    size_t n;
+    /* the next arg to hand out */
+    size_t next;
+    /* calls that have not returned yet */
+    size_t pending;
+    struct mongosql_auth_pool_job_t *next_job;
+} mongosql_auth_pool_job_t;
+
+/*
+ * Sets how many conversations may be stepped at once, counting the thread
+ * that runs the handshake. 1 or 0 disables the pool. Threads that are
+ * already running are stopped, and the new size applies from the next
+ * handshake on.
+ */
+void
+_mongosql_auth_pool_set_size(int size);
+
+/* returns how many conversations may be stepped at once */
+int
+_mongosql_auth_pool_size(void);
+
+/*
+ * Calls fn on each of the n args, spread over the pool's threads and the
+ * calling thread, and returns once every call has returned. With no pool
+ * the calls run one after another on the calling thread.
+ */
+void
+_mongosql_auth_pool_run(mongosql_auth_pool_fn fn, void **args, size_t n);
+
+/*
+ * Hands fn and the n args to the pool's threads as job and returns at once,
+ * without making any of the calls on the calling thread. job and args must
+ * stay put until _mongosql_auth_pool_done returns TRUE or
+ * _mongosql_auth_pool_wait returns. Returns FALSE, and submits nothing, if
+ * the pool is disabled or has no threads.
+ */
+my_bool
+_mongosql_auth_pool_submit(mongosql_auth_pool_job_t *job, mongosql_auth_pool_fn fn, void **args, size_t n);
+
+/* returns TRUE once every call of a submitted job has returned */
+my_bool
+_mongosql_auth_pool_done(mongosql_auth_pool_job_t *job);
+
+/* returns once every call of a submitted job has returned */
+void
+_mongosql_auth_pool_wait(mongosql_auth_pool_job_t *job);
+
+/* stops and joins the pool's threads */
+void
+_mongosql_auth_pool_shutdown(void);
+
+#endif /* MONGOSQL_AUTH_POOL_H */
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2018 MongoDB Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "mongosql-auth-ticket.h"
+#include "mongoc/mongoc-crypto-private.h"
+#include "mongoc/mongoc-memcmp-private.h"
+#include "mongoc/mongoc-misc.h"
+#include "mongoc/mongoc-thread-private.h"
+
+typedef struct mongosql_auth_ticket_entry_t {
+    /* monotonic microseconds the ticket expires at, 0 if the slot is free */
+    int64_t expires;
+    char *host;
+    char *user;
+    /* HMAC-SHA-256 of the password under the ticket's secret */
+    uint8_t password_mac[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+    mongosql_auth_ticket_t ticket;
+} mongosql_auth_ticket_entry_t;
+
+static mongoc_mutex_t ticket_mutex = MONGOC_MUTEX_INITIALIZER;
+static mongosql_auth_ticket_entry_t ticket_store[MONGOSQL_AUTH_TICKET_STORE_SIZE];
+static my_bool ticket_enabled = FALSE;
+
+static void
+_mongosql_auth_ticket_password_mac(const mongosql_auth_ticket_t *ticket,
+                                   const char *password,
+                                   uint8_t *mac) {
+    mongoc_crypto_t crypto;
+
+    if (password == NULL) {
+        password = "";
+    }
+
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+    mongoc_crypto_hmac(&crypto, ticket->secret, (int) ticket->secret_len,
+                       (const unsigned char *) password, (int) strlen(password), mac);
+    mongoc_crypto_destroy(&crypto);
+}
+
+static void
+_mongosql_auth_ticket_wipe(mongosql_auth_ticket_entry_t *entry) {
+    free(entry->host);
+    free(entry->user);
+    memset(entry, 0, sizeof *entry);
+}
+
+/* the entry for host and user, or NULL; called with the mutex held */
+static mongosql_auth_ticket_entry_t *
+_mongosql_auth_ticket_find(const char *host, const char *user) {
+    for (size_t i = 0; i < MONGOSQL_AUTH_TICKET_STORE_SIZE; i++) {
+        mongosql_auth_ticket_entry_t *entry = &ticket_store[i];
+
+        if (entry->expires && strcmp(entry->host, host) == 0 && strcmp(entry->user, user) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+void
+_mongosql_auth_ticket_set_enabled(my_bool enabled) {
+    mongoc_mutex_lock(&ticket_mutex);
+    ticket_enabled = enabled;
+    mongoc_mutex_unlock(&ticket_mutex);
+
+    if (!enabled) {
+        _mongosql_auth_ticket_clear();
+    }
+}
+
+my_bool
+_mongosql_auth_ticket_enabled(void) {
+    my_bool enabled;
+
+    mongoc_mutex_lock(&ticket_mutex);
+    enabled = ticket_enabled;
+    mongoc_mutex_unlock(&ticket_mutex);
+
+    return enabled;
+}
+
+void
+_mongosql_auth_ticket_put(const char *host,
+                          const char *user,
+                          const char *password,
+                          const mongosql_auth_ticket_t *ticket) {
+    mongosql_auth_ticket_entry_t *entry;
+    int64_t now = bson_get_monotonic_time();
+    uint32_t lifetime = ticket->lifetime;
+
+    if (host == NULL) {
+        host = "";
+    }
+    if (lifetime == 0 || ticket->ticket_len == 0 || ticket->ticket_len > MONGOSQL_AUTH_TICKET_MAX_SIZE) {
+        return;
+    }
+    if (lifetime > MONGOSQL_AUTH_TICKET_LIFETIME_MAX) {
+        lifetime = MONGOSQL_AUTH_TICKET_LIFETIME_MAX;
+    }
+
+    mongoc_mutex_lock(&ticket_mutex);
+
+    /* reuse the entry of host and user, else a free or expired slot, else
+     * the one closest to expiring */
+    entry = _mongosql_auth_ticket_find(host, user);
+    for (size_t i = 0; entry == NULL && i < MONGOSQL_AUTH_TICKET_STORE_SIZE; i++) {
+        if (ticket_store[i].expires <= now) {
+            entry = &ticket_store[i];
+        }
+    }
+    if (entry == NULL) {
+        entry = &ticket_store[0];
+        for (size_t i = 1; i < MONGOSQL_AUTH_TICKET_STORE_SIZE; i++) {
+            if (ticket_store[i].expires < entry->expires) {
+                entry = &ticket_store[i];
+            }
+        }
+    }
+    _mongosql_auth_ticket_wipe(entry);
+
+    entry->host = strdup(host);
+    entry->user = strdup(user);
+    if (entry->host && entry->user) {
+        entry->ticket = *ticket;
+        _mongosql_auth_ticket_password_mac(ticket, password, entry->password_mac);
+        entry->expires = now + (int64_t) lifetime * 1000000;
+    } else {
+        _mongosql_auth_ticket_wipe(entry);
+    }
+
+    mongoc_mutex_unlock(&ticket_mutex);
+}
+
+my_bool
+_mongosql_auth_ticket_get(const char *host,
+                          const char *user,
+                          const char *password,
+                          mongosql_auth_ticket_t *ticket) {
+    mongosql_auth_ticket_entry_t *entry;
+    uint8_t password_mac[MONGOC_SCRAM_SHA_256_HASH_SIZE];
+    my_bool found = FALSE;
+
+    if (host == NULL) {
+        host = "";
+    }
+
+    mongoc_mutex_lock(&ticket_mutex);
+
+    entry = _mongosql_auth_ticket_find(host, user);
+    if (entry && entry->expires <= bson_get_monotonic_time()) {
+        _mongosql_auth_ticket_wipe(entry);
+    } else if (entry) {
+        _mongosql_auth_ticket_password_mac(&entry->ticket, password, password_mac);
+        if (mongoc_memcmp(password_mac, entry->password_mac, sizeof password_mac) == 0) {
+            *ticket = entry->ticket;
+            found = TRUE;
+        }
+    }
+
+    mongoc_mutex_unlock(&ticket_mutex);
+
+    return found;
+}
+
+void
+_mongosql_auth_ticket_remove(const char *host, const char *user) {
+    mongosql_auth_ticket_entry_t *entry;
+
+    mongoc_mutex_lock(&ticket_mutex);
+    entry = _mongosql_auth_ticket_find(host ? host : "", user);
+    if (entry) {
+        _mongosql_auth_ticket_wipe(entry);
+    }
+    mongoc_mutex_unlock(&ticket_mutex);
+}
+
+void
+_mongosql_auth_ticket_clear(void) {
+    mongoc_mutex_lock(&ticket_mutex);
+    for (size_t i = 0; i < MONGOSQL_AUTH_TICKET_STORE_SIZE; i++) {
+        _mongosql_auth_ticket_wipe(&ticket_store[i]);
+    }
+    mongoc_mutex_unlock(&ticket_mutex);
+}
+
+void
+_mongosql_auth_ticket_proof(const mongosql_auth_ticket_t *ticket,
+                            const char *label,
+                            const uint8_t *nonce,
+                            size_t nonce_len,
+                            uint8_t *proof) {
+    uint8_t data[8 + MONGOSQL_AUTH_TICKET_NONCE_MAX_SIZE + MONGOSQL_AUTH_TICKET_MAX_SIZE];
+    size_t label_len = strlen(label);
+    mongoc_crypto_t crypto;
+
+    memcpy(data, label, label_len);
+    memcpy(data + label_len, nonce, nonce_len);
+    memcpy(data + label_len + nonce_len, ticket->ticket, ticket->ticket_len);
+
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+    mongoc_crypto_hmac(&crypto, ticket->secret, (int) ticket->secret_len,
+                       data, (int) (label_len + nonce_len + ticket->ticket_len), proof);
+    mongoc_crypto_destroy(&crypto);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018 MongoDB Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MONGOSQL_AUTH_TICKET_H
+#define MONGOSQL_AUTH_TICKET_H
+
+#include <my_global.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mongoc/mongoc-scram.h"
+
+/* the largest ticket and server nonce the client accepts */
+#define MONGOSQL_AUTH_TICKET_MAX_SIZE 512
+#define MONGOSQL_AUTH_TICKET_NONCE_MAX_SIZE 64
+
+/* proofs of possession are HMAC-SHA-256 */
+#define MONGOSQL_AUTH_TICKET_PROOF_SIZE MONGOC_SCRAM_SHA_256_HASH_SIZE
+
+/* the most tickets the process keeps, and the longest it keeps one */
+#define MONGOSQL_AUTH_TICKET_STORE_SIZE 64
+#define MONGOSQL_AUTH_TICKET_LIFETIME_MAX 86400
+
+/*
+ * A session ticket, issued by the server with server-final. The ticket
+ * itself is opaque to the client; the secret comes from the SCRAM exchange
+ * it was issued in, and proves the client holds the ticket without sending
+ * the secret.
+ */
+typedef struct mongosql_auth_ticket_t {
+    uint8_t ticket[MONGOSQL_AUTH_TICKET_MAX_SIZE];
+    size_t ticket_len;
+    uint8_t secret[MONGOC_SCRAM_HASH_MAX_SIZE];
+    size_t secret_len;
+    /* seconds the server will honour the ticket for */
+    uint32_t lifetime;
+} mongosql_auth_ticket_t;
+
+/*
+ * Whether handshakes ask for tickets and present them. Off by default;
+ * turning it off also forgets every stored ticket.
+ */
+void
+_mongosql_auth_ticket_set_enabled(my_bool enabled);
+
+my_bool
+_mongosql_auth_ticket_enabled(void);
+
+/*
+ * Keeps ticket for connections to host as user, replacing any ticket they
+ * already had, until its lifetime runs out. When the store is full the
+ * ticket closest to expiring makes room. The password isn't kept, only an
+ * HMAC of it under the ticket's secret, so a ticket is only presented by
+ * connections given the password it was earned with.
+ */
+void
+_mongosql_auth_ticket_put(const char *host,
+                          const char *user,
+                          const char *password,
+                          const mongosql_auth_ticket_t *ticket);
+
+/* copies the unexpired ticket for host, user and password into ticket */
+my_bool
+_mongosql_auth_ticket_get(const char *host,
+                          const char *user,
+                          const char *password,
+                          mongosql_auth_ticket_t *ticket);
+
+/* forgets the ticket for host and user, once the server rejected it */
+void
+_mongosql_auth_ticket_remove(const char *host, const char *user);
+
+/* wipes every stored ticket */
+void
+_mongosql_auth_ticket_clear(void);
+
+/*
+ * HMAC-SHA-256(secret, label + nonce + ticket): "client" for the proof the
+ * client presents, "server" for the one the server answers with.
+ */
+void
+_mongosql_auth_ticket_proof(const mongosql_auth_ticket_t *ticket,
+                            const char *label,
+                            const uint8_t *nonce,
+                            size_t nonce_len,
+                            uint8_t *proof);
+
+#endif /* MONGOSQL_AUTH_TICKET_H */
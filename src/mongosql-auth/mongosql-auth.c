@@ -17,9 +17,24 @@
 #include <stdarg.h>
 #include <stdlib.h>
 #include "mongosql-auth.h"
+#include "mongosql-auth-pool.h"
+#include "mongosql-auth-ticket.h"
+#include "mongoc/mongoc-memcmp-private.h"
 
 #define MONGOSQL_AUTH_PROTOCOL_MAJOR_VERSION 1
-#define MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION 0
+#define MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION 2
+
+/*
+ * from 1.1 on, auth-data carries the mechanism and the number of
+ * conversations, and the client's first reply holds the first client messages
+ */
+#define MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION_MECHANISM_IN_AUTH_DATA 1
+
+/*
+ * from 1.2 on, a capabilities byte follows the version in auth-data, and the
+ * client's first reply starts with the capabilities it accepts
+ */
+#define MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION_CAPABILITIES 2
 
 void
 mongosql_auth_log(const char *format,...) {
@@ -53,39 +68,512 @@ _mongosql_auth_init(mongosql_auth_t *plugin, MYSQL_PLUGIN_VIO *vio) {
     plugin->error_msg = NULL;
     plugin->conversations = NULL;
     plugin->num_conversations = 0;
+    plugin->minor_version = 0;
+    plugin->capabilities = 0;
+    plugin->early_scrams = NULL;
+    plugin->num_early_scrams = 0;
+    plugin->early_running = FALSE;
+    plugin->background_running = FALSE;
+    plugin->background_scrams = NULL;
+    plugin->num_background_scrams = 0;
+    plugin->background_distinct = NULL;
+    plugin->background_sources = NULL;
+    plugin->host = NULL;
+    plugin->user = NULL;
+    plugin->password = NULL;
+    plugin->resumption_nonce = NULL;
+    plugin->resumption_nonce_len = 0;
+    plugin->presented_ticket = NULL;
+    plugin->issued_ticket = NULL;
+    plugin->resumption_answered = FALSE;
+    plugin->resumed = FALSE;
+    plugin->state = MONGOSQL_AUTH_STATE_READ_AUTH_DATA;
+    plugin->nonblocking = FALSE;
+    plugin->frame.data = NULL;
+    plugin->frame.len = 0;
+    plugin->frame.max = 0;
+    _mongoc_arena_init(&plugin->arena);
 }
 
+static void
+_mongosql_auth_join_early_derivation(mongosql_auth_t *plugin);
+
+static void
+_mongosql_auth_join_background_derivation(mongosql_auth_t *plugin);
+
 void
 _mongosql_auth_destroy(mongosql_auth_t *plugin) {
 
-    /* free strduped strings */
-    free(plugin->error_msg);
+    /* a derivation may still be running if the handshake failed */
+    _mongosql_auth_join_early_derivation(plugin);
+    _mongosql_auth_join_background_derivation(plugin);
 
     /* call the conversation destructors */
     for (unsigned int i=0; i<plugin->num_conversations; i++) {
         _mongosql_auth_conversation_destroy(&plugin->conversations[i]);
     }
 
-    /* free the conversations array */
-    free(plugin->conversations);
+    /* wipe and free everything the handshake allocated, secrets included */
+    _mongoc_arena_destroy(&plugin->arena);
+    plugin->error_msg = NULL;
+    plugin->conversations = NULL;
+    plugin->num_conversations = 0;
+    plugin->resumption_nonce = NULL;
+    plugin->presented_ticket = NULL;
+    plugin->issued_ticket = NULL;
+    plugin->frame.data = NULL;
+}
+
+/*
+ * parse "mechanism\0" and a u32 number of conversations, and set up the
+ * conversations. returns the bytes of pkt parsed, or 0 on error.
+ */
+static size_t
+_mongosql_auth_init_conversations(mongosql_auth_t *plugin,
+                                  const uint8_t *pkt,
+                                  size_t pkt_len,
+                                  const char *username,
+                                  const char *password,
+                                  const char *host) {
+    const char *mechanism = (const char *) pkt;
+    const uint8_t *nul;
+
+    nul = memchr(pkt, '\0', pkt_len);
+    if (nul == NULL || (size_t) (pkt + pkt_len - (nul + 1)) < 4) {
+        _mongosql_auth_set_error(plugin, "received malformed mechanism from server");
+        return 0;
+    }
+
+    /* set the plugin's num_conversations field */
+    memcpy(&plugin->num_conversations, nul+1, 4);
+    mongosql_auth_log("    mechanism: %s", mechanism);
+    mongosql_auth_log("    num_conversations: %u", plugin->num_conversations);
+
+    /* allocate and initialize conversations */
+    mongosql_auth_log("Initializing %d conversation structs", plugin->num_conversations);
+    plugin->conversations = _mongoc_arena_calloc(&plugin->arena, plugin->num_conversations,
+                                                 sizeof(mongosql_auth_conversation_t));
+    if (plugin->conversations == NULL) {
+        plugin->num_conversations = 0;
+        _mongosql_auth_set_error(plugin, "failed to allocate conversations");
+        return 0;
+    }
+    for (unsigned int i=0; i<plugin->num_conversations; i++) {
+        _mongosql_auth_conversation_init(&plugin->conversations[i], username, password, mechanism, host,
+                                         &plugin->arena);
+    }
+
+    /* every conversation uses the same credential, so prepare it only once */
+    for (unsigned int i=1; i<plugin->num_conversations; i++) {
+        _mongosql_auth_conversation_share_credential(&plugin->conversations[i], &plugin->conversations[0]);
+    }
+
+    /* one buffer holds every round's responses */
+    if (!_mongosql_auth_frame_init(&plugin->frame, &plugin->arena, plugin->conversations,
+                                   plugin->num_conversations)) {
+        _mongosql_auth_set_error(plugin, "failed to allocate client response");
+        return 0;
+    }
+
+    return (size_t) (nul + 5 - pkt);
+}
+
+/* collect the SCRAM conversations whose salted password can be derived from in */
+static size_t
+_mongosql_auth_prepare_scram_keys(mongosql_auth_t *plugin, mongoc_scram_t **scrams) {
+    size_t num_scrams = 0;
+
+    for (unsigned int i=0; i<plugin->num_conversations; i++) {
+        if (_mongosql_auth_conversation_prepare_derivation(&plugin->conversations[i])) {
+            scrams[num_scrams++] = &plugin->conversations[i].mechanism.scram;
+        }
+    }
+
+    return num_scrams;
+}
+
+static void
+_mongosql_auth_derive_scram_key_cb(void *scram) {
+    mongoc_scram_t *scrams[1] = {(mongoc_scram_t *) scram};
+
+    _mongoc_scram_derive_batch(scrams, 1);
+}
+
+/*
+ * collect the distinct derivations among scrams: scrams whose servers sent
+ * the same salt and iteration count share one. sets sources[i] to the index
+ * in distinct of the derivation scrams[i] takes, and returns the number.
+ */
+static size_t
+_mongosql_auth_group_scram_keys(mongoc_scram_t **scrams,
+                                size_t num_scrams,
+                                mongoc_scram_t **distinct,
+                                size_t *sources) {
+    size_t num_distinct = 0;
+    size_t j;
+
+    for (size_t i=0; i<num_scrams; i++) {
+        for (j=0; j<num_distinct; j++) {
+            if (_mongoc_scram_same_derivation(scrams[i], distinct[j])) {
+                break;
+            }
+        }
+        if (j == num_distinct) {
+            distinct[num_distinct++] = scrams[i];
+        }
+        sources[i] = j;
+    }
+
+    return num_distinct;
+}
+
+/* hand each scram the secrets of the derivation it was grouped into */
+static void
+_mongosql_auth_share_scram_keys(mongoc_scram_t **scrams,
+                                size_t num_scrams,
+                                mongoc_scram_t **distinct,
+                                const size_t *sources) {
+    for (size_t i=0; i<num_scrams; i++) {
+        if (scrams[i] != distinct[sources[i]]) {
+            _mongoc_scram_copy_derivation(scrams[i], distinct[sources[i]]);
+        }
+    }
+}
+
+/*
+ * derive the prepared salted passwords of scrams. the distinct derivations
+ * run together: spread over the worker pool if there is one, where they
+ * still meet in the PBKDF2 batch queue, or else in one batch so their
+ * iterations can share SIMD lanes.
+ */
+static void
+_mongosql_auth_derive_prepared_scram_keys(mongoc_scram_t **scrams, size_t num_scrams) {
+    mongoc_scram_t **distinct;
+    size_t *sources;
+    size_t num_distinct;
+
+    distinct = malloc(num_scrams * sizeof(mongoc_scram_t *));
+    sources = malloc(num_scrams * sizeof(size_t));
+    if (distinct == NULL || sources == NULL) {
+        goto cleanup;
+    }
+
+    num_distinct = _mongosql_auth_group_scram_keys(scrams, num_scrams, distinct, sources);
+
+    mongosql_auth_log("Deriving %zu SCRAM keys for %zu conversations", num_distinct, num_scrams);
+
+    if (num_distinct > 1 && _mongosql_auth_pool_size() > 1) {
+        _mongosql_auth_pool_run(_mongosql_auth_derive_scram_key_cb, (void **) distinct, num_distinct);
+    } else {
+        _mongoc_scram_derive_batch(distinct, num_distinct);
+    }
+
+    _mongosql_auth_share_scram_keys(scrams, num_scrams, distinct, sources);
+
+cleanup:
+    free(distinct);
+    free(sources);
+}
+
+/*
+ * derive the salted passwords of all SCRAM conversations about to take step 2
+ * before stepping them, so they can share derivations and SIMD lanes. a
+ * lone conversation derives its own in step 2.
+ */
+static void
+_mongosql_auth_derive_scram_keys(mongosql_auth_t *plugin) {
+    mongoc_scram_t **scrams;
+    size_t num_scrams;
+
+    if (plugin->num_conversations < 2) {
+        return;
+    }
+
+    scrams = malloc(plugin->num_conversations * sizeof(mongoc_scram_t *));
+    if (scrams == NULL) {
+        return;
+    }
+
+    num_scrams = _mongosql_auth_prepare_scram_keys(plugin, scrams);
+    if (num_scrams >= 2) {
+        _mongosql_auth_derive_prepared_scram_keys(scrams, num_scrams);
+    }
+
+    free(scrams);
+}
+
+/*
+ * prepare the derivations the server's early salts allow, to be started
+ * once the first reply is on its way. if the salts turn out to differ from
+ * the ones in server-first, step 2 derives again.
+ */
+static void
+_mongosql_auth_prepare_early_derivation(mongosql_auth_t *plugin, const uint8_t *pkt, size_t pkt_len) {
+    const char *error;
+
+    plugin->early_scrams = _mongoc_arena_alloc(&plugin->arena,
+                                               plugin->num_conversations * sizeof(mongoc_scram_t *));
+    if (plugin->early_scrams == NULL) {
+        return;
+    }
+
+    /* the early salts are only a head start, so a malformed set is ignored */
+    if (!_mongosql_auth_frame_decode(pkt, pkt_len, plugin->conversations, plugin->num_conversations,
+                                     MONGOSQL_AUTH_MAX_BUF_SIZE, NULL, &error)) {
+        mongosql_auth_log("Ignoring early salts: %s", error);
+    } else {
+        plugin->num_early_scrams = _mongosql_auth_prepare_scram_keys(plugin, plugin->early_scrams);
+    }
+
+    /* the messages point into auth-data, which the first reply replaces */
+    for (unsigned int i=0; i<plugin->num_conversations; i++) {
+        plugin->conversations[i].in = NULL;
+        plugin->conversations[i].in_len = 0;
+    }
+}
+
+MONGOC_THREAD_FUN(_mongosql_auth_early_derivation_thread, arg) {
+    mongosql_auth_t *plugin = (mongosql_auth_t *) arg;
+
+    _mongosql_auth_derive_prepared_scram_keys(plugin->early_scrams, plugin->num_early_scrams);
+
+    MONGOC_THREAD_RETURN;
+}
+
+/*
+ * hand the derivation of the prepared scrams to the worker pool, so that a
+ * non-blocking handshake can go on polling rather than block on it. returns
+ * FALSE, with nothing started, if the pool has no threads to run it.
+ */
+static my_bool
+_mongosql_auth_start_background_derivation(mongosql_auth_t *plugin, mongoc_scram_t **scrams, size_t num_scrams) {
+    size_t num_distinct;
+
+    plugin->background_distinct = _mongoc_arena_alloc(&plugin->arena, num_scrams * sizeof(mongoc_scram_t *));
+    plugin->background_sources = _mongoc_arena_alloc(&plugin->arena, num_scrams * sizeof(size_t));
+    if (plugin->background_distinct == NULL || plugin->background_sources == NULL) {
+        return FALSE;
+    }
+
+    num_distinct = _mongosql_auth_group_scram_keys(scrams, num_scrams, plugin->background_distinct,
+                                                   plugin->background_sources);
+
+    if (!_mongosql_auth_pool_submit(&plugin->background_job, _mongosql_auth_derive_scram_key_cb,
+                                    (void **) plugin->background_distinct, num_distinct)) {
+        return FALSE;
+    }
+
+    mongosql_auth_log("Deriving %zu SCRAM keys for %zu conversations in the background", num_distinct, num_scrams);
+    plugin->background_scrams = scrams;
+    plugin->num_background_scrams = num_scrams;
+    plugin->background_running = TRUE;
+    return TRUE;
+}
+
+/* returns TRUE once no background derivation is running, sharing out its keys */
+static my_bool
+_mongosql_auth_background_derivation_done(mongosql_auth_t *plugin) {
+    if (!plugin->background_running) {
+        return TRUE;
+    }
+
+    if (!_mongosql_auth_pool_done(&plugin->background_job)) {
+        return FALSE;
+    }
+
+    _mongosql_auth_share_scram_keys(plugin->background_scrams, plugin->num_background_scrams,
+                                    plugin->background_distinct, plugin->background_sources);
+    plugin->background_running = FALSE;
+    return TRUE;
+}
+
+/* wait for the background derivation before its scrams go away */
+static void
+_mongosql_auth_join_background_derivation(mongosql_auth_t *plugin) {
+    if (!plugin->background_running) {
+        return;
+    }
+
+    _mongosql_auth_pool_wait(&plugin->background_job);
+    plugin->background_running = FALSE;
+}
+
+/*
+ * in a non-blocking handshake, prepare the derivations step 2 needs and hand
+ * them to the worker pool, a lone conversation's included. returns TRUE if
+ * the handshake has to wait for a derivation before it steps; with no pool,
+ * the prepared derivations run here, as they would in a blocking handshake.
+ */
+static my_bool
+_mongosql_auth_derive_in_background(mongosql_auth_t *plugin) {
+    mongoc_scram_t **scrams;
+    size_t num_scrams;
+
+    /* the one started from early salts */
+    if (plugin->background_running) {
+        return TRUE;
+    }
+
+    /* with no pool to poll, early salts were derived on a thread of their own */
+    _mongosql_auth_join_early_derivation(plugin);
+
+    if (_mongosql_auth_has_error(plugin) || plugin->num_conversations == 0) {
+        return FALSE;
+    }
+
+    scrams = _mongoc_arena_alloc(&plugin->arena, plugin->num_conversations * sizeof(mongoc_scram_t *));
+    if (scrams == NULL) {
+        return FALSE;
+    }
+
+    num_scrams = _mongosql_auth_prepare_scram_keys(plugin, scrams);
+    if (num_scrams == 0) {
+        return FALSE;
+    }
+
+    if (_mongosql_auth_start_background_derivation(plugin, scrams, num_scrams)) {
+        return TRUE;
+    }
+
+    _mongosql_auth_derive_prepared_scram_keys(scrams, num_scrams);
+    return FALSE;
+}
+
+/* start deriving the early salts' keys in the background */
+static void
+_mongosql_auth_start_early_derivation(mongosql_auth_t *plugin) {
+    if (plugin->num_early_scrams == 0 || plugin->early_running) {
+        return;
+    }
+
+    /* a non-blocking handshake polls the pool for it instead of joining a thread */
+    if (plugin->nonblocking &&
+        _mongosql_auth_start_background_derivation(plugin, plugin->early_scrams, plugin->num_early_scrams)) {
+        plugin->num_early_scrams = 0;
+        return;
+    }
+
+    mongosql_auth_log("Deriving the SCRAM keys of %zu conversations from early salts", plugin->num_early_scrams);
+    if (mongoc_thread_create(&plugin->early_thread, _mongosql_auth_early_derivation_thread, plugin) == 0) {
+        plugin->early_running = TRUE;
+    } else {
+        /* derive in the foreground rather than not at all */
+        _mongosql_auth_derive_prepared_scram_keys(plugin->early_scrams, plugin->num_early_scrams);
+        plugin->num_early_scrams = 0;
+    }
+}
+
+/* wait for the early derivation before anything reads its results */
+static void
+_mongosql_auth_join_early_derivation(mongosql_auth_t *plugin) {
+    if (!plugin->early_running) {
+        return;
+    }
+
+    mongoc_thread_join(plugin->early_thread);
+    plugin->early_running = FALSE;
+    plugin->num_early_scrams = 0;
+}
+
+/*
+ * copy the server's nonce, [len u32][nonce], which the proofs of a session
+ * ticket cover. returns the bytes of pkt parsed, or 0 on error.
+ */
+static size_t
+_mongosql_auth_read_resumption_nonce(mongosql_auth_t *plugin, const uint8_t *pkt, size_t pkt_len) {
+    uint32_t len;
+
+    if (pkt_len < 4) {
+        _mongosql_auth_set_error(plugin, "received malformed resumption nonce from server");
+        return 0;
+    }
+    memcpy(&len, pkt, 4);
+    if (len > MONGOSQL_AUTH_TICKET_NONCE_MAX_SIZE || pkt_len - 4 < len) {
+        _mongosql_auth_set_error(plugin, "received malformed resumption nonce from server");
+        return 0;
+    }
+
+    plugin->resumption_nonce = _mongoc_arena_alloc(&plugin->arena, len + 1);
+    if (plugin->resumption_nonce == NULL) {
+        _mongosql_auth_set_error(plugin, "failed to allocate resumption nonce");
+        return 0;
+    }
+    memcpy(plugin->resumption_nonce, pkt + 4, len);
+    plugin->resumption_nonce_len = len;
+
+    return 4 + len;
 }
 
-/* execute the first steps of the conversation and update the plugin with auth data */
+/*
+ * add [len u32][ticket][proof] to the first reply's prefix, with the stored
+ * ticket for this host, user and password, or a length of 0 if there is none
+ */
+static void
+_mongosql_auth_present_ticket(mongosql_auth_t *plugin) {
+    uint8_t *prefix = plugin->frame.data + plugin->frame.prefix_len;
+    mongosql_auth_ticket_t *ticket;
+    uint32_t len = 0;
+
+    ticket = _mongoc_arena_alloc(&plugin->arena, sizeof *ticket);
+    if (ticket && _mongosql_auth_ticket_get(plugin->host, plugin->user, plugin->password, ticket)) {
+        mongosql_auth_log("Presenting a session ticket of %zu bytes", ticket->ticket_len);
+        len = (uint32_t) ticket->ticket_len;
+        memcpy(prefix + 4, ticket->ticket, len);
+        _mongosql_auth_ticket_proof(ticket, "client", plugin->resumption_nonce,
+                                    plugin->resumption_nonce_len, prefix + 4 + len);
+        plugin->frame.prefix_len += len + MONGOSQL_AUTH_TICKET_PROOF_SIZE;
+        plugin->presented_ticket = ticket;
+    }
+
+    memcpy(prefix, &len, 4);
+    plugin->frame.prefix_len += 4;
+}
+
+/* copy str into the handshake's arena; NULL stays NULL. returns FALSE if out of memory */
+static my_bool
+_mongosql_auth_copy_string(mongosql_auth_t *plugin, const char **copy, const char *str) {
+    *copy = str ? _mongoc_arena_strdup(&plugin->arena, str) : NULL;
+    return str == NULL || *copy != NULL;
+}
+
+/*
+ * the handshake starts with reading auth-data, and the credentials are copied
+ * for the conversations it sets up, so that a non-blocking handshake doesn't
+ * depend on the connection's strings between calls
+ */
 void
 _mongosql_auth_start(mongosql_auth_t *plugin,
                      const char *username,
                      const char *password,
                      const char *host) {
-    uint8_t *pkt;
-    int pkt_len;
+    plugin->state = MONGOSQL_AUTH_STATE_READ_AUTH_DATA;
+    if (!_mongosql_auth_copy_string(plugin, &plugin->host, host) ||
+        !_mongosql_auth_copy_string(plugin, &plugin->user, username) ||
+        !_mongosql_auth_copy_string(plugin, &plugin->password, password)) {
+        _mongosql_auth_set_error(plugin, "failed to copy the connection's credentials");
+        return;
+    }
+    mongosql_auth_log("%s", "Reading auth-data from server");
+}
+
+/*
+ * set up the conversations from auth-data. a 1.1 server sends the mechanism
+ * with auth-data, so the client-first messages go out in the client's first
+ * reply; a 1.0 server takes an empty reply first, and a round trip more. a
+ * 1.2 server also offers capabilities.
+ */
+static void
+_mongosql_auth_read_auth_data(mongosql_auth_t *plugin, const uint8_t *pkt, int pkt_len) {
+    const char *username = plugin->user;
+    const char *password = plugin->password;
+    const char *host = plugin->host;
     uint8_t major_version;
     uint8_t minor_version;
-    char *mechanism;
+    uint8_t offered;
+    size_t parsed;
+    size_t pos;
 
-    /* read auth-data */
-    mongosql_auth_log("%s", "Reading auth-data from server");
-    pkt_len = plugin->vio->read_packet(plugin->vio, &pkt);
-    if (pkt_len < 0) {
+    if (pkt_len < 2) {
         _mongosql_auth_set_error(plugin, "failed reading auth-data from initial handshake");
         return;
     }
@@ -97,46 +585,82 @@ _mongosql_auth_start(mongosql_auth_t *plugin,
     mongosql_auth_log("Client protocol version: %d.%d", MONGOSQL_AUTH_PROTOCOL_MAJOR_VERSION,
                                                         MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION);
 
-    /* validate protocol version */
+    /* validate protocol version; older minor versions are spoken as well */
     if (major_version != MONGOSQL_AUTH_PROTOCOL_MAJOR_VERSION ||
-        minor_version != MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION) {
+        minor_version > MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION) {
         _mongosql_auth_set_error(plugin, "server protocol version incompatible with client protocol version");
         return;
     }
+    plugin->minor_version = minor_version;
 
-    /* write 0 bytes */
-    mongosql_auth_log("%s", "Writing empty response to server");
-    if (plugin->vio->write_packet(plugin->vio, (const unsigned char *) "", 1)) {
-        _mongosql_auth_set_error(plugin, "failed while reading zero-byte response to server");
+    if (minor_version >= MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION_CAPABILITIES) {
+        if (pkt_len < 3) {
+            _mongosql_auth_set_error(plugin, "failed reading capabilities from initial handshake");
+            return;
+        }
+
+        mongosql_auth_log("%s", "Reading mechanism from auth-data");
+        parsed = _mongosql_auth_init_conversations(plugin, pkt+3, (size_t) pkt_len - 3, username, password,
+                                                   host);
+        if (parsed == 0) {
+            return;
+        }
+        pos = 3 + parsed;
+
+        /* accept what we understand of what the server offers. tickets are
+         * bound to SCRAM's secrets, and only used when turned on. */
+        offered = pkt[2];
+        plugin->capabilities = offered & MONGOSQL_AUTH_CAPABILITIES;
+        if (!_mongosql_auth_ticket_enabled() || username == NULL || plugin->num_conversations == 0 ||
+            !_mongosql_auth_conversation_is_scram(&plugin->conversations[0])) {
+            plugin->capabilities &= ~MONGOSQL_AUTH_CAPABILITY_RESUMPTION;
+        }
+        mongosql_auth_log("Capabilities: server 0x%02x, agreed 0x%02x", offered, plugin->capabilities);
+
+        /* the nonce is sent whenever resumption is offered, accepted or not */
+        if (offered & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+            parsed = _mongosql_auth_read_resumption_nonce(plugin, pkt+pos, (size_t) pkt_len - pos);
+            if (parsed == 0) {
+                return;
+            }
+            pos += parsed;
+        }
+
+        /* the agreed capabilities lead the first reply, then the ticket */
+        plugin->frame.prefix_len = 1;
+        plugin->frame.data[0] = plugin->capabilities;
+        if (plugin->capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+            _mongosql_auth_present_ticket(plugin);
+        }
+
+        /* a resumed handshake needs no keys, and shouldn't wait for them */
+        if ((plugin->capabilities & MONGOSQL_AUTH_CAPABILITY_EARLY_SALT) && plugin->presented_ticket == NULL) {
+            _mongosql_auth_prepare_early_derivation(plugin, pkt+pos, (size_t) pkt_len - pos);
+        }
         return;
     }
 
-    /* read first auth-more-data */
-    mongosql_auth_log("%s", "Reading first auth-more-data from server");
-    pkt_len = plugin->vio->read_packet(plugin->vio, &pkt);
-    if (pkt_len < 0) {
-        _mongosql_auth_set_error(plugin, "failed while reading first auth-more-data");
+    if (minor_version >= MONGOSQL_AUTH_PROTOCOL_MINOR_VERSION_MECHANISM_IN_AUTH_DATA) {
+        mongosql_auth_log("%s", "Reading mechanism from auth-data");
+        _mongosql_auth_init_conversations(plugin, pkt+2, (size_t) pkt_len - 2, username, password, host);
         return;
     }
 
-    mechanism = (char*) pkt;
-    /* set the plugin's num_conversations field */
-    memcpy(&plugin->num_conversations, pkt+strlen(mechanism)+1, 4);
-    mongosql_auth_log("    mechanism: %s", mechanism);
-    mongosql_auth_log("    num_conversations: %u", plugin->num_conversations);
+    /* write 0 bytes, then read the mechanism from the first auth-more-data */
+    mongosql_auth_log("%s", "Writing empty response to server");
+    plugin->state = MONGOSQL_AUTH_STATE_WRITE_EMPTY_RESPONSE;
+}
 
-    /* allocate and initialize conversations */
-    mongosql_auth_log("Initializing %d conversation structs", plugin->num_conversations);
-    plugin->conversations = calloc(plugin->num_conversations, sizeof(mongosql_auth_conversation_t));
-    for (unsigned int i=0; i<plugin->num_conversations; i++) {
-        _mongosql_auth_conversation_init(&plugin->conversations[i], username, password, mechanism, host);
-    }
+static void
+_mongosql_auth_conversation_step_cb(void *conv) {
+    _mongosql_auth_conversation_step((mongosql_auth_conversation_t *) conv);
 }
 
 /* read server challenge, process it, send response */
 void
 _mongosql_auth_step(mongosql_auth_t *plugin) {
     mongosql_auth_conversation_t *conv;
+    void **args;
 
     /* if there is an error, stop */
     if (_mongosql_auth_has_error(plugin)) {
@@ -145,6 +669,25 @@ _mongosql_auth_step(mongosql_auth_t *plugin) {
 
     mongosql_auth_log("%s", "Stepping mongosql_auth protocol");
 
+    _mongosql_auth_join_early_derivation(plugin);
+    _mongosql_auth_derive_scram_keys(plugin);
+
+    /* the conversations write their responses straight into the frame */
+    _mongosql_auth_frame_begin(&plugin->frame, plugin->conversations, plugin->num_conversations);
+
+    /* step the conversations concurrently on the worker pool if there is one */
+    if (plugin->num_conversations > 1 && _mongosql_auth_pool_size() > 1) {
+        args = malloc(plugin->num_conversations * sizeof(void *));
+        if (args != NULL) {
+            for (unsigned int i=0; i<plugin->num_conversations; i++) {
+                args[i] = &plugin->conversations[i];
+            }
+            _mongosql_auth_pool_run(_mongosql_auth_conversation_step_cb, args, plugin->num_conversations);
+            free(args);
+            return;
+        }
+    }
+
     /* step each individual conversation */
     for (unsigned int i=0; i<plugin->num_conversations; i++) {
         conv = &plugin->conversations[i];
@@ -152,101 +695,330 @@ _mongosql_auth_step(mongosql_auth_t *plugin) {
     }
 }
 
-/* read data from the wire and split it up into individual conversations */
-void
-_mongosql_auth_read_payload(mongosql_auth_t *plugin) {
-    unsigned char *pkt;
-    int pkt_len;
-    mongosql_auth_conversation_t *conv;
+/*
+ * read the leading byte of the server's first reply: 1 and the server's
+ * proof if it accepted the presented ticket, 0 if the full handshake goes on
+ */
+static my_bool
+_mongosql_auth_read_resumption(mongosql_auth_t *plugin, const uint8_t *pkt, size_t pkt_len) {
+    uint8_t proof[MONGOSQL_AUTH_TICKET_PROOF_SIZE];
+
+    if (pkt_len < 1) {
+        _mongosql_auth_set_error(plugin, "received truncated payload");
+        return FALSE;
+    }
+
+    if (pkt[0] == 0) {
+        if (plugin->presented_ticket) {
+            mongosql_auth_log("%s", "Server rejected the session ticket, authenticating in full");
+            _mongosql_auth_ticket_remove(plugin->host, plugin->user);
+            plugin->presented_ticket = NULL;
+        }
+        return TRUE;
+    }
+
+    if (plugin->presented_ticket == NULL || pkt_len != 1 + MONGOSQL_AUTH_TICKET_PROOF_SIZE) {
+        _mongosql_auth_set_error(plugin, "received unexpected session resumption from server");
+        return FALSE;
+    }
+
+    _mongosql_auth_ticket_proof(plugin->presented_ticket, "server", plugin->resumption_nonce,
+                                plugin->resumption_nonce_len, proof);
+    if (mongoc_memcmp(proof, pkt + 1, sizeof proof) != 0) {
+        _mongosql_auth_ticket_remove(plugin->host, plugin->user);
+        _mongosql_auth_set_error(plugin, "could not verify the server's session resumption proof");
+        return FALSE;
+    }
+
+    mongosql_auth_log("%s", "Server accepted the session ticket");
+    plugin->resumed = TRUE;
+    return TRUE;
+}
 
-    /* if we are done, we don't read another server payload */
-    if (_mongosql_auth_is_done(plugin)) {
+/* read the [len u32][ticket][lifetime u32] that ends a payload of a full handshake */
+static void
+_mongosql_auth_read_issued_ticket(mongosql_auth_t *plugin, const uint8_t *pkt, size_t pkt_len) {
+    mongosql_auth_ticket_t *ticket;
+    uint32_t len;
+
+    if (pkt_len < 4) {
+        _mongosql_auth_set_error(plugin, "received malformed session ticket from server");
+        return;
+    }
+    memcpy(&len, pkt, 4);
+    if (len == 0) {
+        return;
+    }
+    if (len > MONGOSQL_AUTH_TICKET_MAX_SIZE || pkt_len - 4 < (size_t) len + 4) {
+        _mongosql_auth_set_error(plugin, "received malformed session ticket from server");
         return;
     }
 
-    mongosql_auth_log("%s", "Reading payload from server");
+    /* kept once step 3 has verified the server that issued it */
+    ticket = _mongoc_arena_calloc(&plugin->arena, 1, sizeof *ticket);
+    if (ticket == NULL) {
+        return;
+    }
+    memcpy(ticket->ticket, pkt + 4, len);
+    ticket->ticket_len = len;
+    memcpy(&ticket->lifetime, pkt + 4 + len, 4);
+    plugin->issued_ticket = ticket;
+}
+
+/* split a payload read from the wire up into individual conversations */
+static void
+_mongosql_auth_read_payload(mongosql_auth_t *plugin, const uint8_t *pkt, int pkt_len) {
+    const char *error;
+    size_t parsed;
 
-    /* read server reply */
-    pkt_len = plugin->vio->read_packet(plugin->vio, &pkt);
     if (pkt_len < 0) {
         _mongosql_auth_set_error(plugin, "failed reading payload from server");
         return;
     }
 
-    /* take the server reply and populate each conversation's buffer */
-    for(unsigned int i=0; i<plugin->num_conversations; i++) {
-        conv = &plugin->conversations[i];
-        memcpy(&conv->buf_len, pkt, 4);
-        mongosql_auth_log("received %zu bytes from server", conv->buf_len);
-        if (conv->buf_len > MONGOSQL_AUTH_MAX_BUF_SIZE) {
-            _mongosql_auth_set_error(plugin, "received data size too large");
-            return;
-        }
-        // This buffer will be the responsibility of its receiver to free.
-        conv->buf = realloc(conv->buf, conv->buf_len);
-        if (conv->buf == NULL) {
-            _mongosql_auth_set_error(plugin, "failed to allocate receive buffer");
+    if ((plugin->capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) && !plugin->resumption_answered) {
+        plugin->resumption_answered = TRUE;
+        if (!_mongosql_auth_read_resumption(plugin, pkt, (size_t) pkt_len) || plugin->resumed) {
             return;
         }
+        pkt++;
+        pkt_len--;
+    }
 
-        pkt += 4;
-        memcpy(conv->buf, pkt, conv->buf_len);
-        pkt += conv->buf_len;
+    /*
+     * point each conversation at its message in the server reply. the packet
+     * stays valid until the next read or write, by which time the
+     * conversations have stepped past it.
+     */
+    if (!_mongosql_auth_frame_decode(pkt, (size_t) pkt_len, plugin->conversations,
+                                     plugin->num_conversations, MONGOSQL_AUTH_MAX_BUF_SIZE,
+                                     &parsed, &error)) {
+        _mongosql_auth_set_error(plugin, error);
+        return;
+    }
+
+    if (plugin->capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+        _mongosql_auth_read_issued_ticket(plugin, pkt + parsed, (size_t) pkt_len - parsed);
+    }
+
+    for (unsigned int i=0; i<plugin->num_conversations; i++) {
+        mongosql_auth_log("received %zu bytes from server", plugin->conversations[i].in_len);
     }
 }
 
-/* bundle up data from individual conversations and send it on the wire */
-void
-_mongosql_auth_write_payload(mongosql_auth_t *plugin) {
-    int err;
-    mongosql_auth_conversation_t *conv;
-    uint32_t i;
-    size_t mongosql_auth_data_len;
-    uint8_t *mongosql_auth_data;
-    uint8_t *conversation_data;
+/*
+ * whether the server already considers the handshake finished: it skips the
+ * empty exchange, and every conversation has finished without a response
+ */
+static my_bool
+_mongosql_auth_skips_empty_exchange(mongosql_auth_t *plugin) {
+    if (!(plugin->capabilities & MONGOSQL_AUTH_CAPABILITY_SKIP_EMPTY_EXCHANGE)) {
+        return FALSE;
+    }
 
+    for (unsigned int i=0; i<plugin->num_conversations; i++) {
+        if (!_mongosql_auth_conversation_is_done(&plugin->conversations[i]) ||
+            plugin->conversations[i].out_len > 0) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/*
+ * bundle up data from individual conversations into the frame. returns FALSE
+ * if there is nothing to send on the wire.
+ */
+static my_bool
+_mongosql_auth_prepare_payload(mongosql_auth_t *plugin) {
     /* if there is an error, stop */
     if (_mongosql_auth_has_error(plugin)) {
         mongosql_auth_log("%s", "Not writing payload: error already encountered");
-        return;
+        return FALSE;
     }
 
+    if (_mongosql_auth_skips_empty_exchange(plugin)) {
+        mongosql_auth_log("%s", "Not writing payload: server finished on server-final");
+        return FALSE;
+    }
+
+    /* derive from the early salts while this round trip is in flight */
+    _mongosql_auth_start_early_derivation(plugin);
+
     mongosql_auth_log("%s", "Writing payload to server");
 
-    // To allocate a buffer for auth protocol payload, calulate the total size of all conversations.
-    // Each buffer will be a different size.
-    mongosql_auth_data_len = 0;
-    for (i = 0; i < plugin->num_conversations; i++) {
-        mongosql_auth_data_len += plugin->conversations[i].buf_len + 5;
+    /* the responses are already in the frame; add their headers */
+    _mongosql_auth_frame_finish(&plugin->frame, plugin->conversations, plugin->num_conversations);
+    return TRUE;
+}
+
+/*
+ * read a packet into pkt and pkt_len, which is negative if the read failed.
+ * returns FALSE if the handshake runs without blocking and the packet hasn't
+ * arrived yet.
+ */
+static my_bool
+_mongosql_auth_vio_read(mongosql_auth_t *plugin, unsigned char **pkt, int *pkt_len) {
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    if (plugin->nonblocking) {
+        switch (plugin->vio->read_packet_nonblocking(plugin->vio, pkt, pkt_len)) {
+        case NET_ASYNC_NOT_READY:
+            return FALSE;
+        case NET_ASYNC_COMPLETE:
+            return TRUE;
+        default:
+            *pkt_len = -1;
+            return TRUE;
+        }
     }
-    mongosql_auth_data = malloc(mongosql_auth_data_len);
+#endif
 
-    /*
-     * for each conversation, take the client message and
-     * populate the corresponding piece of mongosql_auth_data
-     */
-    conversation_data = mongosql_auth_data;
-    for(i=0; i<plugin->num_conversations; i++) {
-        conv = &plugin->conversations[i];
+    *pkt_len = plugin->vio->read_packet(plugin->vio, pkt);
+    return TRUE;
+}
+
+/*
+ * write pkt, setting err if the write failed. returns FALSE if the handshake
+ * runs without blocking and the vio can't take all of it yet; the same
+ * packet is then written again by the next call.
+ */
+static my_bool
+_mongosql_auth_vio_write(mongosql_auth_t *plugin, const uint8_t *pkt, size_t pkt_len, int *err) {
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    if (plugin->nonblocking) {
+        switch (plugin->vio->write_packet_nonblocking(plugin->vio, pkt, (int) pkt_len, err)) {
+        case NET_ASYNC_NOT_READY:
+            return FALSE;
+        case NET_ASYNC_COMPLETE:
+            return TRUE;
+        default:
+            *err = 1;
+            return TRUE;
+        }
+    }
+#endif
+
+    *err = plugin->vio->write_packet(plugin->vio, pkt, (int) pkt_len);
+    return TRUE;
+}
+
+my_bool
+_mongosql_auth_continue(mongosql_auth_t *plugin) {
+    unsigned char *pkt;
+    int pkt_len;
+    int err;
 
-        memcpy(conversation_data, &conv->done, 1);
-        memcpy(conversation_data+1, &conv->buf_len, 4);
-        memcpy(conversation_data+5, conv->buf, conv->buf_len);
+    while (plugin->state != MONGOSQL_AUTH_STATE_DONE) {
+        if (_mongosql_auth_has_error(plugin)) {
+            plugin->state = MONGOSQL_AUTH_STATE_DONE;
+            break;
+        }
+
+        switch (plugin->state) {
+        case MONGOSQL_AUTH_STATE_READ_AUTH_DATA:
+            if (!_mongosql_auth_vio_read(plugin, &pkt, &pkt_len)) {
+                return FALSE;
+            }
+            plugin->state = MONGOSQL_AUTH_STATE_STEP;
+            _mongosql_auth_read_auth_data(plugin, pkt, pkt_len);
+            break;
+
+        case MONGOSQL_AUTH_STATE_WRITE_EMPTY_RESPONSE:
+            if (!_mongosql_auth_vio_write(plugin, (const uint8_t *) "", 1, &err)) {
+                return FALSE;
+            }
+            if (err) {
+                _mongosql_auth_set_error(plugin, "failed while reading zero-byte response to server");
+            }
+            mongosql_auth_log("%s", "Reading first auth-more-data from server");
+            plugin->state = MONGOSQL_AUTH_STATE_READ_MECHANISM;
+            break;
+
+        case MONGOSQL_AUTH_STATE_READ_MECHANISM:
+            if (!_mongosql_auth_vio_read(plugin, &pkt, &pkt_len)) {
+                return FALSE;
+            }
+            if (pkt_len < 0) {
+                _mongosql_auth_set_error(plugin, "failed while reading first auth-more-data");
+            } else {
+                _mongosql_auth_init_conversations(plugin, pkt, (size_t) pkt_len, plugin->user,
+                                                  plugin->password, plugin->host);
+            }
+            plugin->state = MONGOSQL_AUTH_STATE_STEP;
+            break;
+
+        case MONGOSQL_AUTH_STATE_STEP:
+            /* rather than block on a derivation, come back once the pool has done it */
+            if (plugin->nonblocking && _mongosql_auth_derive_in_background(plugin)) {
+                plugin->state = MONGOSQL_AUTH_STATE_DERIVE;
+                return FALSE;
+            }
+            _mongosql_auth_step(plugin);
+            plugin->state = _mongosql_auth_prepare_payload(plugin) ? MONGOSQL_AUTH_STATE_WRITE_PAYLOAD
+                                                                   : MONGOSQL_AUTH_STATE_DONE;
+            break;
+
+        case MONGOSQL_AUTH_STATE_DERIVE:
+            if (!_mongosql_auth_background_derivation_done(plugin)) {
+                return FALSE;
+            }
+            plugin->state = MONGOSQL_AUTH_STATE_STEP;
+            break;
+
+        case MONGOSQL_AUTH_STATE_WRITE_PAYLOAD:
+            if (!_mongosql_auth_vio_write(plugin, plugin->frame.data, plugin->frame.len, &err)) {
+                return FALSE;
+            }
+            if (err) {
+                _mongosql_auth_set_error(plugin, "failed writing client response");
+            }
+
+            /* if we are done, we don't read another server payload */
+            if (_mongosql_auth_is_done(plugin)) {
+                plugin->state = MONGOSQL_AUTH_STATE_DONE;
+            } else {
+                mongosql_auth_log("%s", "Reading payload from server");
+                plugin->state = MONGOSQL_AUTH_STATE_READ_PAYLOAD;
+            }
+            break;
+
+        case MONGOSQL_AUTH_STATE_READ_PAYLOAD:
+            if (!_mongosql_auth_vio_read(plugin, &pkt, &pkt_len)) {
+                return FALSE;
+            }
+            _mongosql_auth_read_payload(plugin, pkt, pkt_len);
+            plugin->state = _mongosql_auth_is_done(plugin) ? MONGOSQL_AUTH_STATE_DONE
+                                                           : MONGOSQL_AUTH_STATE_STEP;
+            break;
+
+        default:
+            plugin->state = MONGOSQL_AUTH_STATE_DONE;
+            break;
+        }
+    }
+
+    return TRUE;
+}
 
-        conversation_data += conv->buf_len + 5;
+void
+_mongosql_auth_save_ticket(mongosql_auth_t *plugin) {
+    mongosql_auth_ticket_t *ticket = plugin->issued_ticket;
+
+    if (ticket == NULL || plugin->resumed || _mongosql_auth_has_error(plugin)) {
+        return;
     }
 
-    /* write mongosql_auth_data to the wire */
-    err = plugin->vio->write_packet(
-            plugin->vio,
-            mongosql_auth_data,
-            mongosql_auth_data_len);
-    if (err) {
-        _mongosql_auth_set_error(plugin, "failed writing client response");
+    /* the ticket's secret is bound to the first conversation's exchange */
+    ticket->secret_len = _mongoc_scram_resumption_secret(&plugin->conversations[0].mechanism.scram,
+                                                         ticket->secret);
+    if (ticket->secret_len == 0) {
+        return;
     }
 
-    // No need to free the conversation buffers because they will either be realloc'd or destroyed later
-    free (mongosql_auth_data);
+    mongosql_auth_log("Keeping a session ticket of %zu bytes for %u seconds", ticket->ticket_len,
+                      ticket->lifetime);
+    _mongosql_auth_ticket_put(plugin->host, plugin->user, plugin->password, ticket);
 }
 
 void
@@ -254,7 +1026,7 @@ _mongosql_auth_set_error(mongosql_auth_t *plugin, const char *msg) {
     if (_mongosql_auth_has_error(plugin)) {
         return;
     }
-    plugin->error_msg = strdup(msg);
+    plugin->error_msg = _mongoc_arena_strdup(&plugin->arena, msg);
     plugin->status = CR_ERROR;
 }
 
@@ -274,7 +1046,7 @@ _mongosql_auth_has_error(mongosql_auth_t *plugin) {
     for (unsigned int i=0; i<plugin->num_conversations; i++) {
         conv = &plugin->conversations[i];
         if (_mongosql_auth_conversation_has_error(conv)) {
-            plugin->error_msg = strdup(conv->error_msg);
+            plugin->error_msg = _mongoc_arena_strdup(&plugin->arena, conv->error_msg);
             plugin->status = CR_ERROR;
             return TRUE;
         }
@@ -285,7 +1057,7 @@ _mongosql_auth_has_error(mongosql_auth_t *plugin) {
 
 my_bool
 _mongosql_auth_is_done(mongosql_auth_t *plugin) {
-    if (_mongosql_auth_has_error(plugin)) {
+    if (_mongosql_auth_has_error(plugin) || plugin->resumed) {
         return TRUE;
     }
 
@@ -23,15 +23,113 @@
 #include <stdint.h>
 #include "mongosql-auth-config.h"
 #include "mongosql-auth-conversation.h"
+#include "mongosql-auth-frame.h"
+#include "mongosql-auth-pool.h"
+#include "mongosql-auth-ticket.h"
+#include "mongoc/mongoc-thread-private.h"
 
 #define MONGOSQL_AUTH_MAX_BUF_SIZE 65536
 
+/*
+ * from interface version 2.0 on (MySQL 8.0), the client library can run the
+ * plugin without blocking, through non-blocking reads and writes on its vio
+ */
+#if MYSQL_CLIENT_AUTHENTICATION_PLUGIN_INTERFACE_VERSION >= 0x0200
+#define MONGOSQL_AUTH_ENABLE_NONBLOCKING 1
+#else
+#define MONGOSQL_AUTH_ENABLE_NONBLOCKING 0
+#endif
+
+/*
+ * capabilities a 1.2 server offers in auth-data and the client accepts in its
+ * first reply. with SKIP_EMPTY_EXCHANGE the server finishes a conversation
+ * when it sends its last message, server-final for SCRAM, so the client
+ * doesn't send the empty message that would otherwise close it.
+ */
+#define MONGOSQL_AUTH_CAPABILITY_SKIP_EMPTY_EXCHANGE 0x01
+
+/*
+ * with EARLY_SALT, auth-data ends with a server payload of "s=salt,i=count"
+ * messages, the ones server-first will carry, so the client can derive
+ * SaltedPassword while client-first and server-first are on the wire
+ */
+#define MONGOSQL_AUTH_CAPABILITY_EARLY_SALT 0x02
+
+/*
+ * with RESUMPTION, auth-data carries a nonce after the number of
+ * conversations, as [len u32][nonce]. the client's first reply follows the
+ * capabilities with [len u32][ticket][proof], a session ticket and the
+ * proof it holds the ticket's secret, or a length of 0 without a ticket.
+ * the server's first reply then starts with 1 and its own proof if it
+ * accepts the ticket, which ends the handshake, or 0 and the usual payload.
+ * during a full handshake, every server payload ends with
+ * [len u32][ticket][lifetime u32], empty until server-final.
+ * the client accepts it only for SCRAM, when session tickets are turned on.
+ */
+#define MONGOSQL_AUTH_CAPABILITY_RESUMPTION 0x04
+
+#define MONGOSQL_AUTH_CAPABILITIES \
+    (MONGOSQL_AUTH_CAPABILITY_SKIP_EMPTY_EXCHANGE | MONGOSQL_AUTH_CAPABILITY_EARLY_SALT | \
+     MONGOSQL_AUTH_CAPABILITY_RESUMPTION)
+
+/* where a handshake is, and what it waits on when it can't go on */
+typedef enum {
+    MONGOSQL_AUTH_STATE_READ_AUTH_DATA,
+    /* a 1.0 server takes an empty reply, then sends the mechanism */
+    MONGOSQL_AUTH_STATE_WRITE_EMPTY_RESPONSE,
+    MONGOSQL_AUTH_STATE_READ_MECHANISM,
+    MONGOSQL_AUTH_STATE_STEP,
+    /* a non-blocking handshake waits for the worker pool to derive a key */
+    MONGOSQL_AUTH_STATE_DERIVE,
+    MONGOSQL_AUTH_STATE_WRITE_PAYLOAD,
+    MONGOSQL_AUTH_STATE_READ_PAYLOAD,
+    MONGOSQL_AUTH_STATE_DONE
+} mongosql_auth_state_t;
+
 typedef struct mongosql_auth_t {
     int status;
+    mongosql_auth_state_t state;
+    /* reads and writes go through the vio's non-blocking calls */
+    my_bool nonblocking;
     char* error_msg;
+    /* the minor protocol version the server speaks */
+    uint8_t minor_version;
+    /* the MONGOSQL_AUTH_CAPABILITY_* flags both sides agreed on */
+    uint8_t capabilities;
     uint32_t num_conversations;
     mongosql_auth_conversation_t *conversations;
     MYSQL_PLUGIN_VIO *vio;
+    /* the client payload, reused every round */
+    mongosql_auth_frame_t frame;
+    /* SCRAM derivations prepared from early salts, and the thread running them */
+    mongoc_scram_t **early_scrams;
+    size_t num_early_scrams;
+    mongoc_thread_t early_thread;
+    my_bool early_running;
+    /* the derivation a non-blocking handshake leaves to the worker pool: the
+     * prepared scrams, the distinct derivations the pool runs, and which of
+     * them each scram takes its secrets from */
+    mongosql_auth_pool_job_t background_job;
+    my_bool background_running;
+    mongoc_scram_t **background_scrams;
+    size_t num_background_scrams;
+    mongoc_scram_t **background_distinct;
+    size_t *background_sources;
+    /* session resumption: who the ticket store knows this connection as,
+     * the server's nonce, the ticket presented in the first reply and the
+     * one issued with server-final, both NULL if there is none */
+    const char *host;
+    const char *user;
+    const char *password;
+    uint8_t *resumption_nonce;
+    size_t resumption_nonce_len;
+    mongosql_auth_ticket_t *presented_ticket;
+    mongosql_auth_ticket_t *issued_ticket;
+    /* the server answered the first reply, and accepted the ticket */
+    my_bool resumption_answered;
+    my_bool resumed;
+    /* holds the strings and buffers of the handshake until it is destroyed */
+    mongoc_arena_t arena;
 } mongosql_auth_t;
 
 void
@@ -46,14 +144,23 @@ _mongosql_auth_destroy(mongosql_auth_t *plugin);
 void
 _mongosql_auth_start(mongosql_auth_t *plugin, const char *username, const char *password, const char *host);
 
-void
-_mongosql_auth_step(mongosql_auth_t *plugin);
+/*
+ * Runs the handshake until it finishes, successfully or not, and returns
+ * TRUE. With nonblocking set, returns FALSE instead whenever the vio has no
+ * packet to read yet or can't take a write, or the worker pool is still
+ * deriving a SCRAM key; call it again once it can, and the handshake goes on
+ * where it stopped. A derivation has no connection event to wait for, so the
+ * caller should simply call again.
+ */
+my_bool
+_mongosql_auth_continue(mongosql_auth_t *plugin);
 
 void
-_mongosql_auth_read_payload(mongosql_auth_t *plugin);
+_mongosql_auth_step(mongosql_auth_t *plugin);
 
+/* keeps the ticket the server issued, once the handshake has succeeded */
 void
-_mongosql_auth_write_payload(mongosql_auth_t *plugin);
+_mongosql_auth_save_ticket(mongosql_auth_t *plugin);
 
 void
 _mongosql_auth_set_error(mongosql_auth_t *plugin, const char *msg);
@@ -0,0 +1,712 @@
+#include <my_global.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "mock-server.h"
+#include "mongosql-auth.h"
+#include "mongoc/mongoc-b64.h"
+#include "mongoc/mongoc-misc.h"
+#include "mongoc/mongoc-rand-private.h"
+
+enum {
+    MOCK_SERVER_SEND_AUTH_DATA,
+    MOCK_SERVER_RECV_EMPTY_RESPONSE,
+    MOCK_SERVER_SEND_MECHANISM,
+    MOCK_SERVER_RECV_PAYLOAD,
+    MOCK_SERVER_SEND_PAYLOAD,
+    /* the payload with server-final, when the empty exchange is skipped */
+    MOCK_SERVER_SEND_LAST_PAYLOAD,
+    MOCK_SERVER_FINISHED
+};
+
+/* a ticket is [iv 16][secret len 1][encrypted secret 32][expiry u64][mac 32] */
+#define MOCK_SERVER_TICKET_SIZE (16 + 1 + 32 + 8 + 32)
+#define MOCK_SERVER_TICKET_MAC_OFFSET (16 + 1 + 32 + 8)
+
+static uint8_t mock_server_ticket_key[32];
+static my_bool mock_server_ticket_key_set = FALSE;
+
+static void
+mock_server_set_error(mock_server_t *server, const char *msg) {
+    if (server->error == NULL) {
+        server->error = strdup(msg);
+    }
+}
+
+/* HMAC-SHA-256 of a + b + c under key */
+static void
+mock_server_hmac(const uint8_t *key,
+                 size_t key_len,
+                 const void *a,
+                 size_t a_len,
+                 const void *b,
+                 size_t b_len,
+                 const void *c,
+                 size_t c_len,
+                 uint8_t *out) {
+    mongoc_crypto_t crypto;
+    uint8_t *data = malloc(a_len + b_len + c_len + 1);
+
+    memcpy(data, a, a_len);
+    memcpy(data + a_len, b, b_len);
+    memcpy(data + a_len + b_len, c, c_len);
+
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+    mongoc_crypto_hmac(&crypto, key, (int) key_len, data, (int) (a_len + b_len + c_len), out);
+    mongoc_crypto_destroy(&crypto);
+    free(data);
+}
+
+void
+mock_server_rotate_ticket_key(void) {
+    _mongoc_rand_bytes(mock_server_ticket_key, sizeof mock_server_ticket_key);
+    mock_server_ticket_key_set = TRUE;
+}
+
+/* seals the first conversation's resumption secret into a new ticket */
+static void
+mock_server_issue_ticket(mock_server_t *server, uint8_t *ticket) {
+    uint8_t keystream[32];
+    int64_t expires = (int64_t) time(NULL) + server->ticket_lifetime;
+
+    if (!mock_server_ticket_key_set) {
+        mock_server_rotate_ticket_key();
+    }
+
+    _mongoc_rand_bytes(ticket, 16);
+    ticket[16] = (uint8_t) server->hash_size;
+    mock_server_hmac(mock_server_ticket_key, 32, "enc", 3, ticket, 16, "", 0, keystream);
+    for (size_t k = 0; k < 32; k++) {
+        ticket[17 + k] = (k < server->hash_size ? server->conversations[0].resumption_secret[k] : 0) ^
+                         keystream[k];
+    }
+    memcpy(ticket + 49, &expires, 8);
+    mock_server_hmac(mock_server_ticket_key, 32, "mac", 3, ticket, MOCK_SERVER_TICKET_MAC_OFFSET,
+                     server->username, strlen(server->username), ticket + MOCK_SERVER_TICKET_MAC_OFFSET);
+}
+
+/* opens a ticket and checks the client's proof, writing the server's proof */
+static my_bool
+mock_server_resume(mock_server_t *server,
+                   const uint8_t *ticket,
+                   size_t ticket_len,
+                   const uint8_t *proof,
+                   uint8_t *server_proof) {
+    uint8_t mac[32];
+    uint8_t keystream[32];
+    uint8_t secret[32];
+    uint8_t expected[32];
+    int64_t expires;
+
+    if (ticket_len != MOCK_SERVER_TICKET_SIZE || !mock_server_ticket_key_set || ticket[16] > 32) {
+        return FALSE;
+    }
+
+    mock_server_hmac(mock_server_ticket_key, 32, "mac", 3, ticket, MOCK_SERVER_TICKET_MAC_OFFSET,
+                     server->username, strlen(server->username), mac);
+    memcpy(&expires, ticket + 49, 8);
+    if (memcmp(mac, ticket + MOCK_SERVER_TICKET_MAC_OFFSET, 32) || expires < (int64_t) time(NULL)) {
+        return FALSE;
+    }
+
+    mock_server_hmac(mock_server_ticket_key, 32, "enc", 3, ticket, 16, "", 0, keystream);
+    for (size_t k = 0; k < 32; k++) {
+        secret[k] = ticket[17 + k] ^ keystream[k];
+    }
+
+    mock_server_hmac(secret, ticket[16], "client", 6, server->resumption_nonce,
+                     sizeof server->resumption_nonce, ticket, ticket_len, expected);
+    if (memcmp(expected, proof, 32)) {
+        return FALSE;
+    }
+
+    mock_server_hmac(secret, ticket[16], "server", 6, server->resumption_nonce,
+                     sizeof server->resumption_nonce, ticket, ticket_len, server_proof);
+    return TRUE;
+}
+
+/* a plain RFC 5802 Hi(), kept apart from the client's implementations */
+static void
+mock_server_hi(mongoc_crypto_t *crypto,
+               const char *password,
+               const uint8_t *salt,
+               size_t salt_len,
+               uint32_t iterations,
+               size_t hash_size,
+               uint8_t *output) {
+    uint8_t start[MONGOC_SCRAM_HASH_MAX_SIZE + 4];
+    uint8_t u[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t next[MONGOC_SCRAM_HASH_MAX_SIZE];
+
+    memcpy(start, salt, salt_len);
+    memcpy(start + salt_len, "\x00\x00\x00\x01", 4);
+    mongoc_crypto_hmac(crypto, password, (int) strlen(password), start, (int) salt_len + 4, u);
+    memcpy(output, u, hash_size);
+
+    for (uint32_t i = 1; i < iterations; i++) {
+        mongoc_crypto_hmac(crypto, password, (int) strlen(password), u, (int) hash_size, next);
+        for (size_t k = 0; k < hash_size; k++) {
+            output[k] ^= next[k];
+        }
+        memcpy(u, next, hash_size);
+    }
+}
+
+/* "s=<salt>,i=<iterations>" of conversation i */
+static char *
+mock_server_salt(mock_server_t *server, uint32_t i, uint32_t iterations) {
+    char salt[MONGOC_SCRAM_B64_HASH_MAX_SIZE + 1];
+
+    if (mongoc_b64_ntop(server->conversations[i].salt, server->salt_len, salt, sizeof salt) < 0) {
+        return NULL;
+    }
+
+    return bson_strdup_printf("s=%s,i=%u", salt, iterations);
+}
+
+/* the reply to a client-first message: "r=<client nonce>mock<i>,s=...,i=..." */
+static char *
+mock_server_first(mock_server_t *server, uint32_t i, const char *client_first_bare) {
+    const char *nonce;
+    char *salt;
+    char *reply;
+
+    nonce = strstr(client_first_bare, ",r=");
+    if (nonce == NULL) {
+        return NULL;
+    }
+
+    salt = mock_server_salt(server, i, server->iterations);
+    if (salt == NULL) {
+        return NULL;
+    }
+
+    reply = bson_strdup_printf("r=%smock%u,%s", nonce + 3, i, salt);
+    free(salt);
+    return reply;
+}
+
+/*
+ * auth-data from 1.2 on: the capabilities, the mechanism, a nonce if
+ * resumption is offered and early salts if they are
+ */
+static void
+mock_server_auth_data(mock_server_t *server) {
+    size_t mechanism_len = strlen(server->mechanism) + 1;
+    char **salts;
+    unsigned char *out;
+
+    salts = calloc(server->num_conversations, sizeof(char *));
+    server->packet_len = 3 + mechanism_len + 4;
+    if (server->capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+        server->packet_len += 4 + sizeof server->resumption_nonce;
+    }
+    if (server->capabilities & MONGOSQL_AUTH_CAPABILITY_EARLY_SALT) {
+        for (uint32_t i = 0; i < server->num_conversations; i++) {
+            salts[i] = mock_server_salt(server, i, server->iterations + (server->stale_early_salt ? 1 : 0));
+            server->packet_len += 4 + strlen(salts[i]);
+        }
+    }
+
+    server->packet = malloc(server->packet_len);
+    server->packet[2] = server->capabilities;
+    memcpy(server->packet + 3, server->mechanism, mechanism_len);
+    memcpy(server->packet + 3 + mechanism_len, &server->num_conversations, 4);
+    out = server->packet + 3 + mechanism_len + 4;
+    if (server->capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+        uint32_t len = (uint32_t) sizeof server->resumption_nonce;
+
+        _mongoc_rand_bytes(server->resumption_nonce, sizeof server->resumption_nonce);
+        memcpy(out, &len, 4);
+        memcpy(out + 4, server->resumption_nonce, len);
+        out += 4 + len;
+    }
+    for (uint32_t i = 0; i < server->num_conversations && salts[i]; i++) {
+        uint32_t len = (uint32_t) strlen(salts[i]);
+
+        memcpy(out, &len, 4);
+        memcpy(out + 4, salts[i], len);
+        out += 4 + len;
+        free(salts[i]);
+    }
+    free(salts);
+}
+
+/* checks the proof in a client-final message and returns "v=<server signature>" */
+static char *
+mock_server_final(mock_server_t *server, mock_server_conversation_t *conv, const char *client_final) {
+    mongoc_crypto_t crypto;
+    uint8_t client_signature[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t server_signature[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t stored_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t proof[MONGOC_SCRAM_B64_HASH_MAX_SIZE];
+    char verifier[MONGOC_SCRAM_B64_HASH_MAX_SIZE + 3];
+    const char *proof_str;
+    char *auth_message;
+    char *tmp;
+    int proof_len;
+
+    proof_str = strstr(client_final, ",p=");
+    if (proof_str == NULL) {
+        return NULL;
+    }
+
+    if (server->reject_proof) {
+        return strdup("e=invalid-proof");
+    }
+
+    /* the client must echo the combined nonce sent in server-first */
+    if (strncmp(client_final, "c=biws,", 7) ||
+        strncmp(client_final + 7, conv->server_first, strcspn(conv->server_first, ","))) {
+        return NULL;
+    }
+
+    proof_len = mongoc_b64_pton(proof_str + 3, proof, sizeof proof);
+    if (proof_len != (int) server->hash_size) {
+        return NULL;
+    }
+
+    auth_message = bson_strdup_printf("%s,%s,%.*s",
+                                      conv->client_first_bare,
+                                      conv->server_first,
+                                      (int) (proof_str - client_final),
+                                      client_final);
+
+    mongoc_crypto_init(&crypto, server->algorithm);
+    mongoc_crypto_hmac(&crypto, conv->stored_key, (int) server->hash_size,
+                       (const unsigned char *) auth_message, (int) strlen(auth_message),
+                       client_signature);
+    for (size_t k = 0; k < server->hash_size; k++) {
+        client_key[k] = proof[k] ^ client_signature[k];
+    }
+    mongoc_crypto_hash(&crypto, client_key, server->hash_size, stored_key);
+    mongoc_crypto_hmac(&crypto, conv->server_key, (int) server->hash_size,
+                       (const unsigned char *) auth_message, (int) strlen(auth_message),
+                       server_signature);
+    mongoc_crypto_destroy(&crypto);
+
+    /* HMAC(ClientKey, "Resumption Secret" + AuthMessage) */
+    tmp = bson_strdup_printf("Resumption Secret%s", auth_message);
+    mongoc_crypto_init(&crypto, server->algorithm);
+    mongoc_crypto_hmac(&crypto, client_key, (int) server->hash_size,
+                       (const unsigned char *) tmp, (int) strlen(tmp), conv->resumption_secret);
+    mongoc_crypto_destroy(&crypto);
+    free(tmp);
+    free(auth_message);
+
+    if (memcmp(stored_key, conv->stored_key, server->hash_size)) {
+        return NULL;
+    }
+
+    conv->verified = TRUE;
+
+    memcpy(verifier, "v=", 2);
+    if (mongoc_b64_ntop(server_signature, server->hash_size, verifier + 2, sizeof verifier - 2) < 0) {
+        return NULL;
+    }
+
+    return strdup(verifier);
+}
+
+/* consumes one client payload and queues the reply */
+static int
+mock_server_recv_payload(mock_server_t *server, const unsigned char *pkt, size_t pkt_len) {
+    char **replies;
+    size_t replies_len = 0;
+    my_bool all_done = TRUE;
+    my_bool all_verified = TRUE;
+    my_bool finished_on_reply = FALSE;
+    my_bool issue_ticket = FALSE;
+    unsigned char *out;
+    int ret = 0;
+
+    replies = calloc(server->num_conversations, sizeof(char *));
+
+    for (uint32_t i = 0; i < server->num_conversations; i++) {
+        mock_server_conversation_t *conv = &server->conversations[i];
+        uint8_t done;
+        uint32_t len;
+        char *msg;
+
+        if (pkt_len < 5) {
+            mock_server_set_error(server, "short client payload");
+            ret = 1;
+            goto cleanup;
+        }
+        memcpy(&done, pkt, 1);
+        memcpy(&len, pkt + 1, 4);
+        if (pkt_len - 5 < len) {
+            mock_server_set_error(server, "short client payload");
+            ret = 1;
+            goto cleanup;
+        }
+        msg = malloc(len + 1);
+        memcpy(msg, pkt + 5, len);
+        msg[len] = '\0';
+        pkt += 5 + len;
+        pkt_len -= 5 + len;
+
+        if (done) {
+            if (!conv->verified) {
+                mock_server_set_error(server, "conversation finished before the proof was checked");
+                ret = 1;
+            }
+            conv->done = TRUE;
+            replies[i] = strdup("");
+        } else if (conv->client_first_bare == NULL) {
+            if (strncmp(msg, "n,,", 3)) {
+                mock_server_set_error(server, "malformed client-first message");
+                ret = 1;
+            } else {
+                conv->client_first_bare = strdup(msg + 3);
+                conv->server_first = mock_server_first(server, i, conv->client_first_bare);
+                replies[i] = conv->server_first ? strdup(conv->server_first) : NULL;
+            }
+        } else if (!conv->verified) {
+            replies[i] = mock_server_final(server, conv, msg);
+            if (replies[i] && (server->agreed_capabilities & MONGOSQL_AUTH_CAPABILITY_SKIP_EMPTY_EXCHANGE)) {
+                conv->done = TRUE;
+                finished_on_reply = TRUE;
+            }
+        }
+
+        free(msg);
+
+        if (replies[i] == NULL) {
+            mock_server_set_error(server, "client proof rejected");
+            ret = 1;
+        }
+        if (ret) {
+            goto cleanup;
+        }
+
+        all_done = all_done && conv->done;
+        all_verified = all_verified && conv->verified;
+        replies_len += 4 + strlen(replies[i]);
+    }
+
+    if (all_done && !finished_on_reply) {
+        server->state = MOCK_SERVER_FINISHED;
+        goto cleanup;
+    }
+
+    /* with resumption, the answer to the ticket leads the first reply, and
+     * a ticket block ends each, holding a ticket with server-final */
+    if (server->resumption_pending) {
+        replies_len += 1;
+    }
+    if (server->agreed_capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+        issue_ticket = all_verified && !server->ticket_issued;
+        replies_len += 4 + (issue_ticket ? MOCK_SERVER_TICKET_SIZE + 4 : 0);
+    }
+
+    free(server->packet);
+    server->packet = malloc(replies_len);
+    server->packet_len = replies_len;
+    out = server->packet;
+    if (server->resumption_pending) {
+        *out++ = 0;
+        server->resumption_pending = FALSE;
+    }
+    for (uint32_t i = 0; i < server->num_conversations; i++) {
+        uint32_t len = (uint32_t) strlen(replies[i]);
+
+        memcpy(out, &len, 4);
+        memcpy(out + 4, replies[i], len);
+        out += 4 + len;
+    }
+    if (issue_ticket) {
+        uint32_t len = MOCK_SERVER_TICKET_SIZE;
+
+        memcpy(out, &len, 4);
+        mock_server_issue_ticket(server, out + 4);
+        memcpy(out + 4 + len, &server->ticket_lifetime, 4);
+        server->ticket_issued = TRUE;
+    } else if (server->agreed_capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+        memset(out, 0, 4);
+    }
+    server->state = all_done ? MOCK_SERVER_SEND_LAST_PAYLOAD : MOCK_SERVER_SEND_PAYLOAD;
+
+cleanup:
+    for (uint32_t i = 0; i < server->num_conversations; i++) {
+        free(replies[i]);
+    }
+    free(replies);
+
+    return ret;
+}
+
+/*
+ * reads the [len u32][ticket][proof] after the capabilities of the first
+ * payload. returns 1 if the ticket was accepted and the reply that ends the
+ * handshake is queued, 0 to go on with SCRAM, or -1 if it is malformed.
+ */
+static int
+mock_server_recv_ticket(mock_server_t *server, const unsigned char **pkt, int *pkt_len) {
+    uint8_t server_proof[32];
+    size_t skip;
+    uint32_t len;
+
+    if (*pkt_len < 4) {
+        mock_server_set_error(server, "short session ticket");
+        return -1;
+    }
+    memcpy(&len, *pkt, 4);
+    skip = 4 + (len ? (size_t) len + 32 : 0);
+    if ((size_t) *pkt_len < skip) {
+        mock_server_set_error(server, "short session ticket");
+        return -1;
+    }
+
+    if (len && mock_server_resume(server, *pkt + 4, len, *pkt + 4 + len, server_proof)) {
+        free(server->packet);
+        server->packet = malloc(1 + sizeof server_proof);
+        server->packet[0] = 1;
+        memcpy(server->packet + 1, server_proof, sizeof server_proof);
+        server->packet_len = 1 + sizeof server_proof;
+        server->state = MOCK_SERVER_SEND_LAST_PAYLOAD;
+        server->resumed = TRUE;
+        return 1;
+    }
+
+    *pkt += skip;
+    *pkt_len -= (int) skip;
+    server->resumption_pending = TRUE;
+    return 0;
+}
+
+static int
+mock_server_read_packet(MYSQL_PLUGIN_VIO *vio, unsigned char **buf) {
+    mock_server_t *server = (mock_server_t *) vio;
+    size_t mechanism_len = strlen(server->mechanism) + 1;
+
+    switch (server->state) {
+    case MOCK_SERVER_SEND_AUTH_DATA:
+        free(server->packet);
+        if (server->minor_version >= 2) {
+            mock_server_auth_data(server);
+            server->state = MOCK_SERVER_RECV_PAYLOAD;
+        } else if (server->minor_version == 1) {
+            server->packet = malloc(2 + mechanism_len + 4);
+            memcpy(server->packet + 2, server->mechanism, mechanism_len);
+            memcpy(server->packet + 2 + mechanism_len, &server->num_conversations, 4);
+            server->packet_len = 2 + mechanism_len + 4;
+            server->state = MOCK_SERVER_RECV_PAYLOAD;
+        } else {
+            server->packet = malloc(2);
+            server->packet_len = 2;
+            server->state = MOCK_SERVER_RECV_EMPTY_RESPONSE;
+        }
+        server->packet[0] = 1;
+        server->packet[1] = server->minor_version;
+        break;
+    case MOCK_SERVER_SEND_MECHANISM:
+        free(server->packet);
+        server->packet = malloc(mechanism_len + 4);
+        memcpy(server->packet, server->mechanism, mechanism_len);
+        memcpy(server->packet + mechanism_len, &server->num_conversations, 4);
+        server->packet_len = mechanism_len + 4;
+        server->state = MOCK_SERVER_RECV_PAYLOAD;
+        break;
+    case MOCK_SERVER_SEND_PAYLOAD:
+        server->state = MOCK_SERVER_RECV_PAYLOAD;
+        break;
+    case MOCK_SERVER_SEND_LAST_PAYLOAD:
+        server->state = MOCK_SERVER_FINISHED;
+        break;
+    default:
+        mock_server_set_error(server, "unexpected read from the client");
+        return -1;
+    }
+
+    server->num_reads++;
+    *buf = server->packet;
+    return (int) server->packet_len;
+}
+
+static int
+mock_server_write_packet(MYSQL_PLUGIN_VIO *vio, const unsigned char *pkt, int pkt_len) {
+    mock_server_t *server = (mock_server_t *) vio;
+
+    server->num_writes++;
+
+    switch (server->state) {
+    case MOCK_SERVER_RECV_EMPTY_RESPONSE:
+        if (pkt_len != 1) {
+            mock_server_set_error(server, "expected a one-byte response to auth-data");
+            return 1;
+        }
+        server->state = MOCK_SERVER_SEND_MECHANISM;
+        return 0;
+    case MOCK_SERVER_RECV_PAYLOAD:
+        /* from 1.2 on, the first payload starts with the accepted capabilities */
+        if (server->minor_version >= 2 && !server->negotiated) {
+            if (pkt_len < 1 || (pkt[0] & ~server->capabilities)) {
+                mock_server_set_error(server, "client accepted capabilities that weren't offered");
+                return 1;
+            }
+            server->agreed_capabilities = pkt[0];
+            server->negotiated = TRUE;
+            pkt++;
+            pkt_len--;
+
+            if (server->agreed_capabilities & MONGOSQL_AUTH_CAPABILITY_RESUMPTION) {
+                switch (mock_server_recv_ticket(server, &pkt, &pkt_len)) {
+                case -1:
+                    return 1;
+                case 1:
+                    return 0;
+                }
+            }
+        }
+        return mock_server_recv_payload(server, pkt, (size_t) pkt_len);
+    default:
+        mock_server_set_error(server, "unexpected write from the client");
+        return 1;
+    }
+}
+
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+static enum net_async_status
+mock_server_read_packet_nonblocking(MYSQL_PLUGIN_VIO *vio, unsigned char **buf, int *result) {
+    mock_server_t *server = (mock_server_t *) vio;
+
+    server->would_block = !server->would_block;
+    if (server->would_block) {
+        server->num_not_ready++;
+        return NET_ASYNC_NOT_READY;
+    }
+
+    *result = mock_server_read_packet(vio, buf);
+    return NET_ASYNC_COMPLETE;
+}
+
+static enum net_async_status
+mock_server_write_packet_nonblocking(MYSQL_PLUGIN_VIO *vio, const unsigned char *pkt, int pkt_len, int *result) {
+    mock_server_t *server = (mock_server_t *) vio;
+
+    server->would_block = !server->would_block;
+    if (server->would_block) {
+        server->num_not_ready++;
+        return NET_ASYNC_NOT_READY;
+    }
+
+    *result = mock_server_write_packet(vio, pkt, pkt_len);
+    return NET_ASYNC_COMPLETE;
+}
+#endif
+
+static void
+mock_server_info(MYSQL_PLUGIN_VIO *vio, MYSQL_PLUGIN_VIO_INFO *info) {
+    memset(info, 0, sizeof *info);
+}
+
+void
+mock_server_init(mock_server_t *server,
+                 const char *mechanism,
+                 uint32_t num_conversations,
+                 uint32_t num_salts,
+                 const char *username,
+                 const char *password,
+                 uint32_t iterations) {
+    mongoc_crypto_t crypto;
+    uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    char *prepared_password;
+    char *tmp;
+
+    memset(server, 0, sizeof *server);
+    server->vio.read_packet = mock_server_read_packet;
+    server->vio.write_packet = mock_server_write_packet;
+    server->vio.info = mock_server_info;
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    server->vio.read_packet_nonblocking = mock_server_read_packet_nonblocking;
+    server->vio.write_packet_nonblocking = mock_server_write_packet_nonblocking;
+#endif
+
+    server->mechanism = mechanism;
+    server->username = username;
+    server->ticket_lifetime = 3600;
+    server->num_conversations = num_conversations;
+    server->conversations = calloc(num_conversations, sizeof(mock_server_conversation_t));
+    server->iterations = iterations;
+    server->state = MOCK_SERVER_SEND_AUTH_DATA;
+
+    if (strcmp(mechanism, "SCRAM-SHA-1") == 0) {
+        server->algorithm = MONGOC_CRYPTO_ALGORITHM_SHA_1;
+        server->hash_size = MONGOC_SCRAM_SHA_1_HASH_SIZE;
+        tmp = bson_strdup_printf("%s:mongo:%s", username, password);
+        prepared_password = _mongoc_hex_md5(tmp);
+        free(tmp);
+    } else {
+        /* SASLprep is the identity on the ASCII passwords used in tests */
+        server->algorithm = MONGOC_CRYPTO_ALGORITHM_SHA_256;
+        server->hash_size = MONGOC_SCRAM_SHA_256_HASH_SIZE;
+        prepared_password = strdup(password);
+    }
+
+    server->salt_len = server->hash_size - 4;
+    if (num_salts == 0) {
+        num_salts = 1;
+    }
+
+    mongoc_crypto_init(&crypto, server->algorithm);
+    for (uint32_t i = 0; i < num_conversations; i++) {
+        mock_server_conversation_t *conv = &server->conversations[i];
+
+        for (size_t k = 0; k < server->salt_len; k++) {
+            conv->salt[k] = (uint8_t) (k * 7 + 3 + i % num_salts);
+        }
+
+        /* conversations with the same salt have the same keys */
+        if (i >= num_salts) {
+            memcpy(conv->stored_key, server->conversations[i % num_salts].stored_key, server->hash_size);
+            memcpy(conv->server_key, server->conversations[i % num_salts].server_key, server->hash_size);
+            continue;
+        }
+
+        mock_server_hi(&crypto, prepared_password, conv->salt, server->salt_len,
+                       iterations, server->hash_size, salted_password);
+        mongoc_crypto_hmac(&crypto, salted_password, (int) server->hash_size,
+                           (const unsigned char *) "Client Key", 10, client_key);
+        mongoc_crypto_hash(&crypto, client_key, server->hash_size, conv->stored_key);
+        mongoc_crypto_hmac(&crypto, salted_password, (int) server->hash_size,
+                           (const unsigned char *) "Server Key", 10, conv->server_key);
+    }
+    mongoc_crypto_destroy(&crypto);
+
+    free(prepared_password);
+}
+
+my_bool
+mock_server_authenticated(mock_server_t *server) {
+    if (server->error != NULL || server->state != MOCK_SERVER_FINISHED) {
+        return FALSE;
+    }
+
+    if (server->resumed) {
+        return TRUE;
+    }
+
+    for (uint32_t i = 0; i < server->num_conversations; i++) {
+        if (!server->conversations[i].verified || !server->conversations[i].done) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+void
+mock_server_destroy(mock_server_t *server) {
+    for (uint32_t i = 0; i < server->num_conversations; i++) {
+        free(server->conversations[i].client_first_bare);
+        free(server->conversations[i].server_first);
+    }
+    free(server->conversations);
+    free(server->packet);
+    free(server->error);
+}
@@ -0,0 +1,112 @@
+#ifndef MOCK_SERVER_H
+#define MOCK_SERVER_H
+
+#include <my_global.h>
+#include <mysql/client_plugin.h>
+#include <stdint.h>
+
+#include "mongoc/mongoc-crypto-private.h"
+#include "mongoc/mongoc-scram.h"
+
+/*
+ * An in-process stand-in for the server side of the mongosql_auth protocol.
+ * It hands its vio to mongosql_auth() and answers each conversation's SCRAM
+ * messages, checking the client proofs against one user and password.
+ *
+ * With RESUMPTION it issues session tickets the way a server would, keeping
+ * no state: a ticket holds its secret, encrypted under a key shared by every
+ * mock server in the process, with the user and an expiry time, all under a
+ * MAC.
+ */
+
+typedef struct mock_server_conversation_t {
+    uint8_t salt[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t stored_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    char *client_first_bare;
+    char *server_first;
+    /* the secret a session ticket issued after this exchange is bound to */
+    uint8_t resumption_secret[MONGOC_SCRAM_HASH_MAX_SIZE];
+    my_bool verified;
+    my_bool done;
+} mock_server_conversation_t;
+
+typedef struct mock_server_t {
+    /* must be first: the vio callbacks cast back to the server */
+    MYSQL_PLUGIN_VIO vio;
+
+    const char *mechanism;
+    const char *username;
+    mongoc_crypto_hash_algorithm_t algorithm;
+    size_t hash_size;
+    uint32_t iterations;
+    size_t salt_len;
+
+    uint32_t num_conversations;
+    mock_server_conversation_t *conversations;
+
+    /* the protocol minor version to speak, 0 unless set after init; from 1
+     * on the mechanism goes out with auth-data */
+    uint8_t minor_version;
+    /* from minor version 2 on, the MONGOSQL_AUTH_CAPABILITY_* flags offered
+     * in auth-data, 0 unless set after init, and those the client accepted */
+    uint8_t capabilities;
+    uint8_t agreed_capabilities;
+    my_bool negotiated;
+    /* with EARLY_SALT, announce a count one higher than server-first's, as a
+     * server whose credentials changed in between would */
+    my_bool stale_early_salt;
+    /* answer every client proof with e=, as a server holding other
+     * credentials would */
+    my_bool reject_proof;
+    /* with RESUMPTION, the nonce sent in auth-data, the lifetime of the
+     * tickets issued, 3600 seconds unless set after init, whether the
+     * server's first reply still owes the client its answer to the ticket,
+     * whether a ticket was issued, and whether the client resumed with one */
+    uint8_t resumption_nonce[16];
+    uint32_t ticket_lifetime;
+    my_bool resumption_pending;
+    my_bool ticket_issued;
+    my_bool resumed;
+    /* packets handed to and received from the client */
+    uint32_t num_reads;
+    uint32_t num_writes;
+    /* with a non-blocking client, every other read and write finds the
+     * connection not ready, as a socket would; and how often that was */
+    my_bool would_block;
+    uint32_t num_not_ready;
+
+    /* position in the protocol, and the packet handed out by the last read */
+    int state;
+    unsigned char *packet;
+    size_t packet_len;
+
+    char *error;
+} mock_server_t;
+
+/*
+ * mechanism is "SCRAM-SHA-1" or "SCRAM-SHA-256". conversation i is sent salt
+ * number i % num_salts, so 1 gives every conversation the same salt.
+ */
+void
+mock_server_init(mock_server_t *server,
+                 const char *mechanism,
+                 uint32_t num_conversations,
+                 uint32_t num_salts,
+                 const char *username,
+                 const char *password,
+                 uint32_t iterations);
+
+/* makes every session ticket issued so far invalid, as a new key would */
+void
+mock_server_rotate_ticket_key(void);
+
+/* TRUE once every conversation proved the password and finished, or the
+ * client resumed with a valid ticket */
+my_bool
+mock_server_authenticated(mock_server_t *server);
+
+void
+mock_server_destroy(mock_server_t *server);
+
+#endif /* MOCK_SERVER_H */
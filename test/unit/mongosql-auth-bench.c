@@ -0,0 +1,119 @@
+/*
+ * Handshake latency against the number of conversations, with conversations
+ * stepped one after another and on the worker pool, and with the SCRAM cache
+ * already holding the user's secrets.
+ *
+ * usage: mongosql_auth_bench [mechanism [iterations [rounds]]]
+ */
+
+#include <my_global.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "mock-server.h"
+#include "mongosql-auth.h"
+#include "mongosql-auth-plugin.h"
+#include "mongosql-auth-pool.h"
+#include "mongoc/mongoc-scram-cache-private.h"
+
+static double
+bench_now_ms(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/* returns the mean handshake latency in milliseconds, or -1 on failure */
+static double
+bench_handshake(const char *mechanism,
+                uint32_t num_conversations,
+                uint32_t num_salts,
+                uint32_t iterations,
+                int rounds,
+                my_bool cached) {
+    mock_server_t server;
+    MYSQL mysql;
+    double total = 0;
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+    mysql.passwd = "pencil";
+
+    for (int r = 0; r < rounds; r++) {
+        double start;
+        int status;
+
+        /* the server derives its keys here, outside the timed section */
+        mock_server_init(&server, mechanism, num_conversations, num_salts, "user", "pencil", iterations);
+        if (!cached) {
+            _mongoc_scram_cache_clear();
+        }
+
+        start = bench_now_ms();
+        status = mongosql_auth(&server.vio, &mysql);
+        total += bench_now_ms() - start;
+
+        if (status != CR_OK || !mock_server_authenticated(&server)) {
+            fprintf(stderr, "handshake failed: %s\n", server.error ? server.error : "client error");
+            mock_server_destroy(&server);
+            return -1;
+        }
+        mock_server_destroy(&server);
+    }
+
+    return total / rounds;
+}
+
+int
+main(int argc, char *argv[]) {
+    const uint32_t conversations[] = {1, 2, 4, 8, 16};
+    const char *mechanism = argc > 1 ? argv[1] : "SCRAM-SHA-256";
+    uint32_t iterations = argc > 2 ? (uint32_t) atoi(argv[2]) : 15000;
+    int rounds = argc > 3 ? atoi(argv[3]) : 5;
+    int pool_size;
+
+    if (rounds < 1) {
+        rounds = 1;
+    }
+
+    _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+    pool_size = _mongosql_auth_pool_size();
+
+    /* measure derivations, not a cache file left by earlier runs */
+    mongosql_auth_options("scram_cache_file", "");
+
+    printf("%s, %u iterations, mean of %d handshakes\n", mechanism, iterations, rounds);
+    printf("%15s %15s %15s %15s %15s\n", "conversations", "serial (ms)", "pool (ms)", "one salt (ms)", "cached (ms)");
+
+    for (size_t i = 0; i < sizeof conversations / sizeof conversations[0]; i++) {
+        double serial, pooled, shared, cached;
+
+        /* every conversation gets its own salt, so each derives its keys */
+        _mongosql_auth_pool_set_size(1);
+        serial = bench_handshake(mechanism, conversations[i], conversations[i], iterations, rounds, FALSE);
+
+        _mongosql_auth_pool_set_size(pool_size);
+        pooled = bench_handshake(mechanism, conversations[i], conversations[i], iterations, rounds, FALSE);
+
+        /* servers sharing the user's salt, so one derivation serves them all */
+        shared = bench_handshake(mechanism, conversations[i], 1, iterations, rounds, FALSE);
+
+        /* reconnecting with the same credentials, served by the SCRAM cache */
+        cached = bench_handshake(mechanism, conversations[i], 1, iterations, rounds, TRUE);
+
+        if (serial < 0 || pooled < 0 || shared < 0 || cached < 0) {
+            return 1;
+        }
+
+        printf("%15u %15.2f %15.2f %15.2f %15.3f\n", conversations[i], serial, pooled, shared, cached);
+    }
+
+    printf("pool size: %d\n", pool_size);
+
+    mongosql_auth_deinit();
+    return 0;
+}
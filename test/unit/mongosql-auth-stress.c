@@ -0,0 +1,187 @@
+/*
+ * A burst of concurrent connections, as a connection pool or BI tool opens
+ * at startup: N threads each run one handshake against its own mock server
+ * at the same moment. Reports the CPU the burst took and its connect times,
+ * for N connections of one user, whose derivations are coalesced, and of N
+ * different users, which each derive their own keys.
+ *
+ * usage: mongosql_auth_stress [threads [mechanism [iterations]]]
+ */
+
+#include <my_global.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "mock-server.h"
+#include "mongosql-auth.h"
+#include "mongosql-auth-plugin.h"
+#include "mongoc/mongoc-scram-cache-private.h"
+#include "mongoc/mongoc-thread-private.h"
+
+typedef struct stress_connection_t {
+    mock_server_t server;
+    MYSQL mysql;
+    char user[32];
+    double connect_ms;
+    int status;
+} stress_connection_t;
+
+/* the threads wait here until all of them are ready to connect */
+static mongoc_mutex_t stress_mutex = MONGOC_MUTEX_INITIALIZER;
+static mongoc_cond_t stress_cond = MONGOC_COND_INITIALIZER;
+static my_bool stress_started = FALSE;
+
+static double
+stress_now_ms(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/* CPU time of every thread of the process, in milliseconds */
+static double
+stress_cpu_ms(void) {
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+}
+
+static int
+stress_compare(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+
+    return x < y ? -1 : x > y;
+}
+
+MONGOC_THREAD_FUN(stress_connect, arg) {
+    stress_connection_t *conn = (stress_connection_t *) arg;
+    double start;
+
+    mongoc_mutex_lock(&stress_mutex);
+    while (!stress_started) {
+        mongoc_cond_wait(&stress_cond, &stress_mutex);
+    }
+    mongoc_mutex_unlock(&stress_mutex);
+
+    start = stress_now_ms();
+    conn->status = mongosql_auth(&conn->server.vio, &conn->mysql);
+    conn->connect_ms = stress_now_ms() - start;
+
+    MONGOC_THREAD_RETURN;
+}
+
+/* runs one burst and prints its row, or returns -1 if a handshake failed */
+static int
+stress_burst(const char *label, const char *mechanism, int num_threads, uint32_t iterations, my_bool one_user) {
+    stress_connection_t *conns;
+    mongoc_thread_t *threads;
+    mongoc_scram_cache_stats_t before, after;
+    double *connect_ms;
+    double start, wall_ms, cpu_ms;
+    int ret = 0;
+
+    conns = calloc(num_threads, sizeof *conns);
+    threads = calloc(num_threads, sizeof *threads);
+    connect_ms = calloc(num_threads, sizeof *connect_ms);
+    if (!conns || !threads || !connect_ms) {
+        fprintf(stderr, "out of memory\n");
+        ret = -1;
+        goto cleanup;
+    }
+
+    /* the servers derive their keys here, before the burst */
+    for (int i = 0; i < num_threads; i++) {
+        snprintf(conns[i].user, sizeof conns[i].user, one_user ? "user" : "user%d", i);
+        conns[i].mysql.host = "localhost";
+        conns[i].mysql.user = conns[i].user;
+        conns[i].mysql.passwd = "pencil";
+        mock_server_init(&conns[i].server, mechanism, 1, 1, conns[i].user, "pencil", iterations);
+    }
+
+    _mongoc_scram_cache_clear();
+    _mongoc_scram_cache_stats(&before);
+    stress_started = FALSE;
+
+    for (int i = 0; i < num_threads; i++) {
+        if (mongoc_thread_create(&threads[i], stress_connect, &conns[i])) {
+            fprintf(stderr, "could not start thread %d\n", i);
+            abort();
+        }
+    }
+
+    cpu_ms = stress_cpu_ms();
+    start = stress_now_ms();
+
+    mongoc_mutex_lock(&stress_mutex);
+    stress_started = TRUE;
+    mongoc_cond_broadcast(&stress_cond);
+    mongoc_mutex_unlock(&stress_mutex);
+
+    for (int i = 0; i < num_threads; i++) {
+        mongoc_thread_join(threads[i]);
+    }
+
+    wall_ms = stress_now_ms() - start;
+    cpu_ms = stress_cpu_ms() - cpu_ms;
+    _mongoc_scram_cache_stats(&after);
+
+    for (int i = 0; i < num_threads; i++) {
+        if (conns[i].status != CR_OK || !mock_server_authenticated(&conns[i].server)) {
+            fprintf(stderr, "handshake %d failed: %s\n", i,
+                    conns[i].server.error ? conns[i].server.error : "client error");
+            ret = -1;
+        }
+        connect_ms[i] = conns[i].connect_ms;
+    }
+
+    qsort(connect_ms, num_threads, sizeof *connect_ms, stress_compare);
+
+    printf("%15s %15.1f %15.1f %15.2f %15.2f %15llu %15llu\n", label, cpu_ms, wall_ms,
+           connect_ms[num_threads / 2], connect_ms[(num_threads * 99 - 1) / 100],
+           (unsigned long long) (after.misses - before.misses),
+           (unsigned long long) (after.coalesced - before.coalesced));
+
+    for (int i = 0; i < num_threads; i++) {
+        mock_server_destroy(&conns[i].server);
+    }
+
+cleanup:
+    free(conns);
+    free(threads);
+    free(connect_ms);
+    return ret;
+}
+
+int
+main(int argc, char *argv[]) {
+    int num_threads = argc > 1 ? atoi(argv[1]) : 200;
+    const char *mechanism = argc > 2 ? argv[2] : "SCRAM-SHA-256";
+    uint32_t iterations = argc > 3 ? (uint32_t) atoi(argv[3]) : 15000;
+    int ret = 0;
+
+    if (num_threads < 1) {
+        num_threads = 1;
+    }
+
+    /* measure derivations, not a cache file left by earlier runs */
+    mongosql_auth_options("scram_cache_file", "");
+
+    printf("%s, %u iterations, %d concurrent connections\n", mechanism, iterations, num_threads);
+    printf("%15s %15s %15s %15s %15s %15s %15s\n", "users", "cpu (ms)", "wall (ms)", "p50 (ms)", "p99 (ms)",
+           "derivations", "coalesced");
+
+    if (stress_burst("one", mechanism, num_threads, iterations, TRUE) < 0 ||
+        stress_burst("distinct", mechanism, num_threads, iterations, FALSE) < 0) {
+        ret = 1;
+    }
+
+    mongosql_auth_deinit();
+    return ret;
+}
@@ -3,12 +3,26 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "unit-tests.h"
+#include "mock-server.h"
 #include "mongosql-auth.h"
+#include "mongosql-auth-frame.h"
+#include "mongosql-auth-plugin.h"
+#include "mongosql-auth-pool.h"
 #include "mongosql-auth-sasl.h"
+#include "mongosql-auth-ticket.h"
+#include "mongoc/mongoc-arena-private.h"
+#include "mongoc/mongoc-kdf-scheduler-private.h"
 #include "mongoc/mongoc-misc.h"
 #include "mongoc/mongoc-scram.h"
+#include "mongoc/mongoc-pbkdf2-private.h"
+#include "mongoc/mongoc-scram-cache-private.h"
 
 int
 main (int argc, char *argv[]) {
@@ -16,6 +30,32 @@ main (int argc, char *argv[]) {
     int ret = 0;
 
     ret += test_mongosql_auth_conversation_scram_parameters();
+    ret += test_mongoc_crypto_hash();
+    ret += test_mongoc_crypto_hmac_keyed();
+    ret += test_mongoc_crypto_cleanup();
+    ret += test_mongoc_crypto_pbkdf2();
+    ret += test_mongoc_pbkdf2_kernel();
+    ret += test_mongoc_pbkdf2_batch();
+    ret += test_mongoc_pbkdf2_batch_callers();
+    ret += test_mongosql_auth_pool_handshake();
+    ret += test_mongosql_auth_pool_restart();
+    ret += test_mongosql_auth_protocol_versions();
+    ret += test_mongosql_auth_session_tickets();
+    ret += test_mongosql_auth_nonblocking();
+    ret += test_mongosql_auth_background_derivation();
+    ret += test_mongosql_auth_abandoned_handshake();
+    ret += test_mongosql_auth_shared_derivation();
+    ret += test_mongosql_auth_rejected_proof();
+    ret += test_mongosql_auth_concurrent_derivation();
+    ret += test_mongosql_auth_kdf_limits();
+    ret += test_mongoc_arena();
+    ret += test_mongoc_scram_parse_message();
+    ret += test_mongosql_auth_frame();
+    ret += test_mongoc_scram_cache();
+    ret += test_mongoc_scram_cache_coalescing();
+    ret += test_mongoc_kdf_scheduler();
+    ret += test_mongoc_scram_cache_file();
+    ret += test_mongoc_sasl_prep();
 
     return ret;
 }
@@ -25,7 +65,7 @@ int test_mongosql_auth_conversation_scram_parameters () {
 
     fprintf(stderr, "Testing mongosql_auth_conversation_t SCRAM-SHA-1 parameter initialization...");
 
-    _mongosql_auth_conversation_init(&scram_sha_1_conv, "username?source=mydb", "password", "scram-sha-1", NULL);
+    _mongosql_auth_conversation_init(&scram_sha_1_conv, "username?source=mydb", "password", "scram-sha-1", NULL, NULL);
 
     if (strcmp(scram_sha_1_conv.username, "username")) {
         fprintf(stderr, "FAIL\n");
@@ -55,7 +95,7 @@ int test_mongosql_auth_conversation_scram_parameters () {
 
     fprintf(stderr, "Testing mongosql_auth_conversation_t SCRAM-SHA-256 parameter initialization...");
 
-    _mongosql_auth_conversation_init(&scram_sha_256_conv, "username?source=mydb", "password", "scram-sha-256", NULL);
+    _mongosql_auth_conversation_init(&scram_sha_256_conv, "username?source=mydb", "password", "scram-sha-256", NULL, NULL);
 
     if (strcmp(scram_sha_256_conv.username, "username")) {
         fprintf(stderr, "FAIL\n");
@@ -85,3 +125,1949 @@ int test_mongosql_auth_conversation_scram_parameters () {
     return 0;
 }
 
+
+int test_mongoc_crypto_hash () {
+    /* FIPS 180-2: "abc", and a message padded into a second block */
+    const char *messages[] = {"abc", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"};
+    const uint8_t expected_sha_1[][MONGOC_SCRAM_SHA_1_HASH_SIZE] = {
+        {0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e,
+         0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d},
+        {0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae,
+         0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5, 0xe5, 0x46, 0x70, 0xf1}
+    };
+    const uint8_t expected_sha_256[][MONGOC_SCRAM_SHA_256_HASH_SIZE] = {
+        {0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40,
+         0xde, 0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17,
+         0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad},
+        {0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26,
+         0x93, 0x0c, 0x3e, 0x60, 0x39, 0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff,
+         0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1}
+    };
+    uint8_t hash[MONGOC_SCRAM_HASH_MAX_SIZE];
+    mongoc_crypto_t sha_1, sha_256;
+
+    fprintf(stderr, "Testing mongoc_crypto_t hashes...");
+
+    mongoc_crypto_init(&sha_1, MONGOC_CRYPTO_ALGORITHM_SHA_1);
+    mongoc_crypto_init(&sha_256, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+
+    for (int i = 0; i < 2; i++) {
+        if (!mongoc_crypto_hash(&sha_1, (const unsigned char *) messages[i], strlen(messages[i]), hash) ||
+            memcmp(hash, expected_sha_1[i], MONGOC_SCRAM_SHA_1_HASH_SIZE)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected SHA-1 of message %d to match FIPS 180-2\n", i);
+            mongoc_crypto_destroy(&sha_1);
+            mongoc_crypto_destroy(&sha_256);
+            return 1;
+        }
+
+        if (!mongoc_crypto_hash(&sha_256, (const unsigned char *) messages[i], strlen(messages[i]), hash) ||
+            memcmp(hash, expected_sha_256[i], MONGOC_SCRAM_SHA_256_HASH_SIZE)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected SHA-256 of message %d to match FIPS 180-2\n", i);
+            mongoc_crypto_destroy(&sha_1);
+            mongoc_crypto_destroy(&sha_256);
+            return 1;
+        }
+    }
+
+    mongoc_crypto_destroy(&sha_1);
+    mongoc_crypto_destroy(&sha_256);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_crypto_hmac_keyed () {
+    mongoc_crypto_t crypto;
+    const char *key = "Jefe";
+    const char *data = "what do ya want for nothing?";
+    /* RFC 4231, test case 2 */
+    const uint8_t expected[] = {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24,
+        0x26, 0x08, 0x95, 0x75, 0xc7, 0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27,
+        0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+    };
+    uint8_t one_shot[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t keyed[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t other[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t hash[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t rehash[MONGOC_SCRAM_HASH_MAX_SIZE];
+    my_bool ok;
+
+    fprintf(stderr, "Testing mongoc_crypto_t keyed HMAC...");
+
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+    mongoc_crypto_hmac(&crypto, key, (int) strlen(key), (const unsigned char *) data, (int) strlen(data), one_shot);
+
+    if (!mongoc_crypto_hmac_set_key(&crypto, key, (int) strlen(key))) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected mongoc_crypto_hmac_set_key to succeed\n");
+        mongoc_crypto_destroy(&crypto);
+        return 1;
+    }
+
+    /* the keyed context must be reusable for any number of messages, and
+     * one-shot HMACs with other keys in between must leave it alone */
+    for (int i = 0; i < 3; i++) {
+        memset(keyed, 0, sizeof keyed);
+        ok = mongoc_crypto_hmac_keyed(&crypto, (const unsigned char *) data, (int) strlen(data), keyed);
+        mongoc_crypto_hmac(&crypto, "other", 5, (const unsigned char *) data, (int) strlen(data), other);
+
+        if (!ok || memcmp(keyed, expected, sizeof expected) || memcmp(one_shot, expected, sizeof expected)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected keyed HMAC-SHA-256 to match RFC 4231 test case 2 on call %d\n", i);
+            mongoc_crypto_destroy(&crypto);
+            return 1;
+        }
+    }
+
+    mongoc_crypto_hash(&crypto, (const unsigned char *) data, strlen(data), hash);
+    mongoc_crypto_destroy(&crypto);
+
+    /* a crypto reusing the contexts the last one gave back starts afresh */
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+    memset(one_shot, 0, sizeof one_shot);
+    mongoc_crypto_hmac(&crypto, key, (int) strlen(key), (const unsigned char *) data, (int) strlen(data), one_shot);
+    mongoc_crypto_hash(&crypto, (const unsigned char *) data, strlen(data), rehash);
+    mongoc_crypto_destroy(&crypto);
+
+    if (memcmp(one_shot, expected, sizeof expected) || memcmp(hash, rehash, MONGOC_SCRAM_SHA_256_HASH_SIZE)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected HMAC-SHA-256 and SHA-256 through reused contexts to match\n");
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+/* a thread keeping its crypto contexts alive across mongoc_crypto_cleanup */
+typedef struct crypto_cleanup_thread_t {
+    mongoc_mutex_t mutex;
+    mongoc_cond_t cond;
+    int phase;
+    uint8_t before[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t after[MONGOC_SCRAM_HASH_MAX_SIZE];
+} crypto_cleanup_thread_t;
+
+static void
+crypto_cleanup_hash(uint8_t *out) {
+    mongoc_crypto_t crypto;
+
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_256);
+    mongoc_crypto_hmac(&crypto, "key", 3, (const unsigned char *) "data", 4, out);
+    mongoc_crypto_destroy(&crypto);
+}
+
+static void
+crypto_cleanup_step(crypto_cleanup_thread_t *t, int phase) {
+    mongoc_mutex_lock(&t->mutex);
+    t->phase = phase;
+    mongoc_cond_broadcast(&t->cond);
+    mongoc_mutex_unlock(&t->mutex);
+}
+
+static void
+crypto_cleanup_wait(crypto_cleanup_thread_t *t, int phase) {
+    mongoc_mutex_lock(&t->mutex);
+    while (t->phase < phase) {
+        mongoc_cond_wait(&t->cond, &t->mutex);
+    }
+    mongoc_mutex_unlock(&t->mutex);
+}
+
+MONGOC_THREAD_FUN(crypto_cleanup_thread, arg) {
+    crypto_cleanup_thread_t *t = (crypto_cleanup_thread_t *) arg;
+
+    crypto_cleanup_hash(t->before);
+    crypto_cleanup_step(t, 1);
+    crypto_cleanup_wait(t, 2);
+    crypto_cleanup_hash(t->after);
+    MONGOC_THREAD_RETURN;
+}
+
+int test_mongoc_crypto_cleanup () {
+    crypto_cleanup_thread_t t;
+    mongoc_thread_t thread;
+    uint8_t expected[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t after[MONGOC_SCRAM_HASH_MAX_SIZE];
+
+    fprintf(stderr, "Testing mongoc_crypto_cleanup with another thread's contexts kept...");
+
+    memset(&t, 0, sizeof t);
+    mongoc_mutex_init(&t.mutex);
+    mongoc_cond_init(&t.cond);
+
+    crypto_cleanup_hash(expected);
+
+    /* the other thread's contexts are freed here, while it lives on, and
+     * both threads keep working after */
+    mongoc_thread_create(&thread, crypto_cleanup_thread, &t);
+    crypto_cleanup_wait(&t, 1);
+    mongoc_crypto_cleanup();
+    crypto_cleanup_step(&t, 2);
+    mongoc_thread_join(thread);
+    crypto_cleanup_hash(after);
+
+    mongoc_cond_destroy(&t.cond);
+    mongoc_mutex_destroy(&t.mutex);
+
+    if (memcmp(t.before, expected, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+        memcmp(t.after, expected, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+        memcmp(after, expected, MONGOC_SCRAM_SHA_256_HASH_SIZE)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected HMAC-SHA-256 to match before and after mongoc_crypto_cleanup\n");
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_crypto_pbkdf2 () {
+    mongoc_crypto_t crypto;
+    /* RFC 6070, test case 3 */
+    const uint8_t expected[] = {
+        0x4b, 0x00, 0x79, 0x01, 0xb7, 0x65, 0x48, 0x9a, 0xbe, 0xad,
+        0x49, 0xd9, 0x26, 0xf7, 0x21, 0xd0, 0x65, 0xa4, 0x29, 0xc1
+    };
+    uint8_t output[MONGOC_SCRAM_SHA_1_HASH_SIZE];
+
+    fprintf(stderr, "Testing mongoc_crypto_t PBKDF2...");
+
+    mongoc_crypto_init(&crypto, MONGOC_CRYPTO_ALGORITHM_SHA_1);
+
+    if (!mongoc_crypto_pbkdf2(&crypto, "password", 8, (const uint8_t *) "salt", 4, 4096, sizeof output, output)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected mongoc_crypto_pbkdf2 to succeed\n");
+        mongoc_crypto_destroy(&crypto);
+        return 1;
+    }
+
+    mongoc_crypto_destroy(&crypto);
+
+    if (memcmp(output, expected, sizeof expected)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected PBKDF2-HMAC-SHA-1 to match RFC 6070 test case 3\n");
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_pbkdf2_kernel () {
+    mongoc_pbkdf2_t pbkdf2;
+    /* RFC 6070, test case 3 */
+    const uint8_t expected_sha_1[] = {
+        0x4b, 0x00, 0x79, 0x01, 0xb7, 0x65, 0x48, 0x9a, 0xbe, 0xad,
+        0x49, 0xd9, 0x26, 0xf7, 0x21, 0xd0, 0x65, 0xa4, 0x29, 0xc1
+    };
+    /* the same inputs with HMAC-SHA-256 */
+    const uint8_t expected_sha_256[] = {
+        0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41, 0xaa, 0x53, 0x0d,
+        0xb6, 0x84, 0x5c, 0x4c, 0x8d, 0x96, 0x28, 0x93, 0xa0, 0x01, 0xce,
+        0x4e, 0x11, 0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a
+    };
+    uint8_t output[MONGOC_SCRAM_HASH_MAX_SIZE];
+
+    fprintf(stderr, "Testing mongoc_pbkdf2_t (%s)...", _mongoc_pbkdf2_implementation());
+
+    _mongoc_pbkdf2_init(&pbkdf2, MONGOC_CRYPTO_ALGORITHM_SHA_1, (const uint8_t *) "password", 8, (const uint8_t *) "salt", 4);
+    _mongoc_pbkdf2_iterate(&pbkdf2, 4095);
+    _mongoc_pbkdf2_finish(&pbkdf2, output);
+
+    if (memcmp(output, expected_sha_1, sizeof expected_sha_1)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected PBKDF2-HMAC-SHA-1 to match RFC 6070 test case 3\n");
+        return 1;
+    }
+
+    /* split the iterations up, as a caller checking a deadline would */
+    _mongoc_pbkdf2_init(&pbkdf2, MONGOC_CRYPTO_ALGORITHM_SHA_256, (const uint8_t *) "password", 8, (const uint8_t *) "salt", 4);
+    _mongoc_pbkdf2_iterate(&pbkdf2, 1000);
+    _mongoc_pbkdf2_iterate(&pbkdf2, 0);
+    _mongoc_pbkdf2_iterate(&pbkdf2, 3095);
+    _mongoc_pbkdf2_finish(&pbkdf2, output);
+
+    if (memcmp(output, expected_sha_256, sizeof expected_sha_256)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected PBKDF2-HMAC-SHA-256 to match the known answer\n");
+        return 1;
+    }
+
+    if (_mongoc_pbkdf2_init(&pbkdf2, MONGOC_CRYPTO_ALGORITHM_SHA_1, (const uint8_t *) "password", 8, output, 60)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected _mongoc_pbkdf2_init to reject a salt longer than a block\n");
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_pbkdf2_batch () {
+    mongoc_pbkdf2_t kernels[18];
+    mongoc_pbkdf2_t *batch[18];
+    uint32_t iterations[18];
+    /* RFC 6070, test cases 2 and 3 */
+    const uint8_t expected_sha_1_2[] = {
+        0xea, 0x6c, 0x01, 0x4d, 0xc7, 0x2d, 0x6f, 0x8c, 0xcd, 0x1e,
+        0xd9, 0x2a, 0xce, 0x1d, 0x41, 0xf0, 0xd8, 0xde, 0x89, 0x57
+    };
+    const uint8_t expected_sha_1_4096[] = {
+        0x4b, 0x00, 0x79, 0x01, 0xb7, 0x65, 0x48, 0x9a, 0xbe, 0xad,
+        0x49, 0xd9, 0x26, 0xf7, 0x21, 0xd0, 0x65, 0xa4, 0x29, 0xc1
+    };
+    const uint8_t expected_sha_256_4096[] = {
+        0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41, 0xaa, 0x53, 0x0d,
+        0xb6, 0x84, 0x5c, 0x4c, 0x8d, 0x96, 0x28, 0x93, 0xa0, 0x01, 0xce,
+        0x4e, 0x11, 0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a
+    };
+    uint8_t output[MONGOC_SCRAM_HASH_MAX_SIZE];
+    int i;
+
+    fprintf(stderr, "Testing mongoc_pbkdf2_t batches (%d lanes)...", _mongoc_pbkdf2_lanes());
+
+    /* enough SHA-256 kernels to fill the widest engine, mixed with SHA-1
+     * kernels of different lengths */
+    for (i = 0; i < 18; i++) {
+        batch[i] = &kernels[i];
+        if (i == 5 || i == 11) {
+            _mongoc_pbkdf2_init(batch[i], MONGOC_CRYPTO_ALGORITHM_SHA_1, (const uint8_t *) "password", 8, (const uint8_t *) "salt", 4);
+            iterations[i] = i == 5 ? 2 : 4096;
+        } else {
+            _mongoc_pbkdf2_init(batch[i], MONGOC_CRYPTO_ALGORITHM_SHA_256, (const uint8_t *) "password", 8, (const uint8_t *) "salt", 4);
+            iterations[i] = 4096;
+        }
+    }
+
+    _mongoc_pbkdf2_run_batch(batch, iterations, 18);
+
+    for (i = 0; i < 18; i++) {
+        _mongoc_pbkdf2_finish(batch[i], output);
+
+        if ((i == 5 && memcmp(output, expected_sha_1_2, sizeof expected_sha_1_2)) ||
+            (i == 11 && memcmp(output, expected_sha_1_4096, sizeof expected_sha_1_4096)) ||
+            (i != 5 && i != 11 && memcmp(output, expected_sha_256_4096, sizeof expected_sha_256_4096))) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected kernel %d of the batch to match the known answer\n", i);
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+/* a caller of _mongoc_pbkdf2_run_batch and the kernels it submits */
+typedef struct pbkdf2_batch_caller_t {
+    int n;
+    mongoc_crypto_hash_algorithm_t algorithms[2];
+    uint32_t iterations[2];
+    mongoc_pbkdf2_t kernels[2];
+} pbkdf2_batch_caller_t;
+
+MONGOC_THREAD_FUN(pbkdf2_batch_caller_thread, arg) {
+    pbkdf2_batch_caller_t *caller = (pbkdf2_batch_caller_t *) arg;
+    mongoc_pbkdf2_t *batch[2];
+
+    for (int i = 0; i < caller->n; i++) {
+        _mongoc_pbkdf2_init(&caller->kernels[i], caller->algorithms[i], (const uint8_t *) "password", 8,
+                            (const uint8_t *) "salt", 4);
+        batch[i] = &caller->kernels[i];
+    }
+
+    _mongoc_pbkdf2_run_batch(batch, caller->iterations, caller->n);
+    MONGOC_THREAD_RETURN;
+}
+
+int test_mongoc_pbkdf2_batch_callers () {
+    /* one caller runs the other's kernel while the other runs one of its
+     * own, then finishes first: the one left must still be woken */
+    const pbkdf2_batch_caller_t templates[][2] = {
+        {{2, {MONGOC_CRYPTO_ALGORITHM_SHA_256, MONGOC_CRYPTO_ALGORITHM_SHA_256}, {2048, 20480}},
+         {1, {MONGOC_CRYPTO_ALGORITHM_SHA_256}, {1024}}},
+        {{2, {MONGOC_CRYPTO_ALGORITHM_SHA_1, MONGOC_CRYPTO_ALGORITHM_SHA_256}, {2048, 20480}},
+         {1, {MONGOC_CRYPTO_ALGORITHM_SHA_1}, {1024}}},
+    };
+    pbkdf2_batch_caller_t callers[2];
+    mongoc_thread_t threads[2];
+    mongoc_pbkdf2_t expected;
+    uint8_t output[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t expected_output[MONGOC_SCRAM_HASH_MAX_SIZE];
+
+    fprintf(stderr, "Testing mongoc_pbkdf2_t batches of concurrent callers...");
+
+    for (int trial = 0; trial < 40; trial++) {
+        memcpy(callers, templates[trial % 2], sizeof callers);
+
+        for (int i = 0; i < 2; i++) {
+            mongoc_thread_create(&threads[i], pbkdf2_batch_caller_thread, &callers[i]);
+        }
+        for (int i = 0; i < 2; i++) {
+            mongoc_thread_join(threads[i]);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            for (int k = 0; k < callers[i].n; k++) {
+                memset(output, 0, sizeof output);
+                memset(expected_output, 0, sizeof expected_output);
+                _mongoc_pbkdf2_init(&expected, callers[i].algorithms[k], (const uint8_t *) "password", 8,
+                                    (const uint8_t *) "salt", 4);
+                _mongoc_pbkdf2_iterate(&expected, callers[i].iterations[k] - 1);
+                _mongoc_pbkdf2_finish(&expected, expected_output);
+                _mongoc_pbkdf2_finish(&callers[i].kernels[k], output);
+                if (memcmp(output, expected_output, sizeof output)) {
+                    fprintf(stderr, "FAIL\n");
+                    fprintf(stderr, "    expected kernel %d of caller %d to match running it alone\n", k, i);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongosql_auth_pool_handshake () {
+    const char *mechanisms[] = {"SCRAM-SHA-1", "SCRAM-SHA-256"};
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+
+    fprintf(stderr, "Testing mongosql_auth handshake stepped on a worker pool...");
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+
+    _mongosql_auth_pool_set_size(3);
+
+    for (int i = 0; i < 2; i++) {
+        mysql.passwd = "pencil";
+        mock_server_init(&server, mechanisms[i], 3, 1, "user", "pencil", 4096);
+        status = mongosql_auth(&server.vio, &mysql);
+        if (status != CR_OK || !mock_server_authenticated(&server)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected %s handshake to succeed, got status '%d' and server error '%s'\n",
+                    mechanisms[i], status, server.error ? server.error : "");
+            mock_server_destroy(&server);
+            _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+            return 1;
+        }
+        mock_server_destroy(&server);
+
+        mysql.passwd = "pen";
+        mock_server_init(&server, mechanisms[i], 3, 1, "user", "pencil", 4096);
+        status = mongosql_auth(&server.vio, &mysql);
+        if (status != CR_ERROR || mock_server_authenticated(&server)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected %s handshake with the wrong password to fail, got status '%d'\n",
+                    mechanisms[i], status);
+            mock_server_destroy(&server);
+            _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+            return 1;
+        }
+        mock_server_destroy(&server);
+    }
+
+    _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+static mongoc_mutex_t pool_restart_mutex = MONGOC_MUTEX_INITIALIZER;
+static int pool_restart_calls;
+
+static void
+pool_restart_call(void *arg) {
+    (void) arg;
+    mongoc_mutex_lock(&pool_restart_mutex);
+    pool_restart_calls++;
+    mongoc_mutex_unlock(&pool_restart_mutex);
+}
+
+static my_bool pool_restart_finished;
+
+/* restart the pool, as plugin options setting worker_threads would */
+MONGOC_THREAD_FUN(pool_restart_thread, arg) {
+    (void) arg;
+    _mongosql_auth_pool_set_size(2);
+    mongoc_mutex_lock(&pool_restart_mutex);
+    pool_restart_finished = TRUE;
+    mongoc_mutex_unlock(&pool_restart_mutex);
+    MONGOC_THREAD_RETURN;
+}
+
+static my_bool
+pool_restart_running(void) {
+    my_bool running;
+
+    mongoc_mutex_lock(&pool_restart_mutex);
+    running = !pool_restart_finished;
+    mongoc_mutex_unlock(&pool_restart_mutex);
+
+    return running;
+}
+
+/* submit a job and run it to the end, here if the pool can't take it */
+static void
+pool_restart_submit(mongosql_auth_pool_job_t *job, void **args) {
+    if (!_mongosql_auth_pool_submit(job, pool_restart_call, args, 1)) {
+        pool_restart_call(args[0]);
+        return;
+    }
+    _mongosql_auth_pool_wait(job);
+}
+
+int test_mongosql_auth_pool_restart () {
+    mongosql_auth_pool_job_t job;
+    void *args[1] = {NULL};
+    mongoc_thread_t thread;
+    time_t deadline;
+    my_bool done;
+    int calls;
+
+    fprintf(stderr, "Testing mongosql_auth worker pool restarted while jobs are submitted...");
+
+    /* jobs submitted while a restart joins its threads used to start threads
+     * that exited at once and stayed counted, so later jobs were never run */
+    for (int round = 0; round < 500; round++) {
+        /* start the threads the restart has to join */
+        _mongosql_auth_pool_set_size(2);
+        pool_restart_submit(&job, args);
+        pool_restart_calls = 0;
+        pool_restart_finished = FALSE;
+
+        mongoc_thread_create(&thread, pool_restart_thread, NULL);
+        while (pool_restart_running()) {
+            pool_restart_submit(&job, args);
+        }
+        mongoc_thread_join(thread);
+        calls = pool_restart_calls;
+
+        if (!_mongosql_auth_pool_submit(&job, pool_restart_call, args, 1)) {
+            pool_restart_call(args[0]);
+        }
+
+        deadline = time(NULL) + 10;
+        while (!(done = _mongosql_auth_pool_done(&job)) && time(NULL) < deadline) {
+        }
+
+        if (!done || pool_restart_calls != calls + 1) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected a job submitted after a restart to be run by the pool in round %d, got "
+                    "%s\n", round, done ? "its call missing" : "no progress");
+            _mongosql_auth_pool_wait(&job);
+            _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+            return 1;
+        }
+    }
+
+    _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongosql_auth_protocol_versions () {
+    /*
+     * the server sends auth-data, the mechanism, server-first and
+     * server-final; 1.1 sends the mechanism with auth-data. the client sends
+     * an empty reply, client-first, client-final and an empty message that
+     * ends the conversation, which 1.2 can skip.
+     */
+    const struct {
+        uint8_t minor_version;
+        uint8_t capabilities;
+        uint32_t reads;
+        uint32_t writes;
+    } cases[] = {
+        {0, 0, 4, 4},
+        {1, 0, 3, 3},
+        {2, 0, 3, 3},
+        {2, MONGOSQL_AUTH_CAPABILITY_SKIP_EMPTY_EXCHANGE, 3, 2},
+        {2, MONGOSQL_AUTH_CAPABILITY_EARLY_SALT, 3, 3},
+        /* capabilities the client doesn't know are declined */
+        {2, 0xff, 3, 2},
+    };
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+
+    fprintf(stderr, "Testing mongosql_auth protocol version negotiation...");
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+    mysql.passwd = "pencil";
+
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        /* derive every time rather than finding the keys of the last handshake */
+        _mongoc_scram_cache_clear();
+        mock_server_init(&server, "SCRAM-SHA-256", 2, 1, "user", "pencil", 4096);
+        server.minor_version = cases[i].minor_version;
+        server.capabilities = cases[i].capabilities;
+        status = mongosql_auth(&server.vio, &mysql);
+        if (status != CR_OK || !mock_server_authenticated(&server) ||
+            server.num_reads != cases[i].reads || server.num_writes != cases[i].writes) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected a 1.%d handshake with capabilities 0x%02x in %u reads and %u writes, "
+                    "got status '%d', %u reads, %u writes and server error '%s'\n",
+                    cases[i].minor_version, cases[i].capabilities, cases[i].reads, cases[i].writes, status,
+                    server.num_reads, server.num_writes, server.error ? server.error : "");
+            mock_server_destroy(&server);
+            return 1;
+        }
+        mock_server_destroy(&server);
+    }
+
+    /* early salts that don't match server-first are derived again */
+    _mongoc_scram_cache_clear();
+    mock_server_init(&server, "SCRAM-SHA-256", 2, 2, "user", "pencil", 4096);
+    server.minor_version = 2;
+    server.capabilities = MONGOSQL_AUTH_CAPABILITY_EARLY_SALT;
+    server.stale_early_salt = TRUE;
+    status = mongosql_auth(&server.vio, &mysql);
+    if (status != CR_OK || !mock_server_authenticated(&server)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a handshake with stale early salts to succeed, got status '%d' "
+                "and server error '%s'\n", status, server.error ? server.error : "");
+        mock_server_destroy(&server);
+        return 1;
+    }
+    mock_server_destroy(&server);
+
+    /* a newer server may have changed the messages in ways we can't know */
+    mock_server_init(&server, "SCRAM-SHA-256", 1, 1, "user", "pencil", 4096);
+    server.minor_version = 3;
+    status = mongosql_auth(&server.vio, &mysql);
+    mock_server_destroy(&server);
+    if (status != CR_ERROR) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a 1.3 server to be rejected, got status '%d'\n", status);
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongosql_auth_session_tickets () {
+    /*
+     * a full handshake earns a ticket, and the next connection resumes with
+     * it in one round trip. a wrong password never presents the ticket, and
+     * a rejected ticket falls back to SCRAM without a round trip more.
+     */
+    const struct {
+        const char *password;
+        my_bool rotate_key;
+        int status;
+        my_bool resumed;
+        uint32_t reads;
+        uint32_t writes;
+    } cases[] = {
+        {"pencil", FALSE, CR_OK, FALSE, 3, 2},
+        {"pencil", FALSE, CR_OK, TRUE, 2, 1},
+        {"wrong", FALSE, CR_ERROR, FALSE, 0, 0},
+        {"pencil", TRUE, CR_OK, FALSE, 3, 2},
+        {"pencil", FALSE, CR_OK, TRUE, 2, 1},
+    };
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+
+    fprintf(stderr, "Testing mongosql_auth session resumption...");
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+
+    _mongosql_auth_ticket_set_enabled(TRUE);
+
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        if (cases[i].rotate_key) {
+            mock_server_rotate_ticket_key();
+        }
+
+        mysql.passwd = (char *) cases[i].password;
+        mock_server_init(&server, "SCRAM-SHA-256", 2, 1, "user", "pencil", 4096);
+        server.minor_version = 2;
+        server.capabilities = MONGOSQL_AUTH_CAPABILITY_SKIP_EMPTY_EXCHANGE | MONGOSQL_AUTH_CAPABILITY_RESUMPTION;
+        status = mongosql_auth(&server.vio, &mysql);
+        if (status != cases[i].status || server.resumed != cases[i].resumed ||
+            (status == CR_OK && (!mock_server_authenticated(&server) ||
+                                 server.num_reads != cases[i].reads ||
+                                 server.num_writes != cases[i].writes))) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected connection %zu to end with status '%d'%s in %u reads and %u writes, "
+                    "got status '%d'%s, %u reads, %u writes and server error '%s'\n",
+                    i, cases[i].status, cases[i].resumed ? " resumed" : "", cases[i].reads, cases[i].writes,
+                    status, server.resumed ? " resumed" : "", server.num_reads, server.num_writes,
+                    server.error ? server.error : "");
+            mock_server_destroy(&server);
+            _mongosql_auth_ticket_set_enabled(FALSE);
+            return 1;
+        }
+        mock_server_destroy(&server);
+    }
+
+    /* turned off, the client neither asks for tickets nor presents them */
+    _mongosql_auth_ticket_set_enabled(FALSE);
+    mysql.passwd = "pencil";
+    mock_server_init(&server, "SCRAM-SHA-256", 2, 1, "user", "pencil", 4096);
+    server.minor_version = 2;
+    server.capabilities = MONGOSQL_AUTH_CAPABILITY_RESUMPTION;
+    status = mongosql_auth(&server.vio, &mysql);
+    if (status != CR_OK || !mock_server_authenticated(&server) || server.resumed || server.ticket_issued) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a full handshake without a ticket, got status '%d' and server error '%s'\n",
+                status, server.error ? server.error : "");
+        mock_server_destroy(&server);
+        return 1;
+    }
+    mock_server_destroy(&server);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongosql_auth_nonblocking () {
+#if !MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    fprintf(stderr, "Testing mongosql_auth non-blocking handshakes...skipped before MySQL 8.0\n");
+    return 0;
+#else
+    /* one thread drives every handshake, of every protocol version, at once */
+    const uint8_t minor_versions[] = {0, 1, 2, 2};
+    const uint8_t capabilities[] = {0, 0, 0, MONGOSQL_AUTH_CAPABILITIES};
+    enum { NUM_HANDSHAKES = 16 };
+    mock_server_t servers[NUM_HANDSHAKES];
+    MYSQL connections[NUM_HANDSHAKES];
+    int results[NUM_HANDSHAKES];
+    my_bool finished[NUM_HANDSHAKES];
+    size_t num_finished = 0;
+    int ret = 0;
+
+    fprintf(stderr, "Testing mongosql_auth non-blocking handshakes...");
+
+    _mongoc_scram_cache_clear();
+    for (size_t i = 0; i < NUM_HANDSHAKES; i++) {
+        memset(&connections[i], 0, sizeof connections[i]);
+        connections[i].host = "localhost";
+        connections[i].user = "user";
+        connections[i].passwd = "pencil";
+        mock_server_init(&servers[i], "SCRAM-SHA-256", 2, 1, "user", "pencil", 4096);
+        servers[i].minor_version = minor_versions[i % 4];
+        servers[i].capabilities = capabilities[i % 4];
+        finished[i] = FALSE;
+    }
+
+    while (num_finished < NUM_HANDSHAKES) {
+        for (size_t i = 0; i < NUM_HANDSHAKES; i++) {
+            if (!finished[i] &&
+                mongosql_auth_nonblocking(&servers[i].vio, &connections[i], &results[i]) == NET_ASYNC_COMPLETE) {
+                finished[i] = TRUE;
+                num_finished++;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < NUM_HANDSHAKES; i++) {
+        if (results[i] != CR_OK || !mock_server_authenticated(&servers[i]) || servers[i].num_not_ready == 0) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected handshake %zu to succeed after waiting on the connection, got status "
+                    "'%d', %u waits and server error '%s'\n", i, results[i], servers[i].num_not_ready,
+                    servers[i].error ? servers[i].error : "");
+            ret = 1;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < NUM_HANDSHAKES; i++) {
+        mock_server_destroy(&servers[i]);
+    }
+
+    if (ret == 0) {
+        fprintf(stderr, "PASS\n");
+    }
+    return ret;
+#endif
+}
+
+int test_mongosql_auth_background_derivation () {
+#if !MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    fprintf(stderr, "Testing mongosql_auth deriving SCRAM keys in the background...skipped before MySQL 8.0\n");
+    return 0;
+#else
+    /* the key is derived in step 2, or ahead of it from early salts */
+    const uint8_t capabilities[] = {0, MONGOSQL_AUTH_CAPABILITIES};
+    const int pool_sizes[] = {2, 1};
+    mock_server_t server;
+    MYSQL mysql;
+    int result;
+    uint32_t num_not_ready;
+    uint32_t num_derivation_waits;
+
+    fprintf(stderr, "Testing mongosql_auth deriving SCRAM keys in the background...");
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+    mysql.passwd = "pencil";
+
+    for (size_t p = 0; p < sizeof pool_sizes / sizeof pool_sizes[0]; p++) {
+        _mongosql_auth_pool_set_size(pool_sizes[p]);
+
+        for (size_t c = 0; c < sizeof capabilities; c++) {
+            _mongoc_scram_cache_clear();
+            mock_server_init(&server, "SCRAM-SHA-256", 1, 1, "user", "pencil", 4096);
+            server.capabilities = capabilities[c];
+
+            num_not_ready = 0;
+            while (mongosql_auth_nonblocking(&server.vio, &mysql, &result) == NET_ASYNC_NOT_READY) {
+                num_not_ready++;
+            }
+
+            /* whatever the connection didn't account for was spent waiting on the pool */
+            num_derivation_waits = num_not_ready - server.num_not_ready;
+
+            if (result != CR_OK || !mock_server_authenticated(&server) ||
+                (pool_sizes[p] > 1) != (num_derivation_waits > 0)) {
+                fprintf(stderr, "FAIL\n");
+                fprintf(stderr, "    expected a pool of %d to %s the handshake's derivation with capabilities %u, got "
+                        "status '%d', %u waits on the derivation and server error '%s'\n",
+                        pool_sizes[p], pool_sizes[p] > 1 ? "run" : "leave the handshake", capabilities[c], result,
+                        num_derivation_waits, server.error ? server.error : "");
+                mock_server_destroy(&server);
+                _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+                return 1;
+            }
+
+            mock_server_destroy(&server);
+        }
+    }
+
+    _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+#endif
+}
+
+#if MONGOSQL_AUTH_ENABLE_NONBLOCKING
+/* give mysql freshly allocated credentials, as the client library does on connecting */
+static void
+abandoned_handshake_connect(MYSQL *mysql, const char *password) {
+    mysql->host = strdup("localhost");
+    mysql->user = strdup("user");
+    mysql->passwd = strdup(password);
+}
+
+/* wipe and free mysql's credentials, as the client library does on closing */
+static void
+abandoned_handshake_close(MYSQL *mysql) {
+    char **credentials[] = {&mysql->host, &mysql->user, &mysql->passwd};
+
+    for (size_t i = 0; i < sizeof credentials / sizeof credentials[0]; i++) {
+        memset(*credentials[i], 'x', strlen(*credentials[i]));
+        free(*credentials[i]);
+        *credentials[i] = NULL;
+    }
+}
+
+/* run a handshake over server to the end, or give up after far more calls than it takes */
+static my_bool
+abandoned_handshake_run(mock_server_t *server, MYSQL *mysql, int *result) {
+    for (int calls = 0; calls < 10000; calls++) {
+        if (mongosql_auth_nonblocking(&server->vio, mysql, result) == NET_ASYNC_COMPLETE) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+#endif
+
+int test_mongosql_auth_abandoned_handshake () {
+#if !MONGOSQL_AUTH_ENABLE_NONBLOCKING
+    fprintf(stderr, "Testing mongosql_auth handshakes abandoned midway...skipped before MySQL 8.0\n");
+    return 0;
+#else
+    /* the first handshake is given up on and the connection's handles reused:
+     * telling the plugin, then reconnecting with another password, then
+     * neither, when the stale handshake resumes and has to fail cleanly */
+    const char *passwords[] = {"pencil", "eraser", "pencil"};
+    const my_bool abandon[] = {TRUE, FALSE, FALSE};
+    mock_server_t server;
+    MYSQL mysql;
+    int result = CR_ERROR;
+    my_bool finished;
+    my_bool midway;
+
+    fprintf(stderr, "Testing mongosql_auth handshakes abandoned midway...");
+
+    memset(&mysql, 0, sizeof mysql);
+
+    for (size_t i = 0; i < sizeof passwords / sizeof passwords[0]; i++) {
+        _mongoc_scram_cache_clear();
+
+        /* stop once client-first went out and the SCRAM exchange is under way */
+        abandoned_handshake_connect(&mysql, "pencil");
+        mock_server_init(&server, "SCRAM-SHA-256", 2, 1, "user", "pencil", 4096);
+        midway = FALSE;
+        while (server.num_writes < 2) {
+            midway = mongosql_auth_nonblocking(&server.vio, &mysql, &result) == NET_ASYNC_NOT_READY;
+            if (!midway) {
+                break;
+            }
+        }
+        abandoned_handshake_close(&mysql);
+        mock_server_destroy(&server);
+
+        if (abandon[i]) {
+            mongosql_auth_options("abandon_handshake", &mysql);
+        }
+
+        abandoned_handshake_connect(&mysql, passwords[i]);
+        mock_server_init(&server, "SCRAM-SHA-256", 2, 1, "user", passwords[i], 4096);
+        finished = abandoned_handshake_run(&server, &mysql, &result);
+
+        /* the stale handshake ended with its failure; the next one starts afresh */
+        if (finished && i == 2) {
+            mock_server_destroy(&server);
+            mock_server_init(&server, "SCRAM-SHA-256", 2, 1, "user", passwords[i], 4096);
+            finished = abandoned_handshake_run(&server, &mysql, &result);
+        }
+
+        if (!midway || !finished || result != CR_OK || !mock_server_authenticated(&server)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected a handshake after one abandoned midway %s to succeed, got status '%d', "
+                    "%s and server error '%s'\n",
+                    abandon[i] ? "and dropped" : i == 1 ? "under another password" : "and resumed",
+                    result, !midway ? "no handshake to abandon" : finished ? "finished" : "never finished",
+                    server.error ? server.error : "");
+            abandoned_handshake_close(&mysql);
+            mock_server_destroy(&server);
+            return 1;
+        }
+
+        abandoned_handshake_close(&mysql);
+        mock_server_destroy(&server);
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+#endif
+}
+
+int test_mongosql_auth_shared_derivation () {
+    const uint32_t num_salts[] = {1, 2, 4};
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+
+    fprintf(stderr, "Testing mongosql_auth handshake sharing SCRAM derivations...");
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+    mysql.passwd = "pencil";
+
+    /* one salt for all, pairs of conversations sharing one, and none shared */
+    for (int pool_size = 1; pool_size <= 2; pool_size++) {
+        _mongosql_auth_pool_set_size(pool_size);
+
+        for (size_t i = 0; i < sizeof num_salts / sizeof num_salts[0]; i++) {
+            _mongoc_scram_cache_clear();
+            mock_server_init(&server, "SCRAM-SHA-256", 4, num_salts[i], "user", "pencil", 4096);
+            status = mongosql_auth(&server.vio, &mysql);
+            if (status != CR_OK || !mock_server_authenticated(&server)) {
+                fprintf(stderr, "FAIL\n");
+                fprintf(stderr, "    expected handshake with %u salts and pool size %d to succeed, "
+                        "got status '%d' and server error '%s'\n",
+                        num_salts[i], pool_size, status, server.error ? server.error : "");
+                mock_server_destroy(&server);
+                _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+                return 1;
+            }
+            mock_server_destroy(&server);
+        }
+    }
+
+    _mongosql_auth_pool_set_size(MONGOSQL_AUTH_POOL_SIZE_DEFAULT);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongosql_auth_rejected_proof () {
+    mongoc_scram_cache_stats_t before;
+    mongoc_scram_cache_stats_t after;
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+
+    fprintf(stderr, "Testing mongosql_auth handshake whose SCRAM proof is rejected...");
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.user = "user";
+    mysql.passwd = "pencil";
+
+    _mongoc_scram_cache_clear();
+
+    mock_server_init(&server, "SCRAM-SHA-256", 1, 1, "user", "pencil", 4096);
+    server.reject_proof = TRUE;
+    status = mongosql_auth(&server.vio, &mysql);
+    mock_server_destroy(&server);
+    if (status == CR_OK) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected handshake with a rejected proof to fail\n");
+        return 1;
+    }
+
+    /* the secrets of the rejected handshake were never cached, so the next
+     * one derives them again, and caches them once its server is verified */
+    for (int i = 0; i < 2; i++) {
+        _mongoc_scram_cache_stats(&before);
+        mock_server_init(&server, "SCRAM-SHA-256", 1, 1, "user", "pencil", 4096);
+        status = mongosql_auth(&server.vio, &mysql);
+        _mongoc_scram_cache_stats(&after);
+        if (status != CR_OK || !mock_server_authenticated(&server)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected handshake after a rejected proof to succeed, got status '%d' and "
+                    "server error '%s'\n", status, server.error ? server.error : "");
+            mock_server_destroy(&server);
+            return 1;
+        }
+        mock_server_destroy(&server);
+
+        if (after.misses - before.misses != (i == 0 ? 1 : 0) || after.hits - before.hits != (i == 0 ? 0 : 1)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected the %s handshake after a rejected proof to %s, got %d misses and %d hits\n",
+                    i == 0 ? "first" : "second", i == 0 ? "derive again" : "hit the SCRAM cache",
+                    (int) (after.misses - before.misses), (int) (after.hits - before.hits));
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+/* a handshake run on its own thread */
+typedef struct concurrent_handshake_t {
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+} concurrent_handshake_t;
+
+MONGOC_THREAD_FUN(concurrent_handshake_thread, arg) {
+    concurrent_handshake_t *handshake = (concurrent_handshake_t *) arg;
+
+    handshake->status = mongosql_auth(&handshake->server.vio, &handshake->mysql);
+    MONGOC_THREAD_RETURN;
+}
+
+int test_mongosql_auth_concurrent_derivation () {
+    /* two conversations with their own salts put two kernels in one batch,
+     * next to the single kernel of a one-conversation handshake */
+    char *users[] = {"user", "other"};
+    const uint32_t num_conversations[] = {2, 1};
+    const uint32_t iterations[][2] = {{20480, 4096}, {4096, 20480}};
+    concurrent_handshake_t handshakes[2];
+    mongoc_thread_t threads[2];
+    int ret = 0;
+
+    fprintf(stderr, "Testing mongosql_auth handshakes deriving at the same time...");
+
+    for (int trial = 0; trial < 20 && !ret; trial++) {
+        _mongoc_scram_cache_clear();
+
+        for (int i = 0; i < 2; i++) {
+            memset(&handshakes[i], 0, sizeof handshakes[i]);
+            handshakes[i].mysql.host = "localhost";
+            handshakes[i].mysql.user = users[i];
+            handshakes[i].mysql.passwd = "pencil";
+            mock_server_init(&handshakes[i].server, "SCRAM-SHA-256", num_conversations[i], num_conversations[i],
+                             users[i], "pencil", iterations[trial % 2][i]);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            mongoc_thread_create(&threads[i], concurrent_handshake_thread, &handshakes[i]);
+        }
+        for (int i = 0; i < 2; i++) {
+            mongoc_thread_join(threads[i]);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            if (!ret && (handshakes[i].status != CR_OK || !mock_server_authenticated(&handshakes[i].server))) {
+                fprintf(stderr, "FAIL\n");
+                fprintf(stderr, "    expected the %u-conversation handshake to succeed, got status '%d' and "
+                        "server error '%s'\n", num_conversations[i], handshakes[i].status,
+                        handshakes[i].server.error ? handshakes[i].server.error : "");
+                ret = 1;
+            }
+            mock_server_destroy(&handshakes[i].server);
+        }
+    }
+
+    if (ret == 0) {
+        fprintf(stderr, "PASS\n");
+    }
+    return ret;
+}
+
+int test_mongosql_auth_kdf_limits () {
+    const int max_iterations = 10000;
+    const int default_max_iterations = MONGOC_SCRAM_MAX_ITERATIONS_DEFAULT;
+    mongosql_auth_conversation_t conv;
+    mock_server_t server;
+    MYSQL mysql;
+    int status;
+
+    fprintf(stderr, "Testing mongosql_auth SCRAM iteration ceiling and KDF budget...");
+
+    _mongosql_auth_conversation_init(&conv, "user?maxIterations=100000&kdfBudgetMS=500", "pencil", "SCRAM-SHA-256", NULL, NULL);
+    if (conv.status != CR_OK || conv.mechanism.scram.max_iterations != 100000 ||
+        conv.mechanism.scram.kdf_budget_ms != 500) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected limits '100000' and '500', got '%u' and '%u'\n",
+                conv.mechanism.scram.max_iterations, conv.mechanism.scram.kdf_budget_ms);
+        _mongosql_auth_conversation_destroy(&conv);
+        return 1;
+    }
+    _mongosql_auth_conversation_destroy(&conv);
+
+    _mongosql_auth_conversation_init(&conv, "user?kdfPriority=-3", "pencil", "SCRAM-SHA-256", NULL, NULL);
+    if (conv.status != CR_OK || conv.mechanism.scram.kdf_priority != -3) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected KDF priority '-3', got '%d'\n", (int) conv.mechanism.scram.kdf_priority);
+        _mongosql_auth_conversation_destroy(&conv);
+        return 1;
+    }
+    _mongosql_auth_conversation_destroy(&conv);
+
+    _mongosql_auth_conversation_init(&conv, "user?maxIterations=-1", "pencil", "SCRAM-SHA-256", NULL, NULL);
+    if (conv.status != CR_ERROR) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected an invalid maxIterations to be an error\n");
+        _mongosql_auth_conversation_destroy(&conv);
+        return 1;
+    }
+    _mongosql_auth_conversation_destroy(&conv);
+
+    memset(&mysql, 0, sizeof mysql);
+    mysql.host = "localhost";
+    mysql.passwd = "pencil";
+
+    /* a server asking for more iterations than the ceiling is refused */
+    mongosql_auth_options("scram_max_iterations", &max_iterations);
+    _mongoc_scram_cache_clear();
+
+    mysql.user = "user";
+    mock_server_init(&server, "SCRAM-SHA-256", 1, 1, "user", "pencil", 15000);
+    status = mongosql_auth(&server.vio, &mysql);
+    if (status != CR_ERROR || mock_server_authenticated(&server)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected 15000 iterations over a ceiling of 10000 to fail, got status '%d'\n", status);
+        mock_server_destroy(&server);
+        mongosql_auth_options("scram_max_iterations", &default_max_iterations);
+        return 1;
+    }
+    mock_server_destroy(&server);
+
+    /* unless the username raises it */
+    mysql.user = "user?maxIterations=20000";
+    mock_server_init(&server, "SCRAM-SHA-256", 1, 1, "user", "pencil", 15000);
+    status = mongosql_auth(&server.vio, &mysql);
+    mongosql_auth_options("scram_max_iterations", &default_max_iterations);
+    if (status != CR_OK || !mock_server_authenticated(&server)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected maxIterations=20000 to allow 15000 iterations, got status '%d' and server error '%s'\n",
+                status, server.error ? server.error : "");
+        mock_server_destroy(&server);
+        return 1;
+    }
+    mock_server_destroy(&server);
+
+    /* a derivation running past its budget is abandoned, alone and in a batch */
+    mysql.user = "user?kdfBudgetMS=1";
+    for (uint32_t num_conversations = 1; num_conversations <= 2; num_conversations++) {
+        _mongoc_scram_cache_clear();
+        mock_server_init(&server, "SCRAM-SHA-256", num_conversations, num_conversations, "user", "pencil", 200000);
+        status = mongosql_auth(&server.vio, &mysql);
+        if (status != CR_ERROR || mock_server_authenticated(&server) || server.error) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected %u derivations of 200000 iterations to run out of a 1 ms budget, "
+                    "got status '%d'\n", num_conversations, status);
+            mock_server_destroy(&server);
+            return 1;
+        }
+        mock_server_destroy(&server);
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_arena () {
+    mongoc_arena_t arena;
+    mongosql_auth_conversation_t conv;
+    uint8_t *small, *large, *zeroed;
+    char *str;
+
+    fprintf(stderr, "Testing mongoc arena allocator...");
+
+    _mongoc_arena_init(&arena);
+
+    small = _mongoc_arena_alloc(&arena, 3);
+    str = _mongoc_arena_strdup(&arena, "pencil");
+    large = _mongoc_arena_alloc(&arena, 2 * MONGOC_ARENA_CHUNK_SIZE);
+    zeroed = _mongoc_arena_calloc(&arena, 64, 4);
+    if (small == NULL || str == NULL || large == NULL || zeroed == NULL ||
+        ((uintptr_t) str % 16) || ((uintptr_t) large % 16) || ((uintptr_t) zeroed % 16)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected aligned allocations\n");
+        _mongoc_arena_destroy(&arena);
+        return 1;
+    }
+
+    memset(large, 0xff, 2 * MONGOC_ARENA_CHUNK_SIZE);
+    for (int i = 0; i < 256; i++) {
+        if (zeroed[i]) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected calloc'd memory to be zeroed\n");
+            _mongoc_arena_destroy(&arena);
+            return 1;
+        }
+    }
+
+    if (strcmp(str, "pencil") || small + 16 != (uint8_t *) str) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected small allocations to be packed in one chunk\n");
+        _mongoc_arena_destroy(&arena);
+        return 1;
+    }
+
+    /* a conversation allocating from the arena */
+    _mongosql_auth_conversation_init(&conv, "user?mechanism=SCRAM-SHA-256", "pencil", "SCRAM-SHA-256", NULL, &arena);
+    if (conv.status != CR_OK || strcmp(conv.username, "user") || conv.mechanism.scram.arena != &arena) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the conversation to be initialized from the arena\n");
+        _mongosql_auth_conversation_destroy(&conv);
+        _mongoc_arena_destroy(&arena);
+        return 1;
+    }
+    _mongosql_auth_conversation_destroy(&conv);
+
+    _mongoc_arena_destroy(&arena);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_scram_parse_message () {
+    const char *msg = "r=abc,x=ignored,s=c2FsdA==,i=4096";
+    const char *rejected[] = {"r=abc,m=mandatory", "r=abc,r=abc", "r", "=x", "r=abc,,i=1", "rr=abc"};
+    mongoc_scram_slice_t vals[3];
+    bson_error_t error;
+    size_t i;
+
+    fprintf(stderr, "Testing mongoc SCRAM message parser...");
+
+    if (!_mongoc_scram_parse_message((const uint8_t *) msg, (uint32_t) strlen(msg), "rsi", vals, 2, &error) ||
+        vals[0].value != (const uint8_t *) msg + 2 || vals[0].len != 3 ||
+        vals[1].len != 8 || memcmp(vals[1].value, "c2FsdA==", 8) ||
+        vals[2].len != 4 || memcmp(vals[2].value, "4096", 4)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected r, s and i to point into the message\n");
+        return 1;
+    }
+
+    /* absent keys are NULL, and values may be empty */
+    if (!_mongoc_scram_parse_message((const uint8_t *) "v=", 2, "ev", vals, 3, &error) ||
+        vals[0].value != NULL || vals[1].value == NULL || vals[1].len != 0) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a missing e and an empty v\n");
+        return 1;
+    }
+
+    for (i = 0; i < sizeof rejected / sizeof rejected[0]; i++) {
+        if (_mongoc_scram_parse_message((const uint8_t *) rejected[i], (uint32_t) strlen(rejected[i]), "rsi",
+                                        vals, 2, &error)) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected \"%s\" to be rejected\n", rejected[i]);
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongosql_auth_frame () {
+    const uint8_t expected[] = {0, 2, 0, 0, 0, 'a', 'b', 1, 3, 0, 0, 0, 'x', 'y', 'z'};
+    const uint8_t pkt[] = {2, 0, 0, 0, 'h', 'i', 0, 0, 0, 0};
+    mongoc_arena_t arena;
+    mongosql_auth_conversation_t convs[2];
+    mongosql_auth_frame_t frame;
+    const char *error;
+    size_t parsed;
+    int ret = 0;
+
+    fprintf(stderr, "Testing mongosql_auth payload framing...");
+
+    _mongoc_arena_init(&arena);
+    for (int i = 0; i < 2; i++) {
+        _mongosql_auth_conversation_init(&convs[i], "user", "pencil", "PLAIN", NULL, &arena);
+    }
+
+    /* responses are written into their slots and then packed together */
+    if (!_mongosql_auth_frame_init(&frame, &arena, convs, 2)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the frame to be allocated\n");
+        ret = 1;
+        goto cleanup;
+    }
+    _mongosql_auth_frame_begin(&frame, convs, 2);
+    memcpy(convs[0].out, "ab", 2);
+    convs[0].out_len = 2;
+    memcpy(convs[1].out, "xyz", 3);
+    convs[1].out_len = 3;
+    convs[1].done = 1;
+    _mongosql_auth_frame_finish(&frame, convs, 2);
+
+    if (frame.len != sizeof expected || memcmp(frame.data, expected, sizeof expected)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the responses to be framed without gaps\n");
+        ret = 1;
+        goto cleanup;
+    }
+
+    /* server messages are read in place */
+    if (!_mongosql_auth_frame_decode(pkt, sizeof pkt, convs, 2, 16, &parsed, &error) ||
+        convs[0].in != pkt + 4 || convs[0].in_len != 2 || convs[1].in_len != 0 || parsed != sizeof pkt) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the messages to point into the packet\n");
+        ret = 1;
+        goto cleanup;
+    }
+
+    /* whatever follows the messages is left to the caller */
+    if (!_mongosql_auth_frame_decode(pkt, sizeof pkt, convs, 1, 16, &parsed, &error) || parsed != 6) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the bytes after the messages to be left unparsed\n");
+        ret = 1;
+        goto cleanup;
+    }
+
+    if (_mongosql_auth_frame_decode(pkt, sizeof pkt - 1, convs, 2, 16, NULL, &error) ||
+        _mongosql_auth_frame_decode(pkt, 5, convs, 1, 16, NULL, &error) ||
+        _mongosql_auth_frame_decode(pkt, sizeof pkt, convs, 2, 1, NULL, &error)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected truncated and oversized messages to be rejected\n");
+        ret = 1;
+        goto cleanup;
+    }
+
+    fprintf(stderr, "PASS\n");
+
+cleanup:
+    for (int i = 0; i < 2; i++) {
+        _mongosql_auth_conversation_destroy(&convs[i]);
+    }
+    _mongoc_arena_destroy(&arena);
+    return ret;
+}
+
+int test_mongoc_scram_cache () {
+    mongoc_scram_cache_stats_t before, after;
+    uint8_t salt[MONGOC_SCRAM_SHA_256_HASH_SIZE - 4];
+    uint8_t secret[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint32_t i;
+
+    fprintf(stderr, "Testing mongoc SCRAM cache...");
+
+    _mongoc_scram_cache_clear();
+    _mongoc_scram_cache_stats(&before);
+
+    memset(salt, 0x5a, sizeof salt);
+    memset(secret, 0x11, sizeof secret);
+
+    _mongoc_scram_cache_put(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                            secret, secret, secret);
+
+    if (!_mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                 salted_password, client_key, server_key) ||
+        memcmp(salted_password, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+        memcmp(client_key, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+        memcmp(server_key, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the cached secrets to be returned\n");
+        return 1;
+    }
+
+    /* any part of the key that differs must miss */
+    if (_mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pen", salt, sizeof salt, 4096,
+                                salted_password, client_key, server_key) ||
+        _mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "other", "pencil", salt, sizeof salt, 4096,
+                                salted_password, client_key, server_key) ||
+        _mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4097,
+                                salted_password, client_key, server_key) ||
+        _mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_1, "user", "pencil", salt, 16, 4096,
+                                salted_password, client_key, server_key)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected lookups with different parameters to miss\n");
+        return 1;
+    }
+
+    /* filling the cache with other iteration counts evicts the oldest entry */
+    for (i = 0; i < MONGOC_SCRAM_CACHE_SIZE; i++) {
+        _mongoc_scram_cache_put(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 5000 + i,
+                                secret, secret, secret);
+    }
+
+    if (_mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                salted_password, client_key, server_key)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the least recently used entry to be evicted\n");
+        return 1;
+    }
+
+    _mongoc_scram_cache_stats(&after);
+    if (after.hits - before.hits != 1 || after.misses - before.misses != 5 ||
+        after.evictions - before.evictions != 1) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected 1 hit, 5 misses and 1 eviction, got %llu, %llu and %llu\n",
+                (unsigned long long) (after.hits - before.hits),
+                (unsigned long long) (after.misses - before.misses),
+                (unsigned long long) (after.evictions - before.evictions));
+        return 1;
+    }
+
+    _mongoc_scram_cache_clear();
+    if (_mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 5000,
+                                salted_password, client_key, server_key)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the cache to be empty after clearing it\n");
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+/* a second connection that misses the cache while the first derives */
+typedef struct scram_cache_waiter_t {
+    const uint8_t *salt;
+    size_t salt_len;
+    mongoc_scram_cache_claim_t claim;
+    uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+} scram_cache_waiter_t;
+
+MONGOC_THREAD_FUN(scram_cache_waiter_thread, arg) {
+    scram_cache_waiter_t *waiter = (scram_cache_waiter_t *) arg;
+
+    waiter->claim = _mongoc_scram_cache_claim(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", waiter->salt,
+                                              (uint32_t) waiter->salt_len, 4096, TRUE, waiter->salted_password,
+                                              waiter->client_key, waiter->server_key);
+
+    MONGOC_THREAD_RETURN;
+}
+
+int test_mongoc_scram_cache_coalescing () {
+    uint8_t salt[MONGOC_SCRAM_SHA_256_HASH_SIZE - 4];
+    uint8_t secret[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    scram_cache_waiter_t waiter;
+    mongoc_thread_t thread;
+
+    fprintf(stderr, "Testing mongoc SCRAM cache coalescing derivations...");
+
+    _mongoc_scram_cache_clear();
+
+    memset(salt, 0x3c, sizeof salt);
+    memset(secret, 0x22, sizeof secret);
+    memset(&waiter, 0, sizeof waiter);
+    waiter.salt = salt;
+    waiter.salt_len = sizeof salt;
+
+    if (_mongoc_scram_cache_claim(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                  FALSE, salted_password, client_key, server_key) != MONGOC_SCRAM_CACHE_CLAIMED ||
+        _mongoc_scram_cache_claim(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                  FALSE, salted_password, client_key, server_key) != MONGOC_SCRAM_CACHE_BUSY) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the first miss to claim the derivation and the second to find it busy\n");
+        return 1;
+    }
+
+    /* other credentials are not held up by the claim */
+    if (_mongoc_scram_cache_claim(MONGOC_CRYPTO_ALGORITHM_SHA_256, "other", "pencil", salt, sizeof salt, 4096,
+                                  FALSE, salted_password, client_key, server_key) != MONGOC_SCRAM_CACHE_CLAIMED) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a miss for another user to claim its own derivation\n");
+        return 1;
+    }
+    _mongoc_scram_cache_abandon(MONGOC_CRYPTO_ALGORITHM_SHA_256, "other", "pencil", salt, sizeof salt, 4096);
+
+    /* a waiter gets the secrets the claimant puts */
+    mongoc_thread_create(&thread, scram_cache_waiter_thread, &waiter);
+    _mongoc_scram_cache_put(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                            secret, secret, secret);
+    mongoc_thread_join(thread);
+
+    if (waiter.claim != MONGOC_SCRAM_CACHE_HIT ||
+        memcmp(waiter.salted_password, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+        memcmp(waiter.client_key, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+        memcmp(waiter.server_key, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the waiting connection to get the derived secrets, got claim %d\n",
+                (int) waiter.claim);
+        return 1;
+    }
+
+    /* if the claimant gives up, a waiter claims the derivation instead */
+    _mongoc_scram_cache_clear();
+    if (_mongoc_scram_cache_claim(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                  FALSE, salted_password, client_key, server_key) != MONGOC_SCRAM_CACHE_CLAIMED) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a miss after clearing the cache\n");
+        return 1;
+    }
+
+    mongoc_thread_create(&thread, scram_cache_waiter_thread, &waiter);
+    _mongoc_scram_cache_abandon(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096);
+    mongoc_thread_join(thread);
+
+    if (waiter.claim != MONGOC_SCRAM_CACHE_CLAIMED) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the waiting connection to claim an abandoned derivation, got claim %d\n",
+                (int) waiter.claim);
+        return 1;
+    }
+    _mongoc_scram_cache_abandon(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096);
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+/* a derivation queued for a KDF scheduler slot */
+typedef struct kdf_scheduler_waiter_t {
+    int32_t priority;
+    my_bool admitted;
+} kdf_scheduler_waiter_t;
+
+static mongoc_mutex_t kdf_scheduler_order_mutex = MONGOC_MUTEX_INITIALIZER;
+static int32_t kdf_scheduler_order[2];
+static int kdf_scheduler_num_admitted;
+
+MONGOC_THREAD_FUN(kdf_scheduler_waiter_thread, arg) {
+    kdf_scheduler_waiter_t *waiter = (kdf_scheduler_waiter_t *) arg;
+
+    waiter->admitted = _mongoc_kdf_scheduler_acquire(waiter->priority, 0);
+
+    mongoc_mutex_lock(&kdf_scheduler_order_mutex);
+    if (kdf_scheduler_num_admitted < 2) {
+        kdf_scheduler_order[kdf_scheduler_num_admitted] = waiter->priority;
+    }
+    kdf_scheduler_num_admitted++;
+    mongoc_mutex_unlock(&kdf_scheduler_order_mutex);
+
+    _mongoc_kdf_scheduler_release();
+    MONGOC_THREAD_RETURN;
+}
+
+/* wait until as many threads are queued for a slot */
+static void
+kdf_scheduler_wait_queued(uint32_t queued) {
+    mongoc_mutex_t mutex;
+    mongoc_cond_t cond;
+    mongoc_kdf_scheduler_stats_t stats;
+
+    mongoc_mutex_init(&mutex);
+    mongoc_cond_init(&cond);
+    mongoc_mutex_lock(&mutex);
+    for (_mongoc_kdf_scheduler_stats(&stats); stats.queued < queued; _mongoc_kdf_scheduler_stats(&stats)) {
+        mongoc_cond_timedwait(&cond, &mutex, 1);
+    }
+    mongoc_mutex_unlock(&mutex);
+    mongoc_cond_destroy(&cond);
+    mongoc_mutex_destroy(&mutex);
+}
+
+int test_mongoc_kdf_scheduler () {
+    kdf_scheduler_waiter_t low = {-1, FALSE}, high = {5, FALSE};
+    mongoc_kdf_scheduler_stats_t before, after;
+    mongoc_thread_t low_thread, high_thread;
+
+    fprintf(stderr, "Testing mongoc KDF scheduler admission...");
+
+    /* any share of the processors leaves at least one slot */
+    _mongoc_kdf_scheduler_set_cpu_percent(1);
+    if (_mongoc_kdf_scheduler_slots() != 1) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected 1 slot, got %d\n", _mongoc_kdf_scheduler_slots());
+        _mongoc_kdf_scheduler_set_cpu_percent(0);
+        return 1;
+    }
+
+    /* with the slot taken, a bounded wait gives up */
+    _mongoc_kdf_scheduler_stats(&before);
+    if (!_mongoc_kdf_scheduler_acquire(0, 0) || _mongoc_kdf_scheduler_acquire(0, 20)) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the first acquire to take the slot and the second to time out\n");
+        _mongoc_kdf_scheduler_set_cpu_percent(0);
+        return 1;
+    }
+    _mongoc_kdf_scheduler_stats(&after);
+    if (after.timeouts != before.timeouts + 1 || after.queued != 0 || after.running != 1 ||
+        after.max_wait_us < 20000) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected one timeout after waiting 20 ms, got %llu timeouts, %u queued, "
+                "%u running and a %llu us wait\n", (unsigned long long) (after.timeouts - before.timeouts),
+                after.queued, after.running, (unsigned long long) after.max_wait_us);
+        _mongoc_kdf_scheduler_release();
+        _mongoc_kdf_scheduler_set_cpu_percent(0);
+        return 1;
+    }
+
+    /* a higher priority overtakes an earlier arrival */
+    kdf_scheduler_num_admitted = 0;
+    mongoc_thread_create(&low_thread, kdf_scheduler_waiter_thread, &low);
+    kdf_scheduler_wait_queued(1);
+    mongoc_thread_create(&high_thread, kdf_scheduler_waiter_thread, &high);
+    kdf_scheduler_wait_queued(2);
+    _mongoc_kdf_scheduler_release();
+    mongoc_thread_join(low_thread);
+    mongoc_thread_join(high_thread);
+
+    if (!low.admitted || !high.admitted || kdf_scheduler_order[0] != 5 || kdf_scheduler_order[1] != -1) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected priority 5 to be admitted before -1, got %d then %d\n",
+                (int) kdf_scheduler_order[0], (int) kdf_scheduler_order[1]);
+        _mongoc_kdf_scheduler_set_cpu_percent(0);
+        return 1;
+    }
+
+    /* lifting the limit admits whoever is queued */
+    kdf_scheduler_num_admitted = 0;
+    low.admitted = FALSE;
+    _mongoc_kdf_scheduler_acquire(0, 0);
+    mongoc_thread_create(&low_thread, kdf_scheduler_waiter_thread, &low);
+    kdf_scheduler_wait_queued(1);
+    _mongoc_kdf_scheduler_set_cpu_percent(0);
+    mongoc_thread_join(low_thread);
+    _mongoc_kdf_scheduler_release();
+
+    _mongoc_kdf_scheduler_stats(&after);
+    if (!low.admitted || after.running != 0 || after.queued != 0) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected lifting the limit to admit the queued thread, got %u running and %u queued\n",
+                after.running, after.queued);
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
+
+int test_mongoc_scram_cache_file () {
+#ifdef _WIN32
+    fprintf(stderr, "Testing mongoc SCRAM cache file...skipped on Windows\n");
+    return 0;
+#else
+    char cache_path[] = "/tmp/mongosql-auth-cache-XXXXXX";
+    char key_path[] = "/tmp/mongosql-auth-key-XXXXXX";
+    char other_key_path[] = "/tmp/mongosql-auth-key-XXXXXX";
+    mongoc_scram_cache_stats_t before, after;
+    uint8_t salt[MONGOC_SCRAM_SHA_256_HASH_SIZE - 4];
+    uint8_t secret[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t salted_password[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t client_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    uint8_t server_key[MONGOC_SCRAM_HASH_MAX_SIZE];
+    bson_error_t error;
+    const char *failure = NULL;
+    int fd;
+
+    fprintf(stderr, "Testing mongoc SCRAM cache file...");
+
+    fd = mkstemp(key_path);
+    if (write(fd, "0123456789abcdef0123456789abcdef", 32) != 32) {
+        failure = "expected to write the key file";
+    }
+    close(fd);
+    fd = mkstemp(other_key_path);
+    if (write(fd, "fedcba9876543210fedcba9876543210", 32) != 32) {
+        failure = "expected to write the key file";
+    }
+    close(fd);
+    close(mkstemp(cache_path));
+    unlink(cache_path);
+
+    memset(salt, 0x5a, sizeof salt);
+    memset(secret, 0x22, sizeof secret);
+    _mongoc_scram_cache_clear();
+    _mongoc_scram_cache_stats(&before);
+
+    if (failure) {
+    } else if (!_mongoc_scram_cache_file_open(cache_path, key_path, 60, &error)) {
+        failure = "expected the cache file to open";
+    } else {
+        /* stored by one "process", found by another with an empty memory cache */
+        _mongoc_scram_cache_put(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                secret, secret, secret);
+        _mongoc_scram_cache_clear();
+        _mongoc_scram_cache_file_close();
+
+        if (!_mongoc_scram_cache_file_open(cache_path, key_path, 60, &error) ||
+            !_mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                     salted_password, client_key, server_key) ||
+            memcmp(salted_password, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+            memcmp(client_key, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE) ||
+            memcmp(server_key, secret, MONGOC_SCRAM_SHA_256_HASH_SIZE)) {
+            failure = "expected the secrets to be found in the cache file";
+        }
+    }
+
+    _mongoc_scram_cache_stats(&after);
+    if (!failure && after.file_hits - before.file_hits != 1) {
+        failure = "expected one hit in the cache file";
+    }
+
+    /* a different key can't read the entries */
+    _mongoc_scram_cache_clear();
+    if (!failure && (!_mongoc_scram_cache_file_open(cache_path, other_key_path, 60, &error) ||
+                     _mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                             salted_password, client_key, server_key))) {
+        failure = "expected the entries to be unreadable with another key";
+    }
+
+    /* entries stored with no time to live have expired when read back */
+    if (!failure) {
+        _mongoc_scram_cache_file_open(cache_path, key_path, 0, &error);
+        _mongoc_scram_cache_put(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                secret, secret, secret);
+        _mongoc_scram_cache_clear();
+        if (_mongoc_scram_cache_get(MONGOC_CRYPTO_ALGORITHM_SHA_256, "user", "pencil", salt, sizeof salt, 4096,
+                                    salted_password, client_key, server_key)) {
+            failure = "expected expired entries to be ignored";
+        }
+    }
+
+    /* a key file others can read is refused */
+    _mongoc_scram_cache_file_close();
+    chmod(key_path, 0644);
+    if (!failure && _mongoc_scram_cache_file_open(cache_path, key_path, 60, &error)) {
+        failure = "expected a key file readable by others to be refused";
+    }
+
+    _mongoc_scram_cache_file_close();
+    _mongoc_scram_cache_clear();
+    unlink(cache_path);
+    unlink(key_path);
+    unlink(other_key_path);
+
+    if (failure) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    %s\n", failure);
+        return 1;
+    }
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+#endif
+}
+
+static size_t
+sasl_prep_encode(uint32_t cp, char *out) {
+    if (cp < 0x80) {
+        out[0] = (char) cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char) (0xC0 | (cp >> 6));
+        out[1] = (char) (0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char) (0xE0 | (cp >> 12));
+        out[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char) (0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char) (0xF0 | (cp >> 18));
+    out[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char) (0x80 | (cp & 0x3F));
+    return 4;
+}
+
+#ifdef MONGOC_ENABLE_ICU
+/* prepares the code points with the built-in tables and with ICU, and
+ * returns FALSE if they disagree */
+static my_bool
+sasl_prep_agrees(const uint32_t *cps, int num_cps) {
+    char in[64];
+    size_t len = 0;
+    char *native, *icu;
+    bson_error_t error;
+    my_bool agrees;
+
+    for (int i = 0; i < num_cps; i++) {
+        len += sasl_prep_encode(cps[i], in + len);
+    }
+    in[len] = '\0';
+
+    native = _mongoc_sasl_prep_native("password", in, (int) len, &error);
+    icu = _mongoc_sasl_prep_impl("password", in, (int) len, &error);
+    /* ICU's preflighting fails on strings that prepare to nothing */
+    if (native && !*native && !icu) {
+        agrees = TRUE;
+    } else {
+        agrees = native && icu ? !strcmp(native, icu) : native == icu;
+    }
+
+    if (!agrees) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected the built-in tables and ICU to agree on");
+        for (int i = 0; i < num_cps; i++) {
+            fprintf(stderr, " U+%04X", (unsigned) cps[i]);
+        }
+        fprintf(stderr, ", got %s and %s\n", native ? native : "an error", icu ? icu : "an error");
+    }
+
+    free(native);
+    free(icu);
+    return agrees;
+}
+#endif
+
+int test_mongoc_sasl_prep() {
+    /* RFC 4013 section 3, then NFKC, mapping and UTF-8 cases; NULL for an
+     * error */
+    const char *inputs[] = {"I\xC2\xADX", "user", "USER", "\xC2\xAA", "\xE2\x85\xA8", "\x07", "\xD8\xA7" "1",
+                            "e\xCC\x81", "\xE1\x84\x80\xE1\x85\xA1", "a\xE3\x80\x80" "b", "\xD8\xA7" "1\xD8\xA8",
+                            "\xC8\xB7", "\xC0\xAF", "\xED\xA0\x80", "\xE2\x80\x8C"};
+    const char *expected[] = {"IX", "user", "USER", "a", "IX", NULL, NULL,
+                              "\xC3\xA9", "\xEA\xB0\x80", "a b", "\xD8\xA7" "1\xD8\xA8",
+                              NULL, NULL, NULL, ""};
+    char in[401 * 3];
+    char *out;
+    size_t len = 0;
+    bson_error_t error;
+
+    fprintf(stderr, "Testing SASLPrep...");
+
+    for (size_t i = 0; i < sizeof inputs / sizeof inputs[0]; i++) {
+        out = _mongoc_sasl_prep_native("password", inputs[i], (int) strlen(inputs[i]), &error);
+        if (expected[i] ? !out || strcmp(out, expected[i]) : out != NULL) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected case %d to prepare to %s, got %s\n", (int) i,
+                    expected[i] ? expected[i] : "an error", out ? out : error.message);
+            free(out);
+            return 1;
+        }
+        free(out);
+    }
+
+    /* every byte at every position, against checking one at a time */
+    for (size_t n = 1; n <= 40; n++) {
+        for (size_t pos = 0; pos < n; pos++) {
+            for (int c = 1; c < 256; c++) {
+                memset(in, 'a', n);
+                in[pos] = (char) c;
+                if (_mongoc_sasl_prep_required(in, n) != (c < 32 || c >= 127)) {
+                    fprintf(stderr, "FAIL\n");
+                    fprintf(stderr, "    expected byte %d at %d of %d to %s SASLPrep\n", c, (int) pos, (int) n,
+                            c < 32 || c >= 127 ? "need" : "not need");
+                    return 1;
+                }
+            }
+        }
+    }
+
+    /* printable ASCII is copied as it is, and the rest prepared, also after
+     * the profile is closed */
+    for (int i = 0; i < 2; i++) {
+        char *ascii = _mongoc_sasl_prep("p@ss word~!", 11, &error);
+        out = _mongoc_sasl_prep(inputs[0], (int) strlen(inputs[0]), &error);
+        if (!ascii || strcmp(ascii, "p@ss word~!") || !out || strcmp(out, expected[0])) {
+            fprintf(stderr, "FAIL\n");
+            fprintf(stderr, "    expected SASLPrep to prepare passwords, got %s and %s\n", ascii ? ascii : "an error",
+                    out ? out : "an error");
+            free(ascii);
+            free(out);
+            return 1;
+        }
+        free(ascii);
+        free(out);
+        _mongoc_sasl_prep_cleanup();
+    }
+
+    /* U+FDFA decomposes to 18 code points, more than fit on the stack */
+    for (int i = 0; i < 400; i++) {
+        len += sasl_prep_encode(0xFDFA, in + len);
+    }
+    in[len] = '\0';
+    out = _mongoc_sasl_prep_native("password", in, (int) len, &error);
+    if (!out || strlen(out) != 400 * 33) {
+        fprintf(stderr, "FAIL\n");
+        fprintf(stderr, "    expected a long string to prepare to %d bytes, got %d\n", 400 * 33,
+                out ? (int) strlen(out) : -1);
+        free(out);
+        return 1;
+    }
+    free(out);
+
+#ifdef MONGOC_ENABLE_ICU
+    {
+        /* sequences of marks, jamo and right-to-left letters that compose,
+         * reorder and mix */
+        const uint32_t ranges[][2] = {{0x41, 0x7A}, {0x300, 0x36F}, {0x591, 0x5F4}, {0x621, 0x6ED},
+                                      {0x1100, 0x11F9}, {0x1E00, 0x1FFE}, {0x3099, 0x309A}, {0xAC00, 0xD7A3}};
+        const uint32_t marks[] = {0x301, 0x323, 0x334};
+        uint32_t cps[8];
+        uint32_t seed = 1;
+        int num_cps;
+
+        /* every code point, alone and before marks in the wrong order */
+        for (uint32_t cp = 1; cp < 0x110000; cp++) {
+            if (cp >= 0xD800 && cp <= 0xDFFF) {
+                continue;
+            }
+            cps[0] = cp;
+            memcpy(cps + 1, marks, sizeof marks);
+            if (!sasl_prep_agrees(cps, 1) || !sasl_prep_agrees(cps, 4)) {
+                return 1;
+            }
+        }
+
+        for (int i = 0; i < 200000; i++) {
+            num_cps = 1 + i % 8;
+            for (int j = 0; j < num_cps; j++) {
+                seed = seed * 1103515245 + 12345;
+                const uint32_t *range = ranges[(seed >> 16) % (sizeof ranges / sizeof ranges[0])];
+                seed = seed * 1103515245 + 12345;
+                cps[j] = range[0] + (seed >> 8) % (range[1] - range[0] + 1);
+            }
+            if (!sasl_prep_agrees(cps, num_cps)) {
+                return 1;
+            }
+        }
+    }
+#endif
+
+    fprintf(stderr, "PASS\n");
+    return 0;
+}
@@ -1,3 +1,81 @@
 
 int
 test_mongosql_auth_conversation_scram_parameters();
+
+int
+test_mongoc_crypto_hash();
+
+int
+test_mongoc_crypto_hmac_keyed();
+
+int
+test_mongoc_crypto_cleanup();
+
+int
+test_mongoc_crypto_pbkdf2();
+
+int
+test_mongoc_pbkdf2_kernel();
+
+int
+test_mongoc_pbkdf2_batch();
+
+int
+test_mongoc_pbkdf2_batch_callers();
+
+int
+test_mongosql_auth_pool_handshake();
+
+int
+test_mongosql_auth_pool_restart();
+
+int
+test_mongosql_auth_protocol_versions();
+
+int
+test_mongosql_auth_session_tickets();
+
+int
+test_mongosql_auth_nonblocking();
+
+int
+test_mongosql_auth_background_derivation();
+
+int
+test_mongosql_auth_abandoned_handshake();
+
+int
+test_mongosql_auth_shared_derivation();
+
+int
+test_mongosql_auth_rejected_proof();
+
+int
+test_mongosql_auth_concurrent_derivation();
+
+int
+test_mongosql_auth_kdf_limits();
+
+int
+test_mongoc_arena();
+
+int
+test_mongoc_scram_parse_message();
+
+int
+test_mongosql_auth_frame();
+
+int
+test_mongoc_scram_cache();
+
+int
+test_mongoc_scram_cache_coalescing();
+
+int
+test_mongoc_kdf_scheduler();
+
+int
+test_mongoc_scram_cache_file();
+
+int
+test_mongoc_sasl_prep();